@@ -124,7 +124,8 @@ typedef struct cldnn_memory_impl* cldnn_memory;
 /// @brief Defines available engine types
 typedef enum /*:int32_t*/
 {
-    cldnn_engine_ocl ///< OpenCL engine
+    cldnn_engine_ocl, ///< OpenCL engine
+    cldnn_engine_cpu  ///< Host engine executing primitives on CPU threads
 } cldnn_engine_type;
 
 /// @brief Priority modes.
@@ -161,6 +162,8 @@ typedef struct
     uint32_t enable_memory_pool;                        ///< Enables memory usage optimization. memory objects will be reused when possible. 
     void* context;
     const char* tuning_cache_path;                      ///< Enables defining other than default path to tuning cache json 
+    uint32_t host_threads_count;                        ///< Number of threads executing host-side primitives. 0 means one per hardware thread.
+    uint32_t bind_host_threads;                         ///< Binds threads executing host-side primitives to logical processors.
 }  cldnn_engine_configuration;
 
 /// @brief Information about the engine returned by cldnn_get_engine_info().
@@ -203,6 +206,34 @@ typedef struct
     uint64_t nanoseconds;
 } cldnn_profiling_interval;
 
+/// @brief Step of the program build with its time.
+typedef struct
+{
+    const char* category;               ///< Kind of the step: pass, kernel_selection, implementation, jit_generation, kernels_source, kernels_program, kernels_build or memory_planning.
+    const char* name;                   ///< Name of the step (e.g. pass name or primitive id).
+    uint64_t start_nanoseconds;         ///< Start of the step since the beginning of the build.
+    uint64_t nanoseconds;               ///< Duration of the step.
+    uint64_t items_in;                  ///< Number of nodes before a pass or number of kernels handled by kernels_* steps.
+    uint64_t items_out;                 ///< Number of nodes after a pass.
+    const char* details;                ///< What the step did, when reported (e.g. nodes merged by a pass per primitive type).
+} cldnn_build_profiling_entry;
+
+/// @brief Execution statistics of a network primitive aggregated over network executions.
+typedef struct
+{
+    const char* primitive_id;           ///< Id of the executed primitive.
+    const char* kernel_name;            ///< Name of the kernel selected for the primitive.
+    const char* original_ids;           ///< Comma separated ids of user primitives computed by this primitive (e.g. fused activations).
+    uint64_t count;                     ///< Number of executions.
+    uint64_t min_nanoseconds;           ///< Minimal device execution time.
+    uint64_t median_nanoseconds;        ///< Median device execution time.
+    uint64_t p99_nanoseconds;           ///< 99th percentile of device execution time.
+    uint64_t total_nanoseconds;         ///< Total device execution time.
+    uint64_t queued_to_start_median_nanoseconds;    ///< Median time between enqueue on the device and the start of execution.
+    uint64_t enqueue_median_nanoseconds;            ///< Median host time of enqueueing the primitive.
+    uint64_t enqueue_total_nanoseconds;             ///< Total host time of enqueueing the primitive.
+} cldnn_primitive_profiling_stats;
+
 /// @brief Network build option types.
 typedef enum /*:int32_t*/
 {
@@ -213,7 +244,12 @@ typedef enum /*:int32_t*/
     cldnn_build_option_tuning_config,           ///< Tuning config.
     cldnn_build_option_graph_dumps_dir,         ///< Specifies a directory to which stages of network compilation should be dumped.
     cldnn_build_option_learning_config,         ///< User defined learning parameters.
-    cldnn_build_option_detection_output_gpu     ///< Run detection output layer always on GPU, regardless performance
+    cldnn_build_option_detection_output_gpu,    ///< Run detection output layer always on GPU, regardless performance
+    cldnn_build_option_dynamic_batch,           ///< Allow executing the network with batch smaller than the one it was built for.
+    cldnn_build_option_shape_agnostic_kernels,  ///< Prefer kernels which get tensor shapes as arguments, so they are shared by primitives of different shapes.
+    cldnn_build_option_cpu_fallback,            ///< Allow executing primitives by host implementations, when device has none or when it is estimated to be faster.
+    cldnn_build_option_host_placement_cost_model, ///< Performance model used to place primitives on the host with cpu_fallback.
+    cldnn_build_option_build_profiling          ///< Record times of the program build steps.
 } cldnn_build_option_type;
 
 /// @brief Tuning modes.
@@ -238,6 +274,17 @@ struct cldnn_learning_params
 	const float weights_decay;
 };
 
+/// @brief Performance model of the device and the host used to place primitives with cpu_fallback, times are in microseconds.
+struct cldnn_host_placement_cost_model
+{
+    const double kernel_launch_time;    ///< Overhead of a kernel enqueued on the device.
+    const double host_call_time;        ///< Overhead of a host implementation call.
+    const double transfer_latency;      ///< Overhead of a copy between device and host memory.
+    const double transfer_bytes_per_us; ///< Bandwidth of copies between device and host memory.
+    const double device_ops_per_us;     ///< Throughput of the device, 0 means estimated from the engine info.
+    const double host_ops_per_us;       ///< Throughput of the host, 0 means estimated from the host threads count.
+};
+
 /// @brief Represents network build option.
 typedef struct
 {
@@ -579,7 +626,7 @@ CLDNN_API uint32_t cldnn_get_engine_count(/*cldnn_engine_type*/ int32_t type, cl
 CLDNN_API void cldnn_release_pending_memory(cldnn_engine engine, cldnn_status* status);
 
 /// @brief Create new engine of the specified @p type, @p engine_num, and @p configuration options.
-/// @param[in] type Engine type @ref cldnn_engine_type. Only OCL engine is supported.
+/// @param[in] type Engine type @ref cldnn_engine_type.
 /// @param[in] engine_num Engine index. Should be 0.
 /// @param[in] configuration Pointer to engine configuration options.
 CLDNN_API cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t engine_num, const cldnn_engine_configuration* configuration, cldnn_status* status);
@@ -651,6 +698,13 @@ CLDNN_API void cldnn_retain_program(cldnn_program program, cldnn_status* status)
 
 /// @brief Decrement reference counter for the program object. Deletes object when counter becomes zero.
 CLDNN_API void cldnn_release_program(cldnn_program program, cldnn_status* status);
+
+/// @brief Returns times of the program build steps, recorded when the program is built with build_profiling option (or graph dumps).
+/// Strings stay valid as long as the program exists.
+/// @param[in] entries Pointer to the array of @ref cldnn_build_profiling_entry where information to be stored.
+/// @param[in] size Number of elements in the array of @ref cldnn_build_profiling_entry.
+/// @param[out] size_ret Number of elements required to store profiling information.
+CLDNN_API void cldnn_get_program_build_profiling_info(cldnn_program program, cldnn_build_profiling_entry* entries, size_t size, size_t* size_ret, cldnn_status* status);
 /// @}
 
 /// @addtogroup c_network
@@ -749,6 +803,20 @@ CLDNN_API                 void cldnn_execute_network(cldnn_network network, cldn
 /// before getting an access to cldnn_network_output::memory.
 CLDNN_API cldnn_network_output cldnn_get_network_output(cldnn_network network, const char* name, cldnn_status* status);
 
+/// @brief Returns handle of the network output with @p name.
+/// @details Handle stays valid for the lifetime of the network. Resolve it once and pass it to cldnn_get_network_outputs()
+/// after every execution, so the outputs are not looked up by name.
+/// @param name Output name.
+/// @returns Position of the output in the list returned by cldnn_get_network_output_names().
+CLDNN_API size_t cldnn_get_network_output_handle(cldnn_network network, cldnn_primitive_id name, cldnn_status* status);
+
+/// @brief Returns executed network output information for outputs identified by handles.
+/// @details Fills user provided array, @p outputs[i] gets the output with @p handles[i] the same way as cldnn_get_network_output() does.
+/// @param handles Output handles returned by cldnn_get_network_output_handle().
+/// @param outputs Pointer to user-allocated array of @p size elements.
+/// @param size Number of elements in @p handles and @p outputs arrays.
+CLDNN_API void cldnn_get_network_outputs(cldnn_network network, const size_t* handles, cldnn_network_output* outputs, size_t size, cldnn_status* status);
+
 /// @brief Returns @ref memory corresponding to output with @p name.
 /// @details User can call this function even before calling cldnn_execute_network(), but then content of memory is uninitialized.
 /// @param name Output name to get the result.
@@ -760,6 +828,22 @@ CLDNN_API cldnn_memory cldnn_get_network_output_memory(cldnn_network network, co
 /// @param name Output name to get the result.
 /// @returns @ref cldnn_event structure with the output information.
 CLDNN_API cldnn_event cldnn_get_network_output_event(cldnn_network network, const char* name, cldnn_status* status);
+
+/// @brief Returns execution statistics of network primitives aggregated since network creation or the last reset.
+/// @details Requires an engine created with profiling enabled. Such network waits for completion of each execution to read device times.
+/// Strings stay valid until the next call of this function or reset of the statistics.
+/// @param[in] stats Pointer to the array of @ref cldnn_primitive_profiling_stats where information to be stored.
+/// @param[in] size Number of elements in the array of @ref cldnn_primitive_profiling_stats.
+/// @param[out] size_ret Number of elements required to store the statistics.
+CLDNN_API void cldnn_get_network_profiling_stats(cldnn_network network, cldnn_primitive_profiling_stats* stats, size_t size, size_t* size_ret, cldnn_status* status);
+
+/// @brief Drops execution statistics collected so far.
+CLDNN_API void cldnn_reset_network_profiling_stats(cldnn_network network, cldnn_status* status);
+
+/// @brief Writes collected execution statistics to files.
+/// @param[in] trace_path Path of Chrome trace event file with enqueue and execution of every primitive, or null.
+/// @param[in] csv_path Path of CSV file with aggregated statistics, or null.
+CLDNN_API void cldnn_dump_network_profiling_stats(cldnn_network network, const char* trace_path, const char* csv_path, cldnn_status* status);
 /// @}
 
 /// @addtogroup c_memory
@@ -787,12 +871,23 @@ CLDNN_API cldnn_layout cldnn_get_memory_layout(cldnn_memory memory, cldnn_status
 /// @brief Returns reference to the engine associated with memory object.
 /// @returns The engine associated with memory object. Or NULL if memory was attached to user-allocated buffer.
 CLDNN_API cldnn_engine cldnn_get_memory_engine(cldnn_memory memory, cldnn_status* status);
+/// @brief Converts data from @p src described by @p src_layout into @p dst described by @p dst_layout on the host.
+/// @details Both layouts have to describe the same logical size, format, data type and padding may differ.
+/// Padding and block alignment of @p dst is filled with zeros. Supports plain formats, bfyx_f16, b_fs_yx_fsv4,
+/// fs_b_yx_fsv32, byxf_af32 and os_iyx_osv16/32/64 weights.
+CLDNN_API void cldnn_convert_layout(cldnn_layout src_layout, const void* src, cldnn_layout dst_layout, void* dst, cldnn_status* status);
 /// @brief converts float(32 bit) to half_t(fp16 bit)
 /// @returns 16bit half_t
 CLDNN_API uint16_t cldnn_float_to_half(float,cldnn_status*);
 /// @brief converts  half_t(f16 bit) to float(32 bit) 
 /// @returns 32bit float
 CLDNN_API float cldnn_half_to_float(uint16_t, cldnn_status*);
+/// @brief converts @p count floats(32 bit) from @p src to half_t(fp16 bit) values stored in @p dst
+/// @note Uses the widest conversion instructions supported by the host CPU (SSE4.1, F16C or AVX-512).
+CLDNN_API void cldnn_float_to_half_array(const float* src, uint16_t* dst, size_t count, cldnn_status* status);
+/// @brief converts @p count half_t(fp16 bit) values from @p src to floats(32 bit) stored in @p dst
+/// @note Uses the widest conversion instructions supported by the host CPU (SSE4.1, F16C or AVX-512).
+CLDNN_API void cldnn_half_to_float_array(const uint16_t* src, float* dst, size_t count, cldnn_status* status);
 
 /// @}
 
@@ -210,23 +210,30 @@ private:
 
 #define CLDNN_THROW(msg, status) throw cldnn::error(msg, status);
 
+// Error message is copied only when the call fails, successful calls do not allocate.
 template<class T>
-T check_status(std::string err_msg, std::function<T(status_t*)> func)
+T check_status(const char* err_msg, std::function<T(status_t*)> func)
 {
     status_t status = CLDNN_SUCCESS;
     auto result = func(&status);
     if (status != CLDNN_SUCCESS)
-        CLDNN_THROW(err_msg.append(": ").append(cldnn_get_last_error_message()), status);
+        CLDNN_THROW(std::string(err_msg).append(": ").append(cldnn_get_last_error_message()), status);
     return result;
 }
 
 template<>
-inline void check_status<void>(std::string err_msg, std::function<void(status_t*)> func)
+inline void check_status<void>(const char* err_msg, std::function<void(status_t*)> func)
 {
     status_t status = CLDNN_SUCCESS;
     func(&status);
     if (status != CLDNN_SUCCESS)
-        CLDNN_THROW(err_msg.append(": ").append(cldnn_get_last_error_message()), status);
+        CLDNN_THROW(std::string(err_msg).append(": ").append(cldnn_get_last_error_message()), status);
+}
+
+template<class T>
+T check_status(const std::string& err_msg, std::function<T(status_t*)> func)
+{
+    return check_status<T>(err_msg.c_str(), func);
 }
 
 /// @}
@@ -248,6 +255,36 @@ inline version_t get_version()
 
 /// @}
 
+/// @defgroup cpp_half Half Precision Conversion
+/// @{
+
+static_assert(sizeof(half_t) == sizeof(uint16_t), "half_t has to be 16 bit wide");
+
+/// @brief Converts @p count floats from @p src to half precision values stored in @p dst.
+/// @details Intended for staging user data into @ref data_types::f16 memory objects.
+/// Conversion uses the widest SIMD instructions supported by the host CPU.
+inline void float_to_half(const float* src, half_t* dst, size_t count)
+{
+    check_status<void>("float_to_half: conversion to half failed",
+                       [&](status_t* status)
+                       {
+                           ::cldnn_float_to_half_array(src, reinterpret_cast<uint16_t*>(dst), count, status);
+                       });
+}
+
+/// @brief Converts @p count half precision values from @p src to floats stored in @p dst.
+/// @details Conversion uses the widest SIMD instructions supported by the host CPU.
+inline void half_to_float(const half_t* src, float* dst, size_t count)
+{
+    check_status<void>("half_to_float: conversion from half failed",
+                       [&](status_t* status)
+                       {
+                           ::cldnn_half_to_float_array(reinterpret_cast<const uint16_t*>(src), dst, count, status);
+                       });
+}
+
+/// @}
+
 /// @cond CPP_HELPERS
 
 /// @defgroup cpp_helpers Helpers
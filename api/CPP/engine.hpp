@@ -30,7 +30,8 @@ namespace cldnn
 /// @brief Defines available engine types
 enum class engine_types : int32_t
 {
-    ocl = cldnn_engine_ocl
+    ocl = cldnn_engine_ocl,
+    cpu = cldnn_engine_cpu
 };
 
 /// @brief Defines available priority mode types
@@ -68,6 +69,8 @@ struct engine_configuration
     bool enable_memory_pool;                    ///< Enables memory usage optimization. memory objects will be reused when possible (switched off for older drivers then NEO).
     void* context;              ///< Pointer to user context
     const std::string tuning_cache_path;        ///< Path to tuning kernel cache 
+    const uint32_t host_threads_count;          ///< Number of threads executing host-side primitives, shared by all networks of the engine. 0 means one per hardware thread.
+    const bool bind_host_threads;               ///< Binds threads executing host-side primitives to logical processors.
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -75,6 +78,8 @@ struct engine_configuration
     /// @param dump_custom_program Dump the custom OpenCL programs to files
     /// @param options OpenCL compiler options string.
     /// @param single_kernel If provided, runs specific layer.
+    /// @param host_threads_count Number of threads executing host-side primitives, 0 means one per hardware thread.
+    /// @param bind_host_threads Bind threads executing host-side primitives to logical processors.
     engine_configuration(
             bool profiling = false,
             bool decorate_kernel_names = false,
@@ -88,7 +93,9 @@ struct engine_configuration
             throttle_mode_types throttle_mode = throttle_mode_types::disabled,
             bool memory_pool = true,
             void* context = nullptr,
-            const std::string& tuning_cache_path = "cache.json")
+            const std::string& tuning_cache_path = "cache.json",
+            uint32_t host_threads_count = 0,
+            bool bind_host_threads = false)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -102,6 +109,8 @@ struct engine_configuration
         , enable_memory_pool(memory_pool)
         , context(context)
         , tuning_cache_path(tuning_cache_path)
+        , host_threads_count(host_threads_count)
+        , bind_host_threads(bind_host_threads)
     {}
 
     engine_configuration(const cldnn_engine_configuration& c_conf)
@@ -118,6 +127,8 @@ struct engine_configuration
         , enable_memory_pool(c_conf.enable_memory_pool != 0)
         , context(c_conf.context)
 		, tuning_cache_path(c_conf.tuning_cache_path)
+        , host_threads_count(c_conf.host_threads_count)
+        , bind_host_threads(c_conf.bind_host_threads != 0)
     {}
 
     /// @brief Implicit conversion to C API @ref ::cldnn_engine_configuration
@@ -136,7 +147,9 @@ struct engine_configuration
             static_cast<int16_t>(throttle_mode),
             enable_memory_pool,
             context,
-            tuning_cache_path.c_str()
+            tuning_cache_path.c_str(),
+            host_threads_count,
+            bind_host_threads
         };
     }
 };
@@ -154,7 +167,7 @@ struct engine
     {}
 
     /// @brief Construct engine of the specified @p type, @p engine_num, and @p configuration options.
-    /// @param[in] type Engine type @ref cldnn_engine_type. Only OCL engine is supported.
+    /// @param[in] type Engine type @ref cldnn_engine_type.
     /// @param[in] engine_num Engine index. Should be 0.
     /// @param[in] configuration Pointer to engine configuration options.
     engine(engine_types type, uint32_t engine_num, const engine_configuration& configuration = engine_configuration())
@@ -299,6 +299,25 @@ template <typename T>
 pointer<T> memory::pointer() const { return cldnn::pointer<T>(*this); }
 #endif
 
+/// @brief Converts @p src described by @p src_layout into @p dst described by @p dst_layout on the host.
+/// @details Both layouts have to describe the same logical size, format, data type and padding may differ.
+/// Padding and block alignment of @p dst is filled with zeros.
+inline void convert_layout(const layout& src_layout, const void* src, const layout& dst_layout, void* dst)
+{
+    check_status<void>("layout conversion failed", [&](status_t* status)
+    {
+        cldnn_convert_layout(src_layout, src, dst_layout, dst, status);
+    });
+}
+
+/// @brief Converts data of @p src into the layout of @p dst on the host, without executing any primitive.
+inline void convert_layout(const memory& src, const memory& dst)
+{
+    auto src_ptr = src.pointer<char>();
+    auto dst_ptr = dst.pointer<char>();
+    convert_layout(src.get_layout(), src_ptr.data(), dst.get_layout(), dst_ptr.data());
+}
+
 /// @}
 
 /// @}
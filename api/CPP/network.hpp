@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <algorithm>
+#include <chrono>
 #include <map>
 
 namespace cldnn
@@ -55,6 +56,26 @@ private:
     friend struct network;
 };
 
+/// @brief Handle of network output returned by @ref network::get_output_handle().
+using network_output_handle = size_t;
+
+/// @brief Execution statistics of a network primitive aggregated over network executions.
+/// @sa @ref ::cldnn_primitive_profiling_stats
+struct primitive_profiling_stats
+{
+    primitive_id id;                                    ///< @brief Id of the executed primitive.
+    std::string kernel_name;                            ///< @brief Name of the kernel selected for the primitive.
+    std::vector<primitive_id> original_ids;             ///< @brief Ids of user primitives computed by this primitive (e.g. fused activations).
+    uint64_t count;                                     ///< @brief Number of executions.
+    std::chrono::nanoseconds min;                       ///< @brief Minimal device execution time.
+    std::chrono::nanoseconds median;                    ///< @brief Median device execution time.
+    std::chrono::nanoseconds p99;                       ///< @brief 99th percentile of device execution time.
+    std::chrono::nanoseconds total;                     ///< @brief Total device execution time.
+    std::chrono::nanoseconds queued_to_start_median;    ///< @brief Median time between enqueue on the device and the start of execution.
+    std::chrono::nanoseconds enqueue_median;            ///< @brief Median host time of enqueueing the primitive.
+    std::chrono::nanoseconds enqueue_total;             ///< @brief Total host time of enqueueing the primitive.
+};
+
 /// @brief Executable network allocated from @ref program.
 struct network
 {
@@ -192,6 +213,16 @@ struct network
         return network_output( output.event, output.memory );
     }
 
+    /// @brief Returns handle of the @p output, which stays valid for the lifetime of the network.
+    /// @sa execute(const std::vector<network_output_handle>&, std::vector<network_output>&, const std::vector<event>&)
+    network_output_handle get_output_handle(const primitive_id& output_id) const
+    {
+        return check_status<network_output_handle>("get network output handle failed", [&](status_t* status)
+        {
+            return cldnn_get_network_output_handle(_impl, output_id.c_str(), status);
+        });
+    }
+
     /// @brief Returns @ref memory object for particular @p output. Can be called before network execution
     memory get_output_memory(const primitive_id& output_id) const
     {
@@ -251,6 +282,70 @@ struct network
         return result;
     }
 
+    /// @brief Returns execution statistics of primitives aggregated since network creation or the last reset.
+    /// @note Requires an engine created with profiling enabled.
+    std::vector<primitive_profiling_stats> get_profiling_stats() const
+    {
+        size_t size_ret = 0;
+        check_status<void>("get network profiling stats failed", [&](status_t* status)
+        {
+            cldnn_get_network_profiling_stats(_impl, nullptr, 0, &size_ret, status);
+        });
+
+        std::vector<cldnn_primitive_profiling_stats> stats_ref(size_ret);
+        if (size_ret != 0)
+        {
+            check_status<void>("get network profiling stats failed", [&](status_t* status)
+            {
+                cldnn_get_network_profiling_stats(_impl, stats_ref.data(), stats_ref.size(), &size_ret, status);
+            });
+        }
+
+        std::vector<primitive_profiling_stats> result;
+        result.reserve(stats_ref.size());
+        for (auto& ref : stats_ref)
+        {
+            std::vector<primitive_id> original_ids;
+            std::string ids = ref.original_ids;
+            for (size_t start = 0, end = 0; start < ids.size(); start = end + 1)
+            {
+                end = std::min(ids.find(',', start), ids.size());
+                original_ids.push_back(ids.substr(start, end - start));
+            }
+
+            result.push_back({
+                ref.primitive_id,
+                ref.kernel_name,
+                original_ids,
+                ref.count,
+                std::chrono::nanoseconds(ref.min_nanoseconds),
+                std::chrono::nanoseconds(ref.median_nanoseconds),
+                std::chrono::nanoseconds(ref.p99_nanoseconds),
+                std::chrono::nanoseconds(ref.total_nanoseconds),
+                std::chrono::nanoseconds(ref.queued_to_start_median_nanoseconds),
+                std::chrono::nanoseconds(ref.enqueue_median_nanoseconds),
+                std::chrono::nanoseconds(ref.enqueue_total_nanoseconds)
+            });
+        }
+        return result;
+    }
+
+    /// @brief Drops execution statistics collected so far.
+    void reset_profiling_stats() const
+    {
+        check_status<void>("reset network profiling stats failed", [&](status_t* status) { cldnn_reset_network_profiling_stats(_impl, status); });
+    }
+
+    /// @brief Writes collected execution statistics as Chrome trace (@p trace_path) and CSV (@p csv_path). Empty path skips the file.
+    void dump_profiling_stats(const std::string& trace_path, const std::string& csv_path) const
+    {
+        check_status<void>("dump network profiling stats failed", [&](status_t* status)
+        {
+            cldnn_dump_network_profiling_stats(_impl, trace_path.empty() ? nullptr : trace_path.c_str(),
+                                               csv_path.empty() ? nullptr : csv_path.c_str(), status);
+        });
+    }
+
     /// @brief Executes network and returns the list of @ref network_output.
     /// @param dependencies List of @ref event objects to be waited before network execution.
     /// @note User should call set_input_data() for every @ref input_layout defined in source @ref topology
@@ -277,6 +372,53 @@ struct network
         return result;
     }
 
+    /// @brief Executes network and stores outputs with given handles in @p outputs.
+    /// @param handles Handles of the outputs returned by get_output_handle().
+    /// @param outputs Receives @ref network_output of @p handles[i] at position i. Its elements are reused when it already
+    /// has the size of @p handles, so repeated executions without @p dependencies do not allocate host memory for the
+    /// results. Execution itself still creates an event per executed primitive inside the engine.
+    /// @param dependencies List of @ref event objects to be waited before network execution.
+    void execute(const std::vector<network_output_handle>& handles, std::vector<network_output>& outputs, const std::vector<event>& dependencies = {}) const
+    {
+        status_t status = CLDNN_SUCCESS;
+        auto& raw_events = scratch<cldnn_event>();
+        raw_events.resize(dependencies.size());
+        for (size_t i = 0; i < dependencies.size(); i++)
+        {
+            raw_events[i] = dependencies[i].get();
+        }
+        cldnn_execute_network(_impl, raw_events.data(), raw_events.size(), &status);
+        if (status != CLDNN_SUCCESS)
+            CLDNN_THROW(std::string("network execute failed: ").append(cldnn_get_last_error_message()), status);
+
+        auto& raw_outputs = scratch<cldnn_network_output>();
+        raw_outputs.assign(handles.size(), { nullptr, nullptr });
+        cldnn_get_network_outputs(_impl, handles.data(), raw_outputs.data(), handles.size(), &status);
+        if (status != CLDNN_SUCCESS)
+            CLDNN_THROW(std::string("get network outputs failed: ").append(cldnn_get_last_error_message()), status);
+
+        if (outputs.size() != handles.size())
+        {
+            outputs.clear();
+            outputs.reserve(raw_outputs.size());
+            for (auto& raw : raw_outputs)
+                outputs.push_back(network_output(raw.event, raw.memory));
+            return;
+        }
+
+        for (size_t i = 0; i < raw_outputs.size(); i++)
+        {
+            auto& output = outputs[i];
+            output._event = event(raw_outputs[i].event);
+            // output buffers usually stay the same between executions, in which case only the reference taken for us
+            // is dropped and the layout of the wrapper is not queried again
+            if (output._result.get() == raw_outputs[i].memory)
+                cldnn_release_memory(raw_outputs[i].memory, &status);
+            else
+                output._result = memory(raw_outputs[i].memory);
+        }
+    }
+
     /// @brief Returns wrapped C API @ref cldnn_network handler.
     cldnn_network get() const { return _impl; }
 
@@ -285,6 +427,14 @@ private:
 
     typedef void(*get_prim_ids_func_t)(cldnn_network network, char* names, size_t size, size_t* size_ret, cldnn_status* status);
 
+    // Per thread storage for the C API arrays of execute(handles, outputs), which keeps its capacity between calls.
+    template<class T>
+    static std::vector<T>& scratch()
+    {
+        static thread_local std::vector<T> storage;
+        return storage;
+    }
+
     void retain()
     {
         check_status<void>("retain topology failed", [=](status_t* status) { cldnn_retain_network(_impl, status); });
@@ -21,7 +21,10 @@
 #include "engine.hpp"
 #include <iostream>
 
+#include <chrono>
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace cldnn
 {
@@ -63,7 +66,33 @@ enum class build_option_type
     tuning_config = cldnn_build_option_tuning_config,
 
     /// @brief Specifies a directory to which stages of network compilation should be dumped. (default: empty, i.e. no dumping)
-    graph_dumps_dir = cldnn_build_option_graph_dumps_dir
+    graph_dumps_dir = cldnn_build_option_graph_dumps_dir,
+
+    /// @brief Allow executing the network with batch smaller than the one it was built for (default: false).
+    /// @details The batch of the network inputs is the maximum batch. Inputs set with smaller batch are copied
+    /// into the network buffers and network outputs are returned as views of the valid batches only. Outputs with
+    /// interleaved or padded batches (e.g. yxfb output of fully connected) are reordered to bfyx or bfzyx for that.
+    /// Only primitives computed from the network inputs carry the runtime batch. Kernels which support it (reference
+    /// convolution, fully connected and activation) get it as an argument and are enqueued only for the valid
+    /// batches, the other ones still process the whole buffers.
+    dynamic_batch = cldnn_build_option_dynamic_batch,
+
+    /// @brief Prefer kernels which get shapes of tensors as arguments (default: false).
+    /// @details Primitives which differ only in shapes share compiled kernels, so fewer kernels are compiled
+    /// at the cost of kernels which are not optimized for the shapes.
+    shape_agnostic_kernels = cldnn_build_option_shape_agnostic_kernels,
+
+    /// @brief Allow executing primitives by host implementations in a GPU program (default: false).
+    /// @details Primitives without GPU implementation, and those for which host execution is estimated to be faster
+    /// (including the cost of transfers between device and host memory), are executed by implementations of the CPU engine.
+    cpu_fallback = cldnn_build_option_cpu_fallback,
+
+    /// @brief Performance model used to place primitives on the host with @ref cpu_fallback (default: estimated from the engine).
+    host_placement_cost_model = cldnn_build_option_host_placement_cost_model,
+
+    /// @brief Record times of the program build steps, see @ref program::get_build_profiling_info (default: false).
+    /// @details Times are recorded also when @ref graph_dumps_dir is set, to dump them as a trace.
+    build_profiling = cldnn_build_option_build_profiling
 
 };
 
@@ -104,6 +133,27 @@ struct learning_params
 	{}
 };
 
+/// @brief Performance model of the device and the host used to place primitives with @ref build_option_type::cpu_fallback.
+/// @details Times are in microseconds. Throughputs set to 0 are estimated from the engine.
+struct host_placement_cost_model
+{
+    double kernel_launch_time;
+    double host_call_time;
+    double transfer_latency;
+    double transfer_bytes_per_us;
+    double device_ops_per_us;
+    double host_ops_per_us;
+
+    host_placement_cost_model() :
+        kernel_launch_time(10.0),
+        host_call_time(2.0),
+        transfer_latency(15.0),
+        transfer_bytes_per_us(4000.0),
+        device_ops_per_us(0.0),
+        host_ops_per_us(0.0)
+    {}
+};
+
 /// @brief Represents user-provided program build option.
 struct build_option
 {
@@ -120,6 +170,21 @@ struct build_option
     /// @details This option enforce all program primitives to be accessible as outputs.
     static std::shared_ptr<const build_option> debug(bool enable = false);
 
+    /// @brief Allow executing the network with batch smaller than the one it was built for (default: false).
+    static std::shared_ptr<const build_option> dynamic_batch(bool enable = false);
+
+    /// @brief Prefer kernels which get shapes of tensors as arguments (default: false).
+    static std::shared_ptr<const build_option> shape_agnostic_kernels(bool enable = false);
+
+    /// @brief Allow executing primitives by host implementations in a GPU program (default: false).
+    static std::shared_ptr<const build_option> cpu_fallback(bool enable = false);
+
+    /// @brief Record times of the program build steps (default: false).
+    static std::shared_ptr<const build_option> build_profiling(bool enable = false);
+
+    /// @brief Performance model used to place primitives on the host with cpu_fallback (default: estimated from the engine).
+    static std::shared_ptr<const build_option> host_placement_cost_model(const cldnn::host_placement_cost_model& model = cldnn::host_placement_cost_model());
+
     /// @brief User selected list of program outputs.
     static std::shared_ptr<const build_option> outputs(const std::vector<primitive_id>& outs);
 
@@ -316,6 +381,54 @@ private:
     }
 };
 
+/// @brief @ref build_option specialization for host placement cost model.
+struct build_option_host_placement_cost_model : build_option
+{
+    /// @brief Performance model of the device and the host.
+    const cldnn::host_placement_cost_model model;
+
+    /// @brief Constructs host placement cost model build option.
+    /// @param model Performance model of the device and the host.
+    explicit build_option_host_placement_cost_model(const cldnn::host_placement_cost_model& model) :
+        model(model),
+        model_ref({ model.kernel_launch_time, model.host_call_time, model.transfer_latency,
+                    model.transfer_bytes_per_us, model.device_ops_per_us, model.host_ops_per_us })
+    {}
+
+    /// @brief Constructs host placement cost model build option from C API @ref ::cldnn_build_option.
+    explicit build_option_host_placement_cost_model(const cldnn_build_option& value)
+        : build_option_host_placement_cost_model(make_model_from_ref(value))
+    {
+        assert(value.type == static_cast<int32_t>(cldnn_build_option_host_placement_cost_model));
+    }
+
+private:
+    /// @brief Returns build_option_type::host_placement_cost_model.
+    build_option_type get_type() const override { return build_option_type::host_placement_cost_model; }
+    /// @brief Returns pointer to @ref cldnn_host_placement_cost_model.
+    const void* get_data() const override { return &model_ref; }
+
+    build_option_host_placement_cost_model(const build_option_host_placement_cost_model& other) = delete;
+    build_option_host_placement_cost_model& operator=(const build_option_host_placement_cost_model& other) = delete;
+
+    const cldnn_host_placement_cost_model model_ref;
+
+    static cldnn::host_placement_cost_model make_model_from_ref(const cldnn_build_option& value)
+    {
+        if (value.type != cldnn_build_option_host_placement_cost_model) throw std::invalid_argument("option type does not match: should be 'host_placement_cost_model'");
+        if (value.data == nullptr) throw std::invalid_argument("Host placement cost model data is empty");
+        auto refs = reinterpret_cast<const cldnn_host_placement_cost_model*>(value.data);
+        cldnn::host_placement_cost_model result;
+        result.kernel_launch_time = refs->kernel_launch_time;
+        result.host_call_time = refs->host_call_time;
+        result.transfer_latency = refs->transfer_latency;
+        result.transfer_bytes_per_us = refs->transfer_bytes_per_us;
+        result.device_ops_per_us = refs->device_ops_per_us;
+        result.host_ops_per_us = refs->host_ops_per_us;
+        return result;
+    }
+};
+
 /// @brief @ref build_option specialization for selecting a directory.
 template<build_option_type OptType>
 struct build_option_directory : build_option
@@ -398,6 +511,56 @@ namespace detail
             return std::make_shared<object_type>(option);
         }
     };
+    template<> struct build_option_traits<build_option_type::dynamic_batch>
+    {
+        typedef build_option_bool<build_option_type::dynamic_batch> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::dynamic_batch(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_dynamic_batch);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::shape_agnostic_kernels>
+    {
+        typedef build_option_bool<build_option_type::shape_agnostic_kernels> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::shape_agnostic_kernels(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_shape_agnostic_kernels);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::cpu_fallback>
+    {
+        typedef build_option_bool<build_option_type::cpu_fallback> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::cpu_fallback(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_cpu_fallback);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::build_profiling>
+    {
+        typedef build_option_bool<build_option_type::build_profiling> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::build_profiling(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_build_profiling);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::host_placement_cost_model>
+    {
+        typedef build_option_host_placement_cost_model object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::host_placement_cost_model(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_host_placement_cost_model);
+            return std::make_shared<object_type>(option);
+        }
+    };
     template<> struct build_option_traits<build_option_type::debug>
     {
         typedef build_option_bool<build_option_type::debug> object_type;
@@ -473,6 +636,31 @@ inline std::shared_ptr<const build_option> build_option::debug(bool enable)
     return std::make_shared<build_option_bool<build_option_type::debug>>(enable);
 }
 
+inline std::shared_ptr<const build_option> build_option::dynamic_batch(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::dynamic_batch>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::shape_agnostic_kernels(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::shape_agnostic_kernels>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::cpu_fallback(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::cpu_fallback>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::build_profiling(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::build_profiling>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::host_placement_cost_model(const cldnn::host_placement_cost_model& model)
+{
+    return std::make_shared<build_option_host_placement_cost_model>(model);
+}
+
 inline std::shared_ptr<const build_option> build_option::outputs(const std::vector<primitive_id>& outs)
 {
     return std::make_shared<build_option_outputs>(outs);
@@ -586,6 +774,16 @@ private:
             return detail::build_option_traits<build_option_type::detection_output_gpu>::make_option(option);
         case cldnn_build_option_debug:
             return detail::build_option_traits<build_option_type::debug>::make_option(option);
+        case cldnn_build_option_dynamic_batch:
+            return detail::build_option_traits<build_option_type::dynamic_batch>::make_option(option);
+        case cldnn_build_option_shape_agnostic_kernels:
+            return detail::build_option_traits<build_option_type::shape_agnostic_kernels>::make_option(option);
+        case cldnn_build_option_cpu_fallback:
+            return detail::build_option_traits<build_option_type::cpu_fallback>::make_option(option);
+        case cldnn_build_option_build_profiling:
+            return detail::build_option_traits<build_option_type::build_profiling>::make_option(option);
+        case cldnn_build_option_host_placement_cost_model:
+            return detail::build_option_traits<build_option_type::host_placement_cost_model>::make_option(option);
         case cldnn_build_option_outputs:
             return detail::build_option_traits<build_option_type::outputs>::make_option(option);
         case cldnn_build_option_tuning_config:
@@ -597,6 +795,19 @@ private:
     }
 };
 
+/// @brief Step of the program build with its time.
+/// @sa @ref ::cldnn_build_profiling_entry
+struct build_profiling_entry
+{
+    std::string category;               ///< @brief Kind of the step: pass, kernel_selection, implementation, jit_generation, kernels_source, kernels_program, kernels_build or memory_planning.
+    std::string name;                   ///< @brief Name of the step (e.g. pass name or primitive id).
+    std::chrono::nanoseconds start;     ///< @brief Start of the step since the beginning of the build.
+    std::chrono::nanoseconds duration;  ///< @brief Duration of the step.
+    uint64_t items_in;                  ///< @brief Number of nodes before a pass or number of kernels handled by kernels_* steps.
+    uint64_t items_out;                 ///< @brief Number of nodes after a pass.
+    std::string details;                ///< @brief What the step did, when reported (e.g. nodes merged by a pass per primitive type).
+};
+
 /// @brief Compiled program build from @ref topology by @ref engine
 struct program
 {
@@ -646,6 +857,43 @@ public:
     /// @brief Returns wrapped C API @ref cldnn_program handler.
     ::cldnn_program get() const { return _impl; }
 
+    /// @brief Returns times of the program build steps in the order they finished.
+    /// @details Times are recorded only when the program is built with @ref build_option::build_profiling (or graph dumps).
+    std::vector<build_profiling_entry> get_build_profiling_info() const
+    {
+        size_t size_ret = 0;
+        status_t err_invalid_arg = CLDNN_SUCCESS;
+        cldnn_get_program_build_profiling_info(_impl, nullptr, 0, &size_ret, &err_invalid_arg);
+
+        if (size_ret == 0)
+        {
+            return{};
+        }
+
+        std::vector<cldnn_build_profiling_entry> entries_ref(size_ret);
+
+        check_status<void>("get program build profiling info failed", [&](status_t* status)
+        {
+            cldnn_get_program_build_profiling_info(_impl, entries_ref.data(), entries_ref.size(), &size_ret, status);
+        });
+
+        std::vector<build_profiling_entry> result;
+        result.reserve(entries_ref.size());
+        for (auto& ref : entries_ref)
+        {
+            result.push_back({
+                ref.category,
+                ref.name,
+                std::chrono::nanoseconds(ref.start_nanoseconds),
+                std::chrono::nanoseconds(ref.nanoseconds),
+                ref.items_in,
+                ref.items_out,
+                ref.details
+            });
+        }
+        return result;
+    }
+
 private:
 
     ::cldnn_program _impl;
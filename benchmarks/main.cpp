@@ -0,0 +1,484 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Model zoo benchmarks: topologies validated with clDNN are built with synthetic weights and for every one of them
+// the benchmark reports:
+//  - program build time split into phases: graph optimization, kernel selection, kernels compilation and other work,
+//    followed by network allocation time,
+//  - peak device memory used by the engine (weights and memory pool of the network),
+//  - latency of single executions and throughput of back-to-back executions (percentiles).
+// Results are printed as a table and can be written to JSON file for regression tracking.
+// Any OpenCL device (e.g. CPU ICD) can be selected with --device, it is passed to clDNN as user context.
+
+#include "models.h"
+
+#include <api/CPP/memory.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/program.hpp>
+
+#define CL_HPP_ENABLE_EXCEPTIONS
+#define CL_HPP_MINIMUM_OPENCL_VERSION 120
+#define CL_HPP_TARGET_OPENCL_VERSION 120
+#include <cl2_wrapper.h>
+
+#include "stringbuffer.h"
+#include "prettywriter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace cldnn;
+using namespace benchmarks;
+
+struct benchmark_options
+{
+    uint32_t iterations = 3;
+    uint32_t executions = 50;
+    uint32_t window = 10;
+    int32_t batch = 1;
+    data_types data_type = data_types::f16;
+    std::string device;
+    std::string json_path;
+    std::vector<std::string> models;
+};
+
+// Samples of single metric in milliseconds (or frames per second for throughput).
+class samples
+{
+public:
+    void add(double value) { _values.push_back(value); }
+    void add(std::chrono::nanoseconds time) { add(std::chrono::duration<double, std::milli>(time).count()); }
+
+    double min() const { return *std::min_element(_values.begin(), _values.end()); }
+    double max() const { return *std::max_element(_values.begin(), _values.end()); }
+    double mean() const { return std::accumulate(_values.begin(), _values.end(), 0.0) / _values.size(); }
+
+    // nearest-rank percentile
+    double percentile(double p) const
+    {
+        auto sorted = _values;
+        std::sort(sorted.begin(), sorted.end());
+        auto rank = static_cast<size_t>(p / 100.0 * sorted.size() + 0.5);
+        return sorted[std::min(sorted.size() - 1, rank > 0 ? rank - 1 : 0)];
+    }
+    double median() const { return percentile(50); }
+
+private:
+    std::vector<double> _values;
+};
+
+struct model_results
+{
+    std::string name;
+    int32_t batch = 0;
+    size_t primitives = 0;
+    samples total, optimize, select, compile, other, allocate;
+    uint64_t peak_memory = 0;
+    samples latency;
+    samples throughput;
+};
+
+void print_usage(const char* exe)
+{
+    std::cout << "Usage: " << exe << " [options] [model...]\n"
+        << "Options:\n"
+        << "  --iterations=N         programs and networks built for every model (default: 3)\n"
+        << "  --executions=N         timed executions of every network (default: 50)\n"
+        << "  --window=N             back-to-back executions of a throughput sample (default: 10)\n"
+        << "  --batch=N              batch size (default: 1)\n"
+        << "  --data-type=f16|f32    data type of inputs and weights (default: f16)\n"
+        << "  --device=P:D           OpenCL device D of platform P (default: clDNN default device)\n"
+        << "  --list-devices         list available OpenCL devices\n"
+        << "  --json=PATH            write results to JSON file\n"
+        << "  --list                 list available models\n";
+}
+
+bool parse_value(const char* arg, const char* name, std::string& value)
+{
+    auto length = std::strlen(name);
+    if (std::strncmp(arg, name, length) != 0 || arg[length] != '=')
+        return false;
+    value = arg + length + 1;
+    return true;
+}
+
+std::string device_type_name(cl_device_type type)
+{
+    if (type & CL_DEVICE_TYPE_GPU)
+        return "GPU";
+    if (type & CL_DEVICE_TYPE_CPU)
+        return "CPU";
+    if (type & CL_DEVICE_TYPE_ACCELERATOR)
+        return "accelerator";
+    return "other";
+}
+
+void list_devices()
+{
+    std::vector<cl::Platform> platforms;
+    cl::Platform::get(&platforms);
+    for (size_t p = 0; p < platforms.size(); p++)
+    {
+        std::vector<cl::Device> devices;
+        platforms[p].getDevices(CL_DEVICE_TYPE_ALL, &devices);
+        for (size_t d = 0; d < devices.size(); d++)
+        {
+            std::cout << p << ":" << d << "  " << devices[d].getInfo<CL_DEVICE_NAME>()
+                << " (" << device_type_name(devices[d].getInfo<CL_DEVICE_TYPE>()) << ", "
+                << platforms[p].getInfo<CL_PLATFORM_NAME>() << ")" << std::endl;
+        }
+    }
+}
+
+// Selects device given as "platform:device" indices.
+cl::Device get_device(const std::string& name)
+{
+    auto separator = name.find(':');
+    if (separator == std::string::npos)
+        throw std::invalid_argument("device has to be given as <platform>:<device>, e.g. --device=0:0");
+
+    std::vector<cl::Platform> platforms;
+    cl::Platform::get(&platforms);
+    auto p = static_cast<size_t>(std::atoi(name.substr(0, separator).c_str()));
+    if (p >= platforms.size())
+        throw std::invalid_argument("invalid OpenCL platform index: " + name);
+
+    std::vector<cl::Device> devices;
+    platforms[p].getDevices(CL_DEVICE_TYPE_ALL, &devices);
+    auto d = static_cast<size_t>(std::atoi(name.substr(separator + 1).c_str()));
+    if (d >= devices.size())
+        throw std::invalid_argument("invalid OpenCL device index: " + name);
+    return devices[d];
+}
+
+std::string get_default_device_name()
+{
+    std::vector<cl::Platform> platforms;
+    cl::Platform::get(&platforms);
+    for (const auto& platform : platforms)
+    {
+        std::vector<cl::Device> devices;
+        platform.getDevices(CL_DEVICE_TYPE_ALL, &devices);
+        for (const auto& device : devices)
+        {
+            if (device.getInfo<CL_DEVICE_TYPE>() & CL_DEVICE_TYPE_GPU)
+                return device.getInfo<CL_DEVICE_NAME>();
+        }
+    }
+    return "<no device>";
+}
+
+bool is_inside(const build_profiling_entry& inner, const build_profiling_entry& outer)
+{
+    return inner.start >= outer.start && inner.start + inner.duration <= outer.start + outer.duration;
+}
+
+// Sums durations of entries of given categories; when nested_in is given, only entries inside of its entries are summed.
+std::chrono::nanoseconds sum(const std::vector<build_profiling_entry>& entries, std::initializer_list<const char*> categories,
+                             const char* nested_in = nullptr)
+{
+    std::chrono::nanoseconds result(0);
+    for (const auto& entry : entries)
+    {
+        if (std::find_if(categories.begin(), categories.end(), [&](const char* c) { return entry.category == c; }) == categories.end())
+            continue;
+        if (nested_in && std::none_of(entries.begin(), entries.end(),
+                [&](const build_profiling_entry& outer) { return outer.category == nested_in && is_inside(entry, outer); }))
+            continue;
+        result += entry.duration;
+    }
+    return result;
+}
+
+// Kernel selection is done inside of the graph compilation pass. Kernels are compiled after all passes, but some of them
+// may be compiled earlier by the constant propagation pass, so compilation inside of passes is not counted as optimization.
+void add_build_phases(model_results& results, const std::vector<build_profiling_entry>& entries, std::chrono::nanoseconds total)
+{
+    auto select = sum(entries, { "kernel_selection" });
+    auto compile = sum(entries, { "kernels_source", "kernels_program" });
+    auto optimize = sum(entries, { "pass", "memory_planning" }) - select - sum(entries, { "kernels_source", "kernels_program" }, "pass");
+
+    results.total.add(total);
+    results.select.add(select);
+    results.compile.add(compile);
+    results.optimize.add(optimize);
+    results.other.add(std::max(std::chrono::nanoseconds(0), total - select - compile - optimize));
+}
+
+std::map<primitive_id, network_output> execute(network& network)
+{
+    // waiting for outputs includes execution of all primitives
+    auto outputs = network.execute();
+    for (auto& output : outputs)
+        output.second.get_memory();
+    return outputs;
+}
+
+model_results run(const model& model, const benchmark_options& options, cl::Context* context)
+{
+    build_options build_options;
+    build_options.set_option(build_option::optimize_data(true));
+    build_options.set_option(build_option::build_profiling(true));
+
+    model_results results;
+    results.name = model.name;
+    results.batch = model.single_batch ? 1 : options.batch;
+    auto input_size = model.input_size;
+    input_size.batch[0] = results.batch;
+
+    for (uint32_t i = 0; i < options.iterations; i++)
+    {
+        // every engine has its own kernels cache and memory pool, so all kernels are compiled again
+        engine_configuration configuration(false, false, false, std::string(), std::string(), true, std::string(),
+            std::string(), priority_mode_types::disabled, throttle_mode_types::disabled, true, context);
+        engine engine(configuration);
+
+        topology_builder builder(engine, options.data_type, input_size);
+        model.build(builder);
+        auto input = memory::allocate(engine, { options.data_type, format::bfyx, input_size });
+
+        auto start = std::chrono::steady_clock::now();
+        program program(engine, builder.get(), build_options);
+        auto built = std::chrono::steady_clock::now();
+        network network(program);
+        auto allocated = std::chrono::steady_clock::now();
+
+        add_build_phases(results, program.get_build_profiling_info(), built - start);
+        results.allocate.add(allocated - built);
+
+        network.set_input_data("input", input);
+        execute(network);   // warm-up
+        if (i + 1 < options.iterations)
+            continue;
+
+        // steady state is measured on the network of the last iteration
+        for (uint32_t e = 0; e < options.executions; e++)
+        {
+            auto execution_start = std::chrono::steady_clock::now();
+            execute(network);
+            results.latency.add(std::chrono::steady_clock::now() - execution_start);
+        }
+
+        for (uint32_t e = 0; e < options.executions; e += options.window)
+        {
+            auto window_start = std::chrono::steady_clock::now();
+            std::map<primitive_id, network_output> outputs;
+            for (uint32_t w = 0; w < options.window; w++)
+                outputs = network.execute();
+            for (auto& output : outputs)
+                output.second.get_memory();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - window_start;
+            results.throughput.add(results.batch * options.window / elapsed.count());
+        }
+
+        results.primitives = network.get_executed_primitive_ids().size();
+        results.peak_memory = engine.get_max_used_device_memory_size();
+    }
+    return results;
+}
+
+void print_header()
+{
+    std::cout << std::left << std::setw(14) << "" << std::right << std::setw(12) << ""
+        << std::setw(54) << "build, median [ms]" << std::setw(10) << "memory"
+        << std::setw(40) << "latency [ms]" << std::setw(30) << "throughput [fps]" << std::endl
+        << std::left << std::setw(14) << "model" << std::right << std::setw(6) << "batch" << std::setw(6) << "prims";
+    for (auto column : { "total", "optimize", "select", "compile", "other", "allocate" })
+        std::cout << std::setw(9) << column;
+    std::cout << std::setw(10) << "peak [MB]";
+    for (auto column : { "min", "mean", "p50", "p90", "p99" })
+        std::cout << std::setw(8) << column;
+    for (auto column : { "mean", "p10", "p50", "p90" })
+        std::cout << std::setw(8) << column;
+    std::cout << std::endl;
+}
+
+void print(const model_results& r)
+{
+    std::cout << std::left << std::setw(14) << r.name << std::right << std::setw(6) << r.batch << std::setw(6) << r.primitives;
+    for (const auto* s : { &r.total, &r.optimize, &r.select, &r.compile, &r.other, &r.allocate })
+        std::cout << std::setw(9) << s->median();
+    std::cout << std::setw(10) << r.peak_memory / (1024.0 * 1024.0)
+        << std::setw(8) << r.latency.min() << std::setw(8) << r.latency.mean() << std::setw(8) << r.latency.percentile(50)
+        << std::setw(8) << r.latency.percentile(90) << std::setw(8) << r.latency.percentile(99)
+        << std::setw(8) << r.throughput.mean() << std::setw(8) << r.throughput.percentile(10)
+        << std::setw(8) << r.throughput.percentile(50) << std::setw(8) << r.throughput.percentile(90) << std::endl;
+}
+
+template <class Writer>
+void write_samples(Writer& writer, const char* name, const samples& s, std::initializer_list<double> percentiles)
+{
+    writer.Key(name);
+    writer.StartObject();
+    writer.Key("min");
+    writer.Double(s.min());
+    writer.Key("mean");
+    writer.Double(s.mean());
+    writer.Key("max");
+    writer.Double(s.max());
+    for (auto p : percentiles)
+    {
+        writer.Key(("p" + std::to_string(static_cast<int>(p))).c_str());
+        writer.Double(s.percentile(p));
+    }
+    writer.EndObject();
+}
+
+void write_json(const std::string& path, const std::string& device, const benchmark_options& options, const std::vector<model_results>& results)
+{
+    rapidjson::StringBuffer buffer(0, 1024);
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("device");
+    writer.String(device.c_str());
+    writer.Key("data_type");
+    writer.String(options.data_type == data_types::f16 ? "f16" : "f32");
+    writer.Key("iterations");
+    writer.Uint(options.iterations);
+    writer.Key("executions");
+    writer.Uint(options.executions);
+    writer.Key("models");
+    writer.StartArray();
+    for (const auto& r : results)
+    {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(r.name.c_str());
+        writer.Key("batch");
+        writer.Int(r.batch);
+        writer.Key("primitives");
+        writer.Uint64(r.primitives);
+        writer.Key("build_ms");
+        writer.StartObject();
+        write_samples(writer, "total", r.total, { 50 });
+        write_samples(writer, "optimize", r.optimize, { 50 });
+        write_samples(writer, "select", r.select, { 50 });
+        write_samples(writer, "compile", r.compile, { 50 });
+        write_samples(writer, "other", r.other, { 50 });
+        write_samples(writer, "allocate", r.allocate, { 50 });
+        writer.EndObject();
+        writer.Key("peak_memory_bytes");
+        writer.Uint64(r.peak_memory);
+        write_samples(writer, "latency_ms", r.latency, { 50, 90, 99 });
+        write_samples(writer, "throughput_fps", r.throughput, { 10, 50, 90 });
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    std::ofstream file(path);
+    if (!file)
+        throw std::runtime_error("cannot open JSON output file: " + path);
+    file << buffer.GetString() << std::endl;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark_options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string value;
+        if (parse_value(argv[i], "--iterations", value))
+            options.iterations = std::max(1, std::atoi(value.c_str()));
+        else if (parse_value(argv[i], "--executions", value))
+            options.executions = std::max(1, std::atoi(value.c_str()));
+        else if (parse_value(argv[i], "--window", value))
+            options.window = std::max(1, std::atoi(value.c_str()));
+        else if (parse_value(argv[i], "--batch", value))
+            options.batch = std::max(1, std::atoi(value.c_str()));
+        else if (parse_value(argv[i], "--data-type", value) && (value == "f16" || value == "f32"))
+            options.data_type = (value == "f16") ? data_types::f16 : data_types::f32;
+        else if (parse_value(argv[i], "--device", value))
+            options.device = value;
+        else if (parse_value(argv[i], "--json", value))
+            options.json_path = value;
+        else if (std::strcmp(argv[i], "--list-devices") == 0)
+        {
+            list_devices();
+            return 0;
+        }
+        else if (std::strcmp(argv[i], "--list") == 0)
+        {
+            for (const auto& model : get_models())
+                std::cout << std::left << std::setw(14) << model.name << model.description << std::endl;
+            return 0;
+        }
+        else if (argv[i][0] == '-')
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+        else
+            options.models.push_back(argv[i]);
+    }
+
+    try
+    {
+        std::unique_ptr<cl::Context> context;
+        std::string device_name;
+        if (!options.device.empty())
+        {
+            auto device = get_device(options.device);
+            context.reset(new cl::Context(device));
+            device_name = device.getInfo<CL_DEVICE_NAME>();
+        }
+        else
+            device_name = get_default_device_name();
+        std::cout << "Device: " << device_name << std::endl;
+
+        std::vector<model_results> results;
+        std::cout << std::fixed << std::setprecision(1);
+        print_header();
+        for (const auto& model : get_models())
+        {
+            if (options.models.empty() ||
+                std::find(options.models.begin(), options.models.end(), model.name) != options.models.end())
+            {
+                results.push_back(run(model, options, context.get()));
+                print(results.back());
+            }
+        }
+
+        if (!options.json_path.empty())
+            write_json(options.json_path, device_name, options, results);
+    }
+    catch (const cl::Error& err)
+    {
+        std::cerr << "OpenCL error: " << err.what() << " (" << err.err() << ")" << std::endl;
+        return 1;
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,372 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "models.h"
+
+#include <api/CPP/concatenation.hpp>
+#include <api/CPP/detection_output.hpp>
+#include <api/CPP/normalize.hpp>
+#include <api/CPP/permute.hpp>
+#include <api/CPP/prior_box.hpp>
+#include <api/CPP/proposal.hpp>
+#include <api/CPP/region_yolo.hpp>
+#include <api/CPP/reorg_yolo.hpp>
+#include <api/CPP/roi_pooling.hpp>
+#include <api/CPP/softmax.hpp>
+
+namespace benchmarks
+{
+using namespace cldnn;
+
+namespace
+{
+    primitive_id classifier(topology_builder& b, const primitive_id& input)
+    {
+        return b.softmax(b.fc(input, 1000, false));
+    }
+
+    void alexnet(topology_builder& b)
+    {
+        // single group convolutions, as in CaffeNet trained on one GPU
+        auto x = b.max_pool(b.lrn(b.conv("input", 96, 11, 11, 4, 0, 0), 5), 3, 2);
+        x = b.max_pool(b.lrn(b.conv(x, 256, 5), 5), 3, 2);
+        x = b.conv(b.conv(b.conv(x, 384, 3), 384, 3), 256, 3);
+        x = b.max_pool(x, 3, 2);
+        classifier(b, b.fc(b.fc(x, 4096), 4096));
+    }
+
+    primitive_id vgg16_features(topology_builder& b, const primitive_id& input, std::vector<primitive_id>& stages)
+    {
+        const int32_t widths[] = { 64, 128, 256, 512, 512 };
+        const int32_t convs[] = { 2, 2, 3, 3, 3 };
+        auto x = input;
+        for (int stage = 0; stage < 5; stage++)
+        {
+            if (stage > 0)
+                x = b.max_pool(x, 2, 2);
+            for (int i = 0; i < convs[stage]; i++)
+                x = b.conv(x, widths[stage], 3);
+            stages.push_back(x);
+        }
+        return x;
+    }
+
+    void vgg16(topology_builder& b)
+    {
+        std::vector<primitive_id> stages;
+        auto x = b.max_pool(vgg16_features(b, "input", stages), 2, 2);
+        classifier(b, b.fc(b.fc(x, 4096), 4096));
+    }
+
+    primitive_id inception_v1(topology_builder& b, const primitive_id& x, int32_t c1, int32_t c3r, int32_t c3, int32_t c5r, int32_t c5, int32_t pool_proj)
+    {
+        return b.concat({
+            b.conv(x, c1, 1),
+            b.conv(b.conv(x, c3r, 1), c3, 3),
+            b.conv(b.conv(x, c5r, 1), c5, 5),
+            b.conv(b.max_pool(x, 3, 1, 1), pool_proj, 1) });
+    }
+
+    void googlenet_v1(topology_builder& b)
+    {
+        auto x = b.lrn(b.max_pool(b.conv("input", 64, 7, 2), 3, 2), 5);
+        x = b.max_pool(b.lrn(b.conv(b.conv(x, 64, 1), 192, 3), 5), 3, 2);
+        x = inception_v1(b, x, 64, 96, 128, 16, 32, 32);
+        x = inception_v1(b, x, 128, 128, 192, 32, 96, 64);
+        x = b.max_pool(x, 3, 2);
+        x = inception_v1(b, x, 192, 96, 208, 16, 48, 64);
+        x = inception_v1(b, x, 160, 112, 224, 24, 64, 64);
+        x = inception_v1(b, x, 128, 128, 256, 24, 64, 64);
+        x = inception_v1(b, x, 112, 144, 288, 32, 64, 64);
+        x = inception_v1(b, x, 256, 160, 320, 32, 128, 128);
+        x = b.max_pool(x, 3, 2);
+        x = inception_v1(b, x, 256, 160, 320, 32, 128, 128);
+        x = inception_v1(b, x, 384, 192, 384, 48, 128, 128);
+        classifier(b, b.global_pool(x));
+    }
+
+    // BN-Inception module: 5x5 convolution replaced by two 3x3 ones, reduction modules (stride 2) pass pooled input
+    primitive_id inception_v2(topology_builder& b, const primitive_id& x, int32_t c1, int32_t c3r, int32_t c3, int32_t cd3r, int32_t cd3,
+                              pooling_mode pool_mode, int32_t pool_proj, int32_t stride = 1)
+    {
+        std::vector<primitive_id> branches;
+        if (c1 > 0)
+            branches.push_back(b.conv(x, c1, 1));
+        branches.push_back(b.conv(b.conv(x, c3r, 1), c3, 3, stride));
+        branches.push_back(b.conv(b.conv(b.conv(x, cd3r, 1), cd3, 3), cd3, 3, stride));
+        if (stride == 1)
+            branches.push_back(b.conv(b.pool(x, pool_mode, 3, 1, 1), pool_proj, 1));
+        else
+            branches.push_back(b.max_pool(x, 3, 2));
+        return b.concat(branches);
+    }
+
+    void googlenet_v2(topology_builder& b)
+    {
+        const auto avg = pooling_mode::average;
+        const auto max = pooling_mode::max;
+        auto x = b.max_pool(b.conv("input", 64, 7, 2), 3, 2);
+        x = b.max_pool(b.conv(b.conv(x, 64, 1), 192, 3), 3, 2);
+        x = inception_v2(b, x, 64, 64, 64, 64, 96, avg, 32);
+        x = inception_v2(b, x, 64, 64, 96, 64, 96, avg, 64);
+        x = inception_v2(b, x, 0, 128, 160, 64, 96, max, 0, 2);
+        x = inception_v2(b, x, 224, 64, 96, 96, 128, avg, 128);
+        x = inception_v2(b, x, 192, 96, 128, 96, 128, avg, 128);
+        x = inception_v2(b, x, 160, 128, 160, 128, 160, avg, 128);
+        x = inception_v2(b, x, 96, 128, 192, 160, 192, avg, 128);
+        x = inception_v2(b, x, 0, 128, 192, 192, 256, max, 0, 2);
+        x = inception_v2(b, x, 352, 192, 320, 160, 224, avg, 128);
+        x = inception_v2(b, x, 352, 192, 320, 192, 224, max, 128);
+        classifier(b, b.global_pool(x));
+    }
+
+    // 1xN followed by Nx1 convolution (or the other way round)
+    primitive_id conv_1xn(topology_builder& b, const primitive_id& x, int32_t ofm, int32_t n)
+    {
+        return b.conv(x, ofm, n, 1, 1, n / 2, 0);
+    }
+
+    primitive_id conv_nx1(topology_builder& b, const primitive_id& x, int32_t ofm, int32_t n)
+    {
+        return b.conv(x, ofm, 1, n, 1, 0, n / 2);
+    }
+
+    primitive_id avg_pool_proj(topology_builder& b, const primitive_id& x, int32_t ofm)
+    {
+        return b.conv(b.pool(x, pooling_mode::average, 3, 1, 1), ofm, 1);
+    }
+
+    void googlenet_v3(topology_builder& b)
+    {
+        auto x = b.conv(b.conv("input", 32, 3, 3, 2, 0, 0), 32, 3, 3, 1, 0, 0);
+        x = b.max_pool(b.conv(x, 64, 3), 3, 2);
+        x = b.max_pool(b.conv(b.conv(x, 80, 1), 192, 3, 3, 1, 0, 0), 3, 2);
+
+        for (auto pool_features : { 32, 64, 64 })
+        {
+            x = b.concat({
+                b.conv(x, 64, 1),
+                b.conv(b.conv(x, 48, 1), 64, 5),
+                b.conv(b.conv(b.conv(x, 64, 1), 96, 3), 96, 3),
+                avg_pool_proj(b, x, pool_features) });
+        }
+
+        x = b.concat({
+            b.conv(x, 384, 3, 3, 2, 0, 0),
+            b.conv(b.conv(b.conv(x, 64, 1), 96, 3), 96, 3, 3, 2, 0, 0),
+            b.max_pool(x, 3, 2) });
+
+        for (auto c7 : { 128, 160, 160, 192 })
+        {
+            auto b7 = conv_nx1(b, conv_1xn(b, b.conv(x, c7, 1), c7, 7), 192, 7);
+            auto dbl = conv_1xn(b, conv_nx1(b, b.conv(x, c7, 1), c7, 7), c7, 7);
+            dbl = conv_1xn(b, conv_nx1(b, dbl, c7, 7), 192, 7);
+            x = b.concat({ b.conv(x, 192, 1), b7, dbl, avg_pool_proj(b, x, 192) });
+        }
+
+        x = b.concat({
+            b.conv(b.conv(x, 192, 1), 320, 3, 3, 2, 0, 0),
+            b.conv(conv_nx1(b, conv_1xn(b, b.conv(x, 192, 1), 192, 7), 192, 7), 192, 3, 3, 2, 0, 0),
+            b.max_pool(x, 3, 2) });
+
+        for (int i = 0; i < 2; i++)
+        {
+            auto b3 = b.conv(x, 384, 1);
+            auto dbl = b.conv(b.conv(x, 448, 1), 384, 3);
+            x = b.concat({
+                b.conv(x, 320, 1),
+                b.concat({ conv_1xn(b, b3, 384, 3), conv_nx1(b, b3, 384, 3) }),
+                b.concat({ conv_1xn(b, dbl, 384, 3), conv_nx1(b, dbl, 384, 3) }),
+                avg_pool_proj(b, x, 192) });
+        }
+        classifier(b, b.global_pool(x));
+    }
+
+    // ResNet with bottleneck blocks, downsampling is done by the first convolution of the block (as in Caffe models)
+    void resnet(topology_builder& b, const std::vector<int>& blocks)
+    {
+        auto x = b.max_pool(b.conv("input", 64, 7, 2), 3, 2);
+        for (size_t stage = 0; stage < blocks.size(); stage++)
+        {
+            auto width = 64 << stage;
+            for (int block = 0; block < blocks[stage]; block++)
+            {
+                auto stride = (stage > 0 && block == 0) ? 2 : 1;
+                auto shortcut = (block == 0) ? b.conv(x, 4 * width, 1, stride, false) : x;
+                auto branch = b.conv(b.conv(b.conv(x, width, 1, stride), width, 3), 4 * width, 1, 1, false);
+                x = b.relu(b.sum(branch, shortcut));
+            }
+        }
+        classifier(b, b.global_pool(x));
+    }
+
+    primitive_id fire(topology_builder& b, const primitive_id& x, int32_t squeeze, int32_t expand)
+    {
+        auto s = b.conv(x, squeeze, 1);
+        return b.concat({ b.conv(s, expand, 1), b.conv(s, expand, 3) });
+    }
+
+    void squeezenet(topology_builder& b)
+    {
+        auto x = b.max_pool(b.conv("input", 64, 3, 3, 2, 0, 0), 3, 2);
+        x = b.max_pool(fire(b, fire(b, x, 16, 64), 16, 64), 3, 2);
+        x = b.max_pool(fire(b, fire(b, x, 32, 128), 32, 128), 3, 2);
+        x = fire(b, fire(b, x, 48, 192), 48, 192);
+        x = fire(b, fire(b, x, 64, 256), 64, 256);
+        b.softmax(b.global_pool(b.conv(x, 1000, 1)));
+    }
+
+    // flattens NCHW output of a head convolution in NHWC order
+    primitive_id flatten(topology_builder& b, const primitive_id& x)
+    {
+        const auto& size = b.size(x);
+        auto permuted = b.add(permute(b.next_id("permute"), x, { 0, 2, 3, 1 }), size);
+        return b.reshape(permuted, { size.batch[0], static_cast<int32_t>(size.count() / size.batch[0]), 1, 1 });
+    }
+
+    primitive_id concat_along(topology_builder& b, const std::vector<primitive_id>& inputs, concatenation::concatenation_axis axis)
+    {
+        auto size = b.size(inputs.front());
+        auto& concatenated = (axis == concatenation::along_f) ? size.feature[0] : size.spatial[1];
+        concatenated = 0;
+        for (const auto& input : inputs)
+            concatenated += (axis == concatenation::along_f) ? b.size(input).feature[0] : b.size(input).spatial[1];
+        return b.add(concatenation(b.next_id("concat"), inputs, axis), size);
+    }
+
+    void ssd300(topology_builder& b)
+    {
+        const int32_t classes = 21;
+        struct head { primitive_id source; float min_size; float max_size; std::vector<float> aspect_ratios; float step; };
+
+        std::vector<primitive_id> stages;
+        vgg16_features(b, "input", stages);
+        auto conv4_3 = stages[3];
+        auto scale = b.add_data("conv4_3_norm_scale", { 1, 1, b.size(conv4_3).feature[0], 1 }, { 20.f });
+        auto conv4_3_norm = b.add(normalize("conv4_3_norm", conv4_3, scale, false), b.size(conv4_3));
+
+        auto x = b.max_pool(stages[4], 3, 1, 1);
+        auto fc7 = b.conv(b.conv(x, 1024, 3, 3, 1, 6, 6, true, 6), 1024, 1);
+        auto conv6_2 = b.conv(b.conv(fc7, 256, 1), 512, 3, 2);
+        auto conv7_2 = b.conv(b.conv(conv6_2, 128, 1), 256, 3, 2);
+        auto conv8_2 = b.conv(b.conv(conv7_2, 128, 1), 256, 3, 3, 1, 0, 0);
+        auto conv9_2 = b.conv(b.conv(conv8_2, 128, 1), 256, 3, 3, 1, 0, 0);
+
+        const std::vector<head> heads = {
+            { conv4_3_norm, 30.f, 60.f, { 2.f }, 8.f },
+            { fc7, 60.f, 111.f, { 2.f, 3.f }, 16.f },
+            { conv6_2, 111.f, 162.f, { 2.f, 3.f }, 32.f },
+            { conv7_2, 162.f, 213.f, { 2.f, 3.f }, 64.f },
+            { conv8_2, 213.f, 264.f, { 2.f }, 100.f },
+            { conv9_2, 264.f, 315.f, { 2.f }, 300.f },
+        };
+
+        std::vector<primitive_id> locations, confidences, priors;
+        int32_t priors_count = 0;
+        for (const auto& h : heads)
+        {
+            // one prior of min size, one of max size and two per aspect ratio (flipped)
+            auto priors_per_location = static_cast<int32_t>(2 + 2 * h.aspect_ratios.size());
+            const auto& size = b.size(h.source);
+            locations.push_back(flatten(b, b.conv(h.source, priors_per_location * 4, 3, 1, false)));
+            confidences.push_back(flatten(b, b.conv(h.source, priors_per_location * classes, 3, 1, false)));
+
+            auto locations_count = size.spatial[0] * size.spatial[1] * priors_per_location;
+            priors.push_back(b.add(prior_box(b.next_id("prior_box"), h.source, { 1, 3, 300, 300 }, { h.min_size }, { h.max_size },
+                                             h.aspect_ratios, true, false, { 0.1f, 0.1f, 0.2f, 0.2f }, h.step, h.step),
+                                   { 1, 2, 1, locations_count * 4 }));
+            priors_count += locations_count;
+        }
+
+        auto batch = b.size("input").batch[0];
+        auto location = concat_along(b, locations, concatenation::along_f);
+        auto confidence = b.reshape(concat_along(b, confidences, concatenation::along_f), { batch, priors_count, classes, 1 });
+        confidence = b.add(softmax("mbox_conf_softmax", confidence, softmax::normalize_x), b.size(confidence));
+        confidence = b.reshape(confidence, { batch, priors_count * classes, 1, 1 });
+        auto prior = concat_along(b, priors, concatenation::along_y);
+        b.add(detection_output("detection_out", location, confidence, prior, classes, 200, true, 0, 0.45f, 400), { 1, 1, 7, 200 * batch });
+    }
+
+    void faster_rcnn(topology_builder& b)
+    {
+        const int32_t anchors = 9;
+        const int32_t rois = 300;
+        std::vector<primitive_id> stages;
+        auto conv5_3 = vgg16_features(b, "input", stages);
+        const auto& size = b.size(conv5_3);
+        const auto& input_size = b.size("input");
+
+        auto rpn = b.conv(conv5_3, 512, 3);
+        auto scores = b.conv(rpn, 2 * anchors, 1, 1, false);
+        auto deltas = b.conv(rpn, 4 * anchors, 1, 1, false);
+        // softmax over background/object scores of every anchor
+        auto probabilities = b.reshape(scores, { 1, 2, size.spatial[0], anchors * size.spatial[1] });
+        probabilities = b.add(softmax("rpn_cls_prob", probabilities, softmax::normalize_f), b.size(probabilities));
+        probabilities = b.reshape(probabilities, b.size(scores));
+
+        auto image_info = b.add_data("im_info", { 1, 1, 3, 1 }, { static_cast<float>(input_size.spatial[1]), static_cast<float>(input_size.spatial[0]), 1.f });
+        auto proposals = b.add(proposal("proposal", probabilities, deltas, image_info, rois, 0.7f, 16, 16, 6000, rois,
+                                        { 0.5f, 1.f, 2.f }, { 8.f, 16.f, 32.f }), { rois, 5, 1, 1 });
+        auto pooled = b.add(roi_pooling("roi_pool5", conv5_3, proposals, pooling_mode::max, 7, 7, 1.f / 16),
+                            { rois, size.feature[0], 7, 7 });
+
+        auto x = b.fc(b.fc(pooled, 4096), 4096);
+        b.softmax(b.fc(x, 21, false), "cls_prob");
+        b.fc(x, 21 * 4, false);
+    }
+
+    void yolo_v2(topology_builder& b)
+    {
+        b.set_relu_slope(0.1f);
+        auto x = b.max_pool(b.conv("input", 32, 3), 2, 2);
+        x = b.max_pool(b.conv(x, 64, 3), 2, 2);
+        x = b.max_pool(b.conv(b.conv(b.conv(x, 128, 3), 64, 1), 128, 3), 2, 2);
+        x = b.max_pool(b.conv(b.conv(b.conv(x, 256, 3), 128, 1), 256, 3), 2, 2);
+        auto passthrough = b.conv(b.conv(b.conv(b.conv(b.conv(x, 512, 3), 256, 1), 512, 3), 256, 1), 512, 3);
+        x = b.max_pool(passthrough, 2, 2);
+        x = b.conv(b.conv(b.conv(b.conv(b.conv(x, 1024, 3), 512, 1), 1024, 3), 512, 1), 1024, 3);
+        x = b.conv(b.conv(x, 1024, 3), 1024, 3);
+
+        auto reorg_input = b.conv(passthrough, 64, 1);
+        const auto& size = b.size(reorg_input);
+        auto reorg = b.add(reorg_yolo("reorg", reorg_input, 2), { size.batch[0], size.feature[0] * 4, size.spatial[0] / 2, size.spatial[1] / 2 });
+        x = b.conv(b.conv(b.concat({ reorg, x }), 1024, 3), 5 * (20 + 4 + 1), 1, 1, false);
+        b.add(region_yolo("region", x, 4, 20, 5), b.size(x));
+    }
+}
+
+const std::vector<model>& get_models()
+{
+    static const std::vector<model> models = {
+        { "alexnet",      "AlexNet (CaffeNet)",             { 1, 3, 227, 227 },  false, alexnet },
+        { "vgg16",        "VGG16",                          { 1, 3, 224, 224 },  false, vgg16 },
+        { "googlenet_v1", "GoogleNet v1",                   { 1, 3, 224, 224 },  false, googlenet_v1 },
+        { "googlenet_v2", "GoogleNet v2 (BN-Inception)",    { 1, 3, 224, 224 },  false, googlenet_v2 },
+        { "googlenet_v3", "GoogleNet v3 (Inception v3)",    { 1, 3, 299, 299 },  false, googlenet_v3 },
+        { "resnet50",     "ResNet-50",                      { 1, 3, 224, 224 },  false, [](topology_builder& b) { resnet(b, { 3, 4, 6, 3 }); } },
+        { "resnet101",    "ResNet-101",                     { 1, 3, 224, 224 },  false, [](topology_builder& b) { resnet(b, { 3, 4, 23, 3 }); } },
+        { "resnet152",    "ResNet-152",                     { 1, 3, 224, 224 },  false, [](topology_builder& b) { resnet(b, { 3, 8, 36, 3 }); } },
+        { "squeezenet",   "SqueezeNet 1.1",                 { 1, 3, 224, 224 },  false, squeezenet },
+        { "ssd300",       "SSD300 (VGG16), 21 classes",     { 1, 3, 300, 300 },  false, ssd300 },
+        { "faster_rcnn",  "Faster R-CNN (VGG16), 300 ROIs", { 1, 3, 800, 600 },  true,  faster_rcnn },
+        { "yolo_v2",      "YOLO v2 (VOC)",                  { 1, 3, 416, 416 },  false, yolo_v2 },
+    };
+    return models;
+}
+
+}
@@ -0,0 +1,43 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "topology_builder.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace benchmarks
+{
+
+// Topology of the model zoo built with synthetic weights.
+struct model
+{
+    std::string name;
+    std::string description;
+    cldnn::tensor input_size;                       // size of the input with batch 1
+    bool single_batch;                              // topology supports batch 1 only
+    std::function<void(topology_builder&)> build;   // adds all primitives except of the input
+};
+
+// Topologies validated with clDNN (see README): AlexNet, VGG16, GoogleNet v1-v3, ResNet-50/101/152, SqueezeNet 1.1,
+// SSD300, Faster R-CNN and YOLO v2. Batch normalizations are folded into convolutions, as they are for inference.
+const std::vector<model>& get_models();
+
+}
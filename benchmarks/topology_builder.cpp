@@ -0,0 +1,177 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "topology_builder.h"
+
+#include <api/CPP/activation.hpp>
+#include <api/CPP/concatenation.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/fully_connected.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/lrn.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/reshape.hpp>
+#include <api/CPP/softmax.hpp>
+
+namespace benchmarks
+{
+using namespace cldnn;
+
+namespace
+{
+    template <class T>
+    void fill(memory& mem, const std::vector<float>& values)
+    {
+        std::vector<T> converted;
+        for (auto value : values)
+            converted.push_back(T(value));
+
+        auto ptr = mem.pointer<T>();
+        for (size_t i = 0; i < ptr.size(); i++)
+            ptr[i] = converted[i % converted.size()];
+    }
+}
+
+topology_builder::topology_builder(const engine& engine, data_types data_type, const tensor& input_size)
+    : _engine(engine)
+    , _data_type(data_type)
+{
+    _topology.add(input_layout("input", { data_type, format::bfyx, input_size }));
+    _sizes["input"] = input_size;
+}
+
+primitive_id topology_builder::conv(const primitive_id& input, int32_t ofm, int32_t kernel, int32_t stride, bool relu)
+{
+    return conv(input, ofm, kernel, kernel, stride, kernel / 2, kernel / 2, relu);
+}
+
+primitive_id topology_builder::conv(const primitive_id& input, int32_t ofm, int32_t kernel_x, int32_t kernel_y, int32_t stride,
+                                    int32_t pad_x, int32_t pad_y, bool relu, int32_t dilation)
+{
+    auto id = next_id("conv");
+    const auto& in = size(input);
+    auto weights = add_data(id + "_weights", { ofm, in.feature[0], kernel_x, kernel_y });
+    auto bias = add_data(id + "_bias", { 1, 1, ofm, 1 });
+    _topology.add(convolution(id, input, { weights }, { bias },
+        { 1, 1, stride, stride }, { 0, 0, -pad_x, -pad_y }, { 1, 1, dilation, dilation }, relu, _relu_slope));
+
+    auto out_x = (in.spatial[0] + 2 * pad_x - (kernel_x - 1) * dilation - 1) / stride + 1;
+    auto out_y = (in.spatial[1] + 2 * pad_y - (kernel_y - 1) * dilation - 1) / stride + 1;
+    _sizes[id] = { in.batch[0], ofm, out_x, out_y };
+    return id;
+}
+
+primitive_id topology_builder::pool(const primitive_id& input, pooling_mode mode, int32_t size, int32_t stride, int32_t pad)
+{
+    auto id = next_id("pool");
+    _topology.add(pooling(id, input, mode, { 1, 1, size, size }, { 1, 1, stride, stride }, { 0, 0, -pad, -pad }));
+
+    // the last window has to start inside of the input or its upper padding
+    const auto& in = this->size(input);
+    auto out_size = [&](int32_t in_size)
+    {
+        auto out = (in_size + 2 * pad - size + stride - 1) / stride + 1;
+        return ((out - 1) * stride >= in_size + pad) ? out - 1 : out;
+    };
+    _sizes[id] = { in.batch[0], in.feature[0], out_size(in.spatial[0]), out_size(in.spatial[1]) };
+    return id;
+}
+
+primitive_id topology_builder::global_pool(const primitive_id& input)
+{
+    auto id = next_id("gpool");
+    _topology.add(pooling(id, input, pooling_mode::average));
+    _sizes[id] = { size(input).batch[0], size(input).feature[0], 1, 1 };
+    return id;
+}
+
+primitive_id topology_builder::fc(const primitive_id& input, int32_t ofm, bool relu)
+{
+    auto id = next_id("fc");
+    const auto& in = size(input);
+    auto weights = add_data(id + "_weights", { ofm, in.feature[0], in.spatial[0], in.spatial[1] });
+    auto bias = add_data(id + "_bias", { 1, 1, ofm, 1 });
+    _topology.add(fully_connected(id, input, weights, bias, relu, _relu_slope));
+    _sizes[id] = { in.batch[0], ofm, 1, 1 };
+    return id;
+}
+
+primitive_id topology_builder::relu(const primitive_id& input)
+{
+    return add(activation(next_id("relu"), input, activation_relu), size(input));
+}
+
+primitive_id topology_builder::lrn(const primitive_id& input, uint32_t size)
+{
+    return add(cldnn::lrn(next_id("lrn"), input, size, 1.f, 0.0001f, 0.75f, cldnn_lrn_norm_region_across_channel), this->size(input));
+}
+
+primitive_id topology_builder::sum(const primitive_id& first, const primitive_id& second)
+{
+    return add(eltwise(next_id("sum"), { first, second }, eltwise_mode::sum), size(first));
+}
+
+primitive_id topology_builder::concat(const std::vector<primitive_id>& inputs)
+{
+    auto output_size = size(inputs.front());
+    output_size.feature[0] = 0;
+    for (const auto& input : inputs)
+        output_size.feature[0] += size(input).feature[0];
+    return add(concatenation(next_id("concat"), inputs, concatenation::along_f), output_size);
+}
+
+primitive_id topology_builder::softmax(const primitive_id& input, const primitive_id& id)
+{
+    return add(cldnn::softmax(id, input), size(input));
+}
+
+primitive_id topology_builder::reshape(const primitive_id& input, const tensor& size)
+{
+    return add(cldnn::reshape(next_id("reshape"), input, size), size);
+}
+
+primitive_id topology_builder::add_data(const primitive_id& id, const tensor& size)
+{
+    // values of both signs scaled by number of inputs of a neuron keep activations of deep topologies finite
+    auto fan_in = static_cast<float>(size.count() / size.batch[0]);
+    std::vector<float> values;
+    for (int i = -3; i <= 3; i++)
+        values.push_back(i / (8.f * fan_in));
+    return add_data(id, size, values);
+}
+
+primitive_id topology_builder::add_data(const primitive_id& id, const tensor& size, const std::vector<float>& values)
+{
+    auto mem = memory::allocate(_engine, { _data_type, format::bfyx, size });
+    if (_data_type == data_types::f16)
+        fill<half_t>(mem, values);
+    else
+        fill<float>(mem, values);
+    _topology.add(data(id, mem));
+    _sizes[id] = size;
+    return id;
+}
+
+primitive_id topology_builder::next_id(const std::string& prefix)
+{
+    return prefix + std::to_string(++_counter);
+}
+
+}
@@ -0,0 +1,92 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <api/CPP/engine.hpp>
+#include <api/CPP/layout.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/topology.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace benchmarks
+{
+
+// Builds topologies with synthetic weights allocated on the engine. Output sizes of added primitives are tracked,
+// so weights of convolutions and fully connected layers get sizes matching their inputs.
+// Input of the topology is named "input". Padding of convolutions and poolings is symmetric.
+class topology_builder
+{
+public:
+    topology_builder(const cldnn::engine& engine, cldnn::data_types data_type, const cldnn::tensor& input_size);
+
+    // "same" convolution (padding of half of the kernel size) with bias and fused relu (leaky when relu_slope is set)
+    cldnn::primitive_id conv(const cldnn::primitive_id& input, int32_t ofm, int32_t kernel, int32_t stride = 1, bool relu = true);
+    cldnn::primitive_id conv(const cldnn::primitive_id& input, int32_t ofm, int32_t kernel_x, int32_t kernel_y, int32_t stride,
+                             int32_t pad_x, int32_t pad_y, bool relu = true, int32_t dilation = 1);
+
+    // pooling with output size rounded up (as in Caffe)
+    cldnn::primitive_id pool(const cldnn::primitive_id& input, cldnn::pooling_mode mode, int32_t size, int32_t stride, int32_t pad = 0);
+    cldnn::primitive_id max_pool(const cldnn::primitive_id& input, int32_t size, int32_t stride, int32_t pad = 0)
+    {
+        return pool(input, cldnn::pooling_mode::max, size, stride, pad);
+    }
+    cldnn::primitive_id global_pool(const cldnn::primitive_id& input);
+
+    cldnn::primitive_id fc(const cldnn::primitive_id& input, int32_t ofm, bool relu = true);
+    cldnn::primitive_id relu(const cldnn::primitive_id& input);
+    cldnn::primitive_id lrn(const cldnn::primitive_id& input, uint32_t size);
+    cldnn::primitive_id sum(const cldnn::primitive_id& first, const cldnn::primitive_id& second);
+    cldnn::primitive_id concat(const std::vector<cldnn::primitive_id>& inputs);
+    cldnn::primitive_id softmax(const cldnn::primitive_id& input, const cldnn::primitive_id& id = "prob");
+    cldnn::primitive_id reshape(const cldnn::primitive_id& input, const cldnn::tensor& size);
+
+    // Adds primitive which shape is not tracked by helpers above, its output size has to be given.
+    template <class PType>
+    cldnn::primitive_id add(const PType& prim, const cldnn::tensor& output_size)
+    {
+        _topology.add(prim);
+        _sizes[prim.get_id()] = output_size;
+        return prim.get_id();
+    }
+
+    // Adds constant data of given size filled with small values or with given values repeated.
+    cldnn::primitive_id add_data(const cldnn::primitive_id& id, const cldnn::tensor& size);
+    cldnn::primitive_id add_data(const cldnn::primitive_id& id, const cldnn::tensor& size, const std::vector<float>& values);
+
+    cldnn::primitive_id next_id(const std::string& prefix);
+    const cldnn::tensor& size(const cldnn::primitive_id& id) const { return _sizes.at(id); }
+    cldnn::data_types data_type() const { return _data_type; }
+
+    // slope of relu fused into convolutions and fully connected layers (e.g. 0.1 for YOLO leaky relu)
+    void set_relu_slope(float slope) { _relu_slope = slope; }
+
+    const cldnn::topology& get() const { return _topology; }
+
+private:
+    const cldnn::engine& _engine;
+    cldnn::data_types _data_type;
+    cldnn::topology _topology;
+    std::map<cldnn::primitive_id, cldnn::tensor> _sizes;
+    float _relu_slope = 0.f;
+    uint32_t _counter = 0;
+};
+
+}
@@ -0,0 +1,228 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Host overhead benchmarks: time spent by clDNN on the host side when topologies are built into programs
+// (program_impl construction), programs are allocated into networks (network_impl construction) and networks
+// are executed. The executable is linked with the null device OpenCL library, so no GPU is needed and
+// driver/device time is limited to latencies configured with --build-us, --enqueue-us and --kernel-us.
+
+#include "topologies.h"
+
+#include <api/CPP/memory.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/program.hpp>
+
+#include <CL/cl.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace
+{
+using namespace cldnn;
+using namespace host_benchmarks;
+
+struct benchmark_options
+{
+    uint32_t iterations = 5;
+    uint32_t executions = 20;
+    bool optimize_data = true;
+    std::vector<std::string> topologies;
+};
+
+// Samples of single phase in microseconds.
+class samples
+{
+public:
+    void add(std::chrono::steady_clock::duration time)
+    {
+        _values.push_back(std::chrono::duration<double, std::micro>(time).count());
+    }
+
+    double min() const { return *std::min_element(_values.begin(), _values.end()); }
+    double mean() const { return std::accumulate(_values.begin(), _values.end(), 0.0) / _values.size(); }
+    double median() const
+    {
+        auto sorted = _values;
+        std::sort(sorted.begin(), sorted.end());
+        return sorted[sorted.size() / 2];
+    }
+
+private:
+    std::vector<double> _values;
+};
+
+std::ostream& operator<<(std::ostream& os, const samples& s)
+{
+    return os << std::setw(10) << s.min() << std::setw(10) << s.median() << std::setw(10) << s.mean();
+}
+
+void print_usage(const char* exe)
+{
+    std::cout << "Usage: " << exe << " [options] [topology...]\n"
+        << "Options:\n"
+        << "  --iterations=N   programs and networks built for every topology (default: 5)\n"
+        << "  --executions=N   timed executions of every network (default: 20)\n"
+        << "  --build-us=N     simulated time of every OpenCL program build\n"
+        << "  --enqueue-us=N   simulated host time of every enqueue\n"
+        << "  --kernel-us=N    simulated device time of every kernel\n"
+        << "  --no-optimize    build programs without optimize_data option\n"
+        << "  --list           list available topologies\n";
+}
+
+bool parse_value(const char* arg, const char* name, std::string& value)
+{
+    auto length = std::strlen(name);
+    if (std::strncmp(arg, name, length) != 0 || arg[length] != '=')
+        return false;
+    value = arg + length + 1;
+    return true;
+}
+
+// Null device latencies are read from environment when the first OpenCL function is called.
+void set_latency(const char* variable, const std::string& value)
+{
+    setenv(variable, value.c_str(), 1);
+}
+
+std::string get_device_name()
+{
+    cl_platform_id platform;
+    cl_device_id device;
+    char name[256] = {};
+    if (clGetPlatformIDs(1, &platform, nullptr) != CL_SUCCESS ||
+        clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, nullptr) != CL_SUCCESS ||
+        clGetDeviceInfo(device, CL_DEVICE_NAME, sizeof(name) - 1, name, nullptr) != CL_SUCCESS)
+        return "<no device>";
+    return name;
+}
+
+void execute(const network& network)
+{
+    // waiting for outputs includes dispatch of all primitives
+    for (auto& output : network.execute())
+        output.second.get_memory();
+}
+
+void run(const benchmark_topology& benchmark, const benchmark_options& options)
+{
+    build_options build_options;
+    build_options.set_option(build_option::optimize_data(options.optimize_data));
+
+    samples build, allocation, execution;
+    size_t primitives = 0;
+    for (uint32_t i = 0; i < options.iterations; i++)
+    {
+        // every engine has its own kernels cache, so all kernels are compiled again
+        engine engine;
+        auto topology = benchmark.build(engine, benchmark.input_layout);
+        auto input = memory::allocate(engine, benchmark.input_layout);
+
+        auto start = std::chrono::steady_clock::now();
+        program program(engine, topology, build_options);
+        auto built = std::chrono::steady_clock::now();
+        network network(program);
+        auto allocated = std::chrono::steady_clock::now();
+        build.add(built - start);
+        allocation.add(allocated - built);
+
+        network.set_input_data("input", input);
+        execute(network);
+        for (uint32_t e = 0; e < options.executions; e++)
+        {
+            auto execution_start = std::chrono::steady_clock::now();
+            execute(network);
+            execution.add(std::chrono::steady_clock::now() - execution_start);
+        }
+        primitives = network.get_executed_primitive_ids().size();
+    }
+
+    std::cout << std::left << std::setw(16) << benchmark.name << std::right << std::setw(6) << primitives
+        << build << allocation << execution << std::endl;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    benchmark_options options;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string value;
+        if (parse_value(argv[i], "--iterations", value))
+            options.iterations = std::max(1, std::atoi(value.c_str()));
+        else if (parse_value(argv[i], "--executions", value))
+            options.executions = std::max(1, std::atoi(value.c_str()));
+        else if (parse_value(argv[i], "--build-us", value))
+            set_latency("NULL_OCL_BUILD_US", value);
+        else if (parse_value(argv[i], "--enqueue-us", value))
+            set_latency("NULL_OCL_ENQUEUE_US", value);
+        else if (parse_value(argv[i], "--kernel-us", value))
+            set_latency("NULL_OCL_KERNEL_US", value);
+        else if (std::strcmp(argv[i], "--no-optimize") == 0)
+            options.optimize_data = false;
+        else if (std::strcmp(argv[i], "--list") == 0)
+        {
+            for (const auto& topology : get_topologies())
+                std::cout << std::left << std::setw(16) << topology.name << topology.description << std::endl;
+            return 0;
+        }
+        else if (argv[i][0] == '-')
+        {
+            print_usage(argv[0]);
+            return 1;
+        }
+        else
+            options.topologies.push_back(argv[i]);
+    }
+
+    auto device = get_device_name();
+    std::cout << "Device: " << device << std::endl;
+    if (device != "Null OpenCL Device")
+        std::cout << "Warning: not running on null device, times include work of the driver and the device." << std::endl;
+
+    std::cout << std::fixed << std::setprecision(1)
+        << std::left << std::setw(16) << "" << std::right << std::setw(6) << ""
+        << std::setw(30) << "program build [us]" << std::setw(30) << "network allocation [us]" << std::setw(30) << "execution [us]" << std::endl
+        << std::left << std::setw(16) << "topology" << std::right << std::setw(6) << "prims";
+    for (int phase = 0; phase < 3; phase++)
+        std::cout << std::setw(10) << "min" << std::setw(10) << "median" << std::setw(10) << "mean";
+    std::cout << std::endl;
+
+    try
+    {
+        for (const auto& topology : get_topologies())
+        {
+            if (options.topologies.empty() ||
+                std::find(options.topologies.begin(), options.topologies.end(), topology.name) != options.topologies.end())
+                run(topology, options);
+        }
+    }
+    catch (const std::exception& ex)
+    {
+        std::cerr << "Error: " << ex.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,242 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "topologies.h"
+
+#include <api/CPP/activation.hpp>
+#include <api/CPP/concatenation.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/fully_connected.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/softmax.hpp>
+
+#include <map>
+
+namespace host_benchmarks
+{
+namespace
+{
+using namespace cldnn;
+
+// Adds primitives with synthetic weights to the topology and tracks number of features of their outputs.
+class topology_builder
+{
+public:
+    topology_builder(const engine& engine, const layout& input)
+        : _engine(engine)
+    {
+        _topology.add(input_layout("input", input));
+        _features["input"] = input.size.feature[0];
+    }
+
+    primitive_id conv(const primitive_id& input, int32_t ofm, int32_t kernel, int32_t stride = 1, bool relu = true)
+    {
+        auto id = next_id("conv");
+        auto ifm = _features.at(input);
+        auto pad = kernel / 2;
+        _topology.add(convolution(id, input,
+            { add_data(id + "_weights", { ofm, ifm, kernel, kernel }) },
+            { add_data(id + "_bias", { 1, 1, ofm, 1 }) },
+            { 1, 1, stride, stride }, { 0, 0, -pad, -pad }, { 1, 1, 1, 1 }, relu));
+        _features[id] = ofm;
+        return id;
+    }
+
+    primitive_id max_pool(const primitive_id& input, int32_t size, int32_t stride)
+    {
+        return add(pooling(next_id("pool"), input, pooling_mode::max, { 1, 1, size, size }, { 1, 1, stride, stride }), input);
+    }
+
+    primitive_id global_pool(const primitive_id& input)
+    {
+        return add(pooling(next_id("gpool"), input, pooling_mode::average), input);
+    }
+
+    primitive_id relu(const primitive_id& input)
+    {
+        return add(activation(next_id("relu"), input, activation_relu), input);
+    }
+
+    primitive_id sum(const primitive_id& first, const primitive_id& second)
+    {
+        return add(eltwise(next_id("sum"), { first, second }, eltwise_mode::sum), first);
+    }
+
+    primitive_id concat(const std::vector<primitive_id>& inputs)
+    {
+        auto id = next_id("concat");
+        int32_t features = 0;
+        for (const auto& input : inputs)
+            features += _features.at(input);
+        _topology.add(concatenation(id, inputs, concatenation::along_f));
+        _features[id] = features;
+        return id;
+    }
+
+    // Fully connected layer on top of globally pooled input followed by softmax.
+    primitive_id classifier(const primitive_id& input, int32_t classes)
+    {
+        auto id = next_id("fc");
+        auto ifm = _features.at(input);
+        _topology.add(fully_connected(id, input,
+            add_data(id + "_weights", { classes, ifm, 1, 1 }),
+            add_data(id + "_bias", { 1, 1, classes, 1 })));
+        _features[id] = classes;
+        return probabilities(id);
+    }
+
+    primitive_id probabilities(const primitive_id& input)
+    {
+        _topology.add(softmax("prob", input));
+        _features["prob"] = _features.at(input);
+        return "prob";
+    }
+
+    const topology& get() const { return _topology; }
+
+private:
+    // primitive keeping number of features of its input
+    template <class PType>
+    primitive_id add(const PType& prim, const primitive_id& input)
+    {
+        _topology.add(prim);
+        _features[prim.get_id()] = _features.at(input);
+        return prim.get_id();
+    }
+
+    primitive_id add_data(const primitive_id& id, const tensor& size)
+    {
+        auto mem = memory::allocate(_engine, { data_types::f32, format::bfyx, size });
+        auto ptr = mem.pointer<float>();
+        // small values of both signs keep activations of deep topologies finite
+        for (size_t i = 0; i < ptr.size(); i++)
+            ptr[i] = static_cast<float>(static_cast<int>(i % 7) - 3) / (8.f * size.count() / size.batch[0]);
+        _topology.add(data(id, mem));
+        return id;
+    }
+
+    primitive_id next_id(const std::string& prefix)
+    {
+        return prefix + std::to_string(++_counter);
+    }
+
+    const engine& _engine;
+    topology _topology;
+    std::map<primitive_id, int32_t> _features;
+    uint32_t _counter = 0;
+};
+
+// Long chain of small convolutions: per primitive cost of kernel selection, compilation and dispatch.
+topology conv_chain(const engine& engine, const layout& input)
+{
+    topology_builder builder(engine, input);
+    auto last = builder.conv("input", 16, 3);
+    for (int i = 0; i < 23; i++)
+        last = builder.conv(last, 16, 3);
+    builder.classifier(builder.global_pool(last), 10);
+    return builder.get();
+}
+
+// Activations and element-wise sums only: tiny kernels, so cost is dominated by graph passes and enqueues.
+topology eltwise_chain(const engine& engine, const layout& input)
+{
+    topology_builder builder(engine, input);
+    primitive_id last = "input";
+    for (int i = 0; i < 32; i++)
+        last = builder.sum(builder.relu(last), last);
+    return builder.get();
+}
+
+// Many parallel branches joined by concatenation: dependencies tracking, events and in-place concatenation.
+topology wide_concat(const engine& engine, const layout& input)
+{
+    topology_builder builder(engine, input);
+    primitive_id last = "input";
+    for (int block = 0; block < 4; block++)
+    {
+        std::vector<primitive_id> branches;
+        for (int i = 0; i < 8; i++)
+            branches.push_back(builder.conv(last, 8, 1));
+        last = builder.conv(builder.concat(branches), 16, 1);
+    }
+    builder.classifier(builder.global_pool(last), 10);
+    return builder.get();
+}
+
+// ResNet-50 like: bottleneck blocks with projection shortcuts (fewer blocks per stage).
+topology resnet_like(const engine& engine, const layout& input)
+{
+    topology_builder builder(engine, input);
+    auto last = builder.max_pool(builder.conv("input", 64, 7, 2), 3, 2);
+    const int32_t widths[] = { 64, 128, 256, 512 };
+    for (int stage = 0; stage < 4; stage++)
+    {
+        auto width = widths[stage];
+        for (int block = 0; block < 2; block++)
+        {
+            auto stride = (stage > 0 && block == 0) ? 2 : 1;
+            auto shortcut = (block == 0) ? builder.conv(last, 4 * width, 1, stride, false) : last;
+            auto branch = builder.conv(last, width, 1, stride);
+            branch = builder.conv(branch, width, 3);
+            branch = builder.conv(branch, 4 * width, 1, 1, false);
+            last = builder.relu(builder.sum(branch, shortcut));
+        }
+    }
+    builder.classifier(builder.global_pool(last), 1000);
+    return builder.get();
+}
+
+// SqueezeNet 1.1: fire modules (squeeze 1x1, expand 1x1 and 3x3 concatenated).
+topology squeezenet(const engine& engine, const layout& input)
+{
+    topology_builder builder(engine, input);
+    auto fire = [&](const primitive_id& in, int32_t squeeze, int32_t expand)
+    {
+        auto s = builder.conv(in, squeeze, 1);
+        return builder.concat({ builder.conv(s, expand, 1), builder.conv(s, expand, 3) });
+    };
+
+    auto last = builder.max_pool(builder.conv("input", 64, 3, 2), 3, 2);
+    last = fire(fire(last, 16, 64), 16, 64);
+    last = builder.max_pool(last, 3, 2);
+    last = fire(fire(last, 32, 128), 32, 128);
+    last = builder.max_pool(last, 3, 2);
+    last = fire(fire(last, 48, 192), 48, 192);
+    last = fire(fire(last, 64, 256), 64, 256);
+    builder.probabilities(builder.global_pool(builder.conv(last, 1000, 1)));
+    return builder.get();
+}
+}
+
+const std::vector<benchmark_topology>& get_topologies()
+{
+    static const std::vector<benchmark_topology> topologies = {
+        { "conv_chain",    "24 convolutions 3x3 with fused relu",          { data_types::f32, format::bfyx, { 1, 16, 28, 28 } },  conv_chain },
+        { "eltwise_chain", "32 pairs of relu and eltwise sum",             { data_types::f32, format::bfyx, { 1, 16, 28, 28 } },  eltwise_chain },
+        { "wide_concat",   "4 blocks of 8 parallel convolutions 1x1",      { data_types::f32, format::bfyx, { 1, 16, 28, 28 } },  wide_concat },
+        { "resnet_like",   "ResNet-50 shaped, 2 bottleneck blocks/stage",  { data_types::f32, format::bfyx, { 1, 3, 224, 224 } }, resnet_like },
+        { "squeezenet",    "SqueezeNet 1.1",                               { data_types::f32, format::bfyx, { 1, 3, 224, 224 } }, squeezenet },
+    };
+    return topologies;
+}
+
+}
@@ -0,0 +1,44 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <api/CPP/engine.hpp>
+#include <api/CPP/layout.hpp>
+#include <api/CPP/topology.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace host_benchmarks
+{
+
+// Topology measured by host benchmarks. Weights are synthetic and allocated on the engine passed to build,
+// so topology is built again for every engine. Input of the topology is named "input".
+struct benchmark_topology
+{
+    std::string name;
+    std::string description;
+    cldnn::layout input_layout;
+    std::function<cldnn::topology(const cldnn::engine&, const cldnn::layout&)> build;
+};
+
+// Synthetic topologies stressing single host side paths and topologies shaped after model zoo networks.
+const std::vector<benchmark_topology>& get_topologies();
+
+}
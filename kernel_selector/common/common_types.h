@@ -58,6 +58,7 @@ namespace kernel_selector
         FULLY_CONNECTED_GRAD_WEIGHTS,
         LSTM_GEMM,
         LSTM_ELT,
+        LSTM_SEQ,
         EMBED,
         SOFT_MAX_LOSS_GRAD,
         BORDER,
@@ -70,7 +71,8 @@ namespace kernel_selector
 
         CONTRACT,
         ONE_HOT,
- 		DETECTION_OUTPUT    
+ 		DETECTION_OUTPUT,
+        CONDITION,
 	};
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -280,6 +282,16 @@ namespace kernel_selector
         OUTPUT_BUFFER
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FusedOpType
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class FusedOpType
+    {
+        ACTIVATION, // res = ACTIVATION(res)
+        SCALE,      // res = res * input0 (+ input1)
+        ELTWISE,    // res = res <mode> input0
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // SoftmaxDim
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -435,4 +447,14 @@ namespace kernel_selector
         ANY,
         MAX,
     };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ConditionFunction
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class ConditionFunction
+    {
+        EQUAL,
+        GREATER,
+        LESS,
+    };
 }
@@ -99,6 +99,10 @@ namespace kernel_selector
 
         auto runInfo = SetDefault(newParams);
         auto cldnn_jit = GetJitConstants(newParams, runInfo);
+        std::vector<std::pair<std::string, DataTensor>> extraTensors;
+        if (!newParams.inputActivationParams.empty())
+            extraTensors.push_back({ "ADDITIONAL_PARAMS", newParams.inputActivationParams[0] });
+        auto shapeInfo = MakeShapeAgnosticJitConstants(cldnn_jit, newParams, options, extraTensors);
         auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
         auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
         
@@ -113,6 +117,8 @@ namespace kernel_selector
             kernel.arguments.push_back({ ArgumentDescriptor::Types::SLOPE, 0 });
         }
 
+        AddShapeInfoArguments(kernel, shapeInfo);
+
         kd.estimatedTime = runInfo.effiency;
 
         return{ kd };
@@ -35,11 +35,25 @@ namespace kernel_selector {
         k.EnableTensorPitches();
         k.EnableBatching();
         k.EnableGradient();
+        k.EnableShapeAgnostic();
         return k;
     }
 
     KernelsData ActivationKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options);
+        KernelsData kds = GetCommonKernelsData(params, options);
+        for (auto& kd : kds)
+        {
+            const auto& out = static_cast<const activation_params&>(params).output;
+            AddRuntimeBatchArgument(kd.kernels[0], out.GetLayout() == DataLayout::yxfb ? 0 : 2);
+        }
+        return kds;
+    }
+
+    JitConstants ActivationKernelRef::GetJitConstants(const activation_params& params, DispatchData kd) const
+    {
+        auto jit = ActivationKernelBase::GetJitConstants(params, kd);
+        AddRuntimeBatchJitConstants(jit);
+        return jit;
     }
 }
\ No newline at end of file
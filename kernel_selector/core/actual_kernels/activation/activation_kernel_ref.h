@@ -28,5 +28,8 @@ namespace kernel_selector
 
         virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
         virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        virtual JitConstants GetJitConstants(const activation_params& params, DispatchData kd) const override;
     };
 }
\ No newline at end of file
@@ -129,6 +129,7 @@ namespace kernel_selector
             auto& kernel = kd.kernels[i];
             DispatchData runInfo = SetDefault(newParams);
             auto cldnnJit = GetJitConstants(newParams);
+            auto shapeInfo = MakeShapeAgnosticJitConstants(cldnnJit, newParams, options);
             auto entryPoint = GetEntryPoint(kernelName, newParams.layerID, options);
             auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
 
@@ -143,6 +144,7 @@ namespace kernel_selector
             s.v.u32 = lastOffset;
             kernel.scalars.push_back(s);
             kernel.arguments.push_back({ ArgumentDescriptor::Types::SCALAR, 0 });
+            AddShapeInfoArguments(kernel, shapeInfo);
 
             lastOffset += (uint32_t)input.GetDims()[concatChannelIndex].v;
             effiency = std::max(effiency, runInfo.effiency);
@@ -55,6 +55,7 @@ namespace kernel_selector
         k.EnableConcatAxis(ConcatAxis::FEATURE);
         k.EnableConcatAxis(ConcatAxis::BATCH);
         k.EnableConcatKernelPerInput();
+        k.EnableShapeAgnostic();
         return k;
     }
 
@@ -0,0 +1,102 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "condition_kernel_base.h"
+
+#include "kernel_selector_utils.h"
+
+#include <algorithm>
+
+
+namespace kernel_selector
+{
+    bool ConditionKernelBase::Validate(const Params& p, const optional_params& o) const
+    {
+        if (p.GetType() != KernelType::CONDITION ||
+            o.GetType() != KernelType::CONDITION)
+        {
+            return false;
+        }
+
+        const condition_params& params = static_cast<const condition_params&>(p);
+
+        if (params.inputs.size() != 2 || params.output.LogicalSize() != 1)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    JitConstants ConditionKernelBase::GetJitConstants(const condition_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        jit.AddConstant(MakeJitConstant("OFFSET", params.offset));
+
+        switch (params.function)
+        {
+        case ConditionFunction::EQUAL:
+            jit.AddConstant(MakeJitConstant("CONDITION(a, b)", "((a) == (b))"));
+            break;
+        case ConditionFunction::GREATER:
+            jit.AddConstant(MakeJitConstant("CONDITION(a, b)", "((a) > (b))"));
+            break;
+        case ConditionFunction::LESS:
+            jit.AddConstant(MakeJitConstant("CONDITION(a, b)", "((a) < (b))"));
+            break;
+        }
+
+        return jit;
+    }
+
+    ConditionKernelBase::DispatchData ConditionKernelBase::SetDefault(const condition_params& params)
+    {
+        DispatchData kd;
+
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        // all compared elements are reduced to the flag within a single work group
+        const size_t max_lws = std::min<size_t>(256, params.engineInfo.maxWorkGroupSize);
+        kd.gws0 = kd.lws0 = std::max<size_t>(1, std::min(params.inputs[1].LogicalSize(), max_lws));
+        kd.gws1 = kd.lws1 = 1;
+        kd.gws2 = kd.lws2 = 1;
+
+        return kd;
+    }
+
+    KernelsData ConditionKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const auto& prim_params = static_cast<const condition_params&>(params); // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+
+        auto run_info = SetDefault(prim_params);
+        KernelData k_data = KernelData::Default<condition_params>(params);
+
+        auto cldnn_jit = GetJitConstants(prim_params);
+        auto entry_point = GetEntryPoint(kernelName, prim_params.layerID, options);
+        auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        auto& kernel = k_data.kernels[0];
+        FillCLKernelData(kernel, run_info, params.engineInfo, kernelName, jit, entry_point, DEFAULT, false, false, 2);
+        k_data.estimatedTime = estimated_time;
+
+        return{ k_data };
+    }
+}
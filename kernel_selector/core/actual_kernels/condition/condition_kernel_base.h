@@ -0,0 +1,65 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // condition_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // inputs[0] is compared with inputs[1] placed at offset, output is a single int flag set to 1 when the condition
+    // holds for all compared elements.
+    struct condition_params : public base_params
+    {
+        condition_params()
+            : base_params(KernelType::CONDITION)
+        {
+        }
+        ConditionFunction function = ConditionFunction::EQUAL;
+        DimTensor<uint32_t> offset;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // condition_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct condition_optional_params : optional_params
+    {
+        condition_optional_params()
+            : optional_params(KernelType::CONDITION)
+        {
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ConditionKernelBase
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class ConditionKernelBase : public common_kernel_base
+    {
+    public:
+        using common_kernel_base::common_kernel_base;
+
+        using DispatchData = CommonDispatchData;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        JitConstants GetJitConstants(const condition_params& params) const;
+        static DispatchData SetDefault(const condition_params& params);
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params&, float estimated_time) const;
+    };
+}
@@ -254,6 +254,11 @@ namespace kernel_selector
         return jit;
     }
 
+    float ConvolutionKernel_MMAD_blocks::EstimateTime(const Params& params, const optional_params& options) const
+    {
+        return Parent::EstimateTime(params, options) == NOT_SUPPORTED ? NOT_SUPPORTED : FORCE_PRIORITY_2;
+    }
+
     KernelsData ConvolutionKernel_MMAD_blocks::GetKernelsData(const Params& params, const optional_params& options) const
     {
         KernelsData kd = GetTunedKernelsDataByIndex(params, options);
@@ -276,6 +276,7 @@ namespace kernel_selector
         auto& kernel = kd.kernels[0];
         FillCLKernelData(kernel, runInfo, params.engineInfo, finalKernelName, jit, entryPoint, exeMode, true, !newParams.bias.empty(), 1, newParams.int8_quantization, newParams.output_calibration);
         kernel.arguments.push_back({ ArgumentDescriptor::Types::SPLIT, 0 });
+        AddFusedOpsArguments(kernel.arguments, newParams);
 
         kd.estimatedTime = runInfo.effiency;
         kd.autoTuneIndex = autoTuneIndex;
@@ -283,6 +284,35 @@ namespace kernel_selector
         return{ kd };
     }
 
+    float ConvolutionKernelBase::EstimateTime(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return NOT_SUPPORTED;
+        }
+
+        // same dispatch data as in GetCommonKernelsData()
+        const auto& orgParams = static_cast<const convolution_params&>(params);
+        DispatchData runInfo;
+        if (NeedPaddedInput())
+        {
+            convolution_params newParams = orgParams;
+            CovolutionUpdateInputParams(newParams);
+            runInfo = SetDefault(newParams);
+        }
+        else
+        {
+            runInfo = SetDefault(orgParams);
+        }
+
+        if (!CheckWorkGroups(runInfo))
+        {
+            return NOT_SUPPORTED;
+        }
+
+        return runInfo.effiency;
+    }
+
     bool CheckConvolutionPaddedInputDesc(const convolution_params& params, const DataTensor& reqDesc)
     {
         assert(params.inputs.size() == 1);
@@ -162,6 +162,11 @@ namespace kernel_selector
             return{ WeightsLayout::yxio };
     }
 
+    float convolution_kernel_bfyx_1x1_opt::EstimateTime(const Params& params, const optional_params& options) const
+    {
+        return Parent::EstimateTime(params, options) == NOT_SUPPORTED ? NOT_SUPPORTED : FORCE_PRIORITY_1;
+    }
+
     KernelsData convolution_kernel_bfyx_1x1_opt::GetKernelsData(const Params& params, const optional_params& options) const
     {
         KernelsData kd = GetCommonKernelsData(params, options);
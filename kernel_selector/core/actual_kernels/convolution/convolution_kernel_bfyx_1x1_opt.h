@@ -28,6 +28,7 @@ namespace kernel_selector {
         virtual ~convolution_kernel_bfyx_1x1_opt() {}
 
         virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual float EstimateTime(const Params& params, const optional_params& options) const override;
         virtual ParamsKey GetSupportedKey() const override;
     
     protected:
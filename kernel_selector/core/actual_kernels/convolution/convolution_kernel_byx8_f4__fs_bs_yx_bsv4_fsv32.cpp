@@ -87,6 +87,11 @@ namespace kernel_selector {
         return jits;
     }
 
+    float ConvolutionKernel_byx8_f4__fs_bs_yx_bsv4_fsv32::EstimateTime(const Params& params, const optional_params& options) const
+    {
+        return Parent::EstimateTime(params, options) == NOT_SUPPORTED ? NOT_SUPPORTED : FORCE_PRIORITY_3;
+    }
+
     KernelsData ConvolutionKernel_byx8_f4__fs_bs_yx_bsv4_fsv32::GetKernelsData(const Params& params, const optional_params& options) const
     {
         KernelsData kd = GetCommonKernelsData(params, options, " -Dcl_intel_subgroups_char");
@@ -28,6 +28,7 @@ namespace kernel_selector {
         virtual ~ConvolutionKernel_byx8_f4__fs_bs_yx_bsv4_fsv32() {}
 
         virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual float EstimateTime(const Params& params, const optional_params& options) const override;
         virtual ParamsKey GetSupportedKey() const override;
 
     protected:
@@ -57,6 +57,11 @@ namespace kernel_selector {
         return true;
     }
 
+    float ConvolutionKernel_byxf_af32_depthiwise::EstimateTime(const Params& params, const optional_params& options) const
+    {
+        return Parent::EstimateTime(params, options) == NOT_SUPPORTED ? NOT_SUPPORTED : FORCE_PRIORITY_3;
+    }
+
     KernelsData ConvolutionKernel_byxf_af32_depthiwise::GetKernelsData(const Params& params, const optional_params& options) const
     {
         KernelsData kd = GetTunedKernelsDataByIndex(params, options);
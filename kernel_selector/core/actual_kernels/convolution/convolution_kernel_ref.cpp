@@ -56,12 +56,19 @@ namespace kernel_selector {
         k.DisableTuning();
         k.EnableLocalConvolution();
         k.EnableGroupedConvolution();
+        k.EnableFusedOps();
         return k;
     }
 
     KernelsData ConvolutionKernel_Ref::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetTunedKernelsDataByIndex(params, options);
+        KernelsData kds = GetTunedKernelsDataByIndex(params, options);
+        for (auto& kd : kds)
+        {
+            // the third dimension is feature * batch, see SetDefault
+            AddRuntimeBatchArgument(kd.kernels[0], 2);
+        }
+        return kds;
     }
     JitConstants
     ConvolutionKernel_Ref::GetJitConstants(const convolution_params& params,
@@ -90,6 +97,8 @@ namespace kernel_selector {
             && params.bias[0].GetDType() == Datatype::F32)
             jit.AddConstant(MakeJitConstant("DONT_DEQUANTIZE_BIAS", "1"));
 
+        AddRuntimeBatchJitConstants(jit);
+
         return jit;
     }
     ConvolutionKernelBase::DispatchData
@@ -130,6 +139,13 @@ namespace kernel_selector {
         auto input_type = conv_params.inputs[0].GetDType();
         auto output_type = conv_params.output.GetDType();
 
+        // Fused ops are indexed by the output feature, which is split-relative
+        // for split and grouped convolutions.
+        if (!conv_params.fused_ops.empty() &&
+            (conv_params.int8_quantization || conv_params.output_calibration || input_type != output_type ||
+             conv_params.split > 1 || conv_params.groups > 1 || conv_params.depthwise_separable_opt))
+            return false;
+
         // The only supported u8 input is the one with quantization, would
         // require some additional checks.
 
@@ -183,7 +183,7 @@ namespace kernel_selector
         }
 
         jit.AddConstant(MakeJitConstant("INPUTS_DECLS", inputs_decls));
-        jit.AddConstant(MakeJitConstant("ELTWISE_NO_PITCH_SAME_DIMS", CheckInputsOutputNoPitchSameDims(params)));
+        jit.AddConstant(MakeJitConstant("ELTWISE_NO_PITCH_SAME_DIMS", !params.layoutBased && CheckInputsOutputNoPitchSameDims(params)));
 
         if (useVload8)
             jit.AddConstant(MakeJitConstant("VLOAD_DECLS", vload_decls));
@@ -452,8 +452,15 @@ namespace kernel_selector
         KernelData kd = KernelData::Default<eltwise_params>(params);
         eltwise_params& newParams = *static_cast<eltwise_params*>(kd.params.get());
 
+        // fused ops need logical output coordinates
+        if (!newParams.fused_ops.empty())
+        {
+            newParams.layoutBased = true;
+        }
+
         auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
         auto cldnn_jit = GetJitConstants(newParams);
+        auto shapeInfo = MakeShapeAgnosticJitConstants(cldnn_jit, newParams, options);
         std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
 
         DispatchData runInfo = SetDefault(newParams);
@@ -465,6 +472,8 @@ namespace kernel_selector
 
         kernel.kernelString = GetKernelString(kernelName, jit, entry_point, params.engineInfo, DEFAULT);
         kernel.arguments = GetArgsDesc((uint32_t)newParams.inputs.size(), false, false, newParams.int8_quantization, newParams.output_calibration);
+        AddFusedOpsArguments(kernel.arguments, newParams);
+        AddShapeInfoArguments(kernel, shapeInfo);
 
         kd.estimatedTime = DONT_USE_IF_HAVE_SOMETHING_ELSE;
 
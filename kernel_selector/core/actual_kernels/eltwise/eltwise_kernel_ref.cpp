@@ -42,6 +42,8 @@ namespace kernel_selector {
         k.EnableOutputCalibration();
         k.EnableEltwiseStride();
         k.EnableEltwiseBroadcast();
+        k.EnableFusedOps();
+        k.EnableShapeAgnostic();
         return k;
     }
 
@@ -64,6 +66,11 @@ namespace kernel_selector {
             params.output.GetLayout() == DataLayout::fs_b_yx_fsv32)
             return false;
 
+        // fused ops are applied in the layout based 2D path only
+        if (!params.fused_ops.empty() &&
+            (params.int8_quantization || params.output.GetLayout() == DataLayout::bfzyx))
+            return false;
+
         return true;
     }
 
@@ -123,6 +123,7 @@ namespace kernel_selector
 
         auto& kernel = kd.kernels[0];
         FillCLKernelData(kernel, *runInfo.get(), params.engineInfo, kernelName, jit, entry_point, exeMode, true, !orgParams.bias.empty(), 1, newParams.int8_quantization, newParams.output_calibration);
+        AddFusedOpsArguments(kernel.arguments, newParams);
 
         kd.estimatedTime = estimated_time;
         kd.autoTuneIndex = autoTuneIndex;
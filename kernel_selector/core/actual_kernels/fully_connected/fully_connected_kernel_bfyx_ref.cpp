@@ -43,6 +43,7 @@ namespace kernel_selector
         k.EnableBatching();
         k.EnableInt8Quantization();
         k.EnableOutputCalibration();
+        k.EnableFusedOps();
         return k;
     }
 
@@ -64,6 +65,13 @@ namespace kernel_selector
         return std::move(runInfo);
     }
 
+    JitConstants FullyConnected_bfyx_Ref::GetJitConstants(const fully_connected_params& params, const DispatchData& kd) const
+    {
+        auto jit = Parent::GetJitConstants(params, kd);
+        AddRuntimeBatchJitConstants(jit);
+        return jit;
+    }
+
     KernelsData FullyConnected_bfyx_Ref::GetKernelsData(const Params& params, const optional_params& options) const
     {
         KernelsData res = {};
@@ -74,6 +82,8 @@ namespace kernel_selector
                 DONT_USE_IF_HAVE_SOMETHING_ELSE, (int)i);
             if (!kd.empty())
             {
+                // the second dimension is batch, see SetDefault
+                AddRuntimeBatchArgument(kd[0].kernels[0], 1);
                 res.emplace_back(kd[0]);
             }
         }
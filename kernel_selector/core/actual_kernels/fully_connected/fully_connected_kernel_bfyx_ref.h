@@ -32,5 +32,6 @@ namespace kernel_selector {
         
     protected:
         std::unique_ptr<DispatchData> SetDefault(const fully_connected_params& params, int autoTuneIndex = -1) const override;
+        JitConstants GetJitConstants(const fully_connected_params& params, const DispatchData& kd) const override;
     };
 }
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "lstm_seq_kernel_base.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+#include <algorithm>
+
+namespace kernel_selector
+{
+    JitConstants LSTMSeqKernelBase::GetJitConstants(const lstm_seq_params& params, size_t lws) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        jit.AddConstants({
+            MakeJitConstant("WEIGHTS", params.weights),
+            MakeJitConstant("RECURRENT", params.recurrent),
+            MakeJitConstant("LWS", lws),
+        });
+        if (params.hasBias) {
+            jit.AddConstants({ MakeJitConstant("BIAS", params.bias), MakeJitConstant("BIAS_TERM", true) });
+        }
+        if (params.hasHidden) {
+            jit.AddConstants({ MakeJitConstant("HIDDEN", params.hidden), MakeJitConstant("HIDDEN_TERM", true) });
+        }
+        if (params.hasCell) {
+            jit.AddConstants({ MakeJitConstant("CELL", params.cell), MakeJitConstant("CELL_TERM", true) });
+        }
+        if (params.clip > 0) {
+            std::string psclip = toCodeString(params.clip);
+            std::string nsclip = toCodeString(-params.clip);
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "((x > " + psclip + ") ? " +
+                psclip + ": (x < " + nsclip + ") ? " + nsclip + " : (x))") });
+        }
+        else {
+            jit.AddConstants({ MakeJitConstant("CLIP(x)", "(x)") });
+        }
+        if (params.input_forget) {
+            jit.AddConstants({ MakeJitConstant("INPUT_FORGET", true) });
+        }
+        if (params.output_sequence) {
+            jit.AddConstants({ MakeJitConstant("OUTPUT_SEQUENCE", true) });
+        }
+        if (params.output_cell) {
+            jit.AddConstants({ MakeJitConstant("OUTPUT_CELL", true) });
+        }
+
+        size_t size = params.output.X().v;
+        jit.AddConstants({
+            MakeJitConstant("GEMM_OFFSET_I", params.GetOffsetIndexI() * size),
+            MakeJitConstant("GEMM_OFFSET_O", params.GetOffsetIndexO() * size),
+            MakeJitConstant("GEMM_OFFSET_F", params.GetOffsetIndexF() * size),
+            MakeJitConstant("GEMM_OFFSET_Z", params.GetOffsetIndexZ() * size),
+        });
+        return jit;
+    }
+
+    KernelsData LSTMSeqKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const lstm_seq_params& orgParams = static_cast<const lstm_seq_params&>(params);
+
+        KernelData kd = KernelData::Default<lstm_seq_params>(params, orgParams.inputs.size());
+
+        float effiency = FORCE_PRIORITY_9;
+        const auto& out = orgParams.output;
+        const size_t directions = orgParams.weights.Feature().v;
+
+        size_t lws = out.X().v;
+        if (params.engineInfo.maxWorkGroupSize > 0)
+        {
+            lws = std::min(lws, static_cast<size_t>(params.engineInfo.maxWorkGroupSize));
+        }
+
+        auto& kernel = kd.kernels[0];
+        auto cldnnJit = GetJitConstants(orgParams, lws);
+        auto entryPoint = GetEntryPoint(kernelName, orgParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
+
+        kernel.workGroups.global = { lws, out.Batch().v, directions };
+        kernel.workGroups.local = { lws, 1, 1 };
+        kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, params.engineInfo);
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::OUTPUT, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::WEIGHTS, 0 });
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::RECURRENT, 0 });
+        if (orgParams.hasBias) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::BIAS, 0 });
+        }
+        if (orgParams.hasHidden) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::HIDDEN, 0 });
+        }
+        if (orgParams.hasCell) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::CELL, 0 });
+        }
+
+        kd.estimatedTime = effiency;
+
+        return{ kd };
+    }
+}
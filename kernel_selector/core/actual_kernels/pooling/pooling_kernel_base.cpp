@@ -126,6 +126,10 @@ namespace kernel_selector
         KernelData kd = KernelData::Default<pooling_params>(params);
 
         auto cldnn_jit = GetJitConstants(orgParams, runInfo);
+        auto shapeInfo = MakeShapeAgnosticJitConstants(cldnn_jit, orgParams, options);
+        // whether the boundary has to be checked depends on the shapes
+        if (!shapeInfo.empty() && !runInfo.needsBoundary)
+            cldnn_jit.AddConstant(MakeJitConstant("CHECK_BOUNDRY", 1));
         auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
         auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
 
@@ -133,6 +137,7 @@ namespace kernel_selector
         FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
         if(orgParams.poolType == PoolType::MAX_WITH_ARGMAX)
             kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 1 });
+        AddShapeInfoArguments(kernel, shapeInfo);
 
         kd.estimatedTime = estimatedTime;
 
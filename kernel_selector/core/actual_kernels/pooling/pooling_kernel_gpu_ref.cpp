@@ -45,6 +45,7 @@ namespace kernel_selector
         k.EnablePoolKernelDividerMode(KernelDividerMode::DYNAMIC);
         k.EnablePoolKernelDividerMode(KernelDividerMode::DYNAMIC_WITH_PADDING);
         k.EnableDifferentTypes();
+        k.EnableShapeAgnostic();
         return k;
     }
 
@@ -40,6 +40,7 @@ namespace kernel_selector
         k.EnableTensorOffset();
         k.EnableTensorPitches();
         k.EnableBatching();
+        k.EnableShapeAgnostic();
         return k;
     }
 
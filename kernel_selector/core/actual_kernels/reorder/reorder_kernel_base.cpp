@@ -212,6 +212,10 @@ namespace kernel_selector
 
         auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
         auto cldnn_jit = GetJitConstants(newParams);
+        std::vector<std::pair<std::string, DataTensor>> extraTensors;
+        if (newParams.mode == MeanSubtractMode::IN_BUFFER)
+            extraTensors.push_back({ "MEAN_SUBTRACT", newParams.mean });
+        auto shapeInfo = MakeShapeAgnosticJitConstants(cldnn_jit, newParams, options, extraTensors);
         std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
 
         auto& kernel = kd.kernels[0];
@@ -223,6 +227,7 @@ namespace kernel_selector
         {
             kernel.arguments.push_back({ ArgumentDescriptor::Types::BIAS, 0 });
         }
+        AddShapeInfoArguments(kernel, shapeInfo);
 
         kd.estimatedTime = estimated_time;
 
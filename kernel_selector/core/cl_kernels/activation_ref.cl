@@ -29,6 +29,12 @@ KERNEL(activation)(
 #endif
 #ifdef PARAMETERIZED 
     , __global ADDITIONAL_PARAMS_TYPE* params
+#endif
+#ifdef SHAPE_INFO_ARGS
+    SHAPE_INFO_ARGS
+#endif
+#ifdef RUNTIME_BATCH_ARG
+    RUNTIME_BATCH_ARG
 #endif
     )
 {
@@ -36,37 +42,26 @@ KERNEL(activation)(
     const unsigned x = get_global_id(0);
     const uint y = get_global_id(1) % OUTPUT_SIZE_Y;
     const uint z = get_global_id(1) / OUTPUT_SIZE_Y;
-#if OUTPUT_BATCH_NUM == 1
-    const unsigned feature = get_global_id(2);
-    const unsigned batch = 0;
-#else
     const unsigned feature = get_global_id(2) % OUTPUT_FEATURE_NUM;
     const unsigned batch = get_global_id(2) / OUTPUT_FEATURE_NUM;
-#endif
 #else
 #if defined OUTPUT_LAYOUT_YXFB
     const unsigned x = get_global_id(1);
     const unsigned y = get_global_id(2);
 #define z 0
-#if OUTPUT_BATCH_NUM == 1
-    const unsigned feature = get_global_id(0);
-    const unsigned batch = 0;
-#else
     const unsigned feature = get_global_id(0) % OUTPUT_FEATURE_NUM;
     const unsigned batch = get_global_id(0) / OUTPUT_FEATURE_NUM;
-#endif
 #else
 #define z 0
     const unsigned x = get_global_id(0);
     const unsigned y = get_global_id(1);
-#if OUTPUT_BATCH_NUM == 1
-    const unsigned feature = get_global_id(2);
-    const unsigned batch = 0;
-#else
     const unsigned feature = get_global_id(2) % OUTPUT_FEATURE_NUM;
     const unsigned batch = get_global_id(2) / OUTPUT_FEATURE_NUM;
 #endif
 #endif
+#ifdef RUNTIME_BATCH_ARG
+    if (batch >= runtime_batch)
+        return;
 #endif
 
 #if GRADIENT
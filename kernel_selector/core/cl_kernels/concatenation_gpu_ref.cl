@@ -15,7 +15,11 @@
 
 #include "include/include_all.cl"
 
-KERNEL (concatenation_gpu_ref)(__global UNIT_TYPE* input, __global UNIT_TYPE* output, uint output_offset_in_concat_axis)
+KERNEL (concatenation_gpu_ref)(__global UNIT_TYPE* input, __global UNIT_TYPE* output, uint output_offset_in_concat_axis
+#ifdef SHAPE_INFO_ARGS
+    SHAPE_INFO_ARGS
+#endif
+    )
 {
     const uint d1 = get_global_id(0);
     const uint d2 = get_global_id(1);
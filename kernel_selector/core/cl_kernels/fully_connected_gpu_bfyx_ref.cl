@@ -27,11 +27,21 @@ KERNEL(fc)(
 #endif
 #if CALIBRATION_TERM
     ,const __global float* calibrations
+#endif
+#if HAS_FUSED_OPS
+    FUSED_OPS_DECLS
+#endif
+#ifdef RUNTIME_BATCH_ARG
+    RUNTIME_BATCH_ARG
 #endif
     )
 {
     const uint ofm = get_global_id(0);
     const uint b = get_global_id(1);
+#ifdef RUNTIME_BATCH_ARG
+    if (b >= runtime_batch)
+        return;
+#endif
 
 #if QUANTIZATION_TERM
     int dotProd = 0;
@@ -76,6 +86,10 @@ KERNEL(fc)(
 
 #if QUANTIZATION_TERM
     output[output_idx] = ACTIVATION(convert_char(dotProd), NL_M, NL_N);
+#elif HAS_FUSED_OPS
+    UNIT_TYPE res = ACTIVATION((UNIT_TYPE)dotProd, NL_M, NL_N);
+    FUSED_OPS(res, b, ofm, 0, 0);
+    output[output_idx] = res;
 #else
     output[output_idx] = ACTIVATION((UNIT_TYPE)dotProd, NL_M, NL_N);
 #endif
@@ -76,6 +76,9 @@ KERNEL(kernel_name)(
     const __global float* calibrations,
 #endif
     uint split_idx
+#if HAS_FUSED_OPS
+    FUSED_OPS_DECLS
+#endif
 #if defined(ACTIVATION_ELTW_TYPED)
 #    if IN_OUT_OPT
     // The argument is always present (in this case it would be the same as
@@ -87,6 +90,9 @@ KERNEL(kernel_name)(
 #    if ELTW_CALIBRATION_TERM
     , const __global float* eltw_output_calibrations
 #    endif
+#endif
+#ifdef RUNTIME_BATCH_ARG
+    RUNTIME_BATCH_ARG
 #endif
     )
 {
@@ -100,6 +106,10 @@ KERNEL(kernel_name)(
     const uint f = get_global_id(2) % OUTPUT_FEATURE_NUM;
     const uint b = get_global_id(2) / OUTPUT_FEATURE_NUM;
 #endif
+#ifdef RUNTIME_BATCH_ARG
+    if (b >= runtime_batch)
+        return;
+#endif
 
     ACCUMULATOR_TYPE dotProd = (ACCUMULATOR_TYPE)0;
     const int input_x = x * STRIDE_SIZE_X - PADDING_SIZE_X;
@@ -194,7 +204,12 @@ KERNEL(kernel_name)(
     const uint out_split_offset = split_idx * OUTPUT_FEATURE_PITCH * OUTPUT_FEATURE_NUM;
     const uint dst_index = GET_DATA_INDEX(OUTPUT, b, f, y, x) + out_split_offset;
 
-#if !defined(ACTIVATION_ELTW_TYPED)
+#if !defined(ACTIVATION_ELTW_TYPED) && HAS_FUSED_OPS
+    // fused ops are only enabled for non-quantized convolutions, so no saturation is needed
+    OUTPUT_TYPE res = TO_OUTPUT_TYPE(after_output_calibration);
+    FUSED_OPS(res, b, f, y, x);
+    output[dst_index] = res;
+#elif !defined(ACTIVATION_ELTW_TYPED)
     output[dst_index] = TO_OUTPUT_TYPE_SAT(after_output_calibration);
 #else
 
@@ -200,6 +200,12 @@ KERNEL(eltwise)(
     __global UNIT_TYPE* output
 #if CALIBRATION_TERM
     , const __global float* calibrations
+#endif
+#if HAS_FUSED_OPS
+    FUSED_OPS_DECLS
+#endif
+#ifdef SHAPE_INFO_ARGS
+    SHAPE_INFO_ARGS
 #endif
     )
 {
@@ -326,6 +332,11 @@ KERNEL(eltwise)(
 
 #if QUANTIZATION_TERM
     output[output_offset] = ACTIVATION(convert_char_sat(res), NL_M, NL_N);
+#elif HAS_FUSED_OPS
+    // fused ops are only enabled for the layout based 2D path, where d1..d4 are x, y, f, b
+    res = ACTIVATION(res, NL_M, NL_N);
+    FUSED_OPS(res, d4, d3, d2, d1);
+    output[output_offset] = res;
 #else
     output[output_offset] = ACTIVATION(res, NL_M, NL_N);
 #endif
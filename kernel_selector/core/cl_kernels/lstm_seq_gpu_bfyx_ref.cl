@@ -0,0 +1,152 @@
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+#define ACTIVATION_LOGISTIC(input)                      (UNIT_VAL_ONE/(UNIT_VAL_ONE + exp(-input)))
+#define ACTIVATION_HYPERBOLIC_TAN(input)                (tanh(input))
+
+#define SEQUENCE_LEN INPUT0_FEATURE_NUM
+#define STATE_SIZE  OUTPUT_SIZE_X
+
+inline ACCUMULATOR_TYPE FUNC(gate)(
+    const __global INPUT0_TYPE* input,
+    const __global WEIGHTS_TYPE* weights,
+    const __global RECURRENT_TYPE* recurrent,
+#if BIAS_TERM
+    const __global BIAS_TYPE* biases,
+#endif
+    const __local ACCUMULATOR_TYPE* hidden_state,
+    uint b, uint t, uint input_dir, uint dir, uint y)
+{
+    ACCUMULATOR_TYPE dotProd = 0;
+    for (uint x = 0; x < INPUT0_SIZE_X; ++x) {
+        dotProd += (ACCUMULATOR_TYPE)input[GET_DATA_INDEX(INPUT0, b, t, input_dir, x)] *
+                   (ACCUMULATOR_TYPE)weights[GET_DATA_INDEX(WEIGHTS, 0, dir, y, x)];
+    }
+    for (uint x = 0; x < STATE_SIZE; ++x) {
+        dotProd += hidden_state[x] * (ACCUMULATOR_TYPE)recurrent[GET_DATA_INDEX(RECURRENT, 0, dir, y, x)];
+    }
+#if BIAS_TERM
+    dotProd += (ACCUMULATOR_TYPE)biases[GET_DATA_INDEX(BIAS, 0, 0, dir, y)];
+#endif
+    return dotProd;
+}
+
+// input     = [    batch,  sequence, input_direction,      input_size ]
+// weights   = [        1, direction, 4 * hidden_size,      input_size ]
+// recurrent = [        1, direction, 4 * hidden_size,     hidden_size ]
+// biases    = [        1,         1,       direction, 4 * hidden_size ] optional
+// hidden    = [    batch,         1,       direction,     hidden_size ] optional
+// cell      = [    batch,         1,       direction,     hidden_size ] optional
+// output    = [    batch,  sequence,       direction,     hidden_size ] (+ last cell state as the last feature)
+//
+// One work-group walks the whole sequence of a single (batch, direction) pair. Hidden state is double buffered
+// in local memory, so a single barrier per timestep is enough; the cell state of an element is only touched by
+// the work-item which owns it.
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(lstm_seq)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global WEIGHTS_TYPE* weights,
+    const __global RECURRENT_TYPE* recurrent
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+#if HIDDEN_TERM
+    , const __global HIDDEN_TYPE* hidden
+#endif
+#if CELL_TERM
+    , const __global CELL_TYPE* cell
+#endif
+    )
+{
+    const uint lid = get_local_id(0);
+    const uint b = get_global_id(1);
+    const uint dir = get_global_id(2);
+    // bidirectional output of the previous layer is indexed by direction, otherwise the backward pass reads
+    // the input in reverse order
+    const uint input_dir = INPUT0_SIZE_Y > 1 ? dir : 0;
+    const bool reverse = INPUT0_SIZE_Y < 2 && dir > 0;
+#if HIDDEN_TERM
+    const uint hidden_dir = HIDDEN_SIZE_Y > 1 ? dir : 0;
+#endif
+#if CELL_TERM
+    const uint cell_dir = CELL_SIZE_Y > 1 ? dir : 0;
+#endif
+
+    __local ACCUMULATOR_TYPE hidden_state[2][STATE_SIZE];
+    __local ACCUMULATOR_TYPE cell_state[STATE_SIZE];
+
+    for (uint x = lid; x < STATE_SIZE; x += LWS) {
+#if HIDDEN_TERM
+        hidden_state[0][x] = (ACCUMULATOR_TYPE)hidden[GET_DATA_INDEX(HIDDEN, b, 0, hidden_dir, x)];
+#else
+        hidden_state[0][x] = 0;
+#endif
+#if CELL_TERM
+        cell_state[x] = (ACCUMULATOR_TYPE)cell[GET_DATA_INDEX(CELL, b, 0, cell_dir, x)];
+#else
+        cell_state[x] = 0;
+#endif
+    }
+
+    for (uint i = 0; i < SEQUENCE_LEN; ++i) {
+        const uint t = reverse ? SEQUENCE_LEN - i - 1 : i;
+        const __local ACCUMULATOR_TYPE* prev_hidden = hidden_state[i % 2];
+        __local ACCUMULATOR_TYPE* next_hidden = hidden_state[(i + 1) % 2];
+
+        // hidden state of the previous step is complete and nobody reads the buffer which is written next
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for (uint x = lid; x < STATE_SIZE; x += LWS) {
+#if BIAS_TERM
+    #define GATE(offset) FUNC_CALL(gate)(input, weights, recurrent, biases, prev_hidden, b, t, input_dir, dir, x + offset)
+#else
+    #define GATE(offset) FUNC_CALL(gate)(input, weights, recurrent, prev_hidden, b, t, input_dir, dir, x + offset)
+#endif
+            const ACCUMULATOR_TYPE it = GATE(GEMM_OFFSET_I);
+            const ACCUMULATOR_TYPE ot = GATE(GEMM_OFFSET_O);
+            const ACCUMULATOR_TYPE ft = GATE(GEMM_OFFSET_F);
+            const ACCUMULATOR_TYPE zt = GATE(GEMM_OFFSET_Z);
+    #undef GATE
+
+            ACCUMULATOR_TYPE val = ACTIVATION_LOGISTIC(CLIP(it)) * ACTIVATION_HYPERBOLIC_TAN(CLIP(zt));
+#if INPUT_FORGET
+            val *= ((ACCUMULATOR_TYPE)1 - ft);
+#endif
+            val += cell_state[x] * ACTIVATION_LOGISTIC(CLIP(ft));
+
+            const ACCUMULATOR_TYPE h = ACTIVATION_HYPERBOLIC_TAN(val) * ACTIVATION_LOGISTIC(ot);
+            cell_state[x] = val;
+            next_hidden[x] = h;
+#if OUTPUT_SEQUENCE
+            output[GET_DATA_INDEX(OUTPUT, b, i, dir, x)] = (OUTPUT_TYPE)h;
+#endif
+        }
+    }
+
+    // every work-item stores only the elements it has computed itself, no barrier needed
+    for (uint x = lid; x < STATE_SIZE; x += LWS) {
+#if !OUTPUT_SEQUENCE
+        output[GET_DATA_INDEX(OUTPUT, b, 0, dir, x)] = (OUTPUT_TYPE)hidden_state[SEQUENCE_LEN % 2][x];
+#endif
+#if OUTPUT_CELL
+        output[GET_DATA_INDEX(OUTPUT, b, OUTPUT_FEATURE_NUM - 1, dir, x)] = (OUTPUT_TYPE)cell_state[x];
+#endif
+    }
+}
+
+#undef STATE_SIZE
+#undef SEQUENCE_LEN
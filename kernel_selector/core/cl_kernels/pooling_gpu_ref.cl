@@ -37,17 +37,16 @@ KERNEL(pooling_gpu)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output
 #if MAX_WITH_ARGMAX_POOLING
 , __global float* arg_max
 #endif
+#ifdef SHAPE_INFO_ARGS
+    SHAPE_INFO_ARGS
+#endif
 )
 {
 #if OUTPUT_LAYOUT_BFYX  || OUTPUT_LAYOUT_BYXF || OUTPUT_LAYOUT_BFZYX
     const uint x    = (uint)get_global_id(0);
-#if  INPUT0_SIZE_Z == 1
-    const uint y    = (uint)get_global_id(1);
-    const uint z = 0;
-#else
+    // sizes may be kernel arguments, so 2D pooling takes the 3D path with z == 0 instead of a separate #if branch
     const uint y = get_global_id(1) % OUTPUT_SIZE_Y;
     const uint z = get_global_id(1) / OUTPUT_SIZE_Y;
-#endif
     const uint bf   = (uint)get_global_id(2);
     const uint f    = bf % INPUT0_FEATURE_NUM;
     const uint b    = bf / INPUT0_FEATURE_NUM;
@@ -88,14 +87,12 @@ KERNEL(pooling_gpu)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output
 #endif
 
     const uint batch_and_feature_offset = GET_DATA_INDEX(INPUT0, b, f, 0, 0);
-#if  INPUT0_SIZE_Z != 1  // 3D
     for(uint k = 0; k < POOL_SIZE_Z; k++)
     {
         int input_offset_z = offset_z + k;
         bool zero_z = input_offset_z >= INPUT0_SIZE_Z || input_offset_z < 0;
         if(!zero_z)
         {
-#endif
     for(uint j = 0; j < POOL_SIZE_Y; j++)
     {
         int input_offset_y = offset_y + j;
@@ -108,21 +105,13 @@ KERNEL(pooling_gpu)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output
                 bool zero = input_offset_x >= INPUT0_SIZE_X || input_offset_x < 0;
                 if(!zero)
                 {
-#if  INPUT0_SIZE_Z == 1
-                    const uint input_idx = batch_and_feature_offset + input_offset_y*INPUT0_Y_PITCH + input_offset_x*INPUT0_X_PITCH;
-#else
                     const uint input_idx = batch_and_feature_offset + input_offset_z*INPUT0_Z_PITCH + input_offset_y*INPUT0_Y_PITCH + input_offset_x*INPUT0_X_PITCH;
-#endif
 
 #if MAX_WITH_ARGMAX_POOLING
                     if(input[input_idx] > result)
                     {
-#if  INPUT0_SIZE_Z == 1
-                        const uint input_idx_bfyx_no_padding = input_offset_x + INPUT0_SIZE_X * (input_offset_y + INPUT0_SIZE_Y * (f + INPUT0_FEATURE_NUM * b));
-#else
                         const uint input_idx_bfyx_no_padding = input_offset_x + INPUT0_SIZE_X * (input_offset_y + INPUT0_SIZE_Y *
-                                                               (input_offset_z + INPUT0_SIZE_Z * (f + INPUT0_FEATURE_NUM * b));
-#endif
+                                                               (input_offset_z + INPUT0_SIZE_Z * (f + INPUT0_FEATURE_NUM * b)));
                         arg_max_idx = input_idx_bfyx_no_padding;
                     }
 #endif
@@ -135,10 +124,8 @@ KERNEL(pooling_gpu)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output
             }
         }
     }
-#if  INPUT0_SIZE_Z != 1 // 3D
         }
     }
-#endif
 #ifdef DYNAMIC_WITH_PADDING_KERNEL_DIVIDER
     const int hend = min(offset_y + POOL_SIZE_Y, INPUT0_SIZE_Y + PADDING_SIZE_Y);
     const int wend = min(offset_x + POOL_SIZE_X, INPUT0_SIZE_X + PADDING_SIZE_X);
@@ -148,11 +135,7 @@ KERNEL(pooling_gpu)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output
     uint input_idx = GET_DATA_INDEX(INPUT0, b, f, offset_y, offset_x);
 
 #if MAX_WITH_ARGMAX_POOLING
-#if  INPUT0_SIZE_Z == 1
-    uint input_idx_bfyx_no_padding = offset_x + INPUT0_SIZE_X * (offset_y + INPUT0_SIZE_Y * (f + INPUT0_FEATURE_NUM * b));
-#else
     uint input_idx_bfyx_no_padding = offset_x + INPUT0_SIZE_X * (offset_y + INPUT0_SIZE_Y * (offset_z + INPUT0_SIZE_Z *(f + INPUT0_FEATURE_NUM * b)));
-#endif
 #endif
 
     for(uint j = 0; j < POOL_SIZE_Y; j++)
@@ -88,6 +88,9 @@ KERNEL (reorder_data)(
     __global OUTPUT_REORDER_TYPE* output
 #ifdef MEAN_SUBTRACT_IN_BUFFER
     , __global MEAN_SUBTRACT_TYPE* mean_subtract
+#endif
+#ifdef SHAPE_INFO_ARGS
+    SHAPE_INFO_ARGS
 #endif
     )
 {
@@ -16,6 +16,7 @@
 
 #include "common_kernel_base.h"
 #include <iostream>
+#include <limits>
 
 #if defined __INTEL_COMPILER
 #pragma warning disable: 177
@@ -23,57 +24,6 @@
 
 namespace kernel_selector 
 {
-    namespace {
-
-        class CodeBuilder
-        {
-            std::ostringstream oss;
-            std::string code;
-            std::vector<std::string> defined_macroses;
-
-            CodeBuilder& register_macro(const std::string& name)
-            {
-                assert(std::count(defined_macroses.begin(), defined_macroses.end(), name) == 0);
-                defined_macroses.push_back(name);
-                return *this;
-            }
-
-        public:
-            CodeBuilder& set_code(const std::string& c)
-            {
-                assert(code.empty());
-                code = c;
-                return *this;
-            }
-
-            CodeBuilder& add_line(const std::string& line) {
-                oss << line << "\n";
-                return *this;
-            }
-
-            CodeBuilder& decoration_macro(const std::string& name, const std::string& prefix, const std::string& postfix, const std::string& name_prefix = std::string())
-            {
-                oss << "#define " << name << "(name) " << prefix << " " + name_prefix + "_##" + "name" << (postfix.empty() ? "" : "##_") << postfix << std::endl;
-                return register_macro(name);
-            }
-
-
-            CodeBuilder& value_macro(const std::string& name, const std::string& value)
-            {
-                oss << "#define " << name << " " << value << std::endl;
-                return register_macro(name.substr(0, name.find('(')));
-            }
-
-            std::string str()
-            {
-                std::ostringstream os;
-                os << oss.str();
-                os << code << std::endl;
-                return os.str();
-            }
-        };
-    }
-
     std::string common_kernel_base::GetEntryPoint(const std::string& templateName, const std::string& layerID, const optional_params& options) const
     {
         std::string kernelID = layerID;
@@ -93,22 +43,19 @@ namespace kernel_selector
 
     std::string common_kernel_base::CreateJit(const std::string& template_name, const JitConstants& constants, const std::string& kernel_id) const
     {
-        class CodeBuilder code;
-        code.add_line("\n//====================================================")
-            .add_line("// Kernel template: " + template_name + " ")
-            .add_line("// Kernel name: " + kernel_id)
-            .value_macro("KERNEL(name)", "__kernel void " + kernel_id)
-            .decoration_macro("FUNC", "", kernel_id)
-            .decoration_macro("FUNC_CALL", "", kernel_id);
-        
-        for (auto& definition : constants.GetDefinitions())
-        {
-            code.value_macro(definition.first, definition.second);
-        }
-
-        std::string jit = code.str();
-
-        return jit;
+        JitGenerationTimer timer;
+        JitWriter jit;
+        jit.AddLine("\n//====================================================")
+           .AddLine("// Kernel template: " + template_name + " ")
+           .AddLine("// Kernel name: " + kernel_id);
+        jit.BeginDefine().Append("KERNEL(name)").EndName().Append("__kernel void ").Append(kernel_id).EndDefine();
+        jit.BeginDefine().Append("FUNC(name)").EndName().Append(" _##name##_").Append(kernel_id).EndDefine();
+        jit.BeginDefine().Append("FUNC_CALL(name)").EndName().Append(" _##name##_").Append(kernel_id).EndDefine();
+
+        constants.Write(jit);
+        jit.Append("\n");
+
+        return jit.Release();
     }
 
     Arguments common_kernel_base::GetArgsDesc(uint32_t num_of_input, bool use_weights, bool use_bias, bool use_quantization, bool use_output_calibration) const
@@ -145,15 +92,97 @@ namespace kernel_selector
         return args;
     }
 
+    void common_kernel_base::AddFusedOpsArguments(Arguments& args, const base_params& params) const
+    {
+        uint32_t idx = 0;
+        for (const auto& op : params.fused_ops)
+        {
+            for (size_t t = 0; t < op.tensors.size(); t++)
+            {
+                args.push_back({ ArgumentDescriptor::Types::FUSED_OP_INPUT, idx++ });
+            }
+        }
+    }
+
+    Scalars common_kernel_base::MakeShapeAgnosticJitConstants(JitConstants& jit, const base_params& params, const optional_params& options,
+                                                              const std::vector<std::pair<std::string, DataTensor>>& tensors) const
+    {
+        if (!options.shapeAgnosticKernels || !GetSupportedKey().isEnabledShapeAgnostic())
+            return{};
+
+        std::vector<std::pair<std::string, DataTensor>> allTensors;
+        for (size_t i = 0; i < params.inputs.size(); i++)
+            allTensors.push_back({ "INPUT" + toCodeString(i), params.inputs[i] });
+        allTensors.push_back({ "OUTPUT", params.output });
+        allTensors.insert(allTensors.end(), tensors.begin(), tensors.end());
+
+        Scalars shapeInfo;
+        std::string args;
+        for (const auto& tensor : allTensors)
+        {
+            for (const auto& info : GetShapeInfo(tensor.second))
+            {
+                // kernels index with 32 bit integers, larger tensors keep their shapes in the code
+                if (info.second > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+                    return{};
+
+                ScalarDescriptor s;
+                s.t = ScalarDescriptor::Types::INT32;
+                s.v.s32 = static_cast<int32_t>(info.second);
+                shapeInfo.push_back(s);
+                args += ", int " + GetShapeInfoArgName(tensor.first, info.first);
+            }
+        }
+
+        // leaves room for other arguments within 1024 bytes, the minimal CL_DEVICE_MAX_PARAMETER_SIZE
+        if (shapeInfo.size() * sizeof(int32_t) > 512)
+            return{};
+
+        for (const auto& tensor : allTensors)
+        {
+            jit.RemoveConstant(tensor.first);
+            jit.AddConstant(MakeShapeAgnosticJitConstant(tensor.first, tensor.second));
+        }
+        // the name of the layer would be the only difference between the kernels of layers
+        jit.RemoveConstant("LayerID");
+        jit.AddConstant(MakeJitConstant("SHAPE_INFO_ARGS", args));
+
+        return shapeInfo;
+    }
+
+    void common_kernel_base::AddShapeInfoArguments(clKernelData& kernel, const Scalars& shapeInfo) const
+    {
+        for (const auto& s : shapeInfo)
+        {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::SCALAR, static_cast<uint32_t>(kernel.scalars.size()) });
+            kernel.scalars.push_back(s);
+        }
+    }
+
+    void common_kernel_base::AddRuntimeBatchJitConstants(JitConstants& jit) const
+    {
+        jit.AddConstant(MakeJitConstant("RUNTIME_BATCH_ARG", ", int runtime_batch"));
+    }
+
+    void common_kernel_base::AddRuntimeBatchArgument(clKernelData& kernel, int32_t batchDim) const
+    {
+        kernel.arguments.push_back({ ArgumentDescriptor::Types::RUNTIME_BATCH, 0 });
+        kernel.workGroups.batchDim = batchDim;
+    }
+
     std::shared_ptr<KernelString> common_kernel_base::GetKernelString(const std::string& name, const std::string& jit, const std::string& entry_point, const EngineInfo& engine_info, const std::string& exe_mode) const
     {
         std::shared_ptr<KernelString> kernel_string = std::make_shared<KernelString>();
 
-        auto codes = db.get(name);
+        std::vector<gpu::cache::primitive_id> shared_headers;
+        auto codes = db.get(name, shared_headers);
 
         if (codes.size())
         {
             kernel_string->str = codes[0];
+            kernel_string->str_hash = db.get_hash(name);
+            for (const auto& header : shared_headers)
+                kernel_string->headers.push_back({ header, db.get_header(header) });
             kernel_string->jit = jit;
             kernel_string->options = exe_mode + " -cl-mad-enable";
             if (engine_info.bIMMADSupport)
@@ -49,6 +49,17 @@ namespace kernel_selector
         std::string                     CreateJit(const std::string& template_name, const JitConstants& constants, const std::string& kernel_name) const;
         std::string                     GetEntryPoint(const std::string& templateName, const std::string& layerID, const optional_params& options) const;
         Arguments                       GetArgsDesc(uint32_t num_of_input, bool use_weights, bool use_bias, bool use_quantization = false, bool use_calibration = 0) const;
+        void                            AddFusedOpsArguments(Arguments& args, const base_params& params) const;
+        // Replaces JIT constants of the data tensors of params (and of the given extra tensors) by shape info arguments when
+        // shape agnostic kernels are enabled and supported, returns their values (none when the kernel is made for the shapes).
+        // Note that preprocessor conditions on the shapes see the argument names, so they evaluate to 0.
+        Scalars                         MakeShapeAgnosticJitConstants(JitConstants& jit, const base_params& params, const optional_params& options,
+                                                                      const std::vector<std::pair<std::string, DataTensor>>& tensors = {}) const;
+        void                            AddShapeInfoArguments(clKernelData& kernel, const Scalars& shapeInfo) const;
+        // Kernels which skip the work items of batches past the batch the network executes with declare RUNTIME_BATCH_ARG last
+        // in their arguments, and the global dimension enumerating the output batches as its outermost factor.
+        void                            AddRuntimeBatchJitConstants(JitConstants& jit) const;
+        void                            AddRuntimeBatchArgument(clKernelData& kernel, int32_t batchDim) const;
         std::shared_ptr<KernelString>   GetKernelString(const std::string& kernel_name, const std::string& jit, const std::string& entry_point, const EngineInfo& engine_info, const std::string& exe_mode = DEFAULT) const;
         void                            FillCLKernelData(clKernelData& kernel, const CommonDispatchData& runInfo, const EngineInfo& engine_info, const std::string& kernel_map_name, const std::string& jit, const std::string& entry_point, const std::string& exe_mode = DEFAULT,
                                                             bool weights = false, bool bias = false, int number_of_inputs = 1, bool quantization = false, bool calibration = false) const;    };
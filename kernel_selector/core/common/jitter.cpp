@@ -181,6 +181,12 @@ namespace kernel_selector {
         return definitons;
     }
 
+    void JitConstants::Write(JitWriter& writer) const
+    {
+        for (auto& constant : _constants)
+            constant->Write(writer);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // TensorBaseTJitConstant
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +221,28 @@ namespace kernel_selector {
 
             return definitions;
         }
+
+        void Write(JitWriter& writer, const Tensor::TensorBaseT<DType, Layout>& t) const
+        {
+            writer.Define(_name, "_OFFSET",         t.GetFirstElementOffset());
+            writer.Define(_name, "_VIEW_OFFSET",    t.GetViewOffset());
+            writer.Define(_name, "_LENGTH",         t.LogicalSize());
+            writer.Define(_name, "_DIMS",           t.GetDims().size());
+            writer.Define(_name, "_SIMPLE",         t.SimpleLayout());
+            writer.BeginDefine().Append(_name).Append("_LAYOUT_").Append(toString(t.GetLayout())).EndName().Append("1").EndDefine();
+
+            WriteTypeJitConstants(writer, t.GetDType(), _name);
+
+            writer.Define(_name, "_SIZE",           t.GetDims().size());
+            writer.BeginDefine().Append(_name).Append("_SIZES").EndName()
+                  .AppendVector(t.GetDims(), "size_t", KERNEL_SELECTOR_TENSOR_DIM_MAX, 1, [](const Tensor::Dim& d) { return d.v; }).EndDefine();
+            writer.BeginDefine().Append(_name).Append("_PITCHES").EndName()
+                  .AppendVector(t.GetDims(), "size_t", KERNEL_SELECTOR_TENSOR_DIM_MAX, 1, [](const Tensor::Dim& d) { return d.pitch; }).EndDefine();
+            writer.BeginDefine().Append(_name).Append("_PAD_BEFORE").EndName()
+                  .AppendVector(t.GetDims(), "size_t", KERNEL_SELECTOR_TENSOR_DIM_MAX, 0, [](const Tensor::Dim& d) { return d.pad.before; }).EndDefine();
+            writer.BeginDefine().Append(_name).Append("_PAD_AFTER").EndName()
+                  .AppendVector(t.GetDims(), "size_t", KERNEL_SELECTOR_TENSOR_DIM_MAX, 0, [](const Tensor::Dim& d) { return d.pad.after; }).EndDefine();
+        }
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -228,6 +256,7 @@ namespace kernel_selector {
         DataTensorJitConstant(const std::string& name, const DataTensor& t) : TensorBaseTJitConstant(name), _tensor(t) {}
 
         JitDefinitions GetDefinitions() const override;
+        void Write(JitWriter& writer) const override;
     };
 
     JitDefinitions DataTensorJitConstant::GetDefinitions() const
@@ -264,11 +293,137 @@ namespace kernel_selector {
         return definitions;
     }
 
+    void DataTensorJitConstant::Write(JitWriter& writer) const
+    {
+        writer.Define(_name, "_SIZE_X",                    _tensor.X().v);
+        writer.Define(_name, "_SIZE_Y",                    _tensor.Y().v);
+        writer.Define(_name, "_SIZE_Z",                    _tensor.Z().v);
+        writer.Define(_name, "_FEATURE_NUM",               _tensor.Feature().v);
+        writer.Define(_name, "_ROI_NUM",                   _tensor.ROI().v);
+        writer.Define(_name, "_BATCH_NUM",                 _tensor.Batch().v);
+        writer.Define(_name, "_X_PITCH",                   _tensor.X().pitch);
+        writer.Define(_name, "_Y_PITCH",                   _tensor.Y().pitch);
+        writer.Define(_name, "_Z_PITCH",                   _tensor.Z().pitch);
+        writer.Define(_name, "_FEATURE_PITCH",             _tensor.Feature().pitch);
+        writer.Define(_name, "_ROI_PITCH",                 _tensor.ROI().pitch);
+        writer.Define(_name, "_BATCH_PITCH",               _tensor.Batch().pitch);
+        writer.Define(_name, "_PAD_BEFORE_SIZE_X",         _tensor.X().pad.before);
+        writer.Define(_name, "_PAD_BEFORE_SIZE_Y",         _tensor.Y().pad.before);
+        writer.Define(_name, "_PAD_BEFORE_SIZE_Z",         _tensor.Z().pad.before);
+        writer.Define(_name, "_PAD_BEFORE_FEATURE_NUM",    _tensor.Feature().pad.before);
+        writer.Define(_name, "_PAD_BEFORE_BATCH_NUM",      _tensor.Batch().pad.before);
+        writer.Define(_name, "_PAD_AFTER_SIZE_X",          _tensor.X().pad.after);
+        writer.Define(_name, "_PAD_AFTER_SIZE_Y",          _tensor.Y().pad.after);
+        writer.Define(_name, "_PAD_AFTER_SIZE_Z",          _tensor.Z().pad.after);
+        writer.Define(_name, "_PAD_AFTER_FEATURE_NUM",     _tensor.Feature().pad.after);
+        writer.Define(_name, "_PAD_AFTER_BATCH_NUM",       _tensor.Batch().pad.after);
+
+        TensorBaseTJitConstant::Write(writer, _tensor);
+    }
+
     std::shared_ptr<JitConstant> MakeJitConstant(const std::string& name, const DataTensor& value)
     {
         return std::static_pointer_cast<JitConstant>(std::make_shared<DataTensorJitConstant>(name, value));
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ShapeAgnosticDataTensorJitConstant
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<std::pair<std::string, size_t>> GetShapeInfo(const DataTensor& t)
+    {
+        return {
+            { "_SIZE_X",                    t.X().v },
+            { "_SIZE_Y",                    t.Y().v },
+            { "_SIZE_Z",                    t.Z().v },
+            { "_FEATURE_NUM",               t.Feature().v },
+            { "_ROI_NUM",                   t.ROI().v },
+            { "_BATCH_NUM",                 t.Batch().v },
+            { "_X_PITCH",                   t.X().pitch },
+            { "_Y_PITCH",                   t.Y().pitch },
+            { "_Z_PITCH",                   t.Z().pitch },
+            { "_FEATURE_PITCH",             t.Feature().pitch },
+            { "_ROI_PITCH",                 t.ROI().pitch },
+            { "_BATCH_PITCH",               t.Batch().pitch },
+            { "_PAD_BEFORE_SIZE_X",         t.X().pad.before },
+            { "_PAD_BEFORE_SIZE_Y",         t.Y().pad.before },
+            { "_PAD_BEFORE_SIZE_Z",         t.Z().pad.before },
+            { "_PAD_BEFORE_FEATURE_NUM",    t.Feature().pad.before },
+            { "_PAD_BEFORE_BATCH_NUM",      t.Batch().pad.before },
+            { "_PAD_AFTER_SIZE_X",          t.X().pad.after },
+            { "_PAD_AFTER_SIZE_Y",          t.Y().pad.after },
+            { "_PAD_AFTER_SIZE_Z",          t.Z().pad.after },
+            { "_PAD_AFTER_FEATURE_NUM",     t.Feature().pad.after },
+            { "_PAD_AFTER_BATCH_NUM",       t.Batch().pad.after },
+            { "_OFFSET",                    t.GetFirstElementOffset() },
+            { "_VIEW_OFFSET",               t.GetViewOffset() },
+            { "_LENGTH",                    t.LogicalSize() },
+        };
+    }
+
+    class ShapeAgnosticDataTensorJitConstant : public JitConstant
+    {
+        const DataTensor _tensor;
+
+        // suffixes of the values of the channels, in order of DataChannelName (X, Y, FEATURE, ROI, BATCH, Z)
+        using ChannelSuffixes = std::array<const char*, 6>;
+
+        // same as toVectorString() of the dims, with the values of the dims replaced by their shape info arguments
+        std::string VectorString(const ChannelSuffixes& suffixes, size_t padFillingVal, size_t (*fetchFunc)(const Tensor::Dim&)) const
+        {
+            const auto& dims = _tensor.GetDims();
+            std::string result = "(size_t []){ ";
+            for (size_t i = 0; i < dims.size(); i++)
+            {
+                const char* suffix = nullptr;
+                for (size_t c = 0; c < suffixes.size(); c++)
+                {
+                    if (DataTensor::Channelndex(_tensor.GetLayout(), static_cast<Tensor::DataChannelName>(c)) == static_cast<int>(i))
+                        suffix = suffixes[c];
+                }
+                // ROI paddings have no jit constants, so they stay a part of the code
+                result += (suffix ? GetShapeInfoArgName(_name, suffix) : toCodeString(fetchFunc(dims[i]))) + ",";
+            }
+            for (size_t i = dims.size(); i < KERNEL_SELECTOR_TENSOR_DIM_MAX; i++)
+                result += toCodeString(padFillingVal) + ",";
+            return result + " } ";
+        }
+
+    public:
+        ShapeAgnosticDataTensorJitConstant(const std::string& name, const DataTensor& t) : JitConstant(name), _tensor(t) {}
+
+        JitDefinitions GetDefinitions() const override
+        {
+            JitDefinitions definitions;
+            for (const auto& info : GetShapeInfo(_tensor))
+                definitions.push_back({ _name + info.first, GetShapeInfoArgName(_name, info.first) });
+
+            definitions.push_back({ _name + "_DIMS",      toCodeString(_tensor.GetDims().size()) });
+            definitions.push_back({ _name + "_SIMPLE",    toCodeString(_tensor.SimpleLayout()) });
+            definitions.push_back({ _name + "_LAYOUT_" + toString(_tensor.GetLayout()), "1" });
+
+            auto type_defs = MakeTypeJitConstants(_tensor.GetDType(), _name).GetDefinitions();
+            definitions.insert(definitions.end(), type_defs.begin(), type_defs.end());
+
+            definitions.push_back({ _name + "_SIZE",       toCodeString(_tensor.GetDims().size()) });
+            definitions.push_back({ _name + "_SIZES",      VectorString({ "_SIZE_X", "_SIZE_Y", "_FEATURE_NUM", "_ROI_NUM", "_BATCH_NUM", "_SIZE_Z" },
+                                                                        1, [](const Tensor::Dim& d) { return d.v; }) });
+            definitions.push_back({ _name + "_PITCHES",    VectorString({ "_X_PITCH", "_Y_PITCH", "_FEATURE_PITCH", "_ROI_PITCH", "_BATCH_PITCH", "_Z_PITCH" },
+                                                                        1, [](const Tensor::Dim& d) { return d.pitch; }) });
+            definitions.push_back({ _name + "_PAD_BEFORE", VectorString({ "_PAD_BEFORE_SIZE_X", "_PAD_BEFORE_SIZE_Y", "_PAD_BEFORE_FEATURE_NUM", nullptr,
+                                                                          "_PAD_BEFORE_BATCH_NUM", "_PAD_BEFORE_SIZE_Z" },
+                                                                        0, [](const Tensor::Dim& d) { return d.pad.before; }) });
+            definitions.push_back({ _name + "_PAD_AFTER",  VectorString({ "_PAD_AFTER_SIZE_X", "_PAD_AFTER_SIZE_Y", "_PAD_AFTER_FEATURE_NUM", nullptr,
+                                                                          "_PAD_AFTER_BATCH_NUM", "_PAD_AFTER_SIZE_Z" },
+                                                                        0, [](const Tensor::Dim& d) { return d.pad.after; }) });
+            return definitions;
+        }
+    };
+
+    std::shared_ptr<JitConstant> MakeShapeAgnosticJitConstant(const std::string& name, const DataTensor& value)
+    {
+        return std::static_pointer_cast<JitConstant>(std::make_shared<ShapeAgnosticDataTensorJitConstant>(name, value));
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // WeightTensorJitConstant
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -280,6 +435,7 @@ namespace kernel_selector {
         WeightTensorJitConstant(const std::string& name, const WeightsTensor& t) : TensorBaseTJitConstant(name), _tensor(t) {}
 
         JitDefinitions GetDefinitions() const override;
+        void Write(JitWriter& writer) const override;
     };
 
     JitDefinitions WeightTensorJitConstant::GetDefinitions() const
@@ -304,6 +460,22 @@ namespace kernel_selector {
         return definitions;
     }
 
+    void WeightTensorJitConstant::Write(JitWriter& writer) const
+    {
+        writer.Define(_name, "_SIZE_X",        _tensor.X().v);
+        writer.Define(_name, "_SIZE_Y",        _tensor.Y().v);
+        writer.Define(_name, "_SIZE_Z",        _tensor.Z().v);
+        writer.Define(_name, "_IFM_NUM",       _tensor.IFM().v);
+        writer.Define(_name, "_OFM_NUM",       _tensor.OFM().v);
+        writer.Define(_name, "_X_PITCH",       _tensor.X().pitch);
+        writer.Define(_name, "_Y_PITCH",       _tensor.Y().pitch);
+        writer.Define(_name, "_Z_PITCH",       _tensor.Z().pitch);
+        writer.Define(_name, "_IFM_PITCH",     _tensor.IFM().pitch);
+        writer.Define(_name, "_OFM_PITCH",     _tensor.OFM().pitch);
+
+        TensorBaseTJitConstant::Write(writer, _tensor);
+    }
+
     std::shared_ptr<JitConstant> MakeJitConstant(const std::string& name, const WeightsTensor& value)
     {
         return std::static_pointer_cast<JitConstant>(std::make_shared<WeightTensorJitConstant>(name, value));
@@ -459,147 +631,110 @@ namespace kernel_selector {
         }
     }
 
-    JitConstants MakeTypeJitConstants(Datatype dataType, const std::string& macroName)
+    namespace
     {
-        std::string type;
-        std::string max_val;
-        std::string min_val;
-        std::string val_one;
-        std::string val_zero;
-        std::string to_type;
-        std::string to_type_sat;
-        std::string max_func;
-        std::string min_func;
-        std::string type_size;
-        bool is_fp;
-        switch (dataType)
+        struct TypeJitValues
         {
-        case Datatype::INT8:
-            type = "char";
-            max_val = "CHAR_MAX";
-            min_val = "CHAR_MIN";
-            val_one = "(char) 1";
-            val_zero = "(char) 0";
-            to_type = "convert_char(v)";
-            to_type_sat = "convert_char_sat(v)";
-            max_func = "max";
-            min_func = "min";
-            type_size = "1";
-            is_fp = false;
-            break;
-        case Datatype::UINT8:
-            type = "uchar";
-            max_val = "UCHAR_MAX";
-            min_val = "0";
-            val_one = "(uchar) 1";
-            val_zero = "(uchar) 0";
-            to_type = "convert_uchar(v)";
-            to_type_sat = "convert_uchar_sat(v)";
-            max_func = "max";
-            min_func = "min";
-            type_size = "1";
-            is_fp = false;
-            break;
-        case Datatype::INT32:
-            type = "int";
-            max_val = "INT_MAX";
-            min_val = "INT_MIN";
-            val_one = "(int) 1";
-            val_zero = "(int) 0";
-            to_type = "convert_int(v)";
-            to_type_sat = "convert_int_sat(v)";
-            max_func = "max";
-            min_func = "min";
-            type_size = "4";
-            is_fp = false;
-            break;
-        case Datatype::UINT32:
-            type = "uint";
-            max_val = "UINT_MAX";
-            min_val = "0";
-            val_one = "(uint) 1";
-            val_zero = "(uint) 0";
-            to_type = "convert_uint(v)";
-            to_type_sat = "convert_uint_sat(v)";
-            max_func = "max";
-            min_func = "min";
-            type_size = "4";
-            is_fp = false;
-            break;
-        case Datatype::INT64:
-            type = "long";
-            max_val = "LONG_MAX";
-            min_val = "LONG_MIN";
-            val_one = "(long) 1";
-            val_zero = "(long) 0";
-            to_type = "convert_long(v)";
-            to_type_sat = "convert_long_sat(v)";
-            max_func = "max";
-            min_func = "min";
-            type_size = "8";
-            is_fp = false;
-            break;
-        case Datatype::F16:
-            type = "half";
-            max_val = "HALF_MAX";
-            min_val = "-" + macroName + "_VAL_MAX";
-            val_one = "1.0h";
-            val_zero = "0.0h";
-            to_type = "convert_half(v)";
-            to_type_sat = "convert_half(v)";
-            max_func = "fmax";
-            min_func = "fmin";
-            type_size = "2";
-            is_fp = true;
-            break;
-        default:
-            type = "float";
-            max_val = "FLT_MAX";
-            min_val = "-" + macroName + "_VAL_MAX";
-            val_one = "1.0f";
-            val_zero = "0.0f";
-            to_type = "convert_float(v)";
-            to_type_sat = "convert_float(v)";
-            max_func = "fmax";
-            min_func = "fmin";
-            type_size = "4";
-            is_fp = true;
-            break;
+            const char* type;
+            const char* max_val;
+            const char* min_val;        // nullptr for floating point types, which use negated max value
+            const char* val_one;
+            const char* val_zero;
+            const char* to_type;
+            const char* to_type_sat;
+            const char* max_func;
+            const char* min_func;
+            const char* type_size;
+            bool is_fp;
+        };
+
+        const TypeJitValues& GetTypeJitValues(Datatype dataType)
+        {
+            static const TypeJitValues int8_values   { "char",  "CHAR_MAX",  "CHAR_MIN", "(char) 1",  "(char) 0",  "convert_char(v)",  "convert_char_sat(v)",  "max",  "min",  "1", false };
+            static const TypeJitValues uint8_values  { "uchar", "UCHAR_MAX", "0",        "(uchar) 1", "(uchar) 0", "convert_uchar(v)", "convert_uchar_sat(v)", "max",  "min",  "1", false };
+            static const TypeJitValues int32_values  { "int",   "INT_MAX",   "INT_MIN",  "(int) 1",   "(int) 0",   "convert_int(v)",   "convert_int_sat(v)",   "max",  "min",  "4", false };
+            static const TypeJitValues uint32_values { "uint",  "UINT_MAX",  "0",        "(uint) 1",  "(uint) 0",  "convert_uint(v)",  "convert_uint_sat(v)",  "max",  "min",  "4", false };
+            static const TypeJitValues int64_values  { "long",  "LONG_MAX",  "LONG_MIN", "(long) 1",  "(long) 0",  "convert_long(v)",  "convert_long_sat(v)",  "max",  "min",  "8", false };
+            static const TypeJitValues f16_values    { "half",  "HALF_MAX",  nullptr,    "1.0h",      "0.0h",      "convert_half(v)",  "convert_half(v)",      "fmax", "fmin", "2", true };
+            static const TypeJitValues f32_values    { "float", "FLT_MAX",   nullptr,    "1.0f",      "0.0f",      "convert_float(v)", "convert_float(v)",     "fmax", "fmin", "4", true };
+
+            switch (dataType)
+            {
+            case Datatype::INT8:    return int8_values;
+            case Datatype::UINT8:   return uint8_values;
+            case Datatype::INT32:   return int32_values;
+            case Datatype::UINT32:  return uint32_values;
+            case Datatype::INT64:   return int64_values;
+            case Datatype::F16:     return f16_values;
+            default:                return f32_values;
+            }
+        }
+
+        Datatype ToTypeJitDatatype(WeightsType weightsType)
+        {
+            switch (weightsType)
+            {
+            case WeightsType::UNSUPPORTED:  return Datatype::UNSUPPORTED;
+            case WeightsType::F16:          return Datatype::F16;
+            case WeightsType::F32:          return Datatype::F32;
+            case WeightsType::INT8:         return Datatype::INT8;
+            case WeightsType::UINT8:        return Datatype::UINT8;
+            }
+            assert(false || "Unreachable!");
+            // FIXME: Is there some builtin_unreachable available?
+            return Datatype::UNSUPPORTED;
         }
+    }
+
+    JitConstants MakeTypeJitConstants(Datatype dataType, const std::string& macroName)
+    {
+        const auto& values = GetTypeJitValues(dataType);
+        const std::string min_val = values.min_val ? values.min_val : "-" + macroName + "_VAL_MAX";
 
         return JitConstants
         {
-            MakeJitConstant(macroName+"_TYPE",              type),
-            MakeJitConstant(macroName+"_VAL_MAX",           max_val),
+            MakeJitConstant(macroName+"_TYPE",              values.type),
+            MakeJitConstant(macroName+"_VAL_MAX",           values.max_val),
             MakeJitConstant(macroName+"_VAL_MIN",           min_val),
-            MakeJitConstant(macroName+"_VAL_ONE",           val_one),
-            MakeJitConstant(macroName+"_VAL_ZERO",          val_zero),
-            MakeJitConstant("TO_"+macroName+"_TYPE(v)",     to_type),
-            MakeJitConstant("TO_"+macroName+"_TYPE_SAT(v)", to_type_sat),
-            MakeJitConstant(macroName+"_MAX_FUNC",          max_func),
-            MakeJitConstant(macroName+"_MIN_FUNC",          min_func),
-            MakeJitConstant(macroName + "_TYPE_SIZE",       type_size),
-            MakeJitConstant(macroName+"_IS_FP",             is_fp),
+            MakeJitConstant(macroName+"_VAL_ONE",           values.val_one),
+            MakeJitConstant(macroName+"_VAL_ZERO",          values.val_zero),
+            MakeJitConstant("TO_"+macroName+"_TYPE(v)",     values.to_type),
+            MakeJitConstant("TO_"+macroName+"_TYPE_SAT(v)", values.to_type_sat),
+            MakeJitConstant(macroName+"_MAX_FUNC",          values.max_func),
+            MakeJitConstant(macroName+"_MIN_FUNC",          values.min_func),
+            MakeJitConstant(macroName + "_TYPE_SIZE",       values.type_size),
+            MakeJitConstant(macroName+"_IS_FP",             values.is_fp),
         };
     }
+
     JitConstants MakeTypeJitConstants(WeightsType weightsType, const std::string& macroName)
     {
-      switch (weightsType)
-        {
-        case WeightsType::UNSUPPORTED:
-            return MakeTypeJitConstants(Datatype::UNSUPPORTED, macroName);
-        case WeightsType::F16:
-            return MakeTypeJitConstants(Datatype::F16, macroName);
-        case WeightsType::F32:
-            return MakeTypeJitConstants(Datatype::F32, macroName);
-        case WeightsType::INT8:
-            return MakeTypeJitConstants(Datatype::INT8, macroName);
-        case WeightsType::UINT8:
-            return MakeTypeJitConstants(Datatype::UINT8, macroName);
-        }
-        assert(false || "Unreachable!");
-        // FIXME: Is there some builtin_unreachable available?
-        return MakeTypeJitConstants(Datatype::UNSUPPORTED, macroName);
+        return MakeTypeJitConstants(ToTypeJitDatatype(weightsType), macroName);
+    }
+
+    void WriteTypeJitConstants(JitWriter& writer, Datatype dataType, const std::string& macroName)
+    {
+        const auto& values = GetTypeJitValues(dataType);
+
+        writer.Define(macroName, "_TYPE",       values.type);
+        writer.Define(macroName, "_VAL_MAX",    values.max_val);
+        if (values.min_val)
+            writer.Define(macroName, "_VAL_MIN", values.min_val);
+        else
+            writer.BeginDefine().Append(macroName).Append("_VAL_MIN").EndName().Append("-").Append(macroName).Append("_VAL_MAX").EndDefine();
+        writer.Define(macroName, "_VAL_ONE",    values.val_one);
+        writer.Define(macroName, "_VAL_ZERO",   values.val_zero);
+        writer.BeginDefine().Append("TO_").Append(macroName).Append("_TYPE(v)").EndName().Append(values.to_type).EndDefine();
+        writer.BeginDefine().Append("TO_").Append(macroName).Append("_TYPE_SAT(v)").EndName().Append(values.to_type_sat).EndDefine();
+        writer.Define(macroName, "_MAX_FUNC",   values.max_func);
+        writer.Define(macroName, "_MIN_FUNC",   values.min_func);
+        writer.Define(macroName, "_TYPE_SIZE",  values.type_size);
+        writer.Define(macroName, "_IS_FP",      values.is_fp);
+    }
+
+    void WriteTypeJitConstants(JitWriter& writer, WeightsType weightsType, const std::string& macroName)
+    {
+        WriteTypeJitConstants(writer, ToTypeJitDatatype(weightsType), macroName);
     }
 
     JitConstants MakeActivationJitConstants(const base_activation_params& params,
@@ -612,6 +747,75 @@ namespace kernel_selector {
                                 params.function, suffix, use_type_parameter)};
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // MakeFusedOpsJitConstants
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    JitConstants MakeFusedOpsJitConstants(const base_params& params)
+    {
+        JitConstants jit{ MakeJitConstant("HAS_FUSED_OPS", !params.fused_ops.empty()) };
+
+        std::string decls;
+        std::string ops;
+        for (size_t op_idx = 0; op_idx < params.fused_ops.size(); op_idx++)
+        {
+            const auto& op = params.fused_ops[op_idx];
+            const std::string op_name = "FUSED_OP" + toCodeString(op_idx);
+
+            std::vector<std::string> operands;
+            for (size_t t = 0; t < op.tensors.size(); t++)
+            {
+                const std::string tensor_name = op_name + "_INPUT" + toCodeString(t);
+                const std::string arg_name = "fused_op" + toCodeString(op_idx) + "_input" + toCodeString(t);
+                jit.AddConstant(MakeJitConstant(tensor_name, op.tensors[t]));
+                decls += ", const __global " + tensor_name + "_TYPE* " + arg_name;
+                operands.push_back(arg_name + "[GET_DATA_INDEX_SAFE(" + tensor_name + ", (b), (f), (y), (x))]");
+            }
+
+            std::string op_body;
+            switch (op.type)
+            {
+            case FusedOpType::ACTIVATION:
+                jit.Merge(MakeActivationJitConstants(op.activation, "_" + op_name));
+                op_body = "res = ACTIVATION_" + op_name + "(res, NL_M_" + op_name + ", NL_N_" + op_name + ")";
+                break;
+            case FusedOpType::SCALE:
+                if (operands.empty())
+                    throw std::runtime_error("Fused scale requires at least one operand");
+                op_body = "res = res * " + operands[0];
+                if (operands.size() > 1)
+                    op_body += " + " + operands[1];
+                break;
+            case FusedOpType::ELTWISE:
+                if (operands.size() != 1)
+                    throw std::runtime_error("Fused eltwise requires exactly one operand");
+                switch (op.mode)
+                {
+                case EltwiseMode::ADD: op_body = "res = res + " + operands[0]; break;
+                case EltwiseMode::SUB: op_body = "res = res - " + operands[0]; break;
+                case EltwiseMode::MUL: op_body = "res = res * " + operands[0]; break;
+                case EltwiseMode::DIV: op_body = "res = res / " + operands[0]; break;
+                case EltwiseMode::MIN: op_body = "res = min(res, " + operands[0] + ")"; break;
+                case EltwiseMode::MAX: op_body = "res = max(res, " + operands[0] + ")"; break;
+                default:
+                    throw std::runtime_error("Unsupported fused eltwise mode: " + toString(op.mode));
+                }
+                break;
+            default:
+                throw std::runtime_error("Unsupported fused operation");
+            }
+
+            jit.AddConstant(MakeJitConstant(op_name + "(res, b, f, y, x)", op_body));
+            ops += op_name + "(res, b, f, y, x);";
+        }
+
+        jit.AddConstants({
+            MakeJitConstant("FUSED_OPS_DECLS", decls),
+            MakeJitConstant("FUSED_OPS(res, b, f, y, x)", ops),
+        });
+
+        return jit;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // MakeLoopUnrollParamsJitConstants
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -22,6 +22,8 @@
 #include <sstream>
 #include <cmath>
 #include <algorithm>
+#include <cassert>
+#include <type_traits>
 
 
 namespace kernel_selector {
@@ -73,6 +75,108 @@ inline std::string toCodeString(bool val) { return val ? "1" : "0"; }
 std::string toCodeString(float val);
 std::string toCodeString(double val);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// JitWriter
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Writes jit "#define NAME VALUE" lines directly into a single growing buffer. Names are usually written as the name
+// of a jit constant followed by a literal suffix and integers are formatted in place, so no temporary strings are made.
+class JitWriter
+{
+    std::string _jit;
+    size_t _nameStart = 0;
+#ifndef NDEBUG
+    std::vector<std::string> _definedMacros;
+#endif
+
+    JitWriter& AppendUnsigned(uint64_t val)
+    {
+        char buffer[20];
+        char* end = buffer + sizeof(buffer);
+        char* begin = end;
+        do
+        {
+            *--begin = static_cast<char>('0' + val % 10);
+            val /= 10;
+        } while (val);
+        _jit.append(begin, end);
+        return *this;
+    }
+
+    JitWriter& AppendSigned(int64_t val)
+    {
+        if (val < 0)
+        {
+            _jit += "-";
+            return AppendUnsigned(0 - static_cast<uint64_t>(val));
+        }
+        return AppendUnsigned(static_cast<uint64_t>(val));
+    }
+
+public:
+    JitWriter() { _jit.reserve(16 * 1024); }
+
+    JitWriter& Append(const std::string& val) { _jit += val; return *this; }
+    JitWriter& Append(const char* val) { _jit += val; return *this; }
+    JitWriter& Append(bool val) { _jit += val ? "1" : "0"; return *this; }
+    JitWriter& Append(float val) { return Append(toCodeString(val)); }
+    JitWriter& Append(double val) { return Append(toCodeString(val)); }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value, JitWriter&>::type Append(T val)
+    {
+        return std::is_signed<T>::value ? AppendSigned(static_cast<int64_t>(val)) : AppendUnsigned(static_cast<uint64_t>(val));
+    }
+
+    JitWriter& AddLine(const std::string& line) { return Append(line).Append("\n"); }
+
+    // "#define " NAME " " VALUE "\n", where the name and the value are appended between the calls
+    JitWriter& BeginDefine()
+    {
+        _jit += "#define ";
+        _nameStart = _jit.size();
+        return *this;
+    }
+
+    JitWriter& EndName()
+    {
+#ifndef NDEBUG
+        const auto name = _jit.substr(_nameStart, _jit.find('(', _nameStart) - _nameStart);
+        assert(std::count(_definedMacros.begin(), _definedMacros.end(), name) == 0);
+        _definedMacros.push_back(name);
+#endif
+        return Append(" ");
+    }
+
+    JitWriter& EndDefine() { return Append("\n"); }
+
+    template <typename T>
+    JitWriter& Define(const std::string& name, const char* suffix, const T& value)
+    {
+        return BeginDefine().Append(name).Append(suffix).EndName().Append(value).EndDefine();
+    }
+
+    template <typename T>
+    JitWriter& Define(const std::string& name, const T& value)
+    {
+        return BeginDefine().Append(name).EndName().Append(value).EndDefine();
+    }
+
+    // writes the same value as toVectorString()
+    template <typename VecT, typename ValT, typename Func>
+    JitWriter& AppendVector(const VecT& vec, const char* vectorType, size_t maxDim, ValT padFillingVal, Func fetchFunc)
+    {
+        Append("(").Append(vectorType).Append(" []){ ");
+        for (size_t i = 0; i < vec.size(); i++)
+            Append(fetchFunc(vec[i])).Append(",");
+        for (size_t i = vec.size(); i < maxDim; i++)
+            Append(padFillingVal).Append(",");
+        return Append(" } ");
+    }
+
+    const std::string& str() const { return _jit; }
+    std::string Release() { return std::move(_jit); }
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // JitConstant
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,6 +205,12 @@ protected:
 public:
     std::string GetJitName() { return _name; }
     virtual JitDefinitions GetDefinitions() const = 0;
+    // writes the same definitions as GetDefinitions(), constants used by most kernels write them without temporaries
+    virtual void Write(JitWriter& writer) const
+    {
+        for (const auto& definition : GetDefinitions())
+            writer.Define(definition.first, definition.second);
+    }
     virtual ~JitConstant() {}
 };
 
@@ -116,17 +226,55 @@ public:
     {
         return JitDefinitions{ {_name, _value} };
     }
+
+    void Write(JitWriter& writer) const override
+    {
+        writer.Define(_name, _value);
+    }
+};
+
+template <typename T>
+class IntegralJitConstant : public JitConstant
+{
+    const T _value;
+
+public:
+    IntegralJitConstant(const std::string& name, T value) : JitConstant(name), _value(value) {}
+
+    JitDefinitions GetDefinitions() const override
+    {
+        return JitDefinitions{ { _name, toCodeString(_value) } };
+    }
+
+    void Write(JitWriter& writer) const override
+    {
+        writer.Define(_name, _value);
+    }
 };
 
 template<typename T>
-std::shared_ptr<JitConstant> MakeJitConstant(const std::string& name, T value) 
+typename std::enable_if<!std::is_integral<T>::value, std::shared_ptr<JitConstant>>::type MakeJitConstant(const std::string& name, T value)
 {
     return std::static_pointer_cast<JitConstant>(std::make_shared<simple_jit_constant>(name, toCodeString(value)));
 }
 
+// integers (and bools) are formatted when the jit is written
+template<typename T>
+typename std::enable_if<std::is_integral<T>::value, std::shared_ptr<JitConstant>>::type MakeJitConstant(const std::string& name, T value)
+{
+    return std::static_pointer_cast<JitConstant>(std::make_shared<IntegralJitConstant<T>>(name, value));
+}
+
 std::shared_ptr<JitConstant> MakeJitConstant(const std::string& name, const struct Tensor::DataTensor& value);
 std::shared_ptr<JitConstant> MakeJitConstant(const std::string& name, const struct Tensor::WeightsTensor& value);
 
+// Shape agnostic kernels get the shape dependent values of data tensors (sizes, pitches, paddings and offsets) as scalar
+// arguments named by GetShapeInfoArgName(), so kernels which differ only in shapes of their tensors share the same code.
+// GetShapeInfo() returns the values in the order of the arguments, as pairs of a jit constant suffix and the value.
+std::vector<std::pair<std::string, size_t>> GetShapeInfo(const struct Tensor::DataTensor& value);
+inline std::string GetShapeInfoArgName(const std::string& name, const std::string& suffix) { return "shape_" + name + suffix; }
+std::shared_ptr<JitConstant> MakeShapeAgnosticJitConstant(const std::string& name, const struct Tensor::DataTensor& value);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // VectorDataJitConstant
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -146,6 +294,13 @@ public:
         };
         return result;
     }
+
+    void Write(JitWriter& writer) const override
+    {
+        writer.Define(_name, "_SIZE", _data.size());
+        writer.BeginDefine().Append(_name).EndName()
+              .AppendVector(_data, GetTypeName<T>().c_str(), _data.size(), 1, [](const T& v) {return v; }).EndDefine();
+    }
 };
 
 template <typename T>
@@ -174,6 +329,13 @@ public:
         };
         return definitions;
     }
+
+    void Write(JitWriter& writer) const override
+    {
+        writer.Define(_name, "_SIZE_X", _size.x);
+        writer.Define(_name, "_SIZE_Y", _size.y);
+        writer.Define(_name, "_SIZE_Z", _size.z);
+    }
 };
 
 template <typename T>
@@ -205,6 +367,15 @@ public:
         };
         return definitions;
     }
+
+    void Write(JitWriter& writer) const override
+    {
+        writer.Define(_name, "_BATCH_NUM", _dims.b);
+        writer.Define(_name, "_FEATURE_NUM", _dims.f);
+        writer.Define(_name, "_SIZE_Y", _dims.y);
+        writer.Define(_name, "_SIZE_X", _dims.x);
+        writer.Define(_name, "_SIZE_Z", _dims.z);
+    }
 };
 
 template <typename T>
@@ -247,6 +418,7 @@ public:
     }
 
     JitDefinitions GetDefinitions() const;
+    void Write(JitWriter& writer) const;
 };
 
 
@@ -273,9 +445,14 @@ JitConstants MakeActivationJitConstants(const base_activation_params& params,
                                         const std::string& suffix = "",
                                         bool use_type_parameter = false);
 JitConstants MakeBaseParamsJitConstants(const base_params& params);
+// Defines FUSED_OPS_DECLS (extra kernel arguments) and FUSED_OPS(res, b, f, y, x) which applies
+// base_params::fused_ops to the value 'res' computed for the given output coordinates.
+JitConstants MakeFusedOpsJitConstants(const base_params& params);
 JitConstants MakeLoopUnrollParamsJitConstants(uint32_t loopCount);
 JitConstants MakeTypeJitConstants(Datatype dataType, const std::string& macroName);
 JitConstants MakeTypeJitConstants(WeightsType weightsType, const std::string& macroName);
+void WriteTypeJitConstants(JitWriter& writer, Datatype dataType, const std::string& macroName);
+void WriteTypeJitConstants(JitWriter& writer, WeightsType weightsType, const std::string& macroName);
 inline JitConstants MakeUnitTypeJitConstants(Datatype dataType)
 {
     return MakeTypeJitConstants(dataType, "UNIT");
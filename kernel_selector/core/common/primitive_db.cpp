@@ -16,6 +16,7 @@
 #include "primitive_db.h"
 #include <assert.h>
 #include <algorithm>
+#include <functional>
 
 #ifndef NDEBUG
 #include <fstream>
@@ -24,11 +25,76 @@
 
 namespace kernel_selector { namespace gpu { namespace cache {
 
+namespace {
+    struct header_entry
+    {
+        const char* name;
+        bool shared;
+        code source;
+    };
+
+    const std::string include_directive = "#include \"";
+}
+
 primitive_db::primitive_db() : primitives({
     #include "ks_primitive_db.inc"
-}) { }
+})
+{
+    std::vector<header_entry> entries = {
+        #include "ks_primitive_db_headers.inc"
+    };
+    for (auto& e : entries)
+        headers[e.name] = { e.shared, std::make_shared<const code>(std::move(e.source)) };
+}
+
+std::vector<code> primitive_db::get(const primitive_id& id) const
+{
+    std::set<primitive_id> included;
+    std::vector<primitive_id> shared_headers;
+    code result;
+    expand(load(id), true, included, shared_headers, result);
+    return{ std::move(result) };
+}
+
+std::vector<code> primitive_db::get(const primitive_id& id, std::vector<primitive_id>& shared_headers) const
+{
+    const auto& result = get_expanded(id);
+    shared_headers.insert(shared_headers.end(), result.shared_headers.begin(), result.shared_headers.end());
+    return{ result.source };
+}
+
+size_t primitive_db::get_hash(const primitive_id& id) const
+{
+    return get_expanded(id).hash;
+}
+
+// kernels are expanded once, as every kernel instance created by kernel selector requests the code of its kernel
+const primitive_db::expanded_code& primitive_db::get_expanded(const primitive_id& id) const
+{
+    std::lock_guard<std::mutex> lock(expanded_mutex);
+    auto it = expanded.find(id);
+    if (it == expanded.end())
+    {
+        std::set<primitive_id> included;
+        expanded_code result;
+        expand(load(id), false, included, result.shared_headers, result.source);
+        result.hash = std::hash<code>()(result.source);
+        it = expanded.emplace(id, std::move(result)).first;
+    }
+    return it->second;
+}
 
-std::vector<code> primitive_db::get(const primitive_id & id) const
+std::shared_ptr<const code> primitive_db::get_header(const primitive_id& name) const
+{
+    const auto it = headers.find(name);
+    if (it == headers.end())
+    {
+        throw std::runtime_error("cannot find the header " + name + " in primitive database.");
+    }
+    return it->second.source;
+}
+
+code primitive_db::load(const primitive_id& id) const
 {
 #ifndef NDEBUG
     {
@@ -44,7 +110,7 @@ std::vector<code> primitive_db::get(const primitive_id & id) const
             ret.resize((size_t)(end - beg));
             kernel_file.read(&ret[0], (size_t)(end - beg));
 
-            return{ std::move(ret) };
+            return ret;
         }
     }
 #endif
@@ -59,7 +125,7 @@ std::vector<code> primitive_db::get(const primitive_id & id) const
             throw std::runtime_error("cannot find the kernel " + id + " in primitive database.");
         }
 
-        return temp;
+        return temp[0];
     }
     catch (...)
     {
@@ -67,4 +133,45 @@ std::vector<code> primitive_db::get(const primitive_id & id) const
     }
 }
 
+// headers are expanded in place of their first include, as the compiler would do with include guards
+void primitive_db::expand(const code& source, bool expand_shared, std::set<primitive_id>& included, std::vector<primitive_id>& shared_headers, code& result) const
+{
+    size_t pos = 0;
+    while (pos < source.size())
+    {
+        size_t end = source.find('\n', pos);
+        end = end == std::string::npos ? source.size() : end + 1;
+
+        const size_t name_pos = pos + include_directive.size();
+        const size_t name_end = source.compare(pos, include_directive.size(), include_directive) ? std::string::npos : source.find('"', name_pos);
+        if (name_end == std::string::npos || name_end >= end)
+        {
+            result.append(source, pos, end - pos);
+        }
+        else
+        {
+            const primitive_id name = source.substr(name_pos, name_end - name_pos);
+            const auto it = headers.find(name);
+            if (it == headers.end())
+            {
+                throw std::runtime_error("cannot find the header " + name + " in primitive database.");
+            }
+
+            if (included.insert(name).second)
+            {
+                if (it->second.shared && !expand_shared)
+                {
+                    shared_headers.push_back(name);
+                }
+                else
+                {
+                    expand(*it->second.source, expand_shared, included, shared_headers, result);
+                    result += "\n";
+                }
+            }
+        }
+        pos = end;
+    }
+}
+
 } } }
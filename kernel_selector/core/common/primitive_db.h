@@ -16,6 +16,9 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <vector>
 #include <cctype>
 #include <string>
@@ -31,9 +34,34 @@ struct primitive_db
 {
     primitive_db( );
 
+    // code of the kernel with all included headers expanded
     std::vector<code> get(const primitive_id& id) const;
+    // code of the kernel with kernel specific headers expanded, includes of shared headers are removed from the code and
+    // their names are returned in shared_headers (shared headers do not depend on JIT, so they can be compiled once per program)
+    std::vector<code> get(const primitive_id& id, std::vector<primitive_id>& shared_headers) const;
+    std::shared_ptr<const code> get_header(const primitive_id& name) const;
+    // hash of the code returned by get(id, shared_headers), computed once per kernel
+    size_t get_hash(const primitive_id& id) const;
 
 private:
+    struct header
+    {
+        bool shared;
+        std::shared_ptr<const code> source;
+    };
+
+    // kernel with kernel specific headers expanded, see get(id, shared_headers)
+    struct expanded_code
+    {
+        code source;
+        std::vector<primitive_id> shared_headers;
+        size_t hash;
+    };
+
+    code load(const primitive_id& id) const;
+    const expanded_code& get_expanded(const primitive_id& id) const;
+    void expand(const code& source, bool expand_shared, std::set<primitive_id>& included, std::vector<primitive_id>& shared_headers, code& result) const;
+
     struct case_insensitive_compare {
         bool operator() (const primitive_id & lhs, const primitive_id & rhs) const {
             return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
@@ -41,6 +69,9 @@ private:
         }
     };
     std::multimap<primitive_id, code, case_insensitive_compare> primitives;
+    std::map<primitive_id, header> headers;
+    mutable std::map<primitive_id, expanded_code, case_insensitive_compare> expanded;
+    mutable std::mutex expanded_mutex;
 };
 
 } } }
@@ -3,20 +3,27 @@
 # To add new kernel please add a .cl file to kernels directory
 # the database name will be the part of the file name up to first '.' character
 # the trailing characters are a tag to allow multiple primitive implementations
+#
+# Kernels are stored with symbolic references to the headers they include (paths relative to kernels directory),
+# headers are stored once in a separate file. A header is marked as shared when it does not include other headers
+# and does not depend on JIT of a kernel (no FUNC decorated functions, conditions only on OpenCL extensions and
+# no code other than macros and typedefs), so one copy of it can be compiled with all kernels of a batched program.
 
 from __future__ import print_function
 import os
+import re
 import argparse
 import glob
 import ntpath
 
 class OpenCL2CHeaders(object):
 
-    def __init__(self, kernels_folder, out_path, out_file_name):
+    def __init__(self, kernels_folder, out_path, out_file_name, out_headers_file_name):
         self.kernels_folder = os.path.abspath(kernels_folder)
         self.out_path = os.path.abspath(out_path)
         self.out_file_name = out_file_name
-        self.include_files = {}
+        self.out_headers_file_name = out_headers_file_name
+        self.headers = {}
 
     def convert(self):
         res = '// This file is autogenerated by primitive_db_gen.py, all changes to this file will be undone\n\n'
@@ -28,38 +35,75 @@ class OpenCL2CHeaders(object):
             #except:
             #    pass
 
-        out_file_name = os.path.join(self.out_path, self.out_file_name)
-        #with open(out_file_name, 'r') as out_file:
-        #    old_content = out_file.read()
-        #if old_content != res:
-        #print('Replacing old DB')
+        headers_res = '// This file is autogenerated by primitive_db_gen.py, all changes to this file will be undone\n\n'
+        for name in sorted(self.headers):
+            headers_res += self.header_to_str(name)
+
+        self.write_file(self.out_file_name, res)
+        self.write_file(self.out_headers_file_name, headers_res)
+
+    def write_file(self, file_name, content):
+        out_file_name = os.path.join(self.out_path, file_name)
         with open(out_file_name, 'w') as out_file:
-            out_file.write(res)
+            out_file.write(content)
+
+    def header_name(self, full_path):
+        return os.path.relpath(full_path, self.kernels_folder).replace('\\', '/')
 
-    def append_file_content(self, filename, origin_file):
+    # returns file content with includes replaced by references relative to kernels folder, and the referenced headers
+    def read_file_content(self, filename):
         res = ""
-        content = []
+        includes = []
         with open(filename) as f:
-            content += f.readlines()
+            content = f.readlines()
         for line in content:
             if line.startswith('#include'):
                 include_file_name = line.strip().split('"')[1].strip()
                 full_path_include = os.path.abspath(os.path.join(os.path.dirname(filename), include_file_name))
-                if full_path_include not in self.include_files[origin_file]:
-                    self.include_files[origin_file][full_path_include] = True
-                    res += self.append_file_content(full_path_include, origin_file)
-                    res += "\n"
+                self.add_header(full_path_include)
+                name = self.header_name(full_path_include)
+                includes.append(name)
+                res += '#include "{}"\n'.format(name)
                 continue
             res += '{}\n'.format(line.rstrip())
-        return res
+        return res, includes
 
-    def cl_file_to_str(self, filename):
-        name = ntpath.basename(filename)
-        self.include_files[filename] = {}
-        #kernel_name = name[:name.find('.')]
-        kernel_name = name[:name.find('.cl')]
-        res = '{{"{}",\n(std::string) R"__krnl(\n'.format(kernel_name)
-        content = self.append_file_content(filename, filename)
+    def add_header(self, full_path):
+        name = self.header_name(full_path)
+        if name in self.headers:
+            return
+        self.headers[name] = None
+        content, includes = self.read_file_content(full_path)
+        self.headers[name] = (content, not includes and self.is_jit_independent(content))
+
+    @staticmethod
+    def is_jit_independent(content):
+        code = re.sub(r'/\*.*?\*/', '', content, flags=re.DOTALL)
+        code = re.sub(r'//[^\n]*', '', code)
+        code = re.sub(r'\\\n', ' ', code)
+        rest = ''
+        for line in code.split('\n'):
+            line = line.strip()
+            if not line.startswith('#'):
+                rest += line + '\n'
+                continue
+            directive = line[1:].split()
+            if not directive:
+                continue
+            if directive[0] in ('if', 'ifdef', 'ifndef', 'elif'):
+                names = re.findall(r'[A-Za-z_]\w*', line[1:])[1:]
+                if any(n != 'defined' and not n.startswith('cl_') for n in names):
+                    return False
+            elif directive[0] not in ('define', 'else', 'endif', 'pragma'):
+                return False
+        if re.search(r'\bFUNC(_CALL)?\b', rest):
+            return False
+        statements = [s.strip() for s in re.sub(r'\{[^{}]*\}', '', rest).split(';')]
+        return all(not s or s.startswith('typedef') for s in statements)
+
+    @staticmethod
+    def code_to_str(content):
+        res = '(std::string) R"__krnl(\n'
         max_lines = 200
 
         for i, line in enumerate(content.split('\n')):
@@ -67,20 +111,31 @@ class OpenCL2CHeaders(object):
                 res += ')__krnl"\n + R"__krnl('
             res += line + '\n'
 
-        res += ')__krnl"}},\n\n'.format(kernel_name, self.append_file_content(filename, filename))
-
+        res += ')__krnl"'
         return res
 
+    def cl_file_to_str(self, filename):
+        name = ntpath.basename(filename)
+        #kernel_name = name[:name.find('.')]
+        kernel_name = name[:name.find('.cl')]
+        content, _ = self.read_file_content(filename)
+        return '{{"{}",\n{}}},\n\n'.format(kernel_name, self.code_to_str(content))
+
+    def header_to_str(self, name):
+        content, shared = self.headers[name]
+        return '{{"{}", {},\n{}}},\n\n'.format(name, 'true' if shared else 'false', self.code_to_str(content))
+
 
 def main():
     ap = argparse.ArgumentParser()
     ap.add_argument('-kernels', required=True, metavar='PATH', help='The absolute path to OpenCL kernels folder')
     ap.add_argument('-out_path', required=True, metavar='PATH', help='The absolute path to dump file')
     ap.add_argument('-out_file_name', required=True, metavar='PATH', help='dump file name')
+    ap.add_argument('-out_headers_file_name', required=True, metavar='PATH', help='dump file name of headers included by kernels')
     args = ap.parse_args()
 
-    converter = OpenCL2CHeaders(args.kernels, args.out_path, args.out_file_name)
+    converter = OpenCL2CHeaders(args.kernels, args.out_path, args.out_file_name, args.out_headers_file_name)
     converter.convert()
 
 if __name__ == '__main__':
-    main()
\ No newline at end of file
+    main()
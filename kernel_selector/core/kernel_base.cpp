@@ -21,6 +21,12 @@ namespace kernel_selector
     const primitive_db KernelBase::db;
     size_t KernelBase::counter = 0;
 
+    std::chrono::nanoseconds& KernelBase::JitGenerationTime()
+    {
+        static thread_local std::chrono::nanoseconds time(0);
+        return time;
+    }
+
     static bool IsTypeUsedIn(Datatype type, const base_params& params)
     {
         return params.output.GetDType() == type
@@ -53,6 +59,7 @@ namespace kernel_selector
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     JitConstants KernelBase::MakeBaseParamsJitConstants(const base_params& params) const
     {
+        JitGenerationTimer timer;
         auto unitType = GetUnitType(params);
 
         JitConstants jit{
@@ -73,6 +80,11 @@ namespace kernel_selector
         jit.Merge(MakeUnitTypeJitConstants(unitType));
         jit.Merge(MakeActivationJitConstants(params.activation));
 
+        if (!params.fused_ops.empty())
+        {
+            jit.Merge(MakeFusedOpsJitConstants(params));
+        }
+
         for (size_t i = 0; i < params.inputs.size(); i++)
         {
             jit.AddConstant(MakeJitConstant("INPUT" + toCodeString(i), params.inputs[i]));
@@ -22,6 +22,8 @@
 #include "jitter.h"
 #include "primitive_db.h"
 
+#include <chrono>
+
 namespace kernel_selector 
 {
     using primitive_db = kernel_selector::gpu::cache::primitive_db;
@@ -42,12 +44,31 @@ namespace kernel_selector
             return GetKernelsData(params, options);
         }
 
+        // Time which GetKernelsData() would report, computed without generating the kernel code. Returns NOT_SUPPORTED when
+        // params are not supported and UNKNOWN_ESTIMATED_TIME when the kernel has to be generated to find out.
+        // The estimate must not be greater than the reported time, otherwise a better kernel can be skipped during selection.
+        virtual float EstimateTime(const Params& /*params*/, const optional_params& /*options*/) const { return UNKNOWN_ESTIMATED_TIME; }
+
         virtual ParamsKey GetSupportedKey() const = 0;
         virtual const std::string GetName() const { return kernelName; }
 
         static const primitive_db& get_db() { return db; }
+
+        // Time spent by the calling thread in generating JIT constants and code (MakeBaseParamsJitConstants, CreateJit),
+        // so that the kernel selector can report it apart from the rest of GetKernelsData.
+        static std::chrono::nanoseconds& JitGenerationTime();
     
     protected:
+        // adds its lifetime to JitGenerationTime()
+        class JitGenerationTimer
+        {
+        public:
+            JitGenerationTimer() : start(std::chrono::steady_clock::now()) {}
+            ~JitGenerationTimer() { JitGenerationTime() += std::chrono::steady_clock::now() - start; }
+        private:
+            std::chrono::steady_clock::time_point start;
+        };
+
         static const primitive_db db;
         const std::string kernelName;
 
@@ -17,6 +17,8 @@
 #include "kernel_base.h"
 #include "kernel_selector_common.h"
 #include "kernel_selector.h"
+#include <algorithm>
+#include <chrono>
 #include <type_traits>
 #include <sstream>
 #include <fstream>
@@ -77,6 +79,12 @@ namespace kernel_selector {
 #endif
     }
 
+    void kernel_selector_base::AddImplementation(std::shared_ptr<KernelBase> implementation)
+    {
+        implementationsIndex.Add(implementation->GetSupportedKey());
+        implementations.push_back(std::move(implementation));
+    }
+
     KernelsData kernel_selector_base::GetNaiveBestKernel(const Params& params, const optional_params& options, KernelType kType) const
     {
         KernelsData kernelsData;
@@ -86,52 +94,118 @@ namespace kernel_selector {
             options.GetType() == kType)
         {
             const ParamsKey requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
-            for (const auto& implementation : implementations)
+            size_t bestIndex = 0;
+            bool forced = false;
+
+            // generates kernels of the implementation and keeps them if they are the best so far; among kernels with
+            // the same estimated time the earliest attached implementation wins
+            auto generate = [&](size_t index)
             {
-                const ParamsKey implKey = implementation->GetSupportedKey();
-                // TODO: Unify this check with the Validate virtual method. Make
-                // sure that the method is called here only, not in all the
-                // GetKernelsData implementations.
-                if (implKey.Support(requireKey))
+                const auto& implementation = implementations[index];
+                try
                 {
-                    try
-                    {
-                        KernelsData kds = implementation->GetKernelsData(params, options);
+                    auto start = std::chrono::steady_clock::now();
+                    auto jit_start = KernelBase::JitGenerationTime();
+                    KernelsData kds = implementation->GetKernelsData(params, options);
+                    if (options.selectionObserver)
+                        options.selectionObserver->ImplementationTried(implementation->GetName(), std::chrono::steady_clock::now() - start,
+                                                                       KernelBase::JitGenerationTime() - jit_start);
 
-                        if (kds.size() && kds[0].kernels.size())
-                        {
+                    if (kds.size() && kds[0].kernels.size())
+                    {
 #ifdef ENABLE_ENV
-                            const auto& it = forceKernels.find(implementation->GetName());
-                            if (it != forceKernels.end())
+                        const auto& it = forceKernels.find(implementation->GetName());
+                        if (it != forceKernels.end())
+                        {
+                            if (it->second == true)
                             {
-                                if (it->second == true)
-                                {
-                                    ENV_PRINTF("Force: %s\n", it->first.c_str());
-                                    return kds;
-                                }
-                                else
-                                {
-                                    ENV_PRINTF("Deny: %s\n", it->first.c_str());
-                                }
+                                ENV_PRINTF("Force: %s\n", it->first.c_str());
+                                kernelsData = kds;
+                                kernelName = implementation->GetName();
+                                forced = true;
                             }
                             else
+                            {
+                                ENV_PRINTF("Deny: %s\n", it->first.c_str());
+                            }
+                        }
+                        else
 #endif
+                        {
+                            if (kernelsData.size() == 0 ||
+                                kds[0].estimatedTime < kernelsData[0].estimatedTime ||
+                                (kds[0].estimatedTime == kernelsData[0].estimatedTime && index < bestIndex))
                             {
-                                if (kernelsData.size() == 0 ||
-                                    kds[0].estimatedTime < kernelsData[0].estimatedTime)
-                                {
-                                    kernelsData = kds;
-                                    kernelName = implementation->GetName();
-                                }
+                                kernelsData = kds;
+                                kernelName = implementation->GetName();
+                                bestIndex = index;
                             }
                         }
                     }
+                }
+                catch (std::runtime_error&)
+                {
+                    // we have to handle it in order to avoid exception in KernelSelector as much we can
+                }
+            };
+
+            auto select = [&](const ParamsKey& key)
+            {
+                // Generating JIT and sources is the expensive part of the selection, so implementations which can estimate
+                // their time up front are generated in order of estimates, only as long as they can still win.
+                std::vector<std::pair<float, size_t>> estimates;
+                // TODO: Unify the supported key check with the Validate virtual method. Make
+                // sure that the method is called here only, not in all the
+                // GetKernelsData implementations.
+                for (auto i : implementationsIndex.GetSupporting(key))
+                {
+                    if (forced)
+                        break;
+
+                    float estimate = UNKNOWN_ESTIMATED_TIME;
+#ifndef ENABLE_ENV
+                    try
+                    {
+                        estimate = implementations[i]->EstimateTime(params, options);
+                    }
                     catch (std::runtime_error&)
                     {
-                        // we have to handle it in order to avoid exception in KernelSelector as much we can
+                        // the implementation reports its error (if any) when generated
                     }
+#endif
+                    if (estimate == NOT_SUPPORTED)
+                        continue;
+
+                    if (estimate == UNKNOWN_ESTIMATED_TIME)
+                        generate(i);
+                    else
+                        estimates.emplace_back(estimate, i);
+                }
+
+                std::sort(estimates.begin(), estimates.end());
+                for (const auto& estimate : estimates)
+                {
+                    // estimates are lower bounds of generated kernels times
+                    if (kernelsData.size() && std::make_pair(kernelsData[0].estimatedTime, bestIndex) < estimate)
+                        break;
+                    generate(estimate.second);
                 }
+            };
+
+            // with shape agnostic kernels enabled their implementations are preferred, so primitives which differ only
+            // in shapes share compiled kernels
+            if (options.shapeAgnosticKernels)
+            {
+                ParamsKey shapeAgnosticKey = requireKey;
+                shapeAgnosticKey.EnableShapeAgnostic();
+                select(shapeAgnosticKey);
             }
+
+            if (kernelsData.empty())
+                select(requireKey);
+
+            if (forced)
+                return kernelsData;
         }
 
         // TODO: find a better place to located this assignment 
@@ -208,10 +282,11 @@ namespace kernel_selector {
             // Start on-line tuning
             assert(options.tuningParams.runner);
 
-            for (const auto& implementation : implementations)
+            const auto supporting = implementationsIndex.GetSupporting(requireKey);
+            for (auto i : supporting)
             {
-                const ParamsKey implKey = implementation->GetSupportedKey();
-                if (implKey.Support(requireKey) && implKey.TuningSupport())
+                const auto& implementation = implementations[i];
+                if (implementation->GetSupportedKey().TuningSupport())
                 {
                     try
                     {
@@ -238,12 +313,11 @@ namespace kernel_selector {
             //try to fallback to reference kernels if no optimized were found during tuning
             if (!kernelsData.size())
             {
-                for (const auto& implementation : implementations)
+                for (auto i : supporting)
                 {
-
-                    const ParamsKey implKey = implementation->GetSupportedKey();
+                    const auto& implementation = implementations[i];
                     //this time, check only implementations that have disabled tuning
-                    if (implKey.Support(requireKey) && !implKey.TuningSupport())
+                    if (!implementation->GetSupportedKey().TuningSupport())
                     {
                         try
                         {
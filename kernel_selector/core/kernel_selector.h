@@ -39,14 +39,17 @@ namespace kernel_selector
         template<typename T>
         inline void Attach()
         {
-            implementations.push_back(std::make_shared<T>());
+            AddImplementation(std::make_shared<T>());
         }
 
+        void AddImplementation(std::shared_ptr<KernelBase> implementation);
+
         virtual KernelsData GetNaiveBestKernel(const Params& params, const optional_params& options, KernelType kType) const;
 
         virtual KernelsData GetAutoTuneBestKernel(const Params& params, const optional_params& options, KernelType kType) const;
 
         KernelList implementations;
+        ParamsKeyIndex implementationsIndex;    // supported keys of implementations
         ForceList forceKernels;
 
         static AutoTuner autoTuner;
@@ -49,6 +49,7 @@ namespace kernel_selector {
 #define DONT_USE_IF_HAVE_SOMETHING_ELSE (1000000.f)
 #define TUTORIAL_PRIORITY (DONT_USE_IF_HAVE_SOMETHING_ELSE + 1.f)
 #define NOT_SUPPORTED (FLT_MAX)
+#define UNKNOWN_ESTIMATED_TIME (-1.f)
 
     std::string GetStringEnv(const char* varName);
 
@@ -57,21 +58,34 @@ namespace kernel_selector {
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     struct KernelString
     {
+        // header which does not depend on JIT, one copy of it is compiled with all kernels of a program that include it
+        struct Header
+        {
+            std::string name;
+            std::shared_ptr<const std::string> code;
+        };
+
         std::string str;
         std::string jit;
         std::string options;
         std::string entry_point;
         bool        batch_compilation;
+        std::vector<Header> headers;    // included by str, in order of inclusion
+        size_t      str_hash;           // hash of str provided by primitive db, or 0 when not known
 
         KernelString() :
             str(""), jit(""),
             options(""), entry_point(""),
-            batch_compilation(false)
+            batch_compilation(false),
+            str_hash(0)
         {};
 
         std::string get_hash()
         {
-            return str + jit + options + entry_point;
+            std::string hash;
+            for (const auto& h : headers)
+                hash += h.name + "\n";
+            return hash + str + jit + options + entry_point;
         }
     };
 
@@ -82,6 +96,10 @@ namespace kernel_selector {
     {
         std::vector<size_t> global;
         std::vector<size_t> local;
+        // Global dimension whose work items enumerate output batches as the outermost factor (batch = id / (global / batch)),
+        // or -1. Such kernels get the RUNTIME_BATCH argument and skip the work items of batches past it, so they may be
+        // enqueued for a smaller runtime batch with this dimension shrunk (and rounded up to the local size).
+        int32_t batchDim = -1;
     private:
         WorkGroupSizes() {}
         friend struct clKernelData;
@@ -149,7 +167,9 @@ namespace kernel_selector {
             HIDDEN,    // RNN/LSTM/GRU hidden input
             CELL,      // LSTM cell input
             LSTM_PACK, // LSTM packed output
-            LEARNING_RATE
+            LEARNING_RATE,
+            FUSED_OP_INPUT, // constant operand of a fused post-operation
+            RUNTIME_BATCH   // batch the network executes with, see WorkGroupSizes::batchDim
         };
 
         enum class ScalarTypes
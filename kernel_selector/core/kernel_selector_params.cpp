@@ -17,6 +17,7 @@
 #include "kernel_selector_params.h"
 #include "kernel_selector_common.h"
 #include <sstream>
+#include <algorithm>
  
 namespace kernel_selector {
 
@@ -456,6 +457,125 @@ namespace kernel_selector {
         ret.key.weightsOutputLayout = key.weightsOutputLayout | k.key.weightsOutputLayout;
         return ret;
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ParamsKeyIndex
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        template <typename Func>
+        void ForEachBit(uint64_t bits, Func func)
+        {
+            for (size_t b = 0; bits; b++, bits >>= 1)
+            {
+                if (bits & 1)
+                    func(b);
+            }
+        }
+    }
+
+    ParamsKeyIndex::PackedKey ParamsKeyIndex::Pack(const ParamsKey& k)
+    {
+        PackedKey packed;
+        packed[RESTRICT] = k.key.restrict.raw;
+        packed[MACHINE_INFO] = k.key.machineInfo.raw;
+        packed[INPUT_TYPE] = k.key.inputType.raw;
+        packed[OUTPUT_TYPE] = k.key.outputType.raw;
+        packed[INPUT_WEIGHTS_TYPE] = k.key.inputWeightsType.raw;
+        packed[OUTPUT_WEIGHTS_TYPE] = k.key.outputWeightsType.raw;
+        packed[INPUT_LAYOUT] = k.key.inputLayout;
+        packed[OUTPUT_LAYOUT] = k.key.outputLayout;
+        packed[WEIGHTS_INPUT_LAYOUT] = k.key.weightsInputLayout;
+        packed[WEIGHTS_OUTPUT_LAYOUT] = k.key.weightsOutputLayout;
+        return packed;
+    }
+
+    void ParamsKeyIndex::Add(const ParamsKey& k)
+    {
+        const auto packed = Pack(k);
+        const size_t setWord = size / bitsPerWord;
+        const uint64_t setBit = uint64_t(1) << (size % bitsPerWord);
+
+        if (size % bitsPerWord == 0)
+        {
+            for (auto& set : keysWithBit)
+                set.push_back(0);
+            for (auto& set : keysWithEmptyWord)
+                set.push_back(0);
+        }
+
+        for (size_t w = 0; w < PACKED_WORDS_COUNT; w++)
+        {
+            if (packed[w] == 0)
+                keysWithEmptyWord[w][setWord] |= setBit;
+
+            ForEachBit(packed[w], [&](size_t b)
+            {
+                keysWithBit[w * bitsPerWord + b][setWord] |= setBit;
+            });
+        }
+
+        usedMachineInfo |= packed[MACHINE_INFO];
+        size++;
+    }
+
+    std::vector<size_t> ParamsKeyIndex::GetSupporting(const ParamsKey& k) const
+    {
+        const auto required = Pack(k);
+        const size_t setWords = (size + bitsPerWord - 1) / bitsPerWord;
+
+        KeySet candidates(setWords, ~uint64_t(0));
+        if (size % bitsPerWord)
+            candidates.back() = (uint64_t(1) << (size % bitsPerWord)) - 1;
+
+        // restrictions and data types - every required bit has to be supported by the key
+        for (auto w : { RESTRICT, INPUT_TYPE, OUTPUT_TYPE, INPUT_WEIGHTS_TYPE, OUTPUT_WEIGHTS_TYPE })
+        {
+            ForEachBit(required[w], [&](size_t b)
+            {
+                const auto& set = keysWithBit[w * bitsPerWord + b];
+                for (size_t i = 0; i < setWords; i++)
+                    candidates[i] &= set[i];
+            });
+        }
+
+        // machine info - every bit of the key has to be provided by the machine
+        ForEachBit(usedMachineInfo & ~required[MACHINE_INFO], [&](size_t b)
+        {
+            const auto& set = keysWithBit[MACHINE_INFO * bitsPerWord + b];
+            for (size_t i = 0; i < setWords; i++)
+                candidates[i] &= ~set[i];
+        });
+
+        // layouts - the key has to support any of the required layouts, or both have no layout
+        for (auto w : { INPUT_LAYOUT, OUTPUT_LAYOUT, WEIGHTS_INPUT_LAYOUT, WEIGHTS_OUTPUT_LAYOUT })
+        {
+            KeySet supporting = keysWithEmptyWord[w];
+            if (required[w] != 0)
+            {
+                std::fill(supporting.begin(), supporting.end(), 0);
+                ForEachBit(required[w], [&](size_t b)
+                {
+                    const auto& set = keysWithBit[w * bitsPerWord + b];
+                    for (size_t i = 0; i < setWords; i++)
+                        supporting[i] |= set[i];
+                });
+            }
+
+            for (size_t i = 0; i < setWords; i++)
+                candidates[i] &= supporting[i];
+        }
+
+        std::vector<size_t> result;
+        for (size_t i = 0; i < setWords; i++)
+        {
+            ForEachBit(candidates[i], [&](size_t b)
+            {
+                result.push_back(i * bitsPerWord + b);
+            });
+        }
+        return result;
+    }
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // Params
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -565,6 +685,11 @@ namespace kernel_selector {
             k.EnableGradient();
         }
 
+        if (!fused_ops.empty())
+        {
+            k.EnableFusedOps();
+        }
+
         return k;
     }
 
@@ -587,6 +712,33 @@ namespace kernel_selector {
         }
         s << toString(output);
 
+        for (const auto& op : fused_ops)
+        {
+            s << "_" << op.to_string();
+        }
+
+        return s.str();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // fused_operation_desc
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::string fused_operation_desc::to_string() const
+    {
+        std::stringstream s;
+        switch (type)
+        {
+        case FusedOpType::ACTIVATION:   s << "FUSED_ACTIVATION_" << activation.to_string(); break;
+        case FusedOpType::SCALE:        s << "FUSED_SCALE"; break;
+        case FusedOpType::ELTWISE:      s << "FUSED_ELTWISE_" << toString(mode); break;
+        default: break;
+        }
+
+        for (const auto& t : tensors)
+        {
+            s << "_" << toString(t);
+        }
+
         return s.str();
     }
 }
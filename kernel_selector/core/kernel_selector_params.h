@@ -18,6 +18,9 @@
 
 #include <string>
 #include <memory>
+#include <array>
+#include <vector>
+#include <chrono>
 #include <cstddef>
 #include "common_types.h"
 #include "tensor_type.h"
@@ -70,6 +73,8 @@ namespace kernel_selector
                     uint32_t gradient : 1;
                     uint32_t gradientOutput : 1;
                     uint32_t momentum : 1;
+                    uint32_t fusedOps : 1;
+                    uint32_t shapeAgnostic : 1;
 
                     union dedicated_t
                     {
@@ -279,6 +284,8 @@ namespace kernel_selector
         void EnableBiasPerOutput() { key.restrict.val.biasPerOutput = 1; }
         void EnableActivationAdditionalParamsAsInput() { key.restrict.val.activationAdditionalParamsAsInput = 1; }
         void EnableMomentum() { key.restrict.val.momentum = 1; }
+        void EnableFusedOps() { key.restrict.val.fusedOps = 1; }
+        void EnableShapeAgnostic() { key.restrict.val.shapeAgnostic = 1; }
         void EnableLRNMode(LRNMode m);
         void EnableLookUpTableAxis(LookUpTableAxis m);
         void EnableNormalizeMode(NormalizeMode m);
@@ -334,10 +341,58 @@ namespace kernel_selector
         bool isEnabledDifferentInputWeightsTypes() const {
             return key.restrict.val.different_input_weights_types ? true : false;
         }
+        bool isEnabledShapeAgnostic() const {
+            return key.restrict.val.shapeAgnostic ? true : false;
+        }
         ParamsKey Merge(const ParamsKey& k) const;
 
     private:
         Key key;
+
+        friend class ParamsKeyIndex;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // ParamsKeyIndex
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Finds keys which support a required key (see ParamsKey::Support) without comparing them one by one.
+    // Keys are packed into words and for every bit of a word the index keeps the set of keys having this bit,
+    // so supporting keys are an intersection of a few sets chosen by the bits of the required key.
+    class ParamsKeyIndex
+    {
+    public:
+        void Add(const ParamsKey& k);
+        size_t Size() const { return size; }
+
+        // indices of keys supporting the required key, in order of adding
+        std::vector<size_t> GetSupporting(const ParamsKey& k) const;
+
+    private:
+        enum PackedWord
+        {
+            RESTRICT,
+            MACHINE_INFO,
+            INPUT_TYPE,
+            OUTPUT_TYPE,
+            INPUT_WEIGHTS_TYPE,
+            OUTPUT_WEIGHTS_TYPE,
+            INPUT_LAYOUT,
+            OUTPUT_LAYOUT,
+            WEIGHTS_INPUT_LAYOUT,
+            WEIGHTS_OUTPUT_LAYOUT,
+            PACKED_WORDS_COUNT
+        };
+        static const size_t bitsPerWord = 64;
+
+        using PackedKey = std::array<uint64_t, PACKED_WORDS_COUNT>;
+        using KeySet = std::vector<uint64_t>;   // bit per added key
+
+        static PackedKey Pack(const ParamsKey& k);
+
+        size_t size = 0;
+        std::vector<KeySet> keysWithBit = std::vector<KeySet>(PACKED_WORDS_COUNT * bitsPerWord);
+        std::vector<KeySet> keysWithEmptyWord = std::vector<KeySet>(PACKED_WORDS_COUNT);
+        uint64_t usedMachineInfo = 0;
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -399,6 +454,21 @@ namespace kernel_selector
         virtual std::string to_string() const;
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // fused_operation_desc
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Post-operation applied by the producer kernel to its result before it is written to the output.
+    // Operations are applied in order, after the fused activation from base_params::activation.
+    struct fused_operation_desc
+    {
+        FusedOpType            type = FusedOpType::ACTIVATION;
+        base_activation_params activation;
+        EltwiseMode            mode = EltwiseMode::ADD;
+        MultiDataTensor        tensors;     // constant operands, broadcast over the output
+
+        std::string to_string() const;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // base_params
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -407,6 +477,7 @@ namespace kernel_selector
         virtual ~base_params() {}
 
         base_activation_params activation;
+        std::vector<fused_operation_desc> fused_ops;
         MultiDataTensor        inputs;
         DataTensor             output;
         bool                   gradient = false;
@@ -431,6 +502,19 @@ namespace kernel_selector
         TuningParams() : mode(TuningMode::TUNING_DISABLED), cacheFilePath(""), runner(nullptr) {}
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // KernelSelectionObserver
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class KernelSelectionObserver
+    {
+    public:
+        virtual ~KernelSelectionObserver() = default;
+
+        // called for every implementation tried by the selector, time covers its GetKernelsData and jit_time the part of it
+        // spent in generating JIT constants and code
+        virtual void ImplementationTried(const std::string& implementation, std::chrono::nanoseconds time, std::chrono::nanoseconds jit_time) = 0;
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // optional_params
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -447,8 +531,10 @@ namespace kernel_selector
         bool allowStaticInputReordering = true;     // allow kernel to provide a kernel which reorder static data like weights/bias/tables...
         bool allowInputReordering       = false;    // allow kernel to ask graph compiler to reorder the input data before executing its
         bool allowOutputReordering      = false;    // allow kernel to ask graph compiler to reorder the output data before executing the next kernel
+        bool shapeAgnosticKernels       = false;    // prefer kernels which get shapes of tensors as arguments, so they can be shared by primitives with different shapes
 
         TuningParams tuningParams;
+        std::shared_ptr<KernelSelectionObserver> selectionObserver;
 
         virtual ParamsKey GetSupportedKey() const;
     protected:
@@ -0,0 +1,1484 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Null device OpenCL library: a drop-in replacement of libOpenCL.so.1 which exposes one GPU device, accepts programs,
+// buffers, kernels and enqueues, but never executes kernels. It lets clDNN host side (graph build, kernel selection,
+// JIT, arguments setting, events management) be measured and tested on machines without a GPU.
+//
+// Buffers and images are backed by host memory, so data written by the host (weights, inputs) can be read back.
+// Kernels found in program sources (__kernel void <name>) can be created from built programs.
+// Time spent by the driver and the device is simulated with latencies read from environment variables:
+//   NULL_OCL_BUILD_US    - host time spent in every clBuildProgram call (busy wait),
+//   NULL_OCL_ENQUEUE_US  - host time spent in every enqueue call (busy wait),
+//   NULL_OCL_KERNEL_US   - device time of every NDRange kernel, commands of in-order queues are executed one by one,
+//   NULL_OCL_VENDOR_ID   - vendor id reported by the device (default: 0x8086).
+// Commands do not wait for user events which are not set yet.
+
+#pragma GCC visibility push(default)
+#include <CL/cl.h>
+#include <CL/cl_ext.h>
+#pragma GCC visibility pop
+
+#include <algorithm>
+#include <cctype>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+using clock_type = std::chrono::steady_clock;
+
+struct settings
+{
+    std::chrono::nanoseconds build_latency;
+    std::chrono::nanoseconds enqueue_latency;
+    std::chrono::nanoseconds kernel_latency;
+    cl_uint vendor_id;
+};
+
+std::chrono::nanoseconds read_latency(const char* name)
+{
+    const char* value = std::getenv(name);
+    if (value == nullptr)
+        return std::chrono::nanoseconds(0);
+    return std::chrono::nanoseconds(static_cast<int64_t>(std::strtod(value, nullptr) * 1000.0));
+}
+
+const settings& get_settings()
+{
+    static const settings instance = []
+    {
+        settings s;
+        s.build_latency = read_latency("NULL_OCL_BUILD_US");
+        s.enqueue_latency = read_latency("NULL_OCL_ENQUEUE_US");
+        s.kernel_latency = read_latency("NULL_OCL_KERNEL_US");
+        const char* vendor_id = std::getenv("NULL_OCL_VENDOR_ID");
+        s.vendor_id = vendor_id ? static_cast<cl_uint>(std::strtoul(vendor_id, nullptr, 0)) : 0x8086;
+        return s;
+    }();
+    return instance;
+}
+
+// simulates work of the driver on the calling thread
+void spend_host_time(std::chrono::nanoseconds time)
+{
+    if (time.count() <= 0)
+        return;
+
+    const auto until = clock_type::now() + time;
+    while (clock_type::now() < until)
+    {
+    }
+}
+
+cl_ulong to_device_timestamp(clock_type::time_point time)
+{
+    return static_cast<cl_ulong>(std::chrono::duration_cast<std::chrono::nanoseconds>(time.time_since_epoch()).count());
+}
+
+const char* const platform_name = "Null OpenCL Platform";
+const char* const platform_vendor = "clDNN";
+const char* const platform_version = "OpenCL 2.1 ";
+const char* const device_name = "Null OpenCL Device";
+const char* const device_version = "OpenCL 2.1 NEO ";
+const char* const driver_version = "1.0";
+const char* const device_extensions =
+    "cl_khr_3d_image_writes cl_khr_byte_addressable_store cl_khr_create_command_queue cl_khr_fp16 cl_khr_fp64 "
+    "cl_khr_global_int32_base_atomics cl_khr_global_int32_extended_atomics cl_khr_int64_base_atomics "
+    "cl_khr_local_int32_base_atomics cl_khr_local_int32_extended_atomics cl_khr_priority_hints cl_khr_subgroups "
+    "cl_khr_throttle_hints cl_intel_required_subgroup_size cl_intel_subgroups cl_intel_subgroups_short";
+const char* const binary_header = "null_ocl\n";
+
+cl_int return_info(const void* data, size_t data_size, size_t size, void* value, size_t* size_ret)
+{
+    if (value != nullptr)
+    {
+        if (size < data_size)
+            return CL_INVALID_VALUE;
+        std::memcpy(value, data, data_size);
+    }
+    if (size_ret != nullptr)
+        *size_ret = data_size;
+    return CL_SUCCESS;
+}
+
+template <typename T>
+cl_int return_info(const T& data, size_t size, void* value, size_t* size_ret)
+{
+    return return_info(&data, sizeof(T), size, value, size_ret);
+}
+
+template <typename T>
+cl_int return_info(const std::vector<T>& data, size_t size, void* value, size_t* size_ret)
+{
+    return return_info(data.data(), data.size() * sizeof(T), size, value, size_ret);
+}
+
+cl_int return_info(const char* data, size_t size, void* value, size_t* size_ret)
+{
+    return return_info(data, std::strlen(data) + 1, size, value, size_ret);
+}
+
+cl_int return_info(const std::string& data, size_t size, void* value, size_t* size_ret)
+{
+    return return_info(data.c_str(), size, value, size_ret);
+}
+
+// writes info of any type to the output parameters of clGet*Info functions
+struct info_writer
+{
+    size_t size;
+    void* value;
+    size_t* size_ret;
+
+    template <typename T>
+    cl_int operator()(const T& data) const { return return_info(data, size, value, size_ret); }
+};
+
+template <typename T>
+T* set_error(cl_int* errcode_ret, cl_int error, T* result = nullptr)
+{
+    if (errcode_ret != nullptr)
+        *errcode_ret = error;
+    return result;
+}
+
+// invokes event callbacks from a separate thread, as drivers do, once the simulated time comes
+class callbacks_thread
+{
+public:
+    static callbacks_thread& instance()
+    {
+        static callbacks_thread thread;
+        return thread;
+    }
+
+    ~callbacks_thread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    void schedule(clock_type::time_point time, std::function<void()> callback)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pending.emplace(time, std::move(callback));
+        if (!_thread.joinable())
+            _thread = std::thread([this] { run(); });
+        _cv.notify_all();
+    }
+
+private:
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (!_stop)
+        {
+            if (_pending.empty())
+            {
+                _cv.wait(lock);
+                continue;
+            }
+
+            auto first = _pending.begin();
+            if (first->first > clock_type::now())
+            {
+                _cv.wait_until(lock, first->first);
+                continue;
+            }
+
+            auto callback = std::move(first->second);
+            _pending.erase(first);
+            lock.unlock();
+            callback();
+            lock.lock();
+        }
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::multimap<clock_type::time_point, std::function<void()>> _pending;
+    std::thread _thread;
+    bool _stop = false;
+};
+}
+
+struct _cl_platform_id
+{
+};
+
+struct _cl_device_id
+{
+};
+
+namespace
+{
+_cl_platform_id the_platform;
+_cl_device_id the_device;
+
+struct ref_counted
+{
+    virtual ~ref_counted() = default;
+
+    void retain() { ++ref_count; }
+    void release()
+    {
+        if (--ref_count == 0)
+            delete this;
+    }
+
+    std::atomic<uint32_t> ref_count{ 1 };
+};
+
+template <typename T>
+cl_int retain(T* object, cl_int invalid_error)
+{
+    if (object == nullptr)
+        return invalid_error;
+    object->retain();
+    return CL_SUCCESS;
+}
+
+template <typename T>
+cl_int release(T* object, cl_int invalid_error)
+{
+    if (object == nullptr)
+        return invalid_error;
+    object->release();
+    return CL_SUCCESS;
+}
+}
+
+struct _cl_context : ref_counted
+{
+    std::vector<cl_context_properties> properties;
+};
+
+struct _cl_command_queue : ref_counted
+{
+    _cl_command_queue(cl_context context, cl_command_queue_properties properties)
+        : context(context), properties(properties)
+    {
+        context->retain();
+    }
+    ~_cl_command_queue() { context->release(); }
+
+    bool in_order() const { return (properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) == 0; }
+
+    cl_context context;
+    cl_command_queue_properties properties;
+    std::mutex mutex;
+    clock_type::time_point completion_time;     // when all enqueued commands are done
+};
+
+struct _cl_mem : ref_counted
+{
+    _cl_mem(cl_context context, cl_mem_flags flags, cl_mem_object_type type, size_t size, void* host_ptr)
+        : context(context), flags(flags), type(type), size(size), host_ptr(host_ptr)
+    {
+        context->retain();
+        if (flags & CL_MEM_USE_HOST_PTR)
+        {
+            data = static_cast<char*>(host_ptr);
+        }
+        else
+        {
+            storage.reset(new char[size]);
+            data = storage.get();
+            if (flags & CL_MEM_COPY_HOST_PTR)
+                std::memcpy(data, host_ptr, size);
+        }
+    }
+    ~_cl_mem() { context->release(); }
+
+    cl_context context;
+    cl_mem_flags flags;
+    cl_mem_object_type type;
+    size_t size;
+    void* host_ptr;
+    std::unique_ptr<char[]> storage;
+    char* data;
+    cl_image_format image_format = {};
+    size_t element_size = 0;
+    size_t width = 0;
+    size_t height = 0;
+    size_t row_pitch = 0;
+    std::atomic<uint32_t> map_count{ 0 };
+};
+
+struct _cl_program : ref_counted
+{
+    explicit _cl_program(cl_context context) : context(context) { context->retain(); }
+    ~_cl_program() { context->release(); }
+
+    cl_context context;
+    std::string source;
+    std::string options;
+    cl_build_status build_status = CL_BUILD_NONE;
+    std::vector<std::string> kernel_names;
+};
+
+struct _cl_kernel : ref_counted
+{
+    _cl_kernel(cl_program program, std::string name) : program(program), name(std::move(name)) { program->retain(); }
+    ~_cl_kernel() { program->release(); }
+
+    cl_program program;
+    std::string name;
+};
+
+struct _cl_event : ref_counted
+{
+    // user event
+    explicit _cl_event(cl_context context)
+        : context(context), queue(nullptr), command_type(CL_COMMAND_USER), user_status(CL_SUBMITTED)
+    {
+        context->retain();
+    }
+
+    // command
+    _cl_event(cl_command_queue queue, cl_command_type command_type, clock_type::time_point queued,
+              clock_type::time_point start, clock_type::time_point end)
+        : context(queue->context), queue(queue), command_type(command_type), queued(queued), start(start), end(end)
+    {
+        context->retain();
+        queue->retain();
+    }
+
+    ~_cl_event()
+    {
+        if (queue != nullptr)
+            queue->release();
+        context->release();
+    }
+
+    cl_int status()
+    {
+        if (queue == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return user_status;
+        }
+
+        const auto now = clock_type::now();
+        if (now >= end)
+            return CL_COMPLETE;
+        return now >= start ? CL_RUNNING : CL_SUBMITTED;
+    }
+
+    // device time when dependent commands can start
+    clock_type::time_point completion_time()
+    {
+        if (queue == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return user_status == CL_COMPLETE ? end : clock_type::now();
+        }
+        return end;
+    }
+
+    cl_int wait()
+    {
+        if (queue == nullptr)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [this] { return user_status <= CL_COMPLETE; });
+            return user_status;
+        }
+
+        std::this_thread::sleep_until(end);
+        return CL_COMPLETE;
+    }
+
+    cl_context context;
+    cl_command_queue queue;
+    cl_command_type command_type;
+    clock_type::time_point queued;
+    clock_type::time_point start;
+    clock_type::time_point end;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    cl_int user_status = CL_COMPLETE;
+    std::vector<std::function<void()>> user_callbacks;
+};
+
+namespace
+{
+bool is_valid_wait_list(cl_uint num_events, const cl_event* events)
+{
+    if ((num_events == 0) != (events == nullptr))
+        return false;
+    return std::none_of(events, events + num_events, [](cl_event ev) { return ev == nullptr; });
+}
+
+// Enqueues a command which takes duration of the device time, starting after the dependencies and, on in-order queues
+// and for barriers, after all commands enqueued before.
+cl_int enqueue(cl_command_queue queue, cl_command_type command_type, std::chrono::nanoseconds duration,
+               cl_uint num_events, const cl_event* events, cl_event* event, bool blocking = false, bool barrier = false)
+{
+    if (queue == nullptr)
+        return CL_INVALID_COMMAND_QUEUE;
+    if (!is_valid_wait_list(num_events, events))
+        return CL_INVALID_EVENT_WAIT_LIST;
+
+    spend_host_time(get_settings().enqueue_latency);
+
+    const auto queued = clock_type::now();
+    auto start = queued;
+    for (cl_uint i = 0; i < num_events; i++)
+        start = std::max(start, events[i]->completion_time());
+
+    clock_type::time_point end;
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        if (queue->in_order() || barrier)
+            start = std::max(start, queue->completion_time);
+        end = start + duration;
+        queue->completion_time = std::max(queue->completion_time, end);
+    }
+
+    if (blocking)
+        std::this_thread::sleep_until(end);
+
+    if (event != nullptr)
+        *event = new _cl_event(queue, command_type, queued, start, end);
+    return CL_SUCCESS;
+}
+
+std::vector<std::string> find_kernel_names(const std::string& source)
+{
+    static const std::string keyword = "kernel";
+    auto is_name_char = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+    auto skip_spaces = [&](size_t pos)
+    {
+        while (pos < source.size() && std::isspace(static_cast<unsigned char>(source[pos])))
+            pos++;
+        return pos;
+    };
+    auto read_name = [&](size_t& pos)
+    {
+        const auto begin = pos;
+        while (pos < source.size() && is_name_char(source[pos]))
+            pos++;
+        return source.substr(begin, pos - begin);
+    };
+
+    std::vector<std::string> names;
+    std::set<std::string> found;
+    for (auto pos = source.find(keyword); pos != std::string::npos; pos = source.find(keyword, pos + keyword.size()))
+    {
+        auto prefix_begin = pos >= 2 && source.compare(pos - 2, 2, "__") == 0 ? pos - 2 : pos;
+        if (prefix_begin > 0 && is_name_char(source[prefix_begin - 1]))
+            continue;
+
+        auto next = pos + keyword.size();
+        if (next < source.size() && is_name_char(source[next]))
+            continue;
+
+        next = skip_spaces(next);
+        if (read_name(next) != "void")
+            continue;
+
+        next = skip_spaces(next);
+        auto name = read_name(next);
+        if (!name.empty() && found.insert(name).second)
+            names.push_back(std::move(name));
+    }
+    return names;
+}
+
+size_t get_element_size(const cl_image_format& format)
+{
+    size_t channels = 0;
+    switch (format.image_channel_order)
+    {
+    case CL_R: case CL_A: case CL_INTENSITY: case CL_LUMINANCE: case CL_DEPTH:
+        channels = 1; break;
+    case CL_RG: case CL_RA: case CL_Rx:
+        channels = 2; break;
+    case CL_RGB: case CL_RGx:
+        channels = 3; break;
+    case CL_RGBA: case CL_BGRA: case CL_ARGB: case CL_RGBx:
+        channels = 4; break;
+    default:
+        return 0;
+    }
+
+    switch (format.image_channel_data_type)
+    {
+    case CL_SNORM_INT8: case CL_UNORM_INT8: case CL_SIGNED_INT8: case CL_UNSIGNED_INT8:
+        return channels;
+    case CL_SNORM_INT16: case CL_UNORM_INT16: case CL_SIGNED_INT16: case CL_UNSIGNED_INT16: case CL_HALF_FLOAT:
+        return channels * 2;
+    case CL_SIGNED_INT32: case CL_UNSIGNED_INT32: case CL_FLOAT:
+        return channels * 4;
+    default:
+        return 0;
+    }
+}
+}
+
+extern "C" {
+
+// ----------------------------------------------- Platform and device -------------------------------------------------
+
+cl_int CL_API_CALL clGetPlatformIDs(cl_uint num_entries, cl_platform_id* platforms, cl_uint* num_platforms)
+{
+    if ((num_entries == 0 && platforms != nullptr) || (platforms == nullptr && num_platforms == nullptr))
+        return CL_INVALID_VALUE;
+    if (platforms != nullptr)
+        platforms[0] = &the_platform;
+    if (num_platforms != nullptr)
+        *num_platforms = 1;
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL clGetPlatformInfo(cl_platform_id platform, cl_platform_info param_name, size_t param_value_size,
+                                     void* param_value, size_t* param_value_size_ret)
+{
+    if (platform != nullptr && platform != &the_platform)
+        return CL_INVALID_PLATFORM;
+
+    switch (param_name)
+    {
+    case CL_PLATFORM_PROFILE:    return return_info("FULL_PROFILE", param_value_size, param_value, param_value_size_ret);
+    case CL_PLATFORM_VERSION:    return return_info(platform_version, param_value_size, param_value, param_value_size_ret);
+    case CL_PLATFORM_NAME:       return return_info(platform_name, param_value_size, param_value, param_value_size_ret);
+    case CL_PLATFORM_VENDOR:     return return_info(platform_vendor, param_value_size, param_value, param_value_size_ret);
+    case CL_PLATFORM_EXTENSIONS: return return_info(device_extensions, param_value_size, param_value, param_value_size_ret);
+    default:                     return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clGetDeviceIDs(cl_platform_id platform, cl_device_type device_type, cl_uint num_entries,
+                                  cl_device_id* devices, cl_uint* num_devices)
+{
+    if (platform != nullptr && platform != &the_platform)
+        return CL_INVALID_PLATFORM;
+    if ((num_entries == 0 && devices != nullptr) || (devices == nullptr && num_devices == nullptr))
+        return CL_INVALID_VALUE;
+    if ((device_type & (CL_DEVICE_TYPE_GPU | CL_DEVICE_TYPE_DEFAULT)) == 0)
+        return CL_DEVICE_NOT_FOUND;
+    if (devices != nullptr)
+        devices[0] = &the_device;
+    if (num_devices != nullptr)
+        *num_devices = 1;
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL clGetDeviceInfo(cl_device_id device, cl_device_info param_name, size_t param_value_size,
+                                   void* param_value, size_t* param_value_size_ret)
+{
+    if (device != &the_device)
+        return CL_INVALID_DEVICE;
+
+    const info_writer info{ param_value_size, param_value, param_value_size_ret };
+    const cl_device_fp_config fp_config = CL_FP_DENORM | CL_FP_INF_NAN | CL_FP_ROUND_TO_NEAREST | CL_FP_FMA;
+    switch (param_name)
+    {
+    case CL_DEVICE_TYPE:                          return info(cl_device_type(CL_DEVICE_TYPE_GPU));
+    case CL_DEVICE_VENDOR_ID:                     return info(get_settings().vendor_id);
+    case CL_DEVICE_MAX_COMPUTE_UNITS:             return info(cl_uint(24));
+    case CL_DEVICE_MAX_WORK_ITEM_DIMENSIONS:      return info(cl_uint(3));
+    case CL_DEVICE_MAX_WORK_ITEM_SIZES:           return info(std::vector<size_t>{ 256, 256, 256 });
+    case CL_DEVICE_MAX_WORK_GROUP_SIZE:           return info(size_t(256));
+    case CL_DEVICE_PREFERRED_VECTOR_WIDTH_CHAR:
+    case CL_DEVICE_PREFERRED_VECTOR_WIDTH_SHORT:
+    case CL_DEVICE_PREFERRED_VECTOR_WIDTH_INT:
+    case CL_DEVICE_PREFERRED_VECTOR_WIDTH_LONG:
+    case CL_DEVICE_PREFERRED_VECTOR_WIDTH_FLOAT:
+    case CL_DEVICE_PREFERRED_VECTOR_WIDTH_DOUBLE:
+    case CL_DEVICE_PREFERRED_VECTOR_WIDTH_HALF:
+    case CL_DEVICE_NATIVE_VECTOR_WIDTH_CHAR:
+    case CL_DEVICE_NATIVE_VECTOR_WIDTH_SHORT:
+    case CL_DEVICE_NATIVE_VECTOR_WIDTH_INT:
+    case CL_DEVICE_NATIVE_VECTOR_WIDTH_LONG:
+    case CL_DEVICE_NATIVE_VECTOR_WIDTH_FLOAT:
+    case CL_DEVICE_NATIVE_VECTOR_WIDTH_DOUBLE:
+    case CL_DEVICE_NATIVE_VECTOR_WIDTH_HALF:      return info(cl_uint(1));
+    case CL_DEVICE_MAX_CLOCK_FREQUENCY:           return info(cl_uint(1000));
+    case CL_DEVICE_ADDRESS_BITS:                  return info(cl_uint(64));
+    case CL_DEVICE_MAX_MEM_ALLOC_SIZE:            return info(cl_ulong(4) << 30);
+    case CL_DEVICE_GLOBAL_MEM_SIZE:               return info(cl_ulong(8) << 30);
+    case CL_DEVICE_GLOBAL_MEM_CACHE_TYPE:         return info(cl_device_mem_cache_type(CL_READ_WRITE_CACHE));
+    case CL_DEVICE_GLOBAL_MEM_CACHELINE_SIZE:     return info(cl_uint(64));
+    case CL_DEVICE_GLOBAL_MEM_CACHE_SIZE:         return info(cl_ulong(512) << 10);
+    case CL_DEVICE_LOCAL_MEM_TYPE:                return info(cl_device_local_mem_type(CL_LOCAL));
+    case CL_DEVICE_LOCAL_MEM_SIZE:                return info(cl_ulong(64) << 10);
+    case CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE:      return info(cl_ulong(4) << 30);
+    case CL_DEVICE_MAX_CONSTANT_ARGS:             return info(cl_uint(8));
+    case CL_DEVICE_MAX_PARAMETER_SIZE:            return info(size_t(1024));
+    case CL_DEVICE_MEM_BASE_ADDR_ALIGN:           return info(cl_uint(1024));
+    case CL_DEVICE_IMAGE_SUPPORT:                 return info(cl_bool(CL_TRUE));
+    case CL_DEVICE_IMAGE2D_MAX_WIDTH:
+    case CL_DEVICE_IMAGE2D_MAX_HEIGHT:            return info(size_t(16384));
+    case CL_DEVICE_IMAGE3D_MAX_WIDTH:
+    case CL_DEVICE_IMAGE3D_MAX_HEIGHT:
+    case CL_DEVICE_IMAGE3D_MAX_DEPTH:             return info(size_t(2048));
+    case CL_DEVICE_IMAGE_MAX_BUFFER_SIZE:         return info(size_t(1) << 26);
+    case CL_DEVICE_IMAGE_MAX_ARRAY_SIZE:          return info(size_t(2048));
+    case CL_DEVICE_MAX_READ_IMAGE_ARGS:
+    case CL_DEVICE_MAX_WRITE_IMAGE_ARGS:          return info(cl_uint(128));
+    case CL_DEVICE_MAX_SAMPLERS:                  return info(cl_uint(16));
+    case CL_DEVICE_SINGLE_FP_CONFIG:
+    case CL_DEVICE_DOUBLE_FP_CONFIG:
+    case CL_DEVICE_HALF_FP_CONFIG:                return info(fp_config);
+    case CL_DEVICE_ERROR_CORRECTION_SUPPORT:      return info(cl_bool(CL_FALSE));
+    case CL_DEVICE_HOST_UNIFIED_MEMORY:           return info(cl_bool(CL_TRUE));
+    case CL_DEVICE_PROFILING_TIMER_RESOLUTION:    return info(size_t(1));
+    case CL_DEVICE_ENDIAN_LITTLE:
+    case CL_DEVICE_AVAILABLE:
+    case CL_DEVICE_COMPILER_AVAILABLE:
+    case CL_DEVICE_LINKER_AVAILABLE:              return info(cl_bool(CL_TRUE));
+    case CL_DEVICE_EXECUTION_CAPABILITIES:        return info(cl_device_exec_capabilities(CL_EXEC_KERNEL));
+    case CL_DEVICE_QUEUE_PROPERTIES:              return info(cl_command_queue_properties(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE | CL_QUEUE_PROFILING_ENABLE));
+    case CL_DEVICE_PLATFORM:                      return info(&the_platform);
+    case CL_DEVICE_NAME:                          return info(device_name);
+    case CL_DEVICE_VENDOR:                        return info(platform_vendor);
+    case CL_DRIVER_VERSION:                       return info(driver_version);
+    case CL_DEVICE_PROFILE:                       return info("FULL_PROFILE");
+    case CL_DEVICE_VERSION:                       return info(device_version);
+    case CL_DEVICE_OPENCL_C_VERSION:              return info("OpenCL C 2.0 ");
+    case CL_DEVICE_EXTENSIONS:                    return info(device_extensions);
+    case CL_DEVICE_BUILT_IN_KERNELS:              return info("");
+    case CL_DEVICE_PRINTF_BUFFER_SIZE:            return info(size_t(4) << 20);
+    case CL_DEVICE_PREFERRED_INTEROP_USER_SYNC:   return info(cl_bool(CL_TRUE));
+    case CL_DEVICE_PARENT_DEVICE:                 return info(cl_device_id(nullptr));
+    case CL_DEVICE_PARTITION_MAX_SUB_DEVICES:     return info(cl_uint(0));
+    case CL_DEVICE_REFERENCE_COUNT:               return info(cl_uint(1));
+    default:                                      return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clRetainDevice(cl_device_id device)
+{
+    return device == &the_device ? CL_SUCCESS : CL_INVALID_DEVICE;
+}
+
+cl_int CL_API_CALL clReleaseDevice(cl_device_id device)
+{
+    return device == &the_device ? CL_SUCCESS : CL_INVALID_DEVICE;
+}
+
+// ----------------------------------------------------- Context -------------------------------------------------------
+
+cl_context CL_API_CALL clCreateContext(const cl_context_properties* properties, cl_uint num_devices,
+                                       const cl_device_id* devices,
+                                       void (CL_CALLBACK*)(const char*, const void*, size_t, void*), void*,
+                                       cl_int* errcode_ret)
+{
+    if (num_devices == 0 || devices == nullptr)
+        return set_error<_cl_context>(errcode_ret, CL_INVALID_VALUE);
+    if (std::any_of(devices, devices + num_devices, [](cl_device_id d) { return d != &the_device; }))
+        return set_error<_cl_context>(errcode_ret, CL_INVALID_DEVICE);
+
+    auto context = new _cl_context();
+    for (auto p = properties; p != nullptr && *p != 0; p += 2)
+        context->properties.insert(context->properties.end(), { p[0], p[1] });
+    if (properties != nullptr)
+        context->properties.push_back(0);
+    return set_error(errcode_ret, CL_SUCCESS, context);
+}
+
+cl_context CL_API_CALL clCreateContextFromType(const cl_context_properties* properties, cl_device_type device_type,
+                                               void (CL_CALLBACK* pfn_notify)(const char*, const void*, size_t, void*),
+                                               void* user_data, cl_int* errcode_ret)
+{
+    if ((device_type & (CL_DEVICE_TYPE_GPU | CL_DEVICE_TYPE_DEFAULT)) == 0)
+        return set_error<_cl_context>(errcode_ret, CL_DEVICE_NOT_FOUND);
+    cl_device_id device = &the_device;
+    return clCreateContext(properties, 1, &device, pfn_notify, user_data, errcode_ret);
+}
+
+cl_int CL_API_CALL clRetainContext(cl_context context)
+{
+    return retain(context, CL_INVALID_CONTEXT);
+}
+
+cl_int CL_API_CALL clReleaseContext(cl_context context)
+{
+    return release(context, CL_INVALID_CONTEXT);
+}
+
+cl_int CL_API_CALL clGetContextInfo(cl_context context, cl_context_info param_name, size_t param_value_size,
+                                    void* param_value, size_t* param_value_size_ret)
+{
+    if (context == nullptr)
+        return CL_INVALID_CONTEXT;
+
+    switch (param_name)
+    {
+    case CL_CONTEXT_REFERENCE_COUNT: return return_info(cl_uint(context->ref_count), param_value_size, param_value, param_value_size_ret);
+    case CL_CONTEXT_NUM_DEVICES:     return return_info(cl_uint(1), param_value_size, param_value, param_value_size_ret);
+    case CL_CONTEXT_DEVICES:         return return_info(&the_device, param_value_size, param_value, param_value_size_ret);
+    case CL_CONTEXT_PROPERTIES:      return return_info(context->properties, param_value_size, param_value, param_value_size_ret);
+    default:                         return CL_INVALID_VALUE;
+    }
+}
+
+// -------------------------------------------------- Command queue ----------------------------------------------------
+
+cl_command_queue CL_API_CALL clCreateCommandQueueWithProperties(cl_context context, cl_device_id device,
+                                                                const cl_queue_properties* properties,
+                                                                cl_int* errcode_ret)
+{
+    if (context == nullptr)
+        return set_error<_cl_command_queue>(errcode_ret, CL_INVALID_CONTEXT);
+    if (device != &the_device)
+        return set_error<_cl_command_queue>(errcode_ret, CL_INVALID_DEVICE);
+
+    // priority and throttle hints are accepted and ignored
+    cl_command_queue_properties queue_properties = 0;
+    for (auto p = properties; p != nullptr && *p != 0; p += 2)
+    {
+        if (p[0] == CL_QUEUE_PROPERTIES)
+            queue_properties = static_cast<cl_command_queue_properties>(p[1]);
+    }
+    if (queue_properties & ~static_cast<cl_command_queue_properties>(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE | CL_QUEUE_PROFILING_ENABLE))
+        return set_error<_cl_command_queue>(errcode_ret, CL_INVALID_QUEUE_PROPERTIES);
+
+    return set_error(errcode_ret, CL_SUCCESS, new _cl_command_queue(context, queue_properties));
+}
+
+cl_command_queue CL_API_CALL clCreateCommandQueue(cl_context context, cl_device_id device,
+                                                  cl_command_queue_properties properties, cl_int* errcode_ret)
+{
+    const cl_queue_properties queue_properties[] = { CL_QUEUE_PROPERTIES, properties, 0 };
+    return clCreateCommandQueueWithProperties(context, device, queue_properties, errcode_ret);
+}
+
+cl_int CL_API_CALL clRetainCommandQueue(cl_command_queue command_queue)
+{
+    return retain(command_queue, CL_INVALID_COMMAND_QUEUE);
+}
+
+cl_int CL_API_CALL clReleaseCommandQueue(cl_command_queue command_queue)
+{
+    return release(command_queue, CL_INVALID_COMMAND_QUEUE);
+}
+
+cl_int CL_API_CALL clGetCommandQueueInfo(cl_command_queue command_queue, cl_command_queue_info param_name,
+                                         size_t param_value_size, void* param_value, size_t* param_value_size_ret)
+{
+    if (command_queue == nullptr)
+        return CL_INVALID_COMMAND_QUEUE;
+
+    switch (param_name)
+    {
+    case CL_QUEUE_CONTEXT:         return return_info(command_queue->context, param_value_size, param_value, param_value_size_ret);
+    case CL_QUEUE_DEVICE:          return return_info(&the_device, param_value_size, param_value, param_value_size_ret);
+    case CL_QUEUE_REFERENCE_COUNT: return return_info(cl_uint(command_queue->ref_count), param_value_size, param_value, param_value_size_ret);
+    case CL_QUEUE_PROPERTIES:      return return_info(command_queue->properties, param_value_size, param_value, param_value_size_ret);
+    default:                       return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clFlush(cl_command_queue command_queue)
+{
+    return command_queue != nullptr ? CL_SUCCESS : CL_INVALID_COMMAND_QUEUE;
+}
+
+cl_int CL_API_CALL clFinish(cl_command_queue command_queue)
+{
+    if (command_queue == nullptr)
+        return CL_INVALID_COMMAND_QUEUE;
+
+    clock_type::time_point completion_time;
+    {
+        std::lock_guard<std::mutex> lock(command_queue->mutex);
+        completion_time = command_queue->completion_time;
+    }
+    std::this_thread::sleep_until(completion_time);
+    return CL_SUCCESS;
+}
+
+// ------------------------------------------------- Memory objects ----------------------------------------------------
+
+cl_mem CL_API_CALL clCreateBuffer(cl_context context, cl_mem_flags flags, size_t size, void* host_ptr,
+                                  cl_int* errcode_ret)
+{
+    if (context == nullptr)
+        return set_error<_cl_mem>(errcode_ret, CL_INVALID_CONTEXT);
+    if (size == 0)
+        return set_error<_cl_mem>(errcode_ret, CL_INVALID_BUFFER_SIZE);
+    if ((host_ptr != nullptr) != ((flags & (CL_MEM_USE_HOST_PTR | CL_MEM_COPY_HOST_PTR)) != 0))
+        return set_error<_cl_mem>(errcode_ret, CL_INVALID_HOST_PTR);
+
+    try
+    {
+        return set_error(errcode_ret, CL_SUCCESS, new _cl_mem(context, flags, CL_MEM_OBJECT_BUFFER, size, host_ptr));
+    }
+    catch (const std::bad_alloc&)
+    {
+        return set_error<_cl_mem>(errcode_ret, CL_MEM_OBJECT_ALLOCATION_FAILURE);
+    }
+}
+
+cl_mem CL_API_CALL clCreateImage(cl_context context, cl_mem_flags flags, const cl_image_format* image_format,
+                                 const cl_image_desc* image_desc, void* host_ptr, cl_int* errcode_ret)
+{
+    if (context == nullptr)
+        return set_error<_cl_mem>(errcode_ret, CL_INVALID_CONTEXT);
+    if (image_format == nullptr || get_element_size(*image_format) == 0)
+        return set_error<_cl_mem>(errcode_ret, CL_INVALID_IMAGE_FORMAT_DESCRIPTOR);
+    if (image_desc == nullptr || image_desc->image_type != CL_MEM_OBJECT_IMAGE2D ||
+        image_desc->image_width == 0 || image_desc->image_height == 0)
+        return set_error<_cl_mem>(errcode_ret, CL_INVALID_IMAGE_DESCRIPTOR);
+    if ((host_ptr != nullptr) != ((flags & (CL_MEM_USE_HOST_PTR | CL_MEM_COPY_HOST_PTR)) != 0))
+        return set_error<_cl_mem>(errcode_ret, CL_INVALID_HOST_PTR);
+
+    const auto element_size = get_element_size(*image_format);
+    const auto row_pitch = image_desc->image_row_pitch != 0 ? image_desc->image_row_pitch : image_desc->image_width * element_size;
+    try
+    {
+        auto image = new _cl_mem(context, flags, CL_MEM_OBJECT_IMAGE2D, row_pitch * image_desc->image_height, host_ptr);
+        image->image_format = *image_format;
+        image->element_size = element_size;
+        image->width = image_desc->image_width;
+        image->height = image_desc->image_height;
+        image->row_pitch = row_pitch;
+        return set_error(errcode_ret, CL_SUCCESS, image);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return set_error<_cl_mem>(errcode_ret, CL_MEM_OBJECT_ALLOCATION_FAILURE);
+    }
+}
+
+cl_int CL_API_CALL clRetainMemObject(cl_mem memobj)
+{
+    return retain(memobj, CL_INVALID_MEM_OBJECT);
+}
+
+cl_int CL_API_CALL clReleaseMemObject(cl_mem memobj)
+{
+    return release(memobj, CL_INVALID_MEM_OBJECT);
+}
+
+cl_int CL_API_CALL clGetMemObjectInfo(cl_mem memobj, cl_mem_info param_name, size_t param_value_size,
+                                      void* param_value, size_t* param_value_size_ret)
+{
+    if (memobj == nullptr)
+        return CL_INVALID_MEM_OBJECT;
+
+    switch (param_name)
+    {
+    case CL_MEM_TYPE:                 return return_info(memobj->type, param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_FLAGS:                return return_info(memobj->flags, param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_SIZE:                 return return_info(memobj->size, param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_HOST_PTR:             return return_info(memobj->host_ptr, param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_MAP_COUNT:            return return_info(cl_uint(memobj->map_count), param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_REFERENCE_COUNT:      return return_info(cl_uint(memobj->ref_count), param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_CONTEXT:              return return_info(memobj->context, param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_ASSOCIATED_MEMOBJECT: return return_info(cl_mem(nullptr), param_value_size, param_value, param_value_size_ret);
+    case CL_MEM_OFFSET:               return return_info(size_t(0), param_value_size, param_value, param_value_size_ret);
+    default:                          return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clGetImageInfo(cl_mem image, cl_image_info param_name, size_t param_value_size,
+                                  void* param_value, size_t* param_value_size_ret)
+{
+    if (image == nullptr || image->type != CL_MEM_OBJECT_IMAGE2D)
+        return CL_INVALID_MEM_OBJECT;
+
+    switch (param_name)
+    {
+    case CL_IMAGE_FORMAT:       return return_info(image->image_format, param_value_size, param_value, param_value_size_ret);
+    case CL_IMAGE_ELEMENT_SIZE: return return_info(image->element_size, param_value_size, param_value, param_value_size_ret);
+    case CL_IMAGE_ROW_PITCH:    return return_info(image->row_pitch, param_value_size, param_value, param_value_size_ret);
+    case CL_IMAGE_SLICE_PITCH:  return return_info(size_t(0), param_value_size, param_value, param_value_size_ret);
+    case CL_IMAGE_WIDTH:        return return_info(image->width, param_value_size, param_value, param_value_size_ret);
+    case CL_IMAGE_HEIGHT:       return return_info(image->height, param_value_size, param_value, param_value_size_ret);
+    case CL_IMAGE_DEPTH:        return return_info(size_t(0), param_value_size, param_value, param_value_size_ret);
+    case CL_IMAGE_ARRAY_SIZE:   return return_info(size_t(0), param_value_size, param_value, param_value_size_ret);
+    default:                    return CL_INVALID_VALUE;
+    }
+}
+
+// ------------------------------------------------ Program and kernel -------------------------------------------------
+
+cl_program CL_API_CALL clCreateProgramWithSource(cl_context context, cl_uint count, const char** strings,
+                                                 const size_t* lengths, cl_int* errcode_ret)
+{
+    if (context == nullptr)
+        return set_error<_cl_program>(errcode_ret, CL_INVALID_CONTEXT);
+    if (count == 0 || strings == nullptr)
+        return set_error<_cl_program>(errcode_ret, CL_INVALID_VALUE);
+
+    auto program = new _cl_program(context);
+    for (cl_uint i = 0; i < count; i++)
+    {
+        if (lengths != nullptr && lengths[i] != 0)
+            program->source.append(strings[i], lengths[i]);
+        else
+            program->source.append(strings[i]);
+    }
+    return set_error(errcode_ret, CL_SUCCESS, program);
+}
+
+cl_program CL_API_CALL clCreateProgramWithBinary(cl_context context, cl_uint num_devices, const cl_device_id* device_list,
+                                                 const size_t* lengths, const unsigned char** binaries,
+                                                 cl_int* binary_status, cl_int* errcode_ret)
+{
+    if (context == nullptr)
+        return set_error<_cl_program>(errcode_ret, CL_INVALID_CONTEXT);
+    if (num_devices != 1 || device_list == nullptr || lengths == nullptr || binaries == nullptr)
+        return set_error<_cl_program>(errcode_ret, CL_INVALID_VALUE);
+    if (device_list[0] != &the_device)
+        return set_error<_cl_program>(errcode_ret, CL_INVALID_DEVICE);
+
+    // binaries are lists of kernel names (see CL_PROGRAM_BINARIES)
+    std::string binary(reinterpret_cast<const char*>(binaries[0]), lengths[0]);
+    const std::string header = binary_header;
+    const bool valid = binary.compare(0, header.size(), header) == 0;
+    if (binary_status != nullptr)
+        binary_status[0] = valid ? CL_SUCCESS : CL_INVALID_BINARY;
+    if (!valid)
+        return set_error<_cl_program>(errcode_ret, CL_INVALID_BINARY);
+
+    auto program = new _cl_program(context);
+    for (size_t pos = header.size(), end; (end = binary.find('\n', pos)) != std::string::npos; pos = end + 1)
+        program->kernel_names.push_back(binary.substr(pos, end - pos));
+    return set_error(errcode_ret, CL_SUCCESS, program);
+}
+
+cl_int CL_API_CALL clRetainProgram(cl_program program)
+{
+    return retain(program, CL_INVALID_PROGRAM);
+}
+
+cl_int CL_API_CALL clReleaseProgram(cl_program program)
+{
+    return release(program, CL_INVALID_PROGRAM);
+}
+
+cl_int CL_API_CALL clBuildProgram(cl_program program, cl_uint num_devices, const cl_device_id* device_list,
+                                  const char* options, void (CL_CALLBACK* pfn_notify)(cl_program, void*),
+                                  void* user_data)
+{
+    if (program == nullptr)
+        return CL_INVALID_PROGRAM;
+    if ((num_devices == 0) != (device_list == nullptr))
+        return CL_INVALID_VALUE;
+    if (std::any_of(device_list, device_list + num_devices, [](cl_device_id d) { return d != &the_device; }))
+        return CL_INVALID_DEVICE;
+
+    spend_host_time(get_settings().build_latency);
+
+    program->options = options != nullptr ? options : "";
+    if (!program->source.empty())
+        program->kernel_names = find_kernel_names(program->source);
+    program->build_status = CL_BUILD_SUCCESS;
+
+    if (pfn_notify != nullptr)
+        pfn_notify(program, user_data);
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL clGetProgramInfo(cl_program program, cl_program_info param_name, size_t param_value_size,
+                                    void* param_value, size_t* param_value_size_ret)
+{
+    if (program == nullptr)
+        return CL_INVALID_PROGRAM;
+
+    std::string binary;
+    if (param_name == CL_PROGRAM_BINARY_SIZES || param_name == CL_PROGRAM_BINARIES)
+    {
+        binary = binary_header;
+        for (const auto& name : program->kernel_names)
+            binary += name + '\n';
+    }
+
+    std::string kernel_names;
+    for (const auto& name : program->kernel_names)
+        kernel_names += (kernel_names.empty() ? "" : ";") + name;
+
+    switch (param_name)
+    {
+    case CL_PROGRAM_REFERENCE_COUNT: return return_info(cl_uint(program->ref_count), param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_CONTEXT:         return return_info(program->context, param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_NUM_DEVICES:     return return_info(cl_uint(1), param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_DEVICES:         return return_info(&the_device, param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_SOURCE:          return return_info(program->source, param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_BINARY_SIZES:    return return_info(binary.size(), param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_BINARIES:
+        // array of pointers to buffers of CL_PROGRAM_BINARY_SIZES sizes
+        if (param_value != nullptr)
+        {
+            auto binaries = static_cast<unsigned char**>(param_value);
+            if (binaries[0] != nullptr)
+                std::memcpy(binaries[0], binary.data(), binary.size());
+        }
+        if (param_value_size_ret != nullptr)
+            *param_value_size_ret = sizeof(unsigned char*);
+        return CL_SUCCESS;
+    case CL_PROGRAM_NUM_KERNELS:     return return_info(program->kernel_names.size(), param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_KERNEL_NAMES:    return return_info(kernel_names, param_value_size, param_value, param_value_size_ret);
+    default:                         return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clGetProgramBuildInfo(cl_program program, cl_device_id device, cl_program_build_info param_name,
+                                         size_t param_value_size, void* param_value, size_t* param_value_size_ret)
+{
+    if (program == nullptr)
+        return CL_INVALID_PROGRAM;
+    if (device != &the_device)
+        return CL_INVALID_DEVICE;
+
+    switch (param_name)
+    {
+    case CL_PROGRAM_BUILD_STATUS:  return return_info(program->build_status, param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_BUILD_OPTIONS: return return_info(program->options, param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_BUILD_LOG:     return return_info("", param_value_size, param_value, param_value_size_ret);
+    case CL_PROGRAM_BINARY_TYPE:   return return_info(cl_program_binary_type(CL_PROGRAM_BINARY_TYPE_EXECUTABLE), param_value_size, param_value, param_value_size_ret);
+    default:                       return CL_INVALID_VALUE;
+    }
+}
+
+cl_kernel CL_API_CALL clCreateKernel(cl_program program, const char* kernel_name, cl_int* errcode_ret)
+{
+    if (program == nullptr)
+        return set_error<_cl_kernel>(errcode_ret, CL_INVALID_PROGRAM);
+    if (program->build_status != CL_BUILD_SUCCESS)
+        return set_error<_cl_kernel>(errcode_ret, CL_INVALID_PROGRAM_EXECUTABLE);
+    if (kernel_name == nullptr)
+        return set_error<_cl_kernel>(errcode_ret, CL_INVALID_VALUE);
+    if (std::find(program->kernel_names.begin(), program->kernel_names.end(), kernel_name) == program->kernel_names.end())
+        return set_error<_cl_kernel>(errcode_ret, CL_INVALID_KERNEL_NAME);
+
+    return set_error(errcode_ret, CL_SUCCESS, new _cl_kernel(program, kernel_name));
+}
+
+cl_int CL_API_CALL clCreateKernelsInProgram(cl_program program, cl_uint num_kernels, cl_kernel* kernels,
+                                            cl_uint* num_kernels_ret)
+{
+    if (program == nullptr)
+        return CL_INVALID_PROGRAM;
+    if (program->build_status != CL_BUILD_SUCCESS)
+        return CL_INVALID_PROGRAM_EXECUTABLE;
+
+    const auto count = static_cast<cl_uint>(program->kernel_names.size());
+    if (kernels != nullptr)
+    {
+        if (num_kernels < count)
+            return CL_INVALID_VALUE;
+        for (cl_uint i = 0; i < count; i++)
+            kernels[i] = new _cl_kernel(program, program->kernel_names[i]);
+    }
+    if (num_kernels_ret != nullptr)
+        *num_kernels_ret = count;
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL clRetainKernel(cl_kernel kernel)
+{
+    return retain(kernel, CL_INVALID_KERNEL);
+}
+
+cl_int CL_API_CALL clReleaseKernel(cl_kernel kernel)
+{
+    return release(kernel, CL_INVALID_KERNEL);
+}
+
+cl_int CL_API_CALL clSetKernelArg(cl_kernel kernel, cl_uint, size_t arg_size, const void* arg_value)
+{
+    if (kernel == nullptr)
+        return CL_INVALID_KERNEL;
+    // local memory arguments are given by size only, other arguments need a value
+    if (arg_size == 0 && arg_value == nullptr)
+        return CL_INVALID_ARG_SIZE;
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL clGetKernelInfo(cl_kernel kernel, cl_kernel_info param_name, size_t param_value_size,
+                                   void* param_value, size_t* param_value_size_ret)
+{
+    if (kernel == nullptr)
+        return CL_INVALID_KERNEL;
+
+    switch (param_name)
+    {
+    case CL_KERNEL_FUNCTION_NAME:   return return_info(kernel->name, param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_NUM_ARGS:        return return_info(cl_uint(0), param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_REFERENCE_COUNT: return return_info(cl_uint(kernel->ref_count), param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_CONTEXT:         return return_info(kernel->program->context, param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_PROGRAM:         return return_info(kernel->program, param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_ATTRIBUTES:      return return_info("", param_value_size, param_value, param_value_size_ret);
+    default:                        return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clGetKernelWorkGroupInfo(cl_kernel kernel, cl_device_id device, cl_kernel_work_group_info param_name,
+                                            size_t param_value_size, void* param_value, size_t* param_value_size_ret)
+{
+    if (kernel == nullptr)
+        return CL_INVALID_KERNEL;
+    if (device != nullptr && device != &the_device)
+        return CL_INVALID_DEVICE;
+
+    switch (param_name)
+    {
+    case CL_KERNEL_WORK_GROUP_SIZE:                    return return_info(size_t(256), param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_COMPILE_WORK_GROUP_SIZE:            return return_info(std::vector<size_t>{ 0, 0, 0 }, param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_LOCAL_MEM_SIZE:
+    case CL_KERNEL_PRIVATE_MEM_SIZE:                   return return_info(cl_ulong(0), param_value_size, param_value, param_value_size_ret);
+    case CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE: return return_info(size_t(16), param_value_size, param_value, param_value_size_ret);
+    default:                                           return CL_INVALID_VALUE;
+    }
+}
+
+// ----------------------------------------------------- Events --------------------------------------------------------
+
+cl_event CL_API_CALL clCreateUserEvent(cl_context context, cl_int* errcode_ret)
+{
+    if (context == nullptr)
+        return set_error<_cl_event>(errcode_ret, CL_INVALID_CONTEXT);
+    return set_error(errcode_ret, CL_SUCCESS, new _cl_event(context));
+}
+
+cl_int CL_API_CALL clSetUserEventStatus(cl_event event, cl_int execution_status)
+{
+    if (event == nullptr || event->queue != nullptr)
+        return CL_INVALID_EVENT;
+    if (execution_status > CL_COMPLETE)
+        return CL_INVALID_VALUE;
+
+    std::vector<std::function<void()>> callbacks;
+    {
+        std::lock_guard<std::mutex> lock(event->mutex);
+        if (event->user_status <= CL_COMPLETE)
+            return CL_INVALID_OPERATION;
+        event->user_status = execution_status;
+        event->end = clock_type::now();
+        callbacks.swap(event->user_callbacks);
+    }
+    event->cv.notify_all();
+
+    for (auto& callback : callbacks)
+        callbacks_thread::instance().schedule(event->end, std::move(callback));
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL clSetEventCallback(cl_event event, cl_int command_exec_callback_type,
+                                      void (CL_CALLBACK* pfn_notify)(cl_event, cl_int, void*), void* user_data)
+{
+    if (event == nullptr)
+        return CL_INVALID_EVENT;
+    if (pfn_notify == nullptr || (command_exec_callback_type != CL_COMPLETE &&
+                                  command_exec_callback_type != CL_RUNNING &&
+                                  command_exec_callback_type != CL_SUBMITTED))
+        return CL_INVALID_VALUE;
+
+    event->retain();
+    auto callback = [=]
+    {
+        pfn_notify(event, command_exec_callback_type, user_data);
+        event->release();
+    };
+
+    if (event->queue == nullptr)
+    {
+        std::unique_lock<std::mutex> lock(event->mutex);
+        if (event->user_status > CL_COMPLETE)
+        {
+            event->user_callbacks.push_back(callback);
+            return CL_SUCCESS;
+        }
+    }
+
+    auto time = event->end;
+    if (command_exec_callback_type == CL_RUNNING)
+        time = event->start;
+    else if (command_exec_callback_type == CL_SUBMITTED)
+        time = event->queued;
+    callbacks_thread::instance().schedule(time, callback);
+    return CL_SUCCESS;
+}
+
+cl_int CL_API_CALL clWaitForEvents(cl_uint num_events, const cl_event* event_list)
+{
+    if (num_events == 0 || !is_valid_wait_list(num_events, event_list))
+        return num_events == 0 ? CL_INVALID_VALUE : CL_INVALID_EVENT;
+
+    cl_int result = CL_SUCCESS;
+    for (cl_uint i = 0; i < num_events; i++)
+    {
+        if (event_list[i]->wait() < 0)
+            result = CL_EXEC_STATUS_ERROR_FOR_EVENTS_IN_WAIT_LIST;
+    }
+    return result;
+}
+
+cl_int CL_API_CALL clGetEventInfo(cl_event event, cl_event_info param_name, size_t param_value_size,
+                                  void* param_value, size_t* param_value_size_ret)
+{
+    if (event == nullptr)
+        return CL_INVALID_EVENT;
+
+    switch (param_name)
+    {
+    case CL_EVENT_COMMAND_QUEUE:            return return_info(event->queue, param_value_size, param_value, param_value_size_ret);
+    case CL_EVENT_CONTEXT:                  return return_info(event->context, param_value_size, param_value, param_value_size_ret);
+    case CL_EVENT_COMMAND_TYPE:             return return_info(event->command_type, param_value_size, param_value, param_value_size_ret);
+    case CL_EVENT_COMMAND_EXECUTION_STATUS: return return_info(event->status(), param_value_size, param_value, param_value_size_ret);
+    case CL_EVENT_REFERENCE_COUNT:          return return_info(cl_uint(event->ref_count), param_value_size, param_value, param_value_size_ret);
+    default:                                return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clGetEventProfilingInfo(cl_event event, cl_profiling_info param_name, size_t param_value_size,
+                                           void* param_value, size_t* param_value_size_ret)
+{
+    if (event == nullptr)
+        return CL_INVALID_EVENT;
+    if (event->queue == nullptr || (event->queue->properties & CL_QUEUE_PROFILING_ENABLE) == 0 || event->status() != CL_COMPLETE)
+        return CL_PROFILING_INFO_NOT_AVAILABLE;
+
+    switch (param_name)
+    {
+    case CL_PROFILING_COMMAND_QUEUED:
+    case CL_PROFILING_COMMAND_SUBMIT:   return return_info(to_device_timestamp(event->queued), param_value_size, param_value, param_value_size_ret);
+    case CL_PROFILING_COMMAND_START:    return return_info(to_device_timestamp(event->start), param_value_size, param_value, param_value_size_ret);
+    case CL_PROFILING_COMMAND_END:
+    case CL_PROFILING_COMMAND_COMPLETE: return return_info(to_device_timestamp(event->end), param_value_size, param_value, param_value_size_ret);
+    default:                            return CL_INVALID_VALUE;
+    }
+}
+
+cl_int CL_API_CALL clRetainEvent(cl_event event)
+{
+    return retain(event, CL_INVALID_EVENT);
+}
+
+cl_int CL_API_CALL clReleaseEvent(cl_event event)
+{
+    return release(event, CL_INVALID_EVENT);
+}
+
+// ---------------------------------------------------- Enqueues -------------------------------------------------------
+
+cl_int CL_API_CALL clEnqueueNDRangeKernel(cl_command_queue command_queue, cl_kernel kernel, cl_uint work_dim,
+                                          const size_t*, const size_t* global_work_size,
+                                          const size_t* local_work_size, cl_uint num_events_in_wait_list,
+                                          const cl_event* event_wait_list, cl_event* event)
+{
+    if (kernel == nullptr)
+        return CL_INVALID_KERNEL;
+    if (work_dim < 1 || work_dim > 3)
+        return CL_INVALID_WORK_DIMENSION;
+    if (global_work_size == nullptr)
+        return CL_INVALID_GLOBAL_WORK_SIZE;
+
+    size_t work_group_size = 1;
+    for (cl_uint i = 0; i < work_dim; i++)
+    {
+        if (global_work_size[i] == 0)
+            return CL_INVALID_GLOBAL_WORK_SIZE;
+        if (local_work_size != nullptr)
+        {
+            if (local_work_size[i] == 0 || global_work_size[i] % local_work_size[i] != 0)
+                return CL_INVALID_WORK_GROUP_SIZE;
+            work_group_size *= local_work_size[i];
+        }
+    }
+    if (work_group_size > 256)
+        return CL_INVALID_WORK_GROUP_SIZE;
+
+    return enqueue(command_queue, CL_COMMAND_NDRANGE_KERNEL, get_settings().kernel_latency,
+                   num_events_in_wait_list, event_wait_list, event);
+}
+
+cl_int CL_API_CALL clEnqueueMarkerWithWaitList(cl_command_queue command_queue, cl_uint num_events_in_wait_list,
+                                               const cl_event* event_wait_list, cl_event* event)
+{
+    // marker without events waits for all previously enqueued commands
+    return enqueue(command_queue, CL_COMMAND_MARKER, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                   event_wait_list, event, false, num_events_in_wait_list == 0);
+}
+
+cl_int CL_API_CALL clEnqueueBarrierWithWaitList(cl_command_queue command_queue, cl_uint num_events_in_wait_list,
+                                                const cl_event* event_wait_list, cl_event* event)
+{
+    return enqueue(command_queue, CL_COMMAND_BARRIER, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                   event_wait_list, event, false, true);
+}
+
+cl_int CL_API_CALL clEnqueueReadBuffer(cl_command_queue command_queue, cl_mem buffer, cl_bool blocking_read,
+                                       size_t offset, size_t size, void* ptr, cl_uint num_events_in_wait_list,
+                                       const cl_event* event_wait_list, cl_event* event)
+{
+    if (buffer == nullptr || buffer->type != CL_MEM_OBJECT_BUFFER)
+        return CL_INVALID_MEM_OBJECT;
+    if (ptr == nullptr || offset + size > buffer->size)
+        return CL_INVALID_VALUE;
+
+    std::memcpy(ptr, buffer->data + offset, size);
+    return enqueue(command_queue, CL_COMMAND_READ_BUFFER, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                   event_wait_list, event, blocking_read == CL_TRUE);
+}
+
+cl_int CL_API_CALL clEnqueueWriteBuffer(cl_command_queue command_queue, cl_mem buffer, cl_bool blocking_write,
+                                        size_t offset, size_t size, const void* ptr, cl_uint num_events_in_wait_list,
+                                        const cl_event* event_wait_list, cl_event* event)
+{
+    if (buffer == nullptr || buffer->type != CL_MEM_OBJECT_BUFFER)
+        return CL_INVALID_MEM_OBJECT;
+    if (ptr == nullptr || offset + size > buffer->size)
+        return CL_INVALID_VALUE;
+
+    std::memcpy(buffer->data + offset, ptr, size);
+    return enqueue(command_queue, CL_COMMAND_WRITE_BUFFER, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                   event_wait_list, event, blocking_write == CL_TRUE);
+}
+
+cl_int CL_API_CALL clEnqueueCopyBuffer(cl_command_queue command_queue, cl_mem src_buffer, cl_mem dst_buffer,
+                                       size_t src_offset, size_t dst_offset, size_t size,
+                                       cl_uint num_events_in_wait_list, const cl_event* event_wait_list,
+                                       cl_event* event)
+{
+    if (src_buffer == nullptr || dst_buffer == nullptr ||
+        src_buffer->type != CL_MEM_OBJECT_BUFFER || dst_buffer->type != CL_MEM_OBJECT_BUFFER)
+        return CL_INVALID_MEM_OBJECT;
+    if (src_offset + size > src_buffer->size || dst_offset + size > dst_buffer->size)
+        return CL_INVALID_VALUE;
+
+    std::memmove(dst_buffer->data + dst_offset, src_buffer->data + src_offset, size);
+    return enqueue(command_queue, CL_COMMAND_COPY_BUFFER, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                   event_wait_list, event);
+}
+
+cl_int CL_API_CALL clEnqueueFillBuffer(cl_command_queue command_queue, cl_mem buffer, const void* pattern,
+                                       size_t pattern_size, size_t offset, size_t size,
+                                       cl_uint num_events_in_wait_list, const cl_event* event_wait_list,
+                                       cl_event* event)
+{
+    if (buffer == nullptr || buffer->type != CL_MEM_OBJECT_BUFFER)
+        return CL_INVALID_MEM_OBJECT;
+    if (pattern == nullptr || pattern_size == 0 || offset % pattern_size != 0 || size % pattern_size != 0 ||
+        offset + size > buffer->size)
+        return CL_INVALID_VALUE;
+
+    for (size_t pos = offset; pos < offset + size; pos += pattern_size)
+        std::memcpy(buffer->data + pos, pattern, pattern_size);
+    return enqueue(command_queue, CL_COMMAND_FILL_BUFFER, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                   event_wait_list, event);
+}
+
+cl_int CL_API_CALL clEnqueueFillImage(cl_command_queue command_queue, cl_mem image, const void* fill_color,
+                                      const size_t* origin, const size_t* region, cl_uint num_events_in_wait_list,
+                                      const cl_event* event_wait_list, cl_event* event)
+{
+    if (image == nullptr || image->type != CL_MEM_OBJECT_IMAGE2D)
+        return CL_INVALID_MEM_OBJECT;
+    if (fill_color == nullptr || origin == nullptr || region == nullptr ||
+        origin[0] + region[0] > image->width || origin[1] + region[1] > image->height)
+        return CL_INVALID_VALUE;
+
+    // the color is converted only for 32 bit channels, images of other types are cleared
+    std::vector<char> pixel(image->element_size, 0);
+    const auto data_type = image->image_format.image_channel_data_type;
+    if (data_type == CL_FLOAT || data_type == CL_SIGNED_INT32 || data_type == CL_UNSIGNED_INT32)
+        std::memcpy(pixel.data(), fill_color, std::min<size_t>(pixel.size(), 4 * sizeof(cl_uint)));
+
+    for (size_t y = origin[1]; y < origin[1] + region[1]; y++)
+    {
+        for (size_t x = origin[0]; x < origin[0] + region[0]; x++)
+            std::memcpy(image->data + y * image->row_pitch + x * image->element_size, pixel.data(), pixel.size());
+    }
+    return enqueue(command_queue, CL_COMMAND_FILL_IMAGE, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                   event_wait_list, event);
+}
+
+void* CL_API_CALL clEnqueueMapBuffer(cl_command_queue command_queue, cl_mem buffer, cl_bool blocking_map,
+                                     cl_map_flags, size_t offset, size_t size, cl_uint num_events_in_wait_list,
+                                     const cl_event* event_wait_list, cl_event* event, cl_int* errcode_ret)
+{
+    if (buffer == nullptr || buffer->type != CL_MEM_OBJECT_BUFFER)
+        return set_error<void>(errcode_ret, CL_INVALID_MEM_OBJECT);
+    if (offset + size > buffer->size)
+        return set_error<void>(errcode_ret, CL_INVALID_VALUE);
+
+    auto err = enqueue(command_queue, CL_COMMAND_MAP_BUFFER, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                       event_wait_list, event, blocking_map == CL_TRUE);
+    if (err != CL_SUCCESS)
+        return set_error<void>(errcode_ret, err);
+
+    ++buffer->map_count;
+    return set_error<void>(errcode_ret, CL_SUCCESS, buffer->data + offset);
+}
+
+void* CL_API_CALL clEnqueueMapImage(cl_command_queue command_queue, cl_mem image, cl_bool blocking_map, cl_map_flags,
+                                    const size_t* origin, const size_t* region, size_t* image_row_pitch,
+                                    size_t* image_slice_pitch, cl_uint num_events_in_wait_list,
+                                    const cl_event* event_wait_list, cl_event* event, cl_int* errcode_ret)
+{
+    if (image == nullptr || image->type != CL_MEM_OBJECT_IMAGE2D)
+        return set_error<void>(errcode_ret, CL_INVALID_MEM_OBJECT);
+    if (origin == nullptr || region == nullptr || image_row_pitch == nullptr ||
+        origin[0] + region[0] > image->width || origin[1] + region[1] > image->height)
+        return set_error<void>(errcode_ret, CL_INVALID_VALUE);
+
+    auto err = enqueue(command_queue, CL_COMMAND_MAP_IMAGE, std::chrono::nanoseconds(0), num_events_in_wait_list,
+                       event_wait_list, event, blocking_map == CL_TRUE);
+    if (err != CL_SUCCESS)
+        return set_error<void>(errcode_ret, err);
+
+    *image_row_pitch = image->row_pitch;
+    if (image_slice_pitch != nullptr)
+        *image_slice_pitch = 0;
+    ++image->map_count;
+    return set_error<void>(errcode_ret, CL_SUCCESS, image->data + origin[1] * image->row_pitch + origin[0] * image->element_size);
+}
+
+cl_int CL_API_CALL clEnqueueUnmapMemObject(cl_command_queue command_queue, cl_mem memobj, void*,
+                                           cl_uint num_events_in_wait_list, const cl_event* event_wait_list,
+                                           cl_event* event)
+{
+    if (memobj == nullptr)
+        return CL_INVALID_MEM_OBJECT;
+    if (memobj->map_count == 0)
+        return CL_INVALID_VALUE;
+
+    auto err = enqueue(command_queue, CL_COMMAND_UNMAP_MEM_OBJECT, std::chrono::nanoseconds(0),
+                       num_events_in_wait_list, event_wait_list, event);
+    if (err == CL_SUCCESS)
+        --memobj->map_count;
+    return err;
+}
+
+}
@@ -0,0 +1,127 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "build_profiler.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+namespace cldnn
+{
+namespace
+{
+    std::string escape_json(const std::string& str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        for (auto c : str)
+        {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            if (static_cast<unsigned char>(c) < 0x20)
+                continue;
+            result += c;
+        }
+        return result;
+    }
+
+    double to_microseconds(std::chrono::nanoseconds time)
+    {
+        return std::chrono::duration<double, std::micro>(time).count();
+    }
+}
+
+build_profiler::scope::scope(build_profiler* profiler, std::string category, std::string name, uint64_t items_in)
+    : _profiler(profiler)
+    , _items_in(items_in)
+{
+    if (!_profiler)
+        return;
+
+    _category = std::move(category);
+    _name = std::move(name);
+    _start = clock::now();
+    std::lock_guard<std::mutex> lock(_profiler->_mutex);
+    _profiler->_running_scopes.push_back(_name);
+}
+
+build_profiler::scope::~scope()
+{
+    if (!_profiler)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(_profiler->_mutex);
+        _profiler->_running_scopes.pop_back();
+    }
+    _profiler->add(std::move(_category), std::move(_name), _start, clock::now(), _items_in, _items_out, std::move(_details));
+}
+
+void build_profiler::add(std::string category, std::string name, clock::time_point start, clock::time_point end, uint64_t items_in, uint64_t items_out,
+                         std::string details)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.push_back({ std::move(category), std::move(name),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - _start),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start),
+        items_in, items_out, std::move(details) });
+}
+
+void build_profiler::add_entries_of(const build_profiler& other, const std::vector<std::string>& categories)
+{
+    std::lock(_mutex, other._mutex);
+    std::lock_guard<std::mutex> lock(_mutex, std::adopt_lock);
+    std::lock_guard<std::mutex> other_lock(other._mutex, std::adopt_lock);
+    auto offset = std::chrono::duration_cast<std::chrono::nanoseconds>(other._start - _start);
+    for (const auto& e : other._entries)
+    {
+        if (std::find(categories.begin(), categories.end(), e.category) == categories.end())
+            continue;
+        _entries.push_back(e);
+        _entries.back().start += offset;
+    }
+}
+
+std::string build_profiler::get_current_scope() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _running_scopes.empty() ? std::string() : _running_scopes.back();
+}
+
+void build_profiler::dump_chrome_trace(const std::string& path, uint32_t process_id) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& entries = _entries;
+
+    std::ofstream trace(path);
+    trace << std::fixed << std::setprecision(3);
+    trace << "{\"traceEvents\":[";
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        auto& e = entries[i];
+        trace << (i == 0 ? "\n" : ",\n")
+              << "{\"name\":\"" << escape_json(e.name) << "\",\"cat\":\"" << escape_json(e.category) << "\",\"ph\":\"X\""
+              << ",\"ts\":" << to_microseconds(e.start) << ",\"dur\":" << to_microseconds(e.duration)
+              << ",\"pid\":" << process_id << ",\"tid\":0"
+              << ",\"args\":{\"items_in\":" << e.items_in << ",\"items_out\":" << e.items_out
+              << ",\"details\":\"" << escape_json(e.details) << "\"}}";
+    }
+    trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+}
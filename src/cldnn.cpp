@@ -24,6 +24,8 @@
 #include "network_impl.h"
 #include "memory_impl.h"
 #include "primitive_inst.h"
+#include "layout_conversion.h"
+#include "build_profiler.h"
 
 namespace cldnn {
     last_err& last_err::instance()
@@ -178,7 +180,7 @@ void cldnn_release_topology(cldnn_topology topology, cldnn_status* status)
 
 uint32_t cldnn_get_engine_count(/*cldnn_engine_type*/ int32_t type, cldnn_status* status)
 {
-    if (type == cldnn_engine_type::cldnn_engine_ocl)
+    if (type == cldnn_engine_type::cldnn_engine_ocl || type == cldnn_engine_type::cldnn_engine_cpu)
     {
         if (status) *status = CLDNN_SUCCESS;
         return 1;
@@ -201,7 +203,7 @@ void cldnn_release_pending_memory(cldnn_engine engine, cldnn_status* status)
 
 cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t engine_num, const cldnn_engine_configuration* configuration, cldnn_status* status)
 {
-    if (engine_num > 0 || (type != cldnn_engine_type::cldnn_engine_ocl))
+    if (engine_num > 0 || (type != cldnn_engine_type::cldnn_engine_ocl && type != cldnn_engine_type::cldnn_engine_cpu))
     {
         if (status)
             *status = CLDNN_DEVICE_ERROR;
@@ -210,7 +212,8 @@ cldnn_engine cldnn_create_engine(/*cldnn_engine_type*/ int32_t type, uint32_t en
 
     return exception_handler<cldnn_engine>(CLDNN_ERROR, status, nullptr, [&]()
     {
-        return api_cast(new cldnn::engine_impl(configuration ? cldnn::engine_configuration(*configuration) : cldnn::engine_configuration()));
+        return api_cast(new cldnn::engine_impl(static_cast<cldnn::engine_types>(type),
+                                               configuration ? cldnn::engine_configuration(*configuration) : cldnn::engine_configuration()));
     });
 }
 
@@ -237,7 +240,7 @@ cldnn_engine_info cldnn_get_engine_info(cldnn_engine engine, cldnn_status* statu
     return exception_handler<cldnn_engine_info>(CLDNN_ERROR, status, { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, [&]() -> cldnn_engine_info
     {
         SHOULD_NOT_BE_NULL(engine, "Engine");
-        auto info = api_cast(engine)->get_engine_info();
+        const auto& info = api_cast(engine)->get_engine_info();
         return
         {
             info.cores_count,
@@ -415,6 +418,44 @@ void cldnn_release_program(cldnn_program program, cldnn_status* status)
     });
 }
 
+void cldnn_get_program_build_profiling_info(cldnn_program program, cldnn_build_profiling_entry* entries, size_t size, size_t* size_ret, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(program, "Program");
+        if (!entries && !size_ret)
+        {
+            if (status) *status = CLDNN_INVALID_ARG;
+            return;
+        }
+        static const std::vector<build_profiler::entry> not_recorded;
+        auto profiler = api_cast(program)->get_build_profiler();
+        auto& profiling_info = profiler ? profiler->get_entries() : not_recorded;
+        if (size_ret)
+            *size_ret = profiling_info.size();
+        if (entries != nullptr)
+        {
+            if (size != profiling_info.size())
+            {
+                if (status) *status = CLDNN_INVALID_ARG;
+                return;
+            }
+            size_t i = 0;
+            for (auto& info : profiling_info)
+            {
+                entries[i].category = info.category.c_str();
+                entries[i].name = info.name.c_str();
+                entries[i].start_nanoseconds = info.start.count();
+                entries[i].nanoseconds = info.duration.count();
+                entries[i].items_in = info.items_in;
+                entries[i].items_out = info.items_out;
+                entries[i].details = info.details.c_str();
+                ++i;
+            }
+        }
+    });
+}
+
 cldnn_network cldnn_allocate_network(cldnn_program program, cldnn_status* status)
 {
     return exception_handler<cldnn_network>(CLDNN_ERROR, status, nullptr, [&]()
@@ -586,6 +627,73 @@ void cldnn_execute_network(cldnn_network network, cldnn_event* dependencies, siz
     });
 }
 
+void cldnn_get_network_profiling_stats(cldnn_network network, cldnn_primitive_profiling_stats* stats, size_t size, size_t* size_ret, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        auto profiler = api_cast(network)->get_profiler();
+        SHOULD_NOT_BE_NULL(profiler, "Network profiler");
+        if (!stats && !size_ret)
+        {
+            if (status) *status = CLDNN_INVALID_ARG;
+            return;
+        }
+        auto& profiling_stats = profiler->get_stats();
+        if (size_ret)
+            *size_ret = profiling_stats.size();
+        if (stats != nullptr)
+        {
+            if (size != profiling_stats.size())
+            {
+                if (status) *status = CLDNN_INVALID_ARG;
+                return;
+            }
+            size_t i = 0;
+            for (auto& s : profiling_stats)
+            {
+                stats[i].primitive_id = s.id.c_str();
+                stats[i].kernel_name = s.kernel_name.c_str();
+                stats[i].original_ids = s.original_ids.c_str();
+                stats[i].count = s.count;
+                stats[i].min_nanoseconds = s.min.count();
+                stats[i].median_nanoseconds = s.median.count();
+                stats[i].p99_nanoseconds = s.p99.count();
+                stats[i].total_nanoseconds = s.total.count();
+                stats[i].queued_to_start_median_nanoseconds = s.queued_to_start_median.count();
+                stats[i].enqueue_median_nanoseconds = s.enqueue_median.count();
+                stats[i].enqueue_total_nanoseconds = s.enqueue_total.count();
+                ++i;
+            }
+        }
+    });
+}
+
+void cldnn_reset_network_profiling_stats(cldnn_network network, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        auto profiler = api_cast(network)->get_profiler();
+        SHOULD_NOT_BE_NULL(profiler, "Network profiler");
+        profiler->reset();
+    });
+}
+
+void cldnn_dump_network_profiling_stats(cldnn_network network, const char* trace_path, const char* csv_path, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        auto profiler = api_cast(network)->get_profiler();
+        SHOULD_NOT_BE_NULL(profiler, "Network profiler");
+        if (trace_path)
+            profiler->dump_chrome_trace(trace_path);
+        if (csv_path)
+            profiler->dump_csv(csv_path);
+    });
+}
+
 cldnn_network_output cldnn_get_network_output(cldnn_network network, const char* name, cldnn_status* status)
 {
     cldnn_network_output error_result = { nullptr, nullptr };
@@ -595,8 +703,7 @@ cldnn_network_output cldnn_get_network_output(cldnn_network network, const char*
         SHOULD_NOT_BE_NULL(name,    "ID of primitive");
         cldnn::primitive_id id(name);
         auto event = api_cast(network)->get_primitive_event(id);
-        auto& mem_result = api_cast(network)->get_primitive(id)->output_memory();
-        refcounted_obj_ptr<cldnn::memory_impl> mem_ptr{&mem_result};
+        auto mem_ptr = api_cast(network)->get_output_memory(id);
         return{
                 api_cast(event.detach()),
                 api_cast(mem_ptr.detach())
@@ -604,6 +711,40 @@ cldnn_network_output cldnn_get_network_output(cldnn_network network, const char*
     });
 }
 
+size_t cldnn_get_network_output_handle(cldnn_network network, cldnn_primitive_id name, cldnn_status* status)
+{
+    return exception_handler<size_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        SHOULD_NOT_BE_NULL(name,    "ID of primitive");
+        return api_cast(network)->get_output_handle(name);
+    });
+}
+
+void cldnn_get_network_outputs(cldnn_network network, const size_t* handles, cldnn_network_output* outputs, size_t size, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        if (size == 0)
+            return;
+        SHOULD_NOT_BE_NULL(handles, "Output handles");
+        SHOULD_NOT_BE_NULL(outputs, "Outputs");
+        // all handles are checked first, so nothing is retained for the caller when one of them is invalid
+        for (size_t i = 0; i < size; i++)
+            api_cast(network)->get_output_event(handles[i]);
+        for (size_t i = 0; i < size; i++)
+        {
+            auto event = api_cast(network)->get_output_event(handles[i]);
+            auto mem_ptr = api_cast(network)->get_output_memory(handles[i]);
+            outputs[i] = {
+                api_cast(event.detach()),
+                api_cast(mem_ptr.detach())
+            };
+        }
+    });
+}
+
 cldnn_memory cldnn_get_network_output_memory(cldnn_network network, const char* name, cldnn_status* status)
 {
     cldnn_memory error_result =  nullptr;
@@ -612,8 +753,7 @@ cldnn_memory cldnn_get_network_output_memory(cldnn_network network, const char*
         SHOULD_NOT_BE_NULL(network, "Network");
         SHOULD_NOT_BE_NULL(name, "ID of primitive");
         cldnn::primitive_id id(name);
-        auto& mem_result = api_cast(network)->get_primitive(id)->output_memory();
-        refcounted_obj_ptr<cldnn::memory_impl> mem_ptr{&mem_result};
+        auto mem_ptr = api_cast(network)->get_output_memory(id);
         return api_cast(mem_ptr.detach());
     });
 }
@@ -743,6 +883,14 @@ cldnn_engine cldnn_get_memory_engine(cldnn_memory memory, cldnn_status* status)
     });
 }
 
+void cldnn_convert_layout(cldnn_layout src_layout, const void* src, cldnn_layout dst_layout, void* dst, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        cldnn::convert_layout(src_layout, src, dst_layout, dst);
+    });
+}
+
 const char* cldnn_get_last_error_message()
 {
     try {
@@ -771,6 +919,30 @@ CLDNN_API float cldnn_half_to_float(uint16_t value, cldnn_status* status)
     });
 }
 
+CLDNN_API void cldnn_float_to_half_array(const float* src, uint16_t* dst, size_t count, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        if (count == 0)
+            return;
+        SHOULD_NOT_BE_NULL(src, "Source");
+        SHOULD_NOT_BE_NULL(dst, "Destination");
+        cldnn::float_to_half(src, dst, count);
+    });
+}
+
+CLDNN_API void cldnn_half_to_float_array(const uint16_t* src, float* dst, size_t count, cldnn_status* status)
+{
+    return exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        if (count == 0)
+            return;
+        SHOULD_NOT_BE_NULL(src, "Source");
+        SHOULD_NOT_BE_NULL(dst, "Destination");
+        cldnn::half_to_float(src, dst, count);
+    });
+}
+
 } /* extern "C" */
 
 #define PRIMITIVE_TYPE_ID_CALL_IMPL(PType) \
@@ -73,6 +73,7 @@ condition_inst::typed_primitive_inst(network_impl& network, condition_node const
     : parent(network, node)
     , _net_true(node.get_program().get_engine().allocate_network(*node.get_branch_true(), true))
     , _net_false(node.get_program().get_engine().allocate_network(*node.get_branch_false(), true))
+    , _flag(network.get_engine().allocate_memory({ data_types::i32, format::bfyx, { 1, 1, 1, 1 } }))
 {
     auto compare_tensor = node.compare().get_output_layout().size;
     auto input_tensor = node.input().get_output_layout().size;
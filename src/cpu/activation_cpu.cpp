@@ -0,0 +1,78 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "activation_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace cpu {
+
+struct activation_cpu : typed_primitive_cpu_impl<activation>
+{
+    using parent = typed_primitive_cpu_impl<activation>;
+    using parent::parent;
+
+protected:
+    void compute(activation_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+
+        dense_input input(instance.input_memory());
+        std::copy(input.data(), input.data() + count(out_dims), output);
+
+        if (!_outer.is_parameterized())
+        {
+            apply_activation(pool, output, out_dims, prim->activation_func, prim->additional_params);
+            return;
+        }
+
+        // clamp and linear take both parameters from the slope input, other functions only the first one
+        const size_t params_num = (prim->activation_func == activation_clamp || prim->activation_func == activation_linear) ? 2 : 1;
+        dense_input slope(instance.slope_memory());
+        CLDNN_ERROR_LESS_THAN(_outer.id(), "Slope count", count(slope.dims()), "features * params_num", out_dims[1] * params_num,
+                              "Error - not enough data inside additional params buffer");
+        apply_activation(pool, output, out_dims, prim->activation_func, prim->additional_params, slope.data(), params_num);
+    }
+
+public:
+    static primitive_impl* create(const activation_node& arg)
+    {
+        return new activation_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<activation>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), activation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), activation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), activation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), activation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), activation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), activation_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
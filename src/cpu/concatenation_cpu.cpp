@@ -0,0 +1,97 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "concatenation_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace cpu {
+
+namespace
+{
+    // index of the axis in dims_t
+    size_t get_axis_index(concatenation::concatenation_axis axis)
+    {
+        switch (axis)
+        {
+        case concatenation::along_b: return 0;
+        case concatenation::along_f: return 1;
+        case concatenation::along_y: return 2;
+        case concatenation::along_x: return 3;
+        default:
+            throw error("CPU engine does not support concatenation along z", CLDNN_ERROR);
+        }
+    }
+}
+
+struct concatenation_cpu : typed_primitive_cpu_impl<concatenation>
+{
+    using parent = typed_primitive_cpu_impl<concatenation>;
+    using parent::parent;
+
+protected:
+    void compute(concatenation_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const size_t axis = get_axis_index(_outer.get_primitive()->axis);
+
+        // every input is a sequence of 'outer' contiguous chunks, placed side by side with chunks of other inputs
+        size_t outer = 1;
+        for (size_t i = 0; i < axis; i++)
+            outer *= out_dims[i];
+        const size_t out_chunk = count(out_dims) / outer;
+
+        size_t offset = 0;
+        for (size_t i = 0; i < _outer.inputs_count(); i++)
+        {
+            dense_input input(instance.input_memory(i));
+            const size_t chunk = count(input.dims()) / outer;
+            pool.parallel_for(outer, [&](size_t o)
+            {
+                std::copy(input.data() + o * chunk, input.data() + (o + 1) * chunk, output + o * out_chunk + offset);
+            });
+            offset += chunk;
+        }
+    }
+
+public:
+    static primitive_impl* create(const concatenation_node& arg)
+    {
+        return new concatenation_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<concatenation>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), concatenation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), concatenation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), concatenation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), concatenation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), concatenation_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), concatenation_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
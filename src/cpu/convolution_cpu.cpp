@@ -0,0 +1,173 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "convolution_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace cpu {
+
+namespace
+{
+    // range [begin, end) of output coordinates, for which input coordinate out * stride + offset is inside the input
+    std::pair<int32_t, int32_t> valid_range(int32_t offset, int32_t stride, int32_t input_size, int32_t output_size)
+    {
+        int32_t begin = offset >= 0 ? 0 : (-offset + stride - 1) / stride;
+        int32_t end = input_size - offset <= 0 ? 0 : (input_size - offset - 1) / stride + 1;
+        return{ std::min(begin, output_size), std::min(end, output_size) };
+    }
+}
+
+struct convolution_cpu : typed_primitive_cpu_impl<convolution>
+{
+    using parent = typed_primitive_cpu_impl<convolution>;
+
+    explicit convolution_cpu(const convolution_node& arg)
+        : parent(arg)
+        , _weights(static_cast<size_t>(buffers_count(arg)))
+        , _biases(static_cast<size_t>(buffers_count(arg)))
+    {}
+
+protected:
+    void compute(convolution_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+        CLDNN_ERROR_BOOL(_outer.id(), "Quantized convolution", _outer.weights_quantization_term() || _outer.output_calibration_term(),
+                         "is not supported by the CPU engine");
+
+        dense_input input(instance.input_memory());
+        const auto& in_dims = input.dims();
+
+        const int32_t buffers = buffers_count(_outer);
+        const int32_t ofm_per_buffer = out_dims[1] / buffers;
+        const int32_t ifm_per_buffer = in_dims[1] / buffers;
+
+        const int32_t stride_x = prim->stride.spatial[0];
+        const int32_t stride_y = prim->stride.spatial[1];
+        const int32_t dilation_x = prim->dilation.spatial[0];
+        const int32_t dilation_y = prim->dilation.spatial[1];
+        const int32_t offset_x = prim->input_offset.spatial[0];
+        const int32_t offset_y = prim->input_offset.spatial[1];
+
+        for (int32_t buffer = 0; buffer < buffers; buffer++)
+        {
+            // weights and biases are converted to dense f32 once, not on every execution
+            auto& weights_memory = instance.weights_memory(buffer);
+            const auto w_dims = get_dims(weights_memory.get_layout().size);
+            const auto& weights = _weights[buffer].get(weights_memory, [](const dense_input& w)
+            {
+                return std::vector<float>(w.data(), w.data() + count(w.dims()));
+            });
+            const int32_t ifm = w_dims[1];
+            const int32_t kernel_y = w_dims[2];
+            const int32_t kernel_x = w_dims[3];
+            // number of groups follows from the input features read by each output feature
+            const int32_t ofm_per_group = ofm_per_buffer / std::max(1, ifm_per_buffer / ifm);
+
+            const std::vector<float> no_bias(ofm_per_buffer, 0.0f);
+            const auto& bias = !_outer.bias_term() ? no_bias : _biases[buffer].get(instance.bias_memory(buffer), [&](const dense_input& b)
+            {
+                return std::vector<float>(b.data(), b.data() + ofm_per_buffer);
+            });
+
+            const size_t planes = static_cast<size_t>(out_dims[0]) * ofm_per_buffer;
+            pool.parallel_for(planes, [&](size_t plane)
+            {
+                const int32_t b = static_cast<int32_t>(plane / ofm_per_buffer);
+                const int32_t ofm = static_cast<int32_t>(plane % ofm_per_buffer);
+                const int32_t first_ifm = buffer * ifm_per_buffer + ofm / ofm_per_group * ifm;
+
+                float* out = output + (static_cast<size_t>(b) * out_dims[1] + buffer * ofm_per_buffer + ofm) * out_dims[2] * out_dims[3];
+                std::fill(out, out + static_cast<size_t>(out_dims[2]) * out_dims[3], bias[ofm]);
+
+                for (int32_t i = 0; i < ifm; i++)
+                {
+                    const float* in = input.data() + (static_cast<size_t>(b) * in_dims[1] + first_ifm + i) * in_dims[2] * in_dims[3];
+                    const float* w = weights.data() + (static_cast<size_t>(ofm) * ifm + i) * kernel_y * kernel_x;
+
+                    for (int32_t ky = 0; ky < kernel_y; ky++)
+                    {
+                        const auto rows = valid_range(offset_y + ky * dilation_y, stride_y, in_dims[2], out_dims[2]);
+                        for (int32_t kx = 0; kx < kernel_x; kx++)
+                        {
+                            const float weight = w[ky * kernel_x + kx];
+                            const int32_t shift_x = offset_x + kx * dilation_x;
+                            const auto columns = valid_range(shift_x, stride_x, in_dims[3], out_dims[3]);
+
+                            for (int32_t oy = rows.first; oy < rows.second; oy++)
+                            {
+                                const float* in_row = in + static_cast<size_t>(oy * stride_y + offset_y + ky * dilation_y) * in_dims[3] + shift_x;
+                                float* out_row = out + static_cast<size_t>(oy) * out_dims[3];
+                                if (stride_x == 1)
+                                {
+                                    for (int32_t ox = columns.first; ox < columns.second; ox++)
+                                        out_row[ox] += weight * in_row[ox];
+                                }
+                                else
+                                {
+                                    for (int32_t ox = columns.first; ox < columns.second; ox++)
+                                        out_row[ox] += weight * in_row[ox * stride_x];
+                                }
+                            }
+                        }
+                    }
+                }
+            });
+        }
+
+        if (prim->with_activation)
+            apply_activation(pool, output, out_dims, activation_relu_negative_slope, { prim->activation_negative_slope, 0.0f });
+    }
+
+public:
+    static primitive_impl* create(const convolution_node& arg)
+    {
+        return new convolution_cpu(arg);
+    }
+
+private:
+    // with groups all weights and biases are in a single buffer, otherwise there is one per split
+    static int32_t buffers_count(const convolution_node& arg)
+    {
+        return arg.get_groups() == 1 ? arg.get_split() : 1;
+    }
+
+    std::vector<prepared_data> _weights;
+    std::vector<prepared_data> _biases;
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<convolution>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), convolution_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), convolution_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), convolution_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), convolution_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), convolution_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), convolution_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
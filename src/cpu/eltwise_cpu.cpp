@@ -0,0 +1,99 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "eltwise_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace cpu {
+
+struct eltwise_cpu : typed_primitive_cpu_impl<eltwise>
+{
+    using parent = typed_primitive_cpu_impl<eltwise>;
+    using parent::parent;
+
+protected:
+    void compute(eltwise_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+        CLDNN_ERROR_BOOL(_outer.id(), "Eltwise with stride or calibration", !prim->stride.empty() || _outer.output_calibration_term(),
+                         "is not supported by the CPU engine");
+
+        // coefficients scale inputs of sum
+        const bool scaled = prim->mode == eltwise_mode::sum && !prim->coefficients.empty();
+
+        for (size_t i = 0; i < _outer.inputs_count(); i++)
+        {
+            dense_input input(instance.input_memory(i));
+            const float* data = input.data();
+
+            std::vector<float> scaled_data;
+            if (scaled && prim->coefficients[i] != 1.0f)
+            {
+                const float coefficient = prim->coefficients[i];
+                scaled_data.resize(count(input.dims()));
+                std::transform(data, data + scaled_data.size(), scaled_data.begin(), [=](float v) { return v * coefficient; });
+                data = scaled_data.data();
+            }
+
+            if (i > 0)
+            {
+                apply_eltwise(pool, prim->mode, output, out_dims, data, input.dims());
+            }
+            else if (input.dims() == out_dims)
+            {
+                std::copy(data, data + count(out_dims), output);
+            }
+            else
+            {
+                std::fill(output, output + count(out_dims), 0.0f);
+                apply_eltwise(pool, eltwise_mode::sum, output, out_dims, data, input.dims());
+            }
+        }
+
+        if (prim->with_activation)
+            apply_activation(pool, output, out_dims, activation_relu_negative_slope, { prim->activation_negative_slope, 0.0f });
+    }
+
+public:
+    static primitive_impl* create(const eltwise_node& arg)
+    {
+        return new eltwise_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<eltwise>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), eltwise_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), eltwise_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), eltwise_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), eltwise_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), eltwise_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), eltwise_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
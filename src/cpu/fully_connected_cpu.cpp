@@ -0,0 +1,115 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "fully_connected_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace cpu {
+
+struct fully_connected_cpu : typed_primitive_cpu_impl<fully_connected>
+{
+    using parent = typed_primitive_cpu_impl<fully_connected>;
+    using parent::parent;
+
+protected:
+    // outputs computed by a task, small enough to keep their accumulators in cache
+    static const size_t block_size = 256;
+
+    void compute(fully_connected_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+        CLDNN_ERROR_BOOL(_outer.id(), "Quantized fully connected", _outer.weights_quantization_term() || _outer.output_calibration_term(),
+                         "is not supported by the CPU engine");
+
+        dense_input input(instance.input_memory());
+        const size_t batch = static_cast<size_t>(input.dims()[0]);
+        const size_t inputs = count(input.dims()) / batch;
+        const size_t outputs = count(out_dims) / batch;
+
+        // weights are transposed once to (input, output) order, so that consecutive outputs are updated by a vector loop
+        const auto& weights = _weights.get(instance.weights_memory(), [&](const dense_input& w)
+        {
+            CLDNN_ERROR_NOT_EQUAL(_outer.id(), "Weights count", count(w.dims()), "inputs * outputs", inputs * outputs, "");
+            std::vector<float> transposed(inputs * outputs);
+            for (size_t o = 0; o < outputs; o++)
+                for (size_t i = 0; i < inputs; i++)
+                    transposed[i * outputs + o] = w.data()[o * inputs + i];
+            return transposed;
+        });
+
+        const std::vector<float> no_bias(outputs, 0.0f);
+        const auto& bias = !_outer.bias_term() ? no_bias : _biases.get(instance.bias_memory(), [&](const dense_input& b)
+        {
+            return std::vector<float>(b.data(), b.data() + outputs);
+        });
+
+        const size_t blocks = (outputs + block_size - 1) / block_size;
+        pool.parallel_for(batch * blocks, [&](size_t task)
+        {
+            const size_t b = task / blocks;
+            const size_t begin = task % blocks * block_size;
+            const size_t end = std::min(begin + block_size, outputs);
+
+            float* out = output + b * outputs;
+            const float* in = input.data() + b * inputs;
+            std::copy(bias.begin() + begin, bias.begin() + end, out + begin);
+            for (size_t i = 0; i < inputs; i++)
+            {
+                const float value = in[i];
+                const float* w = weights.data() + i * outputs;
+                for (size_t o = begin; o < end; o++)
+                    out[o] += value * w[o];
+            }
+        });
+
+        if (prim->with_activation)
+            apply_activation(pool, output, out_dims, activation_relu_negative_slope, { prim->activation_negative_slope, 0.0f });
+    }
+
+public:
+    static primitive_impl* create(const fully_connected_node& arg)
+    {
+        return new fully_connected_cpu(arg);
+    }
+
+private:
+    prepared_data _weights;
+    prepared_data _biases;
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<fully_connected>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), fully_connected_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), fully_connected_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), fully_connected_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), fully_connected_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), fully_connected_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), fully_connected_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
@@ -0,0 +1,116 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "gemm_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace cpu {
+
+struct gemm_cpu : typed_primitive_cpu_impl<gemm>
+{
+    using parent = typed_primitive_cpu_impl<gemm>;
+    using parent::parent;
+
+protected:
+    void compute(gemm_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+        dense_input input1(instance.input_memory(0));
+        dense_input input2(instance.input_memory(1));
+
+        // output is M x N matrix (y, x) per batch, first input is M x K and second K x N (both before transposition)
+        const size_t rows = static_cast<size_t>(out_dims[2]);
+        const size_t columns = static_cast<size_t>(out_dims[3]);
+        const size_t depth = static_cast<size_t>(prim->transpose_input1 ? input1.dims()[2] : input1.dims()[3]);
+        const size_t batch1 = static_cast<size_t>(input1.dims()[0]);
+        const size_t batch2 = static_cast<size_t>(input2.dims()[0]);
+
+        // second matrix is read along rows by the inner loop, so transposed one is transposed back once
+        const float* matrix2 = input2.data();
+        std::vector<float> transposed2;
+        if (prim->transpose_input2)
+        {
+            transposed2.resize(batch2 * depth * columns);
+            for (size_t b = 0; b < batch2; b++)
+                for (size_t n = 0; n < columns; n++)
+                    for (size_t k = 0; k < depth; k++)
+                        transposed2[(b * depth + k) * columns + n] = matrix2[(b * columns + n) * depth + k];
+            matrix2 = transposed2.data();
+        }
+
+        const float alpha = prim->alpha;
+        const float beta = prim->beta;
+        std::unique_ptr<dense_input> input3;
+        if (_outer.inputs_count() > 2)
+            input3.reset(new dense_input(instance.input_memory(2)));
+
+        pool.parallel_for(static_cast<size_t>(out_dims[0]) * rows, [&](size_t task)
+        {
+            const size_t b = task / rows;
+            const size_t m = task % rows;
+            const float* a = input1.data() + b % batch1 * rows * depth;
+            const float* b_matrix = matrix2 + b % batch2 * depth * columns;
+            float* out = output + task * columns;
+
+            std::fill(out, out + columns, 0.0f);
+            for (size_t k = 0; k < depth; k++)
+            {
+                const float value = prim->transpose_input1 ? a[k * rows + m] : a[m * depth + k];
+                const float* row = b_matrix + k * columns;
+                for (size_t n = 0; n < columns; n++)
+                    out[n] += value * row[n];
+            }
+
+            if (input3)
+            {
+                const float* c = input3->data() + (b % input3->dims()[0] * rows + m) * columns;
+                for (size_t n = 0; n < columns; n++)
+                    out[n] = alpha * out[n] + beta * c[n];
+            }
+            else
+            {
+                for (size_t n = 0; n < columns; n++)
+                    out[n] *= alpha;
+            }
+        });
+    }
+
+public:
+    static primitive_impl* create(const gemm_node& arg)
+    {
+        return new gemm_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<gemm>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), gemm_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), gemm_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
@@ -0,0 +1,63 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "host_event.h"
+
+namespace cldnn { namespace cpu {
+
+host_event::host_event(bool set)
+    : user_event(set)
+    , _done(set)
+{
+    _attached = true;
+    if (set)
+        _duration.reset(new cldnn::instrumentation::profiling_period_basic(_timer.uptime()));
+}
+
+void host_event::set_impl()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _duration.reset(new cldnn::instrumentation::profiling_period_basic(_timer.uptime()));
+        _done = true;
+    }
+    _cv.notify_all();
+}
+
+void host_event::wait_impl()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return _done; });
+}
+
+bool host_event::is_set_impl()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _done;
+}
+
+bool host_event::get_profiling_info_impl(std::list<cldnn_profiling_interval>& info)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_duration == nullptr)
+        return false;
+
+    info.push_back({ "duration", static_cast<uint64_t>(_duration->value().count()) });
+    return true;
+}
+
+} }
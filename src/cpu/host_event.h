@@ -0,0 +1,47 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "event_impl.h"
+#include "api/CPP/profiling.hpp"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
+namespace cldnn { namespace cpu {
+
+// Event of the CPU engine. Primitives are executed synchronously, so their events are set on return from execute;
+// events created by the user can be waited for until they are set from another thread.
+struct host_event : public user_event
+{
+    explicit host_event(bool set = false);
+
+private:
+    void set_impl() override;
+    void wait_impl() override;
+    bool is_set_impl() override;
+    bool get_profiling_info_impl(std::list<cldnn_profiling_interval>& info) override;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _done;
+    cldnn::instrumentation::timer<> _timer;
+    std::unique_ptr<cldnn::instrumentation::profiling_period_basic> _duration;
+};
+
+} }
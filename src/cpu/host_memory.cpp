@@ -0,0 +1,68 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "host_memory.h"
+#include "engine_impl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <xmmintrin.h>
+
+namespace cldnn { namespace cpu {
+
+namespace
+{
+    // cache line aligned, so that loops over the buffer can be vectorized without peeling
+    std::shared_ptr<char> allocate_storage(size_t size)
+    {
+        auto ptr = static_cast<char*>(_mm_malloc(std::max<size_t>(size, 1), 64));
+        if (ptr == nullptr)
+            throw std::bad_alloc();
+        return std::shared_ptr<char>(ptr, [](char* p) { _mm_free(p); });
+    }
+}
+
+host_memory::host_memory(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout)
+    : memory_impl(engine, layout, false)
+    , _data(allocate_storage(size()))
+{
+    std::memset(_data.get(), 0, size());
+}
+
+host_memory::host_memory(const refcounted_obj_ptr<engine_impl>& engine, memory_impl& to_copy)
+    : memory_impl(engine, to_copy.get_layout(), false)
+    , _data(allocate_storage(size()))
+{
+    mem_lock<char> src(to_copy);
+    std::memcpy(_data.get(), src.data(), size());
+}
+
+host_memory::host_memory(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const host_memory& other)
+    : memory_impl(engine, new_layout, true)
+    , _data(other._data)
+{
+}
+
+void host_memory::fill(unsigned char pattern, event_impl::ptr ev)
+{
+    std::memset(_data.get(), pattern, size());
+    if (auto user_ev = dynamic_cast<user_event*>(ev.get()))
+        user_ev->set();
+}
+
+} }
@@ -0,0 +1,43 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "memory_impl.h"
+
+#include <memory>
+
+namespace cldnn { namespace cpu {
+
+// Buffer of the CPU engine in host memory. Reinterpreted buffers share the storage with the original one.
+struct host_memory : public memory_impl
+{
+    friend cldnn::memory_pool;
+
+    host_memory(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const host_memory& other);
+    void* lock() override { return _data.get(); }
+    void unlock() override {}
+    void fill(unsigned char pattern, event_impl::ptr ev) override;
+    bool shares_storage(const host_memory& other) const { return _data == other._data; }
+
+private:
+    host_memory(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout);
+    host_memory(const refcounted_obj_ptr<engine_impl>& engine, memory_impl& to_copy);
+
+    std::shared_ptr<char> _data;
+};
+
+} }
@@ -0,0 +1,121 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "lrn_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cldnn { namespace cpu {
+
+struct lrn_cpu : typed_primitive_cpu_impl<lrn>
+{
+    using parent = typed_primitive_cpu_impl<lrn>;
+    using parent::parent;
+
+protected:
+    void compute(lrn_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+        dense_input input(instance.input_memory());
+
+        // window of 'size' values starting 'pad' before the normalized one, values outside of input count as zeros
+        const int32_t size = static_cast<int32_t>(prim->size);
+        const int32_t pad = (size - 1) / 2;
+        const int32_t round_norm_size = (size / 2) * 2 + 1;
+        const bool across_channel = prim->norm_region == cldnn_lrn_norm_region_across_channel;
+        const float div = across_channel ? 1.0f / round_norm_size : 1.0f / (round_norm_size * round_norm_size);
+        const float k = prim->k;
+        const float alpha = prim->alpha;
+        const float beta = prim->beta;
+
+        const int32_t features = out_dims[1];
+        const int32_t height = out_dims[2];
+        const int32_t width = out_dims[3];
+        const size_t plane_size = static_cast<size_t>(height) * width;
+
+        const size_t planes = static_cast<size_t>(out_dims[0]) * features;
+        pool.parallel_for(planes, [&](size_t plane)
+        {
+            const int32_t f = static_cast<int32_t>(plane % features);
+            const float* in = input.data() + plane * plane_size;
+            float* out = output + plane * plane_size;
+            std::vector<float> sums(plane_size, 0.0f);
+
+            if (across_channel)
+            {
+                const int32_t begin = std::max(f - pad, 0) - f;
+                const int32_t end = std::min(f - pad + size, features) - f;
+                for (int32_t c = begin; c < end; c++)
+                {
+                    const float* src = in + c * static_cast<ptrdiff_t>(plane_size);
+                    for (size_t i = 0; i < plane_size; i++)
+                        sums[i] += src[i] * src[i];
+                }
+            }
+            else
+            {
+                for (int32_t y = 0; y < height; y++)
+                {
+                    const int32_t begin_y = std::max(y - pad, 0);
+                    const int32_t end_y = std::min(y - pad + size, height);
+                    for (int32_t x = 0; x < width; x++)
+                    {
+                        const int32_t begin_x = std::max(x - pad, 0);
+                        const int32_t end_x = std::min(x - pad + size, width);
+                        float sum = 0.0f;
+                        for (int32_t wy = begin_y; wy < end_y; wy++)
+                            for (int32_t wx = begin_x; wx < end_x; wx++)
+                                sum += in[wy * width + wx] * in[wy * width + wx];
+                        sums[y * width + x] = sum;
+                    }
+                }
+            }
+
+            for (size_t i = 0; i < plane_size; i++)
+                out[i] = in[i] * std::pow(k + alpha * sums[i] * div, -beta);
+        });
+    }
+
+public:
+    static primitive_impl* create(const lrn_node& arg)
+    {
+        return new lrn_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<lrn>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), lrn_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), lrn_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), lrn_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), lrn_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), lrn_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), lrn_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
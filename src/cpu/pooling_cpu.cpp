@@ -0,0 +1,122 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "pooling_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace cldnn { namespace cpu {
+
+struct pooling_cpu : typed_primitive_cpu_impl<pooling>
+{
+    using parent = typed_primitive_cpu_impl<pooling>;
+    using parent::parent;
+
+protected:
+    void compute(pooling_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+        CLDNN_ERROR_BOOL(_outer.id(), "Pooling mode", prim->mode == pooling_mode::max_with_argmax || prim->mode == pooling_mode::bilinear,
+                         "is not supported by the CPU engine");
+
+        dense_input input(instance.input_memory());
+        const auto& in_dims = input.dims();
+
+        const int32_t size_y = prim->global_pooling ? in_dims[2] : prim->size.spatial[1];
+        const int32_t size_x = prim->global_pooling ? in_dims[3] : prim->size.spatial[0];
+        const int32_t stride_y = prim->stride.spatial[1];
+        const int32_t stride_x = prim->stride.spatial[0];
+        const int32_t offset_y = prim->global_pooling ? 0 : prim->input_offset.spatial[1];
+        const int32_t offset_x = prim->global_pooling ? 0 : prim->input_offset.spatial[0];
+        // padding added by negative input offset, counted by divisor of average pooling (like kernels do)
+        const int32_t pad_y = std::max(-offset_y, 0);
+        const int32_t pad_x = std::max(-offset_x, 0);
+        const auto mode = prim->mode;
+
+        const size_t planes = static_cast<size_t>(out_dims[0]) * out_dims[1];
+        pool.parallel_for(planes, [&](size_t plane)
+        {
+            const float* in = input.data() + plane * in_dims[2] * in_dims[3];
+            float* out = output + plane * out_dims[2] * out_dims[3];
+
+            for (int32_t oy = 0; oy < out_dims[2]; oy++)
+            {
+                const int32_t start_y = oy * stride_y + offset_y;
+                const int32_t begin_y = std::max(start_y, 0);
+                const int32_t end_y = std::min(start_y + size_y, in_dims[2]);
+
+                for (int32_t ox = 0; ox < out_dims[3]; ox++)
+                {
+                    const int32_t start_x = ox * stride_x + offset_x;
+                    const int32_t begin_x = std::max(start_x, 0);
+                    const int32_t end_x = std::min(start_x + size_x, in_dims[3]);
+
+                    float result;
+                    if (mode == pooling_mode::max)
+                    {
+                        result = -std::numeric_limits<float>::max();
+                        for (int32_t y = begin_y; y < end_y; y++)
+                            for (int32_t x = begin_x; x < end_x; x++)
+                                result = std::max(result, in[y * in_dims[3] + x]);
+                    }
+                    else
+                    {
+                        result = 0.0f;
+                        for (int32_t y = begin_y; y < end_y; y++)
+                            for (int32_t x = begin_x; x < end_x; x++)
+                                result += in[y * in_dims[3] + x];
+
+                        const int32_t divisor = mode == pooling_mode::average
+                            ? (std::min(start_y + size_y, in_dims[2] + pad_y) - start_y) * (std::min(start_x + size_x, in_dims[3] + pad_x) - start_x)
+                            : (end_y - begin_y) * (end_x - begin_x);
+                        result = divisor > 0 ? result / divisor : 0.0f;
+                    }
+                    out[oy * out_dims[3] + ox] = result;
+                }
+            }
+        });
+    }
+
+public:
+    static primitive_impl* create(const pooling_node& arg)
+    {
+        return new pooling_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<pooling>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), pooling_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), pooling_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), pooling_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), pooling_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), pooling_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), pooling_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
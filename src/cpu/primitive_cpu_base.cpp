@@ -0,0 +1,311 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "primitive_cpu_base.h"
+#include "layout_conversion.h"
+#include "error_handler.h"
+#include "to_string_utils.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cldnn { namespace cpu
+{
+
+dims_t get_dims(const tensor& t)
+{
+    return{ { t.batch[0], t.feature[0], t.spatial[1], t.spatial[0] } };
+}
+
+size_t count(const dims_t& dims)
+{
+    return static_cast<size_t>(dims[0]) * dims[1] * dims[2] * dims[3];
+}
+
+namespace
+{
+    layout dense_layout(const layout& l)
+    {
+        return layout(data_types::f32, format::bfyx, l.size);
+    }
+
+    void check_layout(const layout& l)
+    {
+        if (l.format.dimension() != 4 || !is_host_convertible(l))
+            throw error("CPU engine does not support layout of format " + fmt_to_str(l.format), CLDNN_ERROR);
+    }
+
+    // calls f(row values, width, b, f, y) for every row of values along x
+    template <class Func>
+    void for_each_row(thread_pool& pool, float* data, const dims_t& dims, Func&& f)
+    {
+        const size_t rows = static_cast<size_t>(dims[0]) * dims[1] * dims[2];
+        pool.parallel_for(rows, [&](size_t row)
+        {
+            const int32_t y = static_cast<int32_t>(row % dims[2]);
+            const int32_t fm = static_cast<int32_t>(row / dims[2] % dims[1]);
+            const int32_t b = static_cast<int32_t>(row / dims[2] / dims[1]);
+            f(data + row * dims[3], dims[3], b, fm, y);
+        });
+    }
+
+    // first value of a row of 'in' broadcasted to the row (b, f, y) of output
+    const float* broadcast_row(const float* in, const dims_t& in_dims, int32_t b, int32_t f, int32_t y)
+    {
+        return in + ((static_cast<size_t>(b % in_dims[0]) * in_dims[1] + f % in_dims[1]) * in_dims[2] + y % in_dims[2]) * in_dims[3];
+    }
+
+    // output and broadcasted operand of binary operations
+    struct operands
+    {
+        thread_pool& pool;
+        float* out;
+        const dims_t& out_dims;
+        const float* in;
+        const dims_t& in_dims;
+    };
+
+    // out = op(out, in) with 'in' broadcasted along its dimensions of size 1 (the same way as GET_DATA_INDEX_SAFE
+    // does in kernels)
+    template <class Op>
+    void broadcast_apply(const operands& args, Op op)
+    {
+        const auto& in_dims = args.in_dims;
+        for_each_row(args.pool, args.out, args.out_dims, [&](float* row, int32_t width, int32_t b, int32_t f, int32_t y)
+        {
+            const float* src = broadcast_row(args.in, in_dims, b, f, y);
+            if (in_dims[3] == 1)
+            {
+                const float value = src[0];
+                for (int32_t x = 0; x < width; x++)
+                    row[x] = op(row[x], value);
+            }
+            else
+            {
+                for (int32_t x = 0; x < width; x++)
+                    row[x] = op(row[x], src[x]);
+            }
+        });
+    }
+
+    // values to activate and parameters 'a' and 'b' of the function, which may be given per feature
+    struct activation_args
+    {
+        thread_pool& pool;
+        float* data;
+        const dims_t& dims;
+        cldnn_activation_additional_params params;
+        const float* params_per_feature;
+        size_t params_num;
+    };
+
+    template <class Func>
+    void activate(const activation_args& args, Func func)
+    {
+        for_each_row(args.pool, args.data, args.dims, [&](float* row, int32_t width, int32_t, int32_t f, int32_t)
+        {
+            float a = args.params.a;
+            float b = args.params.b;
+            if (args.params_per_feature != nullptr)
+            {
+                a = args.params_per_feature[f * args.params_num];
+                if (args.params_num > 1)
+                    b = args.params_per_feature[f * args.params_num + 1];
+            }
+
+            for (int32_t x = 0; x < width; x++)
+                row[x] = func(row[x], a, b);
+        });
+    }
+}
+
+dense_input::dense_input(memory_impl& mem)
+    : _lock(mem)
+    , _dims(get_dims(mem.get_layout().size))
+{
+    const auto& l = mem.get_layout();
+    if (l == dense_layout(l))
+    {
+        _data = reinterpret_cast<const float*>(_lock.data());
+        return;
+    }
+
+    check_layout(l);
+    _copy.resize(l.count());
+    convert_layout(l, _lock.data(), dense_layout(l), _copy.data());
+    _data = _copy.data();
+}
+
+dense_output::dense_output(memory_impl& mem)
+    : _lock(mem)
+    , _layout(mem.get_layout())
+    , _dims(get_dims(_layout.size))
+{
+    if (_layout == dense_layout(_layout))
+    {
+        _data = reinterpret_cast<float*>(_lock.data());
+        return;
+    }
+
+    check_layout(_layout);
+    _copy.resize(_layout.count());
+    _data = _copy.data();
+}
+
+void dense_output::commit()
+{
+    if (!_copy.empty())
+        convert_layout(dense_layout(_layout), _copy.data(), _layout, _lock.data(), false);
+}
+
+void apply_activation(thread_pool& pool, float* data, const dims_t& dims, cldnn_activation_func func,
+                      cldnn_activation_additional_params params, const float* params_per_feature, size_t params_num)
+{
+    const activation_args args{ pool, data, dims, params, params_per_feature, params_num };
+
+    switch (func)
+    {
+    case activation_none:
+        return;
+    case activation_logistic:
+        return activate(args, [](float v, float, float) { return 1.0f / (1.0f + std::exp(-v)); });
+    case activation_hyperbolic_tan:
+        return activate(args, [](float v, float, float) { return std::tanh(v); });
+    case activation_relu:
+        return activate(args, [](float v, float, float) { return std::max(v, 0.0f); });
+    case activation_relu_negative_slope:
+        return activate(args, [](float v, float a, float) { return std::max(v, 0.0f) + a * std::min(v, 0.0f); });
+    case activation_clamp:
+        return activate(args, [](float v, float a, float b) { return std::max(a, std::min(b, v)); });
+    case activation_softrelu:
+        return activate(args, [](float v, float, float) { return std::log(1.0f + std::exp(v)); });
+    case activation_abs:
+        return activate(args, [](float v, float, float) { return std::fabs(v); });
+    case activation_linear:
+        return activate(args, [](float v, float a, float b) { return a * v + b; });
+    case activation_square:
+        return activate(args, [](float v, float, float) { return v * v; });
+    case activation_sqrt:
+        return activate(args, [](float v, float, float) { return std::sqrt(v); });
+    case activation_elu:
+        return activate(args, [](float v, float a, float) { return std::max(v, 0.0f) + a * (std::exp(std::min(v, 0.0f)) - 1.0f); });
+    case activation_sin:
+        return activate(args, [](float v, float, float) { return std::sin(v); });
+    case activation_asin:
+        return activate(args, [](float v, float, float) { return std::asin(v); });
+    case activation_sinh:
+        return activate(args, [](float v, float, float) { return std::sinh(v); });
+    case activation_cos:
+        return activate(args, [](float v, float, float) { return std::cos(v); });
+    case activation_acos:
+        return activate(args, [](float v, float, float) { return std::acos(v); });
+    case activation_cosh:
+        return activate(args, [](float v, float, float) { return std::cosh(v); });
+    case activation_log:
+        return activate(args, [](float v, float, float) { return std::log(v); });
+    case activation_log2:
+        return activate(args, [](float v, float, float) { return std::log2(v); });
+    case activation_exp:
+        return activate(args, [](float v, float, float) { return std::exp(v); });
+    case activation_tan:
+        return activate(args, [](float v, float, float) { return std::tan(v); });
+    case activation_atan:
+        return activate(args, [](float v, float, float) { return std::atan(v); });
+    case activation_floor:
+        return activate(args, [](float v, float, float) { return std::floor(v); });
+    case activation_ceil:
+        return activate(args, [](float v, float, float) { return std::ceil(v); });
+    case activation_negative:
+        return activate(args, [](float v, float, float) { return -v; });
+    case activation_not:
+        return activate(args, [](float v, float, float) { return v == 0.0f ? 1.0f : 0.0f; });
+    default:
+        throw error("CPU engine does not support activation function " + std::to_string(static_cast<int>(func)), CLDNN_ERROR);
+    }
+}
+
+void apply_eltwise(thread_pool& pool, eltwise_mode mode, float* out, const dims_t& out_dims, const float* in, const dims_t& in_dims)
+{
+    const operands args{ pool, out, out_dims, in, in_dims };
+
+    switch (mode)
+    {
+    case eltwise_mode::sum:  return broadcast_apply(args, [](float a, float b) { return a + b; });
+    case eltwise_mode::sub:  return broadcast_apply(args, [](float a, float b) { return a - b; });
+    case eltwise_mode::max:  return broadcast_apply(args, [](float a, float b) { return std::max(a, b); });
+    case eltwise_mode::prod: return broadcast_apply(args, [](float a, float b) { return a * b; });
+    case eltwise_mode::div:  return broadcast_apply(args, [](float a, float b) { return a / b; });
+    case eltwise_mode::min:  return broadcast_apply(args, [](float a, float b) { return std::min(a, b); });
+    case eltwise_mode::pow:  return broadcast_apply(args, [](float a, float b) { return std::pow(a, b); });
+    case eltwise_mode::mod:  return broadcast_apply(args, [](float a, float b) { return std::fmod(a, b); });
+    case eltwise_mode::eq:   return broadcast_apply(args, [](float a, float b) { return a == b ? 1.0f : 0.0f; });
+    case eltwise_mode::ne:   return broadcast_apply(args, [](float a, float b) { return a != b ? 1.0f : 0.0f; });
+    case eltwise_mode::lt:   return broadcast_apply(args, [](float a, float b) { return a < b ? 1.0f : 0.0f; });
+    case eltwise_mode::le:   return broadcast_apply(args, [](float a, float b) { return a <= b ? 1.0f : 0.0f; });
+    case eltwise_mode::gt:   return broadcast_apply(args, [](float a, float b) { return a > b ? 1.0f : 0.0f; });
+    case eltwise_mode::ge:   return broadcast_apply(args, [](float a, float b) { return a >= b ? 1.0f : 0.0f; });
+    case eltwise_mode::logic_and: return broadcast_apply(args, [](float a, float b) { return (a != 0.0f && b != 0.0f) ? 1.0f : 0.0f; });
+    case eltwise_mode::logic_or:  return broadcast_apply(args, [](float a, float b) { return (a != 0.0f || b != 0.0f) ? 1.0f : 0.0f; });
+    default:
+        throw error("CPU engine does not support eltwise mode " + std::to_string(static_cast<int>(mode)), CLDNN_ERROR);
+    }
+}
+
+void apply_scale(thread_pool& pool, float* out, const dims_t& out_dims, const float* scale, const dims_t& scale_dims,
+                 const float* bias, const dims_t& bias_dims)
+{
+    broadcast_apply({ pool, out, out_dims, scale, scale_dims }, [](float a, float b) { return a * b; });
+    if (bias != nullptr)
+        broadcast_apply({ pool, out, out_dims, bias, bias_dims }, [](float a, float b) { return a + b; });
+}
+
+void apply_fused_ops(thread_pool& pool, const program_node& node, float* data, const dims_t& dims)
+{
+    apply_activation(pool, data, dims, node.get_fused_activation_func(), node.get_fused_activation_params());
+
+    for (const auto& fused : node.get_fused_primitives())
+    {
+        switch (fused.type)
+        {
+        case fused_primitive_desc::op_type::activation:
+            apply_activation(pool, data, dims, fused.activation_func, fused.activation_params);
+            break;
+        case fused_primitive_desc::op_type::scale:
+        {
+            dense_input scale(*fused.inputs[0]);
+            if (fused.inputs.size() > 1)
+            {
+                dense_input bias(*fused.inputs[1]);
+                apply_scale(pool, data, dims, scale.data(), scale.dims(), bias.data(), bias.dims());
+            }
+            else
+            {
+                apply_scale(pool, data, dims, scale.data(), scale.dims());
+            }
+            break;
+        }
+        case fused_primitive_desc::op_type::eltwise:
+        {
+            dense_input operand(*fused.inputs[0]);
+            apply_eltwise(pool, fused.mode, data, dims, operand.data(), operand.dims());
+            break;
+        }
+        }
+    }
+}
+
+} }
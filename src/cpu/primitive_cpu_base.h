@@ -0,0 +1,155 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "primitive_inst.h"
+#include "program_impl.h"
+#include "network_impl.h"
+#include "engine_impl.h"
+#include "thread_pool.h"
+#include "api/CPP/eltwise.hpp"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace cldnn { namespace cpu
+{
+
+// sizes in b, f, y, x order - which is the memory order of dense bfyx buffers used by host implementations
+using dims_t = std::array<int32_t, 4>;
+
+dims_t get_dims(const tensor& t);
+size_t count(const dims_t& dims);
+
+// Input of a host implementation as a dense f32 bfyx buffer. Memory with exactly this layout is read in place,
+// other formats, data types and padded buffers are converted into a temporary copy.
+class dense_input
+{
+public:
+    explicit dense_input(memory_impl& mem);
+
+    const float* data() const { return _data; }
+    const dims_t& dims() const { return _dims; }
+
+private:
+    mem_lock<char> _lock;
+    std::vector<float> _copy;
+    const float* _data;
+    dims_t _dims;
+};
+
+// Output of a host implementation computed as a dense f32 bfyx buffer. Memory with exactly this layout is written
+// in place, otherwise commit() converts the result into the memory. Padding of the memory is left untouched, as it
+// may be a part of another primitive's output (e.g. in-place concatenation).
+class dense_output
+{
+public:
+    explicit dense_output(memory_impl& mem);
+
+    float* data() { return _data; }
+    const dims_t& dims() const { return _dims; }
+    void commit();
+
+private:
+    mem_lock<char> _lock;
+    layout _layout;
+    std::vector<float> _copy;
+    float* _data;
+    dims_t _dims;
+};
+
+// Constant data derived from a memory once per implementation (e.g. weights in the order used by a kernel).
+// Implementations are shared by all networks of a program, so the data is prepared under a lock.
+class prepared_data
+{
+public:
+    template <class Prepare>
+    const std::vector<float>& get(memory_impl& source, Prepare&& prepare)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_source.get() != &source)
+        {
+            _data = prepare(dense_input(source));
+            _source = &source;
+        }
+        return _data;
+    }
+
+private:
+    std::mutex _mutex;
+    memory_impl::cptr _source;
+    std::vector<float> _data;
+};
+
+// Applies activation function to all values. Parameterized activations take 'params_num' values per feature.
+void apply_activation(thread_pool& pool, float* data, const dims_t& dims, cldnn_activation_func func,
+                      cldnn_activation_additional_params params, const float* params_per_feature = nullptr, size_t params_num = 0);
+
+// out = out <mode> in, where 'in' is broadcasted along its dimensions of size 1 (indices modulo its sizes)
+void apply_eltwise(thread_pool& pool, eltwise_mode mode, float* out, const dims_t& out_dims, const float* in, const dims_t& in_dims);
+
+// out = out * scale (+ bias), where 'scale' and 'bias' are broadcasted along their dimensions of size 1
+void apply_scale(thread_pool& pool, float* out, const dims_t& out_dims, const float* scale, const dims_t& scale_dims,
+                 const float* bias = nullptr, const dims_t& bias_dims = dims_t());
+
+// Applies fused activation and primitives fused into the node (see prepare_post_ops_fusing).
+void apply_fused_ops(thread_pool& pool, const program_node& node, float* data, const dims_t& dims);
+
+/*
+Base class for all host implementations of specified primitive type, used by the CPU engine.
+Implementations compute dense f32 bfyx output from dense f32 bfyx inputs on the engine's thread pool, the base class
+takes care of conversion of the output and of operations fused into the node.
+*/
+template <class PType>
+struct typed_primitive_cpu_impl : public typed_primitive_impl<PType>
+{
+    const typed_program_node<PType>& _outer;
+
+    explicit typed_primitive_cpu_impl(const typed_program_node<PType>& arg)
+        : _outer(arg)
+    {}
+
+protected:
+    // computes output of the instance (without fused operations)
+    virtual void compute(typed_primitive_inst<PType>& instance, thread_pool& pool, float* output, const dims_t& output_dims) = 0;
+
+    // writes output of the instance into its memory
+    virtual void run(typed_primitive_inst<PType>& instance, thread_pool& pool)
+    {
+        dense_output output(instance.output_memory());
+        compute(instance, pool, output.data(), output.dims());
+        apply_fused_ops(pool, _outer, output.data(), output.dims());
+        output.commit();
+    }
+
+    event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, typed_primitive_inst<PType>& instance) override
+    {
+        auto& engine = instance.get_network().get_engine();
+        engine.wait_for_events(events);
+
+        auto ev = engine.create_user_event(false);
+        if (!_outer.can_be_optimized())
+            run(instance, engine.get_thread_pool());
+
+        dynamic_cast<cldnn::user_event*>(ev.get())->set();
+        return ev;
+    }
+};
+
+} }
@@ -0,0 +1,108 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "reorder_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "layout_conversion.h"
+#include "error_handler.h"
+
+#include <algorithm>
+
+namespace cldnn { namespace cpu {
+
+struct reorder_cpu : typed_primitive_cpu_impl<reorder>
+{
+    using parent = typed_primitive_cpu_impl<reorder>;
+    using parent::parent;
+
+protected:
+    bool has_mean_op() const
+    {
+        const auto& prim = _outer.get_primitive();
+        return prim->mean_mode != cldnn_reorder_mean_mode::mean_none && (_outer.has_mean() || !prim->subtract_per_feature.empty());
+    }
+
+    void run(reorder_inst& instance, thread_pool& pool) override
+    {
+        const bool fused = _outer.get_fused_activation_func() != activation_none || !_outer.get_fused_primitives().empty();
+        if (has_mean_op() || fused)
+            return parent::run(instance, pool);
+
+        // plain reorder converts the memory directly, without going through f32 bfyx
+        auto& input = instance.input_memory();
+        auto& output = instance.output_memory();
+        mem_lock<char> src(input);
+        mem_lock<char> dst(output);
+        convert_layout(input.get_layout(), src.data(), output.get_layout(), dst.data(), false, &pool);
+    }
+
+    void compute(reorder_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        const auto& prim = _outer.get_primitive();
+        CLDNN_ERROR_BOOL(_outer.id(), "Reorder with input offset", _outer.get_input_offset() != tensor(0),
+                         "is not supported by the CPU engine");
+
+        dense_input input(instance.input_memory());
+        std::copy(input.data(), input.data() + count(out_dims), output);
+
+        if (!has_mean_op())
+            return;
+
+        eltwise_mode mode;
+        switch (prim->mean_mode)
+        {
+        case cldnn_reorder_mean_mode::mean_subtract: mode = eltwise_mode::sub; break;
+        case cldnn_reorder_mean_mode::mean_mul:      mode = eltwise_mode::prod; break;
+        case cldnn_reorder_mean_mode::mean_div:      mode = eltwise_mode::div; break;
+        default:
+            throw std::out_of_range(_outer.id() + ": unsupported mean_mode value.");
+        }
+
+        if (_outer.has_mean())
+        {
+            dense_input mean(instance.mean_memory());
+            apply_eltwise(pool, mode, output, out_dims, mean.data(), mean.dims());
+        }
+        else
+        {
+            const auto& values = prim->subtract_per_feature;
+            const dims_t values_dims = { { 1, static_cast<int32_t>(values.size()), 1, 1 } };
+            apply_eltwise(pool, mode, output, out_dims, values.data(), values_dims);
+        }
+    }
+
+public:
+    static primitive_impl* create(const reorder_node& arg)
+    {
+        return new reorder_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<reorder>::add({
+                { engine_types::cpu, reorder_cpu::create }
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
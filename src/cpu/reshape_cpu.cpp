@@ -0,0 +1,91 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "reshape_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "layout_conversion.h"
+
+#include <cstring>
+
+namespace cldnn { namespace cpu {
+
+struct reshape_cpu : typed_primitive_cpu_impl<reshape>
+{
+    using parent = typed_primitive_cpu_impl<reshape>;
+    using parent::parent;
+
+protected:
+    // reshape keeps the order of values in memory, so (after removing padding) the data is copied as is
+    void run(reshape_inst& instance, thread_pool& pool) override
+    {
+        if (_outer.is_in_place())
+            return;
+
+        auto& input = instance.input_memory();
+        auto& output = instance.output_memory();
+        const auto& in_layout = input.get_layout();
+        const auto& out_layout = output.get_layout();
+        const layout dense_in(in_layout.data_type, in_layout.format, in_layout.size);
+        const layout dense_out(out_layout.data_type, out_layout.format, out_layout.size);
+
+        mem_lock<char> src(input);
+        mem_lock<char> dst(output);
+        if (in_layout == dense_in && out_layout == dense_out)
+        {
+            std::memcpy(dst.data(), src.data(), out_layout.bytes_count());
+        }
+        else
+        {
+            std::vector<char> values(dense_in.bytes_count());
+            convert_layout(in_layout, src.data(), dense_in, values.data(), true, &pool);
+            convert_layout(dense_out, values.data(), out_layout, dst.data(), false, &pool);
+        }
+
+        if (_outer.get_fused_activation_func() == activation_none && _outer.get_fused_primitives().empty())
+            return;
+
+        // fused operations are applied to the copied output
+        const layout f32_bfyx(data_types::f32, format::bfyx, out_layout.size);
+        std::vector<float> values(out_layout.count());
+        convert_layout(out_layout, dst.data(), f32_bfyx, values.data());
+        apply_fused_ops(pool, _outer, values.data(), get_dims(out_layout.size));
+        convert_layout(f32_bfyx, values.data(), out_layout, dst.data(), false);
+    }
+
+    void compute(reshape_inst&, thread_pool&, float*, const dims_t&) override {}
+
+public:
+    static primitive_impl* create(const reshape_node& arg)
+    {
+        return new reshape_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<reshape>::add({
+                { engine_types::cpu, reshape_cpu::create }
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
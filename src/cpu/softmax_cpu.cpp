@@ -0,0 +1,109 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "softmax_inst.h"
+#include "primitive_cpu_base.h"
+#include "implementation_map.h"
+#include "error_handler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace cldnn { namespace cpu {
+
+struct softmax_cpu : typed_primitive_cpu_impl<softmax>
+{
+    using parent = typed_primitive_cpu_impl<softmax>;
+    using parent::parent;
+
+protected:
+    void compute(softmax_inst& instance, thread_pool& pool, float* output, const dims_t& out_dims) override
+    {
+        dense_input input(instance.input_memory());
+
+        // values normalized together are 'size' values 'pitch' apart
+        size_t size = 0;
+        size_t pitch = 1;
+        switch (_outer.get_primitive()->dimension)
+        {
+        case softmax::normalize_x:
+            size = out_dims[3];
+            break;
+        case softmax::normalize_y:
+            size = out_dims[2];
+            pitch = out_dims[3];
+            break;
+        case softmax::normalize_f:
+            size = out_dims[1];
+            pitch = static_cast<size_t>(out_dims[2]) * out_dims[3];
+            break;
+        case softmax::normalize_fyx:
+            size = static_cast<size_t>(out_dims[1]) * out_dims[2] * out_dims[3];
+            break;
+        default:
+            throw error("CPU engine does not support softmax dimension", CLDNN_ERROR);
+        }
+
+        const size_t groups = count(out_dims) / size;
+        pool.parallel_for(groups, [&](size_t group)
+        {
+            const size_t first = group / pitch * size * pitch + group % pitch;
+            const float* in = input.data() + first;
+            float* out = output + first;
+
+            float max_value = in[0];
+            for (size_t i = 1; i < size; i++)
+                max_value = std::max(max_value, in[i * pitch]);
+
+            float sum = 0.0f;
+            for (size_t i = 0; i < size; i++)
+            {
+                out[i * pitch] = std::exp(in[i * pitch] - max_value);
+                sum += out[i * pitch];
+            }
+
+            const float scale = 1.0f / sum;
+            for (size_t i = 0; i < size; i++)
+                out[i * pitch] *= scale;
+        });
+    }
+
+public:
+    static primitive_impl* create(const softmax_node& arg)
+    {
+        return new softmax_cpu(arg);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<softmax>::add({
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), softmax_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), softmax_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::yxfb), softmax_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::yxfb), softmax_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f32, format::byxf), softmax_cpu::create },
+                { std::make_tuple(engine_types::cpu, data_types::f16, format::byxf), softmax_cpu::create },
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
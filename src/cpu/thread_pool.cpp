@@ -0,0 +1,189 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace cldnn { namespace cpu {
+
+namespace
+{
+    thread_local bool inside_loop = false;
+
+    // binding is only a hint, so failures (e.g. fewer processors available to the process) are ignored
+    void bind_to_processor(size_t index)
+    {
+#ifdef _WIN32
+        if (index < sizeof(DWORD_PTR) * 8)
+            SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << index);
+#elif defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(index % CPU_SETSIZE, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+        (void)index;
+#endif
+    }
+}
+
+struct thread_pool::job
+{
+    const std::function<void(size_t, size_t)>* body;
+    size_t count;
+    size_t chunk;
+    std::atomic<size_t> next;
+    size_t workers = 0;             // workers executing chunks of the job, guarded by thread_pool::_mutex
+    std::mutex error_mutex;
+    std::exception_ptr error;
+};
+
+thread_pool::thread_pool(size_t threads_count, bool bind_threads)
+{
+    if (threads_count == 0)
+        threads_count = std::max(1u, std::thread::hardware_concurrency());
+
+    // the calling thread is not owned by the pool, so it is never bound
+    _workers.reserve(threads_count - 1);
+    for (size_t i = 1; i < threads_count; i++)
+        _workers.emplace_back([this, i, bind_threads] { worker_loop(i, bind_threads); });
+}
+
+thread_pool::~thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _start.notify_all();
+    for (auto& worker : _workers)
+        worker.join();
+}
+
+void thread_pool::run(size_t count, const std::function<void(size_t, size_t)>& body)
+{
+    // a few chunks per thread balance iterations of different cost
+    run(count, std::max<size_t>(1, count / (threads_count() * 4)), body);
+}
+
+void thread_pool::run_tasks(const std::vector<std::function<void()>>& tasks)
+{
+    run(tasks.size(), 1, [&tasks](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+            tasks[i]();
+    });
+}
+
+void thread_pool::run(size_t count, size_t chunk, const std::function<void(size_t, size_t)>& body)
+{
+    if (count == 0)
+        return;
+
+    if (_workers.empty() || count == 1 || inside_loop)
+    {
+        body(0, count);
+        return;
+    }
+
+    job j;
+    j.body = &body;
+    j.count = count;
+    j.chunk = chunk;
+    j.next = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(&j);
+    }
+    _start.notify_all();
+
+    execute(j);
+
+    // once the job is removed no worker can join it, so only the ones already executing its chunks are waited for
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _jobs.remove(&j);
+        _done.wait(lock, [&j] { return j.workers == 0; });
+    }
+
+    if (j.error)
+        std::rethrow_exception(j.error);
+}
+
+void thread_pool::execute(job& j)
+{
+    inside_loop = true;
+    for (;;)
+    {
+        const size_t begin = j.next.fetch_add(j.chunk);
+        if (begin >= j.count)
+            break;
+
+        try
+        {
+            (*j.body)(begin, std::min(begin + j.chunk, j.count));
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(j.error_mutex);
+            if (!j.error)
+                j.error = std::current_exception();
+        }
+    }
+    inside_loop = false;
+}
+
+void thread_pool::worker_loop(size_t index, bool bind_thread)
+{
+    if (bind_thread)
+        bind_to_processor(index);
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;)
+    {
+        _start.wait(lock, [this] { return _stop || !_jobs.empty(); });
+        if (_stop)
+            return;
+
+        // the job goes to the back, so idle workers are spread over the jobs of concurrent callers
+        auto j = _jobs.front();
+        _jobs.splice(_jobs.end(), _jobs, _jobs.begin());
+        j->workers++;
+        lock.unlock();
+        execute(*j);
+        lock.lock();
+
+        // all chunks are taken, the job is not offered to other workers any more
+        _jobs.remove(j);
+        if (--j->workers == 0)
+            _done.notify_all();
+    }
+}
+
+} }
@@ -0,0 +1,89 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cldnn { namespace cpu {
+
+/*
+    Fixed set of worker threads owned by the engine, which executes loops and tasks of host implementations.
+
+    There are no per-thread work-stealing queues and no task graph. Every loop is a job whose iterations are taken in
+    chunks from a shared counter by the calling thread and by the workers, so threads which finish their chunks early
+    keep taking the remaining ones, which balances the load the way stealing would. Dependencies between tasks are
+    expressed by consecutive run_tasks() calls instead of graph edges.
+
+    Loops of concurrent callers (e.g. several networks of the engine) are active jobs at the same time, idle workers
+    join them in turns. Loops started inside of a loop body run serially on the calling thread, so the pool is never
+    oversubscribed.
+*/
+class thread_pool
+{
+public:
+    // 0 means one thread per hardware thread; bound workers run on logical processors 1, 2, ..., the first one is left
+    // to the calling thread
+    explicit thread_pool(size_t threads_count = 0, bool bind_threads = false);
+    ~thread_pool();
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    // number of threads executing loops, including the calling one
+    size_t threads_count() const { return _workers.size() + 1; }
+
+    // calls func(i) for each i in [0, count)
+    template <class Func>
+    void parallel_for(size_t count, Func&& func)
+    {
+        run(count, [&func](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+                func(i);
+        });
+    }
+
+    // calls func(begin, end) for disjoint ranges covering [0, count)
+    void run(size_t count, const std::function<void(size_t, size_t)>& body);
+
+    // calls each of the independent tasks once, dependent steps are expressed by consecutive calls
+    void run_tasks(const std::vector<std::function<void()>>& tasks);
+
+private:
+    struct job;
+
+    void run(size_t count, size_t chunk, const std::function<void(size_t, size_t)>& body);
+    void worker_loop(size_t index, bool bind_thread);
+    static void execute(job& j);
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _start;
+    std::condition_variable _done;
+    std::list<job*> _jobs;          // jobs of the running loops, which workers may join
+    bool _stop = false;
+};
+
+} }
@@ -0,0 +1,92 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "data_inst.h"
+#include "prior_box_inst.h"
+#include "input_layout_inst.h"
+#include "mutable_data_inst.h"
+#include "implementation_map.h"
+
+#include "network_impl.h"
+#include "engine_impl.h"
+
+namespace cldnn { namespace cpu {
+
+// Primitives which only hold their data (or compute it while building the program) - execution waits for dependencies.
+class wait_for_events_cpu : public primitive_impl
+{
+public:
+    wait_for_events_cpu(const program_node& /*node*/) {}
+
+    event_impl::ptr execute(const std::vector<event_impl::ptr>& events, primitive_inst& instance) override
+    {
+        auto& engine = instance.get_network().get_engine();
+        engine.wait_for_events(events);
+        return engine.create_user_event(true);
+    }
+
+    bool validate(const primitive_inst&) const override
+    {
+        return true;
+    }
+
+    static primitive_impl* create_data(const data_node& data)
+    {
+        return new wait_for_events_cpu(data);
+    }
+
+    static primitive_impl* create_input_layout(const input_layout_node& input)
+    {
+        return new wait_for_events_cpu(input);
+    }
+
+    static primitive_impl* create_prior_box(const prior_box_node& prior_box)
+    {
+        return new wait_for_events_cpu(prior_box);
+    }
+
+    static primitive_impl* create_mutable_data(const mutable_data_node& data)
+    {
+        return new wait_for_events_cpu(data);
+    }
+};
+
+namespace {
+    struct attach {
+        attach() {
+            implementation_map<data>::add({
+                { engine_types::cpu, wait_for_events_cpu::create_data }
+            });
+
+            implementation_map<input_layout>::add({
+                { engine_types::cpu, wait_for_events_cpu::create_input_layout }
+            });
+
+            implementation_map<prior_box>::add({
+                { engine_types::cpu, wait_for_events_cpu::create_prior_box }
+            });
+
+            implementation_map<mutable_data>::add({
+                { engine_types::cpu, wait_for_events_cpu::create_mutable_data }
+            });
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
+} }
@@ -18,10 +18,14 @@
 #include "engine_impl.h"
 #include "event_impl.h"
 #include "program_impl.h"
+#include "program_node.h"
 #include "network_impl.h"
 #include "gpu/ocl_toolkit.h"
 #include "gpu/memory_gpu.h"
 #include "gpu/ocl_user_event.h"
+#include "cpu/host_memory.h"
+#include "cpu/host_event.h"
+#include "cpu/thread_pool.h"
 
 namespace cldnn
 {
@@ -45,9 +49,10 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf)
     return result;
 }
 
-engine_impl::engine_impl(const engine_configuration& conf)
-    : _configuration(conf)
-    , _context(gpu_toolkit::create(convert_configuration(conf)))
+engine_impl::engine_impl(engine_types type, const engine_configuration& conf)
+    : _type(type)
+    , _configuration(conf)
+    , _context(type == engine_types::ocl ? gpu_toolkit::create(convert_configuration(conf)) : nullptr)
     , _memory_pool(*this)
 { }
 
@@ -57,7 +62,22 @@ engine_impl::~engine_impl()
         Engine, which is main owner of context deallocate events pool manually, because
         of the event_impl <-> gpu_toolkit dependencies.
     */
-    _context->release_events_pool();
+    if (_context)
+        _context->release_events_pool();
+}
+
+cpu::thread_pool& engine_impl::get_thread_pool() const
+{
+    std::call_once(_thread_pool_created, [this]
+    {
+        _thread_pool.reset(new cpu::thread_pool(_configuration.host_threads_count, _configuration.bind_host_threads));
+    });
+    return *_thread_pool;
+}
+
+engine_types engine_impl::impl_type(const program_node& node) const
+{
+    return node.is_host_placed() ? engine_types::cpu : _type;
 }
 
 memory_impl::ptr engine_impl::allocate_and_copy_memory(refcounted_obj_ptr<memory_impl> src, resource_flags flags)
@@ -65,9 +85,9 @@ memory_impl::ptr engine_impl::allocate_and_copy_memory(refcounted_obj_ptr<memory
     return _memory_pool.alloc_and_copy_memory(src, flags);
 }
 
-memory_impl::ptr engine_impl::allocate_memory(layout layout)
+memory_impl::ptr engine_impl::allocate_memory(layout layout, resource_flags flags)
 {
-    return _memory_pool.get_memory(layout);
+    return _memory_pool.get_memory(layout, flags);
 }
 
 memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, uint32_t network_id, std::set<primitive_id> dependencies, bool reusable)
@@ -88,7 +108,12 @@ memory_impl::ptr engine_impl::reinterpret_buffer(const memory_impl& memory, layo
     if (!new_layout.format.is_image() && memory.get_layout().format.is_image())
         throw error("trying to reinterpret image buffer as non-image buffer", CLDNN_ERROR);
 
+    if (_type == engine_types::cpu)
+        return{ new cpu::host_memory(this, new_layout, dynamic_cast<const cpu::host_memory&>(memory)), false };
+
     try {
+        if (auto host_buffer = dynamic_cast<const gpu::gpu_host_buffer*>(&memory))
+            return{ new gpu::gpu_host_buffer(this, new_layout, *host_buffer), false };
         if (new_layout.format.is_image_2d())
             return{ new gpu::gpu_image2d(this, new_layout, reinterpret_cast<const gpu::gpu_image2d&>(memory).get_buffer()), false };
         else
@@ -106,11 +131,17 @@ bool engine_impl::is_the_same_buffer(const memory_impl& mem1, const memory_impl&
     if (&mem1 == &mem2)
         return true;
 
+    if (_type == engine_types::cpu)
+        return dynamic_cast<const cpu::host_memory&>(mem1).shares_storage(dynamic_cast<const cpu::host_memory&>(mem2));
+
     return (reinterpret_cast<const gpu::gpu_buffer&>(mem1).get_buffer() == reinterpret_cast<const gpu::gpu_buffer&>(mem2).get_buffer());
 }
 
 event_impl::ptr engine_impl::create_user_event(bool set)
 {
+    if (_type == engine_types::cpu)
+        return{ new cpu::host_event(set), false };
+
     try {
         return _context->create_user_event(set);
     }
@@ -121,12 +152,14 @@ event_impl::ptr engine_impl::create_user_event(bool set)
 
 void engine_impl::flush_network()
 { 
-    get_context()->flush();
+    if (_context)
+        _context->flush();
 }
 
 void engine_impl::release_pending_memory()
 {
-    get_context()->release_pending_memory();
+    if (_context)
+        _context->release_pending_memory();
 }
 
 program_impl::ptr engine_impl::build_program(const topology_impl& topology, const build_options& options, bool is_internal, bool no_optimizations)
@@ -156,23 +189,47 @@ network_impl::ptr engine_impl::allocate_network(const program_impl& program, boo
 
 void engine_impl::wait_for_events(std::vector<event_impl::ptr> const & events)
 {
-    if (!events.empty())
-        _context->wait_for_events(events);
+    if (events.empty())
+        return;
+
+    if (_type == engine_types::cpu)
+    {
+        for (auto& ev : events)
+            ev->wait();
+        return;
+    }
+    _context->wait_for_events(events);
 }
 
-gpu::engine_info_internal engine_impl::get_engine_info() const
+const gpu::engine_info_internal& engine_impl::get_engine_info() const
 {
+    if (_type == engine_types::cpu)
+    {
+        std::call_once(_host_engine_info_created, [this]
+        {
+            _host_engine_info.reset(new gpu::engine_info_internal(
+                gpu::engine_info_internal::host(static_cast<uint32_t>(get_thread_pool().threads_count()))));
+        });
+        return *_host_engine_info;
+    }
     return _context->get_engine_info();
 }
 
-void engine_impl::compile_program(program_impl&)
+void engine_impl::compile_program(program_impl& program)
 {
+    // host implementations have nothing to compile
+    if (_type == engine_types::cpu)
+        return;
+
     //TODO: better compilation logic instead of a simple 'compile all'?
-    _context->get_kernels_cache().build_all();
+    _context->get_kernels_cache().build_all(program.get_build_profiler());
 }
 
 bool engine_impl::use_memory_pool() const
 {
+    if (_type == engine_types::cpu)
+        return configuration().enable_memory_pool != 0;
+
     if (configuration().enable_memory_pool && get_context()->is_neo_driver())
     {
         return true;
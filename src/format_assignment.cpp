@@ -0,0 +1,184 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "format_assignment.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace cldnn
+{
+namespace
+{
+    // upper bound for greedy refinement, each sweep which changes anything strictly lowers the total cost
+    const size_t max_refinement_sweeps = 16;
+}
+
+size_t format_assignment::add_node(std::vector<candidate> candidates)
+{
+    if (candidates.empty())
+        throw std::invalid_argument("format_assignment: node has to have at least one candidate format");
+
+    node_info info;
+    info.candidates = std::move(candidates);
+    _nodes.push_back(std::move(info));
+    return _nodes.size() - 1;
+}
+
+void format_assignment::add_edge(size_t from, size_t to, float reorder_cost)
+{
+    if (from >= to || to >= _nodes.size())
+        throw std::invalid_argument("format_assignment: edges have to follow the order in which nodes were added");
+
+    _nodes[from].users.push_back({ to, reorder_cost });
+    _nodes[to].inputs.push_back({ from, reorder_cost });
+}
+
+void format_assignment::add_fixed_input(size_t node, format fmt, float reorder_cost)
+{
+    _nodes.at(node).fixed_inputs.push_back({ fmt, reorder_cost });
+}
+
+float format_assignment::local_cost(const std::vector<size_t>& choice, size_t node, size_t candidate_idx) const
+{
+    auto& info = _nodes[node];
+    auto& fmt = info.candidates[candidate_idx].fmt;
+
+    float cost = info.candidates[candidate_idx].cost;
+    for (auto& in : info.fixed_inputs)
+        if (in.fmt != fmt)
+            cost += in.cost;
+    for (auto& in : info.inputs)
+        if (get_format(in.node, choice[in.node]) != fmt)
+            cost += in.cost;
+    for (auto& user : info.users)
+        if (get_format(user.node, choice[user.node]) != fmt)
+            cost += user.cost;
+    return cost;
+}
+
+float format_assignment::total_cost(const std::vector<size_t>& choice) const
+{
+    float cost = 0.0f;
+    for (size_t i = 0; i < _nodes.size(); i++)
+    {
+        auto& info = _nodes[i];
+        auto& fmt = info.candidates[choice[i]].fmt;
+
+        cost += info.candidates[choice[i]].cost;
+        for (auto& in : info.fixed_inputs)
+            if (in.fmt != fmt)
+                cost += in.cost;
+        for (auto& in : info.inputs)
+            if (get_format(in.node, choice[in.node]) != fmt)
+                cost += in.cost;
+    }
+    return cost;
+}
+
+std::vector<size_t> format_assignment::solve() const
+{
+    // best[i][c] - minimal cost of node i and everything it (transitively) depends on, if i runs in candidate c.
+    // It is exact as long as every node has at most one user, for shared producers their cost is counted once per user.
+    std::vector<std::vector<float>> best(_nodes.size());
+    for (size_t i = 0; i < _nodes.size(); i++)
+    {
+        auto& info = _nodes[i];
+        best[i].resize(info.candidates.size());
+        for (size_t c = 0; c < info.candidates.size(); c++)
+        {
+            auto& fmt = info.candidates[c].fmt;
+            float cost = info.candidates[c].cost;
+            for (auto& in : info.fixed_inputs)
+                if (in.fmt != fmt)
+                    cost += in.cost;
+
+            for (auto& in : info.inputs)
+            {
+                float best_input = std::numeric_limits<float>::max();
+                for (size_t ic = 0; ic < best[in.node].size(); ic++)
+                {
+                    float input_cost = best[in.node][ic];
+                    if (get_format(in.node, ic) != fmt)
+                        input_cost += in.cost;
+                    best_input = std::min(best_input, input_cost);
+                }
+                cost += best_input;
+            }
+            best[i][c] = cost;
+        }
+    }
+
+    // walk back from the users, every node takes the candidate which fits best to already chosen users
+    std::vector<size_t> choice(_nodes.size(), 0);
+    for (size_t i = _nodes.size(); i-- > 0;)
+    {
+        auto& info = _nodes[i];
+        float best_cost = std::numeric_limits<float>::max();
+        for (size_t c = 0; c < info.candidates.size(); c++)
+        {
+            float cost = best[i][c];
+            for (auto& user : info.users)
+                if (get_format(user.node, choice[user.node]) != info.candidates[c].fmt)
+                    cost += user.cost;
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                choice[i] = c;
+            }
+        }
+    }
+
+    // with shared producers the walk above may end up worse than choosing the cheapest candidate for every node,
+    // refinement starts from the better of both so the result is never worse than local decisions
+    std::vector<size_t> cheapest(_nodes.size(), 0);
+    for (size_t i = 0; i < _nodes.size(); i++)
+    {
+        auto& candidates = _nodes[i].candidates;
+        for (size_t c = 1; c < candidates.size(); c++)
+            if (candidates[c].cost < candidates[cheapest[i]].cost)
+                cheapest[i] = c;
+    }
+    if (total_cost(cheapest) < total_cost(choice))
+        choice = cheapest;
+
+    // refinement for nodes with several users (no-op for chains and trees, which are already optimal)
+    for (size_t sweep = 0; sweep < max_refinement_sweeps; sweep++)
+    {
+        bool changed = false;
+        for (size_t i = 0; i < _nodes.size(); i++)
+        {
+            float current_cost = local_cost(choice, i, choice[i]);
+            for (size_t c = 0; c < _nodes[i].candidates.size(); c++)
+            {
+                float cost = local_cost(choice, i, c);
+                if (cost < current_cost)
+                {
+                    current_cost = cost;
+                    choice[i] = c;
+                    changed = true;
+                }
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+    return choice;
+}
+}
@@ -15,129 +15,119 @@
 #include "condition_inst.h"
 #include "network_impl.h"
 #include "implementation_map.h"
-#include "math_utils.h"
+#include "kernel.h"
+#include "kernel_selector_helper.h"
+#include "condition/condition_kernel_selector.h"
+#include "condition/condition_kernel_base.h"
+#include "error_handler.h"
 
 #include <algorithm>
 
 namespace cldnn { namespace gpu {
 
+namespace {
+    kernel_selector::condition_function get_condition_function(cond_functions func)
+    {
+        switch (func)
+        {
+        case cond_functions::EQUAL:
+            return kernel_selector::condition_function::EQUAL;
+        case cond_functions::GREATER:
+            return kernel_selector::condition_function::GREATER;
+        case cond_functions::LESS:
+            return kernel_selector::condition_function::LESS;
+        default:
+            throw std::runtime_error("Unknown comparison function");
+        }
+    }
+}
+
 struct condition_gpu : typed_primitive_impl<condition>
 {
     const condition_node& outer;
+    kernel_selector::kernel_data _kernel_data;
+    gpu::kernel _kernel;
 
-    condition_gpu(const condition_node& outer)
+    condition_gpu(const condition_node& outer, const kernel_selector::kernel_data& kd)
         : outer(outer)
+        , _kernel_data(kd)
+        , _kernel(outer.get_program().get_engine().get_context(), kd.kernels[0].kernelString)
     {}
 
     event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, condition_inst& instance) override
     {
-        for (auto& a : events)
-        {
-            a->wait();
-        }
-        auto ev = instance.get_network().get_engine().create_user_event(false);
-
-        bool exec_branch = choose_branch_to_exec(instance);
-        memory_impl::ptr memory_to_copy;
-        if (exec_branch)
-            memory_to_copy = &execute_branch(instance.get_net_true(), instance.result_id(), instance.input_memory());
-        else
-            memory_to_copy = &execute_branch(instance.get_net_false(), instance.result_id(), instance.input_memory());
-        //just copy memory
-        mem_lock<float> inp_ptr{ memory_to_copy };
-        mem_lock<float> out_ptr{ instance.output_memory() };
+        bool exec_branch = choose_branch_to_exec(events, instance);
+        auto branch = exec_branch ? instance.get_net_true() : instance.get_net_false();
+        auto output_id = branch->get_outputs().at(0)->id();
+
+        // the branch computes its result directly in the output of condition unless its output aliases another buffer
+        bool in_place = branch->set_output_memory(output_id, instance.output_memory());
+        branch->set_input_data(instance.result_id(), instance.input_memory());
+        branch->execute({});
+
+        // events of the branch go back to the pool when its execution ends and may be handed out again,
+        // so a marker over the branch output is returned instead of the output event itself
+        auto ev = branch->get_primitive_event(output_id);
+        if (in_place)
+            return instance.get_network().get_engine().get_context()->enqueue_marker({ ev });
+
+        ev->wait();
+        mem_lock<char> inp_ptr{ branch->get_outputs().at(0)->output_memory() };
+        mem_lock<char> out_ptr{ instance.output_memory() };
         std::copy(inp_ptr.begin(), inp_ptr.end(), out_ptr.begin());
-        dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
-        return ev;
+        return instance.get_network().get_engine().create_user_event(true);
     }
 
     static primitive_impl* create(const condition_node& arg)
-    { 
-        return new condition_gpu(arg);
-    }
-
-private:
-    /*
-    Add functions here.
-    */
-    bool check_condition(const float value_1, const float value_2, const cond_functions& func) const
     {
-        switch (func)
-        {
-        case cond_functions::EQUAL: return value_1 == value_2;
-            break;
-        case cond_functions::GREATER: return value_1 > value_2;
-            break;
-        case cond_functions::LESS: return value_1 < value_2;
-            break;
-        default:
-            throw("Unknown comparision function for: " + outer.id());
-            break;
-        }
-    }
+        auto cond_params = get_default_params<kernel_selector::condition_params>(arg);
+        auto cond_optional_params = get_default_optional_params<kernel_selector::condition_optional_params>(arg.get_program());
 
-    /*
-    Loop over memory and check condition.
-    Returns boolean flag, which says what branch should be executed.
-    */
-    bool choose_branch_to_exec(condition_inst& instance) const
-    {
-        mem_lock<float> lock_compare_data{ instance.compare_memory() };
-        auto compare_layout = instance.compare_memory().get_layout();
-        auto compare_ptr = lock_compare_data.begin();
+        cond_params.inputs.push_back(convert_data_tensor(arg.compare().get_output_layout()));
+        cond_params.output = convert_data_tensor({ data_types::i32, format::bfyx, { 1, 1, 1, 1 } });
+        cond_params.function = get_condition_function(arg.func());
+        cond_params.offset = convert_dim_vector(arg.offset());
 
-        mem_lock<float> lock_input{ instance.input_memory() };
-        auto input_layout = instance.input_memory().get_layout();
-        auto input_ptr = lock_input.begin();
+        auto& kernel_selector = kernel_selector::condition_kernel_selector::Instance();
+        auto best_kernels = kernel_selector.GetBestKernels(cond_params, cond_optional_params);
 
-        auto function = instance.argument.function;
-        auto& offset = instance.argument.offset;
-        auto& range = compare_layout.size;
+        CLDNN_ERROR_BOOL(arg.id(), "Best_kernel.empty()", best_kernels.empty(), "Cannot find a proper kernel with this arguments");
 
-        for (auto b = 0; b < range.batch[0]; b++)
-        {
-            for (auto f = 0; f < range.feature[0]; f++)
-            {
-                for (auto z = 0; z < range.spatial[2]; z++)
-                {
-                    for (auto y = 0; y < range.spatial[1]; y++)
-                    {
-                        for (auto x = 0; x < range.spatial[0]; x++)
-                        {
-                            auto input_idx = input_layout.get_linear_offset({
-                                b + offset.batch[0],
-                                f + offset.feature[0],
-                                x + offset.spatial[0],
-                                y + offset.spatial[1],
-                                z + offset.spatial[2]
-                            });
-                            auto compare_idx = compare_layout.get_linear_offset({ b, f, x, y, z });
-                            if (!check_condition(input_ptr[input_idx], compare_ptr[compare_idx], function)) return false;
-                        }
-                    }
-                }
-            }
-        }
-        return true;
+        return new condition_gpu(arg, best_kernels[0]);
     }
 
-    
-
-    memory_impl& execute_branch(network_impl::ptr branch, const primitive_id& input_id, memory_impl& input_memory) const
+private:
+    /*
+    Evaluates the condition on the device.
+    Only the flag is read back, so the queue stalls just until the inputs and the comparison are computed.
+    */
+    bool choose_branch_to_exec(const std::vector<event_impl::ptr>& events, condition_inst& instance)
     {
-        branch->set_input_data(input_id, input_memory);
-        branch->execute({});
-        return branch->get_outputs().at(0)->output_memory();
+        gpu::kernel::kernel_arguments_data args;
+        args.inputs = { &instance.input_memory(), &instance.compare_memory() };
+        args.output = &instance.flag_memory();
+
+        _kernel.set_output_event(true);
+        auto ev = _kernel.run(_kernel_data.kernels[0], events, args);
+        ev->wait();
+
+        mem_lock<int32_t> flag{ instance.flag_memory() };
+        return *flag.begin() != 0;
     }
 };
 
 namespace {
     struct attach {
         attach() {
-            implementation_map<condition>::add(std::make_tuple(engine_types::ocl, data_types::f32, format::bfyx),
-                condition_gpu::create);
-            implementation_map<condition>::add(std::make_tuple(engine_types::ocl, data_types::f32, format::yxfb),
-                condition_gpu::create);
+            auto val_fw = condition_gpu::create;
+
+            for (auto dt : { data_types::f32, data_types::f16, data_types::i8, data_types::u8, data_types::i32, data_types::i64 })
+            {
+                for (auto fmt : { format::bfyx, format::yxfb, format::byxf, format::fyxb })
+                {
+                    implementation_map<condition>::add(std::make_tuple(engine_types::ocl, dt, fmt), val_fw);
+                }
+            }
         }
         ~attach() = default;
     };
@@ -19,6 +19,8 @@
 #include "network_impl.h"
 #include "implementation_map.h"
 #include "math_utils.h"
+#include "api_impl.h"
+#include "cpu/thread_pool.h"
 
 #include <algorithm>
 #include <stdexcept>
@@ -26,12 +28,6 @@
 #include <type_traits>
 #include <xmmintrin.h>
 
-#ifdef FIX_OPENMP_RELEASE_ISSUE
-#ifdef OPENMP_FOUND
-#include <omp.h>
-#endif
-#endif
-
 namespace cldnn { namespace gpu {
 
 namespace {
@@ -236,38 +232,35 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
     }
 
     template<typename dtype>
-    void generate_detections(const detection_output_inst& instance, const int num_of_images, const std::vector<std::vector<std::vector<bounding_box>>>& all_bboxes, std::vector<std::vector<std::vector<std::pair<float,int>>>>& confidences)
+    void generate_detections(const detection_output_inst& instance, cpu::thread_pool& pool, const int num_of_images, const std::vector<std::vector<std::vector<bounding_box>>>& all_bboxes, std::vector<std::vector<std::vector<std::pair<float,int>>>>& confidences)
     {
         mem_lock<dtype> lock{ instance.output_memory() };
         auto out_ptr = lock.begin();
 
         const auto& args = instance.argument;
+        const int num_classes = args.get_num_classes();
+
+        // NMS of each class of each image is independent
+        pool.parallel_for(static_cast<size_t>(num_of_images) * num_classes, [&](size_t task)
+        {
+            const int image = static_cast<int>(task / num_classes);
+            const int cls = static_cast<int>(task % num_classes);
+            std::vector<std::pair<float,int>>& scores = confidences[image][cls];
+            if (cls == args.get_background_label_id())
+            {
+                scores.clear();
+                return; // Skip background class.
+            }
+            const int label = args.get_share_location() ? 0 : cls;
+            apply_nms(all_bboxes[image][label], scores, args.get_nms_threshold(), args.get_eta(), args.get_top_k());
+        });
+
         std::vector<std::vector<std::vector<std::pair<float,int>>>> final_detections; // Per image -> For each label: Pair (score, prior index)
         for (int image = 0; image < num_of_images; ++image)
         {
-            const std::vector<std::vector<bounding_box> >& bboxes_per_image = all_bboxes[image];
-            std::vector<std::vector<std::pair<float,int>>>& conf_per_image = confidences[image];
             int num_det = 0;
-#ifdef FIX_OPENMP_RELEASE_ISSUE
-#ifdef OPENMP_FOUND
-            int num_available_threads = omp_get_max_threads();
-            //half available threads usage shows the best perf results for both SKL (4c8t) and APL (4c4t) for this part of detection output
-            int num_threads_to_use = (omp_in_parallel() == 0) ? num_available_threads/2 : 1;
-            #pragma omp parallel for num_threads(num_threads_to_use) reduction(+:num_det)
-#endif
-#endif
-            for (int cls = 0; cls < (int)args.get_num_classes(); ++cls)
-            {
-                if ((int)cls == args.get_background_label_id())
-                {
-                    conf_per_image[cls].clear();
-                    continue; // Skip background class.
-                }
-                std::vector<std::pair<float,int>>& scores = conf_per_image[cls];
-                const int label = args.get_share_location() ? 0 : cls;
-                apply_nms(bboxes_per_image[label], scores, args.get_nms_threshold(), args.get_eta(), args.get_top_k());
+            for (auto& scores : confidences[image])
                 num_det += (int)scores.size();
-            }
             if (num_det > args.get_keep_top_k())
             {
                 std::vector<std::pair<float, std::pair<int, int>>> score_index_pairs;
@@ -454,6 +447,7 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
         const int input_padding_lower_x = input_padding.lower_size().spatial[0];
         const int input_padding_lower_y = input_padding.lower_size().spatial[1];
         const int stride = input_buffer_size_y * input_buffer_size_x;
+        std::vector<float> confidence_data_float;
 
         for (int image = 0; image < num_of_images; ++image)
         {
@@ -462,10 +456,22 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
             int idx = get_linear_feature_index(image, 0, input_buffer_size_f, input_buffer_size_y,
                 input_buffer_size_x, input_padding_lower_y, input_padding_lower_x);
 
-            if (stride == 1 && std::is_same<dtype, float>::value)
+            if (stride == 1 && (std::is_same<dtype, float>::value || std::is_same<dtype, half_t>::value))
             {
-                float const* confidence_ptr_float = (float const*)(&(*confidence_data));
-                confidence_ptr_float += idx;
+                float const* confidence_ptr_float = nullptr;
+                if (std::is_same<dtype, float>::value)
+                {
+                    confidence_ptr_float = (float const*)(&(*confidence_data));
+                    confidence_ptr_float += idx;
+                }
+                else
+                {
+                    // Convert scores of the whole image in bulk, so half inputs can use the same SIMD thresholding.
+                    const size_t image_scores_count = static_cast<size_t>(num_of_priors) * num_classes;
+                    confidence_data_float.resize(image_scores_count);
+                    half_to_float((uint16_t const*)(&(*confidence_data)) + idx, confidence_data_float.data(), image_scores_count);
+                    confidence_ptr_float = confidence_data_float.data();
+                }
                 __m128 threshold = _mm_load_ps1(&confidence_threshold);
                 for (int prior = 0; prior < num_of_priors; ++prior)
                 {
@@ -533,7 +539,7 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
     }
 
     template<typename dtype>
-    void prepare_data(const detection_output_inst& instance, std::vector<std::vector<std::vector<bounding_box>>> &bboxes, std::vector<std::vector<std::vector<std::pair<float, int>>>>& confidences)
+    void prepare_data(const detection_output_inst& instance, cpu::thread_pool& pool, std::vector<std::vector<std::vector<bounding_box>>> &bboxes, std::vector<std::vector<std::vector<std::pair<float, int>>>>& confidences)
     {
         assert(bboxes.size() == confidences.size());
 
@@ -543,48 +549,50 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
         const int num_of_priors = instance.prior_box_memory().get_layout().size.spatial[1] / args.get_prior_info_size();
         const int num_loc_classes = args.get_share_location() ? 1 : args.get_num_classes();
 
-        // Extract locations per image.
         std::vector<std::vector<std::vector<bounding_box>>> locations(num_of_images); // Per image : label -> bounding boxes.
-        extract_locations_per_image<dtype>(instance, locations, num_of_priors, num_loc_classes);
-
-        // Extract prior boxes - same within a batch.
         std::vector<bounding_box> prior_bboxes(num_of_priors); // Prior-Boxes (identical for all images since we assume all images in a batch are of same dimension).
         std::vector<std::array<float, PRIOR_BOX_SIZE>> prior_variances(num_of_priors); // Variances per prior-box (identical for all images since we assume all images in a batch are of same dimension).
-        extract_prior_boxes_and_variances<dtype>(instance, args.get_variance_encoded_in_target(),
-                                                 args.get_prior_info_size(), args.get_prior_coordinates_offset(),
-                                                 prior_bboxes, prior_variances);
 
-        // Create the decoded bounding boxes according to locations predictions and prior-boxes. 
+        // Extract locations per image, prior boxes (same within a batch) and confidences per image - each input is read by a separate task.
+        pool.run_tasks({
+            [&] { extract_locations_per_image<dtype>(instance, locations, num_of_priors, num_loc_classes); },
+            [&] { extract_prior_boxes_and_variances<dtype>(instance, args.get_variance_encoded_in_target(),
+                                                           args.get_prior_info_size(), args.get_prior_coordinates_offset(),
+                                                           prior_bboxes, prior_variances); },
+            [&] { extract_confidences_per_image<dtype>(instance, confidences, num_of_priors); }
+        });
+
         for (int image = 0; image < num_of_images; ++image)
         {
-            std::vector<std::vector<bounding_box>>& bboxes_per_image = bboxes[image];
-            bboxes_per_image.resize(num_loc_classes);
+            bboxes[image].resize(num_loc_classes);
             locations[image].resize(num_loc_classes);
-            for (int cls = 0; cls < num_loc_classes; ++cls)
-            {
-                const int label = args.get_share_location() ? 0 : cls;
-                if (!args.get_share_location() && label == args.get_background_label_id())
-                {
-                    continue; // Skip background class.
-                }
-                const std::vector<bounding_box>& label_loc_preds = locations[image][label];
-                int label_loc_preds_size = (int)label_loc_preds.size();
-                assert((int)prior_bboxes.size() == label_loc_preds_size);
-                
-                bboxes_per_image[label].clear();
+        }
 
-                for (int i = 0; i < label_loc_preds_size; ++i)
-                {
-                    bounding_box decoded_bbox;
-                    decode_bounding_box(prior_bboxes[i], prior_variances[i], args.get_code_type(), args.get_variance_encoded_in_target(), label_loc_preds[i], &decoded_bbox,
-                                        args.get_prior_is_normalized(), args.get_input_width(), args.get_input_height(), args.get_clip());
-                    bboxes_per_image[label].emplace_back(decoded_bbox);
-                }
+        // Create the decoded bounding boxes according to locations predictions and prior-boxes. 
+        pool.parallel_for(static_cast<size_t>(num_of_images) * num_loc_classes, [&](size_t task)
+        {
+            const int image = static_cast<int>(task / num_loc_classes);
+            const int cls = static_cast<int>(task % num_loc_classes);
+            const int label = args.get_share_location() ? 0 : cls;
+            if (!args.get_share_location() && label == args.get_background_label_id())
+            {
+                return; // Skip background class.
             }
-        }
+            const std::vector<bounding_box>& label_loc_preds = locations[image][label];
+            int label_loc_preds_size = (int)label_loc_preds.size();
+            assert((int)prior_bboxes.size() == label_loc_preds_size);
+
+            std::vector<bounding_box>& label_bboxes = bboxes[image][label];
+            label_bboxes.clear();
 
-        // Extract confidences per image.
-        extract_confidences_per_image<dtype>(instance, confidences, num_of_priors);
+            for (int i = 0; i < label_loc_preds_size; ++i)
+            {
+                bounding_box decoded_bbox;
+                decode_bounding_box(prior_bboxes[i], prior_variances[i], args.get_code_type(), args.get_variance_encoded_in_target(), label_loc_preds[i], &decoded_bbox,
+                                    args.get_prior_is_normalized(), args.get_input_width(), args.get_input_height(), args.get_clip());
+                label_bboxes.emplace_back(decoded_bbox);
+            }
+        });
     }
 
     event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, detection_output_inst& instance) override
@@ -594,7 +602,9 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
             a->wait();
         }
 
-        auto ev = instance.get_network().get_engine().create_user_event(false);
+        auto& engine = instance.get_network().get_engine();
+        auto ev = engine.create_user_event(false);
+        auto& pool = engine.get_thread_pool();
 
         const int num_of_images = instance.location_memory().get_layout().size.batch[0]; //batch size
 
@@ -603,15 +613,15 @@ struct detection_output_cpu : typed_primitive_impl<detection_output>
 
         if (instance.location_memory().get_layout().data_type == data_types::f32)
         {
-            prepare_data<data_type_to_type<data_types::f32>::type>(instance, bboxes, confidences);
+            prepare_data<data_type_to_type<data_types::f32>::type>(instance, pool, bboxes, confidences);
 
-            generate_detections<data_type_to_type<data_types::f32>::type>(instance, num_of_images, bboxes, confidences);
+            generate_detections<data_type_to_type<data_types::f32>::type>(instance, pool, num_of_images, bboxes, confidences);
         }
         else
         {
-            prepare_data<data_type_to_type<data_types::f16>::type>(instance, bboxes, confidences);
+            prepare_data<data_type_to_type<data_types::f16>::type>(instance, pool, bboxes, confidences);
 
-            generate_detections<data_type_to_type<data_types::f16>::type>(instance, num_of_images, bboxes, confidences);
+            generate_detections<data_type_to_type<data_types::f16>::type>(instance, pool, num_of_images, bboxes, confidences);
         }
 
         dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
@@ -630,4 +640,16 @@ primitive_impl* runDetectOutCpu(const detection_output_node& arg)
     return new detection_output_cpu(arg);
 }
 
+namespace {
+    struct attach {
+        attach() {
+            // host implementation used by the CPU engine and by nodes placed on the host in GPU programs
+            implementation_map<detection_output>::add(std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), detection_output_cpu::create);
+            implementation_map<detection_output>::add(std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), detection_output_cpu::create);
+        }
+        ~attach() {}
+    };
+    attach attach_impl;
+}
+
 }}
@@ -312,4 +312,48 @@ engine_info_internal::engine_info_internal(const gpu_toolkit& context)
     supports_imad = is_imad_supported(device_id);
     supports_immad = is_immad_supported(device_id);
 }
+
+engine_info_internal engine_info_internal::host(uint32_t threads_count)
+{
+    uint64_t physical_memory = 0;
+#ifdef _WIN32
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    if (GlobalMemoryStatusEx(&status))
+        physical_memory = static_cast<uint64_t>(status.ullTotalPhys);
+#else
+    const long pages = sysconf(_SC_PHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGE_SIZE);
+    if (pages > 0 && page_size > 0)
+        physical_memory = static_cast<uint64_t>(pages) * static_cast<uint64_t>(page_size);
+#endif
+    if (physical_memory == 0)
+        physical_memory = std::numeric_limits<uint64_t>::max();
+
+    engine_info_internal info;
+    info.dev_id = "cpu";
+    info.driver_version = "";
+    info.compute_units_count = threads_count;
+    info.device_cache = std::make_shared<rapidjson::Document>();
+    info.device_cache->Parse("{}");
+
+    info.cores_count = threads_count;
+    info.core_frequency = 0;
+    info.max_work_group_size = 1;
+    info.max_local_mem_size = 0;
+    info.max_global_mem_size = physical_memory;
+    info.max_alloc_mem_size = physical_memory;
+
+    info.supports_image = 0;
+    info.max_image2d_width = 0;
+    info.max_image2d_height = 0;
+
+    // f16 data is converted to f32 by host implementations
+    info.supports_fp16 = 1;
+    info.supports_fp16_denorms = 1;
+    info.supports_subgroups_short = 0;
+    info.supports_imad = 0;
+    info.supports_immad = 0;
+    return info;
+}
 }}
@@ -31,9 +31,13 @@ struct engine_info_internal : cldnn::engine_info
     std::uint32_t compute_units_count;
     std::shared_ptr<rapidjson::Document> device_cache; 
 
+    // information about the host, used by the CPU engine
+    static engine_info_internal host(uint32_t threads_count);
+
 private:
     friend class gpu_toolkit;
     explicit engine_info_internal(const gpu_toolkit& context);
+    engine_info_internal() = default;
 };
 
 }}
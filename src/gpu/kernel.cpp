@@ -23,6 +23,22 @@
 namespace cldnn { namespace gpu {
 
 namespace {
+    // Kernels which declare their batch dimension run only over the batches the network executes with. The dimension
+    // is rounded up to the local size, work items of batches past the runtime one return early in the kernel.
+    std::vector<size_t> get_global_work_size(const kernel_selector::cl_kernel_data& kernel_data, const kernel::kernel_arguments_data& args)
+    {
+        auto global = kernel_data.workGroups.global;
+        const auto& local = kernel_data.workGroups.local;
+        const auto dim = kernel_data.workGroups.batchDim;
+        if (dim < 0 || args.runtime_batch >= args.compiled_batch)
+            return global;
+
+        global[dim] = global[dim] / args.compiled_batch * args.runtime_batch;
+        if (static_cast<size_t>(dim) < local.size() && local[dim] != 0)
+            global[dim] = (global[dim] + local[dim] - 1) / local[dim] * local[dim];
+        return global;
+    }
+
     inline cl::NDRange toNDRange(const std::vector<size_t>& v)
     {
         switch (v.size())
@@ -131,6 +147,12 @@ namespace {
                     }
                 }
 
+                break;
+            case kernel_selector::kernel_argument_types::FUSED_OP_INPUT:
+                if (args[i].index < data.fused_op_inputs.size() && data.fused_op_inputs[args[i].index])
+                {
+                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.fused_op_inputs[args[i].index]).get_buffer());
+                }
                 break;
             case kernel_selector::kernel_argument_types::SCALE_TABLE:
                 if (data.scale_table)
@@ -147,6 +169,9 @@ namespace {
             case kernel_selector::kernel_argument_types::SPLIT:
                 status = kernel.setArg(i, data.split);
                 break;
+            case kernel_selector::kernel_argument_types::RUNTIME_BATCH:
+                status = kernel.setArg(i, data.runtime_batch);
+                break;
             case kernel_selector::kernel_argument_types::LEARNING_RATE:
                 status = kernel.setArg(i, data.lr);
                 break;
@@ -235,15 +260,21 @@ event_impl::ptr kernel::run(
     const std::vector<event_impl::ptr>& dependencies,
     const kernel_arguments_data& args) const
 {
-    auto clkernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
+    std::lock_guard<std::mutex> lock(_instance->mutex);
     try {
-        set_arguments(clkernel, kernel_data.arguments, args);
+        if (!_instance->created)
+        {
+            _instance->kernel = context()->get_kernels_cache().get_kernel(_kernel_id, _one_time_kernel);
+            _instance->created = true;
+        }
+
+        set_arguments(_instance->kernel, kernel_data.arguments, args);
     }
     catch (cl::Error const& err) {
         throw ocl_error(err);
     }
 
-    return context()->enqueue_kernel(clkernel, toNDRange(kernel_data.workGroups.global), toNDRange(kernel_data.workGroups.local), dependencies);
+    return context()->enqueue_kernel(_instance->kernel, toNDRange(get_global_work_size(kernel_data, args)), toNDRange(kernel_data.workGroups.local), dependencies);
 }
 
 } }
\ No newline at end of file
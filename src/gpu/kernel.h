@@ -24,21 +24,37 @@
 
 #include "kernel_selector_helper.h"
 
+#include <limits>
+#include <memory>
+#include <mutex>
+
 namespace cldnn { namespace gpu {
 
 class kernel : public context_holder 
 {
+    // Arguments are set on cl::Kernel object, while the compiled kernel may be shared by all kernels with the same code.
+    // Every kernel object runs its own cl::Kernel (kernels cache clones the compiled one for all but its first user),
+    // and copies of the object (which share it) set arguments and enqueue under a lock.
+    struct cl_kernel_instance
+    {
+        std::mutex mutex;
+        kernels_cache::kernel_type kernel;
+        bool created = false;
+    };
+
     kernels_cache::kernel_id _kernel_id;
     bool _one_time_kernel; //If this flag is true, the kernel is intended to be executed only once (can be removed later from the cache).
+    std::shared_ptr<cl_kernel_instance> _instance;
 
 public:
     explicit kernel(std::shared_ptr<gpu_toolkit> context, const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program = false, bool one_time_kernel = false)
         : context_holder(context)
         , _kernel_id(context->get_kernels_cache().set_kernel_source(kernel_string, dump_custom_program, one_time_kernel)) 
 		, _one_time_kernel(one_time_kernel)
+        , _instance(std::make_shared<cl_kernel_instance>())
     {}
 
-    kernel(const kernel& other) : context_holder(other.context()), _kernel_id(other._kernel_id), _one_time_kernel(other._one_time_kernel) {}
+    kernel(const kernel& other) : context_holder(other.context()), _kernel_id(other._kernel_id), _one_time_kernel(other._one_time_kernel), _instance(other._instance) {}
 
     kernel& operator=(const kernel& other) 
     {
@@ -49,6 +65,7 @@ public:
 
         _kernel_id = other._kernel_id;
         _one_time_kernel = other._one_time_kernel;
+        _instance = other._instance;
 
         return *this;
     }
@@ -72,7 +89,12 @@ public:
         memory_impl::cptr prev_bias_grad;
         // used for fused primitives
         std::vector<memory_impl::cptr> fused_op_calibration_factors;
+        std::vector<memory_impl::cptr> fused_op_inputs;
         int32_t           split          = 0;
+        // batch the network runs with and the batch the kernel was compiled for, see WorkGroupSizes::batchDim
+        // (by default all batches are processed)
+        int32_t           runtime_batch  = std::numeric_limits<int32_t>::max();
+        int32_t           compiled_batch = 0;
         float             lr;
         const kernel_selector::kernel_scalar_arguments* scalars = nullptr;
     };
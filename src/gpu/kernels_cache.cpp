@@ -17,60 +17,64 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "kernels_cache.h"
 #include "ocl_toolkit.h"
+#include "build_profiler.h"
 #include <algorithm>
 #include <cassert>
+#include <cctype>
+#include <cstdint>
 #include <sstream>
 #include <fstream>
+#include <functional>
+#include <iterator>
 #include <set>
 
 #include "kernel_selector_helper.h"
 
-#define MAX_KERNELS_PER_PROGRAM 10
+// kernels are batched into one program until its source exceeds this size, so programs of many small kernels
+// are not split as often as programs of big ones
+#define MAX_PROGRAM_SOURCE_SIZE (512 * 1024)
 
 namespace cldnn { namespace gpu {
 
 namespace {
-    std::string get_undef_jit(kernels_cache::source_code org_source_code)
+    // collects names of macros used by given preprocessor directive (e.g. define or undef) in the source
+    void get_directive_names(const std::string& source, const std::string& directive, std::set<std::string>& names)
     {
         const std::string white_space_with_new_lines = " \t\r\n";
         const std::string white_space = " \t";
 
         size_t current_pos = 0;
-
-        const std::string define = "define";
-
-        std::set<std::string> to_undef;
-        for (const auto& source : org_source_code)
+        do
         {
-            do
+            size_t index_to_hash = source.find_first_not_of(white_space_with_new_lines, current_pos);
+            if (index_to_hash != std::string::npos &&
+                source[index_to_hash] == '#')
             {
-                size_t index_to_hash = source.find_first_not_of(white_space_with_new_lines, current_pos);
-                if (index_to_hash != std::string::npos &&
-                    source[index_to_hash] == '#')
-                {
-                    size_t index_define = source.find_first_not_of(white_space, index_to_hash + 1);
+                size_t index_directive = source.find_first_not_of(white_space, index_to_hash + 1);
 
-                    if (index_define != std::string::npos &&
-                        !source.compare(index_define, define.size(), define))
+                if (index_directive != std::string::npos &&
+                    !source.compare(index_directive, directive.size(), directive))
+                {
+                    size_t index_to_name = source.find_first_not_of(white_space, index_directive + directive.size());
+                    if (index_to_name != std::string::npos)
                     {
-                        size_t index_to_name = source.find_first_not_of(white_space, index_define + define.size());
-                        if (index_to_name != std::string::npos)
+                        size_t index_to_end_name = source.find_first_of(white_space_with_new_lines + "(", index_to_name);
+                        if (index_to_end_name == std::string::npos)
                         {
-                            size_t index_to_end_name = source.find_first_of(white_space_with_new_lines + "(", index_to_name);
-                            if (index_to_end_name == std::string::npos)
-                            {
-                                index_to_end_name = source.size();
-                            }
-                            std::string name = source.substr(index_to_name, index_to_end_name - index_to_name);
-                            to_undef.insert(name);
+                            index_to_end_name = source.size();
                         }
+                        std::string name = source.substr(index_to_name, index_to_end_name - index_to_name);
+                        names.insert(name);
                     }
                 }
+            }
 
-                current_pos = source.find_first_of('\n', current_pos + 1);
-            } while (current_pos != std::string::npos);
-        }
+            current_pos = source.find_first_of('\n', current_pos + 1);
+        } while (current_pos != std::string::npos);
+    }
 
+    std::string get_undef_jit(const std::set<std::string>& to_undef)
+    {
         std::string undefs;
         for (const auto& name : to_undef)
         {
@@ -79,7 +83,15 @@ namespace {
             undefs += "#endif\n";
         }
 
-        return std::move(undefs);
+        return undefs;
+    }
+
+    std::string get_header_guard(const std::string& header_name)
+    {
+        std::string guard = "CLDNN_HEADER_";
+        for (auto c : header_name)
+            guard += std::isalnum(static_cast<unsigned char>(c)) ? static_cast<char>(std::toupper(static_cast<unsigned char>(c))) : '_';
+        return guard;
     }
 
     std::string reorder_options(const std::string& org_options)
@@ -110,18 +122,120 @@ namespace {
             options.find("-D") == std::string::npos &&
             options.find("-I") == std::string::npos;
     }
+
+    // Entry points are unique for every kernel instance created by kernel selector, so they are skipped when kernel
+    // code is hashed and compared to let kernels with identical code (e.g. after rebuilding a topology for a new input
+    // shape) share one compiled binary.
+    size_t find_entry_point(const kernel_selector::kernel_string& kernel_string, size_t pos)
+    {
+        return kernel_string.entry_point.empty() ? std::string::npos : kernel_string.jit.find(kernel_string.entry_point, pos);
+    }
+
+    size_t get_jit_hash(const kernel_selector::kernel_string& kernel_string)
+    {
+        // FNV-1a over the JIT with every entry point replaced by a zero byte
+        uint64_t hash = 14695981039346656037ULL;
+        auto add = [&](char c)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        };
+
+        const auto& jit = kernel_string.jit;
+        size_t pos = 0;
+        for (size_t entry_point = find_entry_point(kernel_string, 0); ; entry_point = find_entry_point(kernel_string, pos))
+        {
+            const size_t end = entry_point == std::string::npos ? jit.size() : entry_point;
+            for (; pos < end; pos++)
+                add(jit[pos]);
+            if (entry_point == std::string::npos)
+                break;
+            add('\0');
+            pos = entry_point + kernel_string.entry_point.size();
+        }
+        return static_cast<size_t>(hash);
+    }
+
+    bool is_same_jit(const kernel_selector::kernel_string& lhs, const kernel_selector::kernel_string& rhs)
+    {
+        size_t lhs_pos = 0;
+        size_t rhs_pos = 0;
+        while (true)
+        {
+            const size_t lhs_entry_point = find_entry_point(lhs, lhs_pos);
+            const size_t rhs_entry_point = find_entry_point(rhs, rhs_pos);
+            const size_t lhs_size = (lhs_entry_point == std::string::npos ? lhs.jit.size() : lhs_entry_point) - lhs_pos;
+            const size_t rhs_size = (rhs_entry_point == std::string::npos ? rhs.jit.size() : rhs_entry_point) - rhs_pos;
+            if (lhs_size != rhs_size || lhs.jit.compare(lhs_pos, lhs_size, rhs.jit, rhs_pos, rhs_size) != 0)
+                return false;
+            if (lhs_entry_point == std::string::npos || rhs_entry_point == std::string::npos)
+                return lhs_entry_point == rhs_entry_point;
+            lhs_pos = lhs_entry_point + lhs.entry_point.size();
+            rhs_pos = rhs_entry_point + rhs.entry_point.size();
+        }
+    }
+
+    size_t get_kernel_code_hash(const kernel_selector::kernel_string& kernel_string)
+    {
+        std::hash<std::string> hasher;
+        size_t seed = 0;
+        auto combine = [&](size_t value)
+        {
+            seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        };
+
+        for (const auto& header : kernel_string.headers)
+            combine(hasher(header.name));
+        // code of kernels from primitive db is hashed once per kernel by the db
+        combine(kernel_string.str_hash != 0 ? kernel_string.str_hash : hasher(kernel_string.str));
+        combine(get_jit_hash(kernel_string));
+        combine(hasher(kernel_string.options));
+        return seed;
+    }
+
+    // hashes of kernel code may collide, so kernels with equal hashes are compared before being shared
+    bool is_same_kernel_code(const kernel_selector::kernel_string& lhs, const kernel_selector::kernel_string& rhs)
+    {
+        if (&lhs == &rhs)
+            return true;
+
+        if (lhs.str != rhs.str || lhs.options != rhs.options || lhs.headers.size() != rhs.headers.size())
+            return false;
+
+        for (size_t i = 0; i < lhs.headers.size(); i++)
+        {
+            if (lhs.headers[i].name != rhs.headers[i].name)
+                return false;
+        }
+
+        return is_same_jit(lhs, rhs);
+    }
+
+    inline cl::Kernel clone_kernel(const cl::Kernel& kernel)
+    {
+        return cl::Kernel(kernel.getInfo<CL_KERNEL_PROGRAM>(), kernel.getInfo<CL_KERNEL_FUNCTION_NAME>().c_str());
+    }
 }
 
 kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code& kernels_source_code) const 
 {
+    // shared headers already compiled in the last part of a program, and the size of its source
+    struct part_state
+    {
+        std::set<std::string> headers;
+        size_t size = 0;
+    };
+
     sorted_code scode;
+    std::map<std::string, part_state> parts;
+    std::map<std::string, std::set<std::string>> header_macros;
 
     for (const auto& code : kernels_source_code)
     {
-        const source_code   org_source_code     = { code.second.kernel_strings->jit, code.second.kernel_strings->str };
-        std::string         entry_point         = code.second.kernel_strings->entry_point;
-        std::string         options             = code.second.kernel_strings->options;
-        bool                batch_compilation   = code.second.kernel_strings->batch_compilation;
+        const auto&         kernel_string       = *code.second.kernel_strings;
+        std::string         entry_point         = kernel_string.entry_point;
+        std::string         options             = kernel_string.options;
+        bool                batch_compilation   = kernel_string.batch_compilation;
         bool                dump_custom_program = code.second.dump_custom_program;
         bool                one_time_kernel     = code.second.one_time_kernel;
 
@@ -151,6 +265,7 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
         }
 
         auto& current_bucket = scode[key];
+        auto& part = parts[key];
         current_bucket.dump_custom_program = dump_custom_program;
         current_bucket.one_time = one_time_kernel;
 
@@ -159,23 +274,65 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
             current_bucket.options = options;
         }
 
-        if ((current_bucket.kernels_counter % MAX_KERNELS_PER_PROGRAM) == 0)
+        size_t kernel_size = kernel_string.jit.size() + kernel_string.str.size();
+        for (const auto& header : kernel_string.headers)
+        {
+            if (part.headers.count(header.name) == 0)
+                kernel_size += header.code->size();
+        }
+
+        if (current_bucket.source.empty() || (part.size != 0 && part.size + kernel_size > MAX_PROGRAM_SOURCE_SIZE))
         {
             current_bucket.source.push_back({});
+            part = part_state();
         }
 
         current_bucket.entry_point_to_id[entry_point] = code.second.id;
 
-        source_code new_source_code = org_source_code;
-
-        if (batch_compilation)
+        auto& part_source = current_bucket.source.back();
+        for (const auto& header : kernel_string.headers)
         {
-            new_source_code.push_back(get_undef_jit(org_source_code));
+            if (!part.headers.insert(header.name).second)
+                continue;
+
+            const auto guard = get_header_guard(header.name);
+            part_source.push_back("#ifndef " + guard + "\n#define " + guard + "\n");
+            part_source.push_back(*header.code);
+            part_source.push_back("\n#endif\n");
+
+            if (header_macros.count(header.name) == 0)
+                get_directive_names(*header.code, "define", header_macros[header.name]);
         }
 
-        for (auto& s : new_source_code)
+        part_source.push_back(kernel_string.jit);
+        part_source.push_back(kernel_string.str);
+        part.size += kernel_size;
+
+        if (batch_compilation)
         {
-            current_bucket.source.back().push_back(std::move(s));
+            std::set<std::string> defined;
+            get_directive_names(kernel_string.jit, "define", defined);
+            get_directive_names(kernel_string.str, "define", defined);
+            part_source.push_back(get_undef_jit(defined));
+            part.size += part_source.back().size();
+
+            // kernel which redefines or undefines macros of a shared header leaves the header incomplete, so it is
+            // compiled again (with macros it still defines redefined identically) for the next kernels including it
+            std::set<std::string> changed = std::move(defined);
+            get_directive_names(kernel_string.str, "undef", changed);
+            for (auto it = part.headers.begin(); it != part.headers.end();)
+            {
+                const auto& macros = header_macros[*it];
+                if (std::any_of(macros.begin(), macros.end(), [&](const std::string& name) { return changed.count(name) != 0; }))
+                {
+                    part_source.push_back("#undef " + get_header_guard(*it) + "\n");
+                    it = part.headers.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
         }
 
         current_bucket.kernels_counter++;
@@ -186,27 +343,52 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
 
 kernels_cache::kernels_cache(gpu_toolkit& context): _context(context) {}
 
+bool kernels_cache::is_same_kernel(const kernel_code& code, const kernel_selector::kernel_string& kernel_string, bool dump_custom_program, bool one_time_kernel)
+{
+    return code.dump_custom_program == dump_custom_program && code.one_time_kernel == one_time_kernel &&
+        is_same_kernel_code(*code.kernel_strings, kernel_string);
+}
+
+const kernels_cache::kernel_code* kernels_cache::find_kernel_code(const kernels_code& codes, size_t hash, const kernel_selector::kernel_string& kernel_string, bool dump_custom_program, bool one_time_kernel)
+{
+    const auto range = codes.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+        if (is_same_kernel(it->second, kernel_string, dump_custom_program, one_time_kernel))
+            return &it->second;
+    }
+    return nullptr;
+}
+
 kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel)
 {
     kernels_cache::kernel_id id;
   
-    // same kernel_string == same kernel
-    const auto key = kernel_string.get()->get_hash();
+    // same kernel code == same kernel
+    const auto hash = get_kernel_code_hash(*kernel_string);
 
     std::lock_guard<std::mutex> lock(_mutex);
 
-    const auto it = _kernels_code.find(key);
+    const auto compiled_range = _compiled_kernels_code.equal_range(hash);
+    for (auto it = compiled_range.first; it != compiled_range.second; ++it)
+    {
+        if (is_same_kernel(it->second->second, *kernel_string, dump_custom_program, one_time_kernel))
+        {
+            _compiled_kernels_lru.splice(_compiled_kernels_lru.begin(), _compiled_kernels_lru, it->second);
+            return it->second->second.id;
+        }
+    }
 
-    if (it == _kernels_code.end())
+    if (const auto pending = find_kernel_code(_kernels_code, hash, *kernel_string, dump_custom_program, one_time_kernel))
     {
-        // we need unique id in order to avoid conflict across topologies.
-        const auto kernel_num = _kernels.size() + _kernels_code.size(); 
-        id = kernel_string->entry_point + "_" + std::to_string(kernel_num);
-        _kernels_code[key] = { kernel_string, id, dump_custom_program, one_time_kernel };
+        id = pending->id;
     }
     else
     {
-        id = it->second.id;
+        // we need unique id in order to avoid conflict across topologies.
+        const auto kernel_num = _kernels.size() + _kernels_code.size(); 
+        id = kernel_string->entry_point + "_" + std::to_string(kernel_num);
+        _kernels_code.emplace(hash, kernel_code{ kernel_string, id, dump_custom_program, one_time_kernel });
     }
 
     assert(_kernels.find(id) == _kernels.end());
@@ -214,7 +396,7 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const
+kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source, build_profiler* profiler) const
 {
     static uint32_t current_file_index = 0;
 
@@ -252,6 +434,8 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
                 }
             }
 
+            auto build_start = build_profiler::clock::now();
+            size_t part_kernels = 0;
             try
             {
                 cl::Program program(_context.context(), sources);
@@ -276,6 +460,7 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
                     auto kernel_name = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
                     kmap.emplace(kernel_name, k);
                 }
+                part_kernels = kernels.size();
             }
             catch (const cl::BuildError& err)
             {
@@ -293,7 +478,10 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
                 if (dump_sources && dump_file.good())
                     dump_file << "*/\n";
             }
-            
+
+            if (profiler)
+                profiler->add("kernels_build", profiler->get_current_scope() + "/part_" + std::to_string(part_idx - 1),
+                    build_start, build_profiler::clock::now(), part_kernels);
         }
 
         if (!err_log.empty())
@@ -316,23 +504,37 @@ kernels_cache::kernel_type kernels_cache::get_kernel(kernel_id id, bool one_time
     }
     else
     {
-        return _kernels.at(id);
+        // arguments are set on the returned object, so only the first user of a shared kernel gets the compiled one
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto& compiled = _kernels.at(id);
+        if (_kernels_in_use.insert(id).second)
+            return compiled;
+        return clone_kernel(compiled);
     }
 }
 
-void kernels_cache::build_all()
+void kernels_cache::build_all(build_profiler* profiler)
 {
     if (!_pending_compilation)
         return;
 
     std::lock_guard<std::mutex> lock(_mutex);
 
+    auto source_start = std::chrono::steady_clock::now();
     auto sorted_program_code = get_program_source(_kernels_code);
+    if (profiler)
+        profiler->add("kernels_source", "get_program_source", source_start, std::chrono::steady_clock::now(), _kernels_code.size());
 
     _one_time_kernels.clear();
+    size_t program_idx = 0;
     for (auto& program : sorted_program_code)
     {
-        auto kernels = build_program(program.second);
+        std::unique_ptr<build_profiler::scope> program_scope;
+        if (profiler)
+            program_scope.reset(new build_profiler::scope(profiler, "kernels_program", "program_" + std::to_string(program_idx), program.second.kernels_counter));
+        program_idx++;
+
+        auto kernels = build_program(program.second, profiler);
 
         for (auto& k : kernels)
         {
@@ -349,6 +551,29 @@ void kernels_cache::build_all()
         }
     }
 
+    for (const auto& code : _kernels_code)
+    {
+        if (code.second.one_time_kernel)
+            continue;
+
+        _compiled_kernels_lru.push_front(code);
+        _compiled_kernels_code.emplace(code.first, _compiled_kernels_lru.begin());
+        if (_compiled_kernels_lru.size() <= compiled_kernels_code_capacity)
+            continue;
+
+        // the compiled kernel itself stays in the cache for programs using it, only its code is no longer matched
+        const auto range = _compiled_kernels_code.equal_range(_compiled_kernels_lru.back().first);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (it->second == std::prev(_compiled_kernels_lru.end()))
+            {
+                _compiled_kernels_code.erase(it);
+                break;
+            }
+        }
+        _compiled_kernels_lru.pop_back();
+    }
+
     _kernels_code.clear();
     _pending_compilation = false;
 }
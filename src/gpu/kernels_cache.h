@@ -16,8 +16,10 @@
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
+#include <list>
 #include <map>
 #include <mutex>
+#include <set>
 #include <vector>
 #include <memory>
 #include <atomic>
@@ -37,7 +39,10 @@ namespace kernel_selector
     using kernel_string = kernel_selector::KernelString;
 }
 
-namespace cldnn { namespace gpu {
+namespace cldnn {
+class build_profiler;
+
+namespace gpu {
 
 class gpu_toolkit;
 
@@ -68,7 +73,7 @@ public:
     typedef cl::Kernel kernel_type;
     using sorted_code = std::map<std::string, program_code>;
     using kernels_map = std::map<std::string, kernel_type>;
-    using kernels_code = std::map<std::string, kernel_code>;
+    using kernels_code = std::multimap<size_t, kernel_code>; // by hash of the code with the entry point excluded
 
 private:
     gpu_toolkit& _context;
@@ -77,18 +82,26 @@ private:
     std::atomic<bool> _pending_compilation{ false };
     std::map<std::string, kernel_type> _kernels;
     std::map<std::string, kernel_type> _one_time_kernels; // These kernels are intended to be executed only once (can be removed later from the cache).
+    // Code of recently compiled kernels, reused by subsequent programs with identical code. Most recently used first.
+    std::list<kernels_code::value_type> _compiled_kernels_lru;
+    std::multimap<size_t, std::list<kernels_code::value_type>::iterator> _compiled_kernels_code;
+    std::set<kernel_id> _kernels_in_use; // Kernels already returned by get_kernel(), later users get a clone.
 
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
+    static bool is_same_kernel(const kernel_code& code, const kernel_selector::kernel_string& kernel_string, bool dump_custom_program, bool one_time_kernel);
+    static const kernel_code* find_kernel_code(const kernels_code& codes, size_t hash, const kernel_selector::kernel_string& kernel_string, bool dump_custom_program, bool one_time_kernel);
     friend class gpu_toolkit;
     explicit kernels_cache(gpu_toolkit& context);
-    kernels_map build_program(const program_code& pcode) const;
+    kernels_map build_program(const program_code& pcode, build_profiler* profiler = nullptr) const;
 
 public:
+    static const size_t compiled_kernels_code_capacity = 1024;
+
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel);
     kernel_type get_kernel(kernel_id id, bool one_time_kernel);
     gpu_toolkit& get_context() { return _context; }
-    //forces compilation of all pending kernels/programs
-    void build_all();
+    //forces compilation of all pending kernels/programs, time of each program part is recorded by the profiler if given
+    void build_all(build_profiler* profiler = nullptr);
 };
 
 }}
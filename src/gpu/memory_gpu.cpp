@@ -57,7 +57,13 @@ gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, resource_f
 }
 
 gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Buffer& buffer)
-    : memory_impl(engine, new_layout, true)
+    : gpu_buffer(engine, new_layout, buffer, true)
+{
+
+}
+
+gpu_buffer::gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Buffer& buffer, bool reused)
+    : memory_impl(engine, new_layout, reused)
     , _context(engine->get_context())
     , _lock_count(0)
     , _buffer(buffer)
@@ -89,6 +95,53 @@ void gpu_buffer::fill(unsigned char pattern, event_impl::ptr ev) {
     _context->queue().enqueueFillBuffer<unsigned char>(_buffer, pattern, 0, size(), 0, &ev_ocl);
 }
 
+gpu_host_buffer::mapping::mapping(std::shared_ptr<gpu_toolkit> context, const cl::Buffer& buffer, size_t size)
+    : context(context)
+    , buffer(buffer)
+    , ptr(context->queue().enqueueMapBuffer(buffer, CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, size))
+{
+}
+
+gpu_host_buffer::mapping::~mapping()
+{
+    context->queue().enqueueUnmapMemObject(buffer, ptr);
+}
+
+gpu_host_buffer::gpu_host_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout)
+    : gpu_buffer(engine, layout, cl::Buffer(engine->get_context()->context(), CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, layout.bytes_count()), false)
+    , _mapping(std::make_shared<mapping>(engine->get_context(), get_buffer(), size()))
+{
+    memset(_mapping->ptr, 0, size());
+}
+
+gpu_host_buffer::gpu_host_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const gpu_host_buffer& other)
+    : gpu_buffer(engine, new_layout, other.get_buffer(), true)
+    , _mapping(other._mapping)
+{
+}
+
+void* gpu_host_buffer::lock() {
+    cl::Event transfer;
+    {
+        std::lock_guard<std::mutex> locker(_mapping->mutex);
+        transfer = _mapping->transfer;
+    }
+    if (transfer.get() != nullptr)
+        transfer.wait();
+    return _mapping->ptr;
+}
+
+void gpu_host_buffer::set_transfer(const cl::Event& ev) {
+    std::lock_guard<std::mutex> locker(_mapping->mutex);
+    _mapping->transfer = ev;
+}
+
+void gpu_host_buffer::fill(unsigned char pattern, event_impl::ptr ev) {
+    memset(gpu_host_buffer::lock(), pattern, size());
+    if (auto user_ev = dynamic_cast<cldnn::user_event*>(ev.get()))
+        user_ev->set();
+}
+
 gpu_image2d::gpu_image2d(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout)
     : memory_impl(engine, layout, false)
     , _context(engine->get_context())
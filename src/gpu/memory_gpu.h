@@ -70,6 +70,9 @@ struct gpu_buffer : public memory_impl {
         return _buffer;
     }
 
+protected:
+    gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const cl::Buffer& buffer, bool reused);
+
 private:
     gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout);
     gpu_buffer(const refcounted_obj_ptr<engine_impl>& engine, resource_flags flags, gpu_buffer::ptr to_copy);
@@ -81,6 +84,43 @@ private:
     void* _mapped_ptr;
 };
 
+/*
+Buffer allocated in host memory (CL_MEM_ALLOC_HOST_PTR), which stays mapped for its whole lifetime. It holds
+inputs and outputs of nodes executed on the host in a device program. Its content is copied from and to device
+buffers by transfers enqueued without blocking, so host accesses wait only for the last transfer, instead of mapping
+the buffer, which waits for all commands in the queue.
+*/
+struct gpu_host_buffer : public gpu_buffer {
+    friend cldnn::memory_pool;
+
+    gpu_host_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& new_layout, const gpu_host_buffer& other);
+    void* lock() override;
+    void unlock() override {}
+    void fill(unsigned char pattern, event_impl::ptr ev) override;
+
+    // mapped memory, accessed by transfers enqueued on the queue
+    void* host_ptr() const { return _mapping->ptr; }
+    // sets the last transfer which reads or writes the buffer
+    void set_transfer(const cl::Event& ev);
+
+private:
+    gpu_host_buffer(const refcounted_obj_ptr<engine_impl>& engine, const layout& layout);
+
+    // shared by all reinterpretations of the buffer
+    struct mapping
+    {
+        mapping(std::shared_ptr<gpu_toolkit> context, const cl::Buffer& buffer, size_t size);
+        ~mapping();
+
+        std::shared_ptr<gpu_toolkit> context;
+        cl::Buffer buffer;
+        void* ptr;
+        std::mutex mutex;
+        cl::Event transfer;
+    };
+    std::shared_ptr<mapping> _mapping;
+};
+
 struct gpu_image2d : public memory_impl {
     friend cldnn::memory_pool;
 
@@ -54,14 +54,10 @@ namespace cldnn { namespace gpu{
             throw std::runtime_error("[ERROR]. Number of devices from user context is not equal to 1.");
         }
         auto device = all_devices.at(0);
-        auto dev_type = device.getInfo<CL_DEVICE_TYPE>();
-        if (dev_type != CL_DEVICE_TYPE_GPU)
-        {
-            throw std::runtime_error("[ERROR]. User defined device is not an gpu device!");
-        }
 
+        // device of user context is chosen explicitly, so any device type and vendor is accepted (e.g. CPU devices)
         std::list<std::string> reasons;
-        if (does_device_match_config(config, device, reasons))
+        if (does_device_match_config(config, device, reasons, false))
         {
             _device = device;
             return;
@@ -124,30 +120,33 @@ namespace cldnn { namespace gpu{
         _context = cl::Context(_device);
     }
 
-    bool ocl_builder::does_device_match_config(const configuration& config, const cl::Device& dev, std::list<std::string>& reasons)
+    bool ocl_builder::does_device_match_config(const configuration& config, const cl::Device& dev, std::list<std::string>& reasons, bool check_type_and_vendor)
     {
         auto dev_name = dev.getInfo<CL_DEVICE_NAME>();
         bool ok = true;
 
-        auto dev_type = dev.getInfo<CL_DEVICE_TYPE>();
+        if (check_type_and_vendor)
+        {
+            auto dev_type = dev.getInfo<CL_DEVICE_TYPE>();
 
-        cl_device_type device_types[] = {
-            CL_DEVICE_TYPE_DEFAULT,
-            CL_DEVICE_TYPE_CPU,
-            CL_DEVICE_TYPE_GPU,
-            CL_DEVICE_TYPE_ACCELERATOR };
+            cl_device_type device_types[] = {
+                CL_DEVICE_TYPE_DEFAULT,
+                CL_DEVICE_TYPE_CPU,
+                CL_DEVICE_TYPE_GPU,
+                CL_DEVICE_TYPE_ACCELERATOR };
 
-        if (dev_type != device_types[config.device_type])
-        {
-            reasons.push_back(dev_name + ": invalid device type");
-            ok = false;
-        }
+            if (dev_type != device_types[config.device_type])
+            {
+                reasons.push_back(dev_name + ": invalid device type");
+                ok = false;
+            }
 
-        auto vendor_id = dev.getInfo<CL_DEVICE_VENDOR_ID>();
-        if (vendor_id != config.device_vendor)
-        {
-            reasons.push_back(dev_name + ": invalid vendor type");
-            ok = false;
+            auto vendor_id = dev.getInfo<CL_DEVICE_VENDOR_ID>();
+            if (vendor_id != config.device_vendor)
+            {
+                reasons.push_back(dev_name + ": invalid vendor type");
+                ok = false;
+            }
         }
 
         if (config.host_out_of_order)
@@ -45,7 +45,7 @@ namespace gpu {
         void build_device_from_user_context(const configuration& config);
         void build_device(const configuration& config);
         void build_context();
-        bool does_device_match_config(const configuration& config, const cl::Device& dev, std::list<std::string>& reasons);
+        bool does_device_match_config(const configuration& config, const cl::Device& dev, std::list<std::string>& reasons, bool check_type_and_vendor = true);
         void build_platform_id();
     };
 
@@ -194,6 +194,53 @@ event_impl::ptr gpu_toolkit::enqueue_kernel(cl::Kernel const& kern, cl::NDRange
     return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter);
 }
 
+template <class Enqueue>
+event_impl::ptr gpu_toolkit::enqueue_transfer(std::vector<event_impl::ptr> const& deps, std::string const& name, Enqueue&& enqueue)
+{
+    std::vector<cl::Event> dep_events;
+    auto dep_events_ptr = &dep_events;
+    if (!_configuration.host_out_of_order)
+    {
+        for (auto& dep : deps)
+            if (auto ocl_ev = dynamic_cast<base_event*>(dep.get()))
+                dep_events.push_back(ocl_ev->get());
+    }
+    else
+    {
+        dep_events_ptr = nullptr;
+        sync_events(deps);
+    }
+
+    // host accesses of the transferred memory wait for this event, so it is created regardless of _output_event
+    cl::Event ret_ev;
+    try {
+        enqueue(dep_events_ptr, &ret_ev);
+    }
+    catch (cl::Error const& err) {
+        throw ocl_error(err);
+    }
+
+    if (logging_enabled())
+        log(_queue_counter + 1, name + ", deps: " + (_configuration.host_out_of_order ? std::string("()") : events_list_to_string(deps)));
+    return _events_pool->get_from_base_pool(shared_from_this(), ret_ev, ++_queue_counter);
+}
+
+event_impl::ptr gpu_toolkit::enqueue_read_buffer(cl::Buffer const& buffer, size_t size, void* ptr, std::vector<event_impl::ptr> const& deps)
+{
+    return enqueue_transfer(deps, "Read buffer", [&](std::vector<cl::Event>* dep_events, cl::Event* ev)
+    {
+        _command_queue.enqueueReadBuffer(buffer, CL_FALSE, 0, size, ptr, dep_events, ev);
+    });
+}
+
+event_impl::ptr gpu_toolkit::enqueue_write_buffer(cl::Buffer const& buffer, size_t size, const void* ptr, std::vector<event_impl::ptr> const& deps)
+{
+    return enqueue_transfer(deps, "Write buffer", [&](std::vector<cl::Event>* dep_events, cl::Event* ev)
+    {
+        _command_queue.enqueueWriteBuffer(buffer, CL_FALSE, 0, size, ptr, dep_events, ev);
+    });
+}
+
 event_impl::ptr gpu_toolkit::enqueue_marker(std::vector<event_impl::ptr> const& deps)
 {
     if (deps.empty())
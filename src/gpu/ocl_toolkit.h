@@ -71,7 +71,7 @@ public:
     const cl::CommandQueue& queue() const { return _command_queue; }
     
     const configuration& get_configuration() const { return _configuration; }
-    engine_info_internal get_engine_info() const { return _engine_info; }
+    const engine_info_internal& get_engine_info() const { return _engine_info; }
     kernels_cache& get_kernels_cache() { return _kernels_cache; }
 
     kernels_binaries_container* get_binaries() { return &_binaries; }
@@ -90,6 +90,9 @@ public:
 
     event_impl::ptr enqueue_kernel(cl::Kernel const& kern, cl::NDRange const& global, cl::NDRange const& local, std::vector<event_impl::ptr> const& deps);
     event_impl::ptr enqueue_marker(std::vector<event_impl::ptr> const& deps);
+    // non-blocking copies between a buffer and host memory, returned events are always backed by OpenCL events
+    event_impl::ptr enqueue_read_buffer(cl::Buffer const& buffer, size_t size, void* ptr, std::vector<event_impl::ptr> const& deps);
+    event_impl::ptr enqueue_write_buffer(cl::Buffer const& buffer, size_t size, const void* ptr, std::vector<event_impl::ptr> const& deps);
     event_impl::ptr group_events(std::vector<event_impl::ptr> const& deps);
     void reset_events();
     event_impl::ptr create_user_event(bool set);
@@ -126,6 +129,8 @@ private:
 
     //returns whether a barrier has been added
     void sync_events(std::vector<event_impl::ptr> const& deps);
+    template <class Enqueue>
+    event_impl::ptr enqueue_transfer(std::vector<event_impl::ptr> const& deps, std::string const& name, Enqueue&& enqueue);
     bool _output_event = false;
     std::ofstream& open_log();
 
@@ -39,12 +39,12 @@ struct user_event : public base_event, public cldnn::user_event
     {
         _event = cl::UserEvent(get_context()->context());
         //we need to reset the timer(since attach_ocl_event is called only when this object is being reused)
-        _timer = cldnn::instrumentation::timer<>(); 
+        _timer = cldnn::instrumentation::timer<>();
+        //the event may have been set during its previous use, and it must not be handed out again until it is reset
+        _set = set;
+        _attached = true;
         if (set)
-        {
             set_impl();
-            _set = set;
-        }
     }
     bool get_profiling_info_impl(std::list<cldnn_profiling_interval>& info) override;
 
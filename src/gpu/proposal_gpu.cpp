@@ -21,6 +21,8 @@
 #include "engine_impl.h"
 #include "math_utils.h"
 #include "error_handler.h"
+#include "api_impl.h"
+#include "cpu/thread_pool.h"
 
 #include <algorithm>
 #include <string>
@@ -81,6 +83,18 @@ namespace {
         return float16_to_float32(*((uint16_t*)(mem)));
     }
 
+    inline const float* float_buffer_helper(const float* mem, size_t, std::vector<float>&)
+    {
+        return mem;
+    }
+
+    inline const float* float_buffer_helper(const half_t* mem, size_t count, std::vector<float>& storage)
+    {
+        storage.resize(count);
+        half_to_float(reinterpret_cast<const uint16_t*>(mem), storage.data(), count);
+        return storage.data();
+    }
+
     inline void float_write_helper(float* mem, float f)
     {
         *mem = f;
@@ -218,7 +232,7 @@ struct proposal_gpu : typed_primitive_impl<proposal>
     {}
     
     template<typename dtype>
-    void execute(proposal_inst& instance)
+    void execute(proposal_inst& instance, cpu::thread_pool& pool)
     {
         const std::vector<proposal_inst::anchor>& anchors = instance.get_anchors();
 
@@ -287,13 +301,17 @@ struct proposal_gpu : typed_primitive_impl<proposal>
 
         mem_lock<dtype> cls_scores_ptr{ cls_scores };
         mem_lock<dtype> bbox_pred_ptr{ bbox_pred };
-        const dtype* cls_scores_mem = cls_scores_ptr.data();
-        const dtype* bbox_pred_mem  = bbox_pred_ptr.data();
-
-        std::vector<proposal_t> sorted_proposals_confidence;
-        sorted_proposals_confidence.reserve(fm_h * fm_w * anchors_num);
-        for (int y = 0; y < fm_h; ++y)
+        // half inputs are converted in bulk once instead of per element inside the anchors loop
+        std::vector<float> cls_scores_storage;
+        std::vector<float> bbox_pred_storage;
+        const float* cls_scores_mem = float_buffer_helper(cls_scores_ptr.data(), cls_scores.get_layout().get_buffer_size().count(), cls_scores_storage);
+        const float* bbox_pred_mem  = float_buffer_helper(bbox_pred_ptr.data(), bbox_pred.get_layout().get_buffer_size().count(), bbox_pred_storage);
+
+        // rows of the feature map are decoded in parallel, each proposal has a fixed position in the vector
+        std::vector<proposal_t> sorted_proposals_confidence(fm_h * fm_w * anchors_num);
+        pool.parallel_for(static_cast<size_t>(fm_h), [&](size_t row)
         {
+            const int y = static_cast<int>(row);
             for (int x = 0; x < fm_w; ++x)
             {
                 const int anchor_shift_x = (swap_xy ? y : x) * instance.argument.feature_stride;
@@ -303,10 +321,10 @@ struct proposal_gpu : typed_primitive_impl<proposal>
                 // we assume proposals are grouped by window location
                 for (unsigned int anchor_index = 0; anchor_index < anchors_num ; anchor_index++)
                 {
-                    float dx0 = float_read_helper(bbox_pred_mem + location_index + fm_sz * (anchor_index * 4 + 0)) / box_coordinate_scale;
-                    float dy0 = float_read_helper(bbox_pred_mem + location_index + fm_sz * (anchor_index * 4 + 1)) / box_coordinate_scale;
-                    float dx1 = float_read_helper(bbox_pred_mem + location_index + fm_sz * (anchor_index * 4 + 2)) / box_size_scale;
-                    float dy1 = float_read_helper(bbox_pred_mem + location_index + fm_sz * (anchor_index * 4 + 3)) / box_size_scale;
+                    float dx0 = bbox_pred_mem[location_index + fm_sz * (anchor_index * 4 + 0)] / box_coordinate_scale;
+                    float dy0 = bbox_pred_mem[location_index + fm_sz * (anchor_index * 4 + 1)] / box_coordinate_scale;
+                    float dx1 = bbox_pred_mem[location_index + fm_sz * (anchor_index * 4 + 2)] / box_size_scale;
+                    float dy1 = bbox_pred_mem[location_index + fm_sz * (anchor_index * 4 + 3)] / box_size_scale;
 
                     delta_t bbox_delta { dx0, dy0, dx1, dy1 };
 
@@ -317,11 +335,12 @@ struct proposal_gpu : typed_primitive_impl<proposal>
                     int bbox_h = (int)(roi.y1 - roi.y0 + coordinates_offset);
 
                     unsigned int scores_index = location_index + fm_sz * (anchor_index + (unsigned int)anchors_num);
-                    float proposal_confidence = (min_bbox_x <= bbox_w)* (min_bbox_y <= bbox_h) * float_read_helper(cls_scores_mem + scores_index);
-                    sorted_proposals_confidence.emplace_back(roi, proposal_confidence, sorted_proposals_confidence.size());
+                    float proposal_confidence = (min_bbox_x <= bbox_w)* (min_bbox_y <= bbox_h) * cls_scores_mem[scores_index];
+                    const size_t ord = location_index * anchors_num + anchor_index;
+                    sorted_proposals_confidence[ord] = proposal_t(roi, proposal_confidence, ord);
                 }
             }
-        }
+        });
 
         size_t pre_nms = std::min(instance.argument.pre_nms_topn, (int)sorted_proposals_confidence.size());
         sort_and_keep_n_items(sorted_proposals_confidence, pre_nms);
@@ -361,15 +380,16 @@ struct proposal_gpu : typed_primitive_impl<proposal>
             a->wait();
         }
 
-        auto ev = instance.get_network().get_engine().create_user_event(false);
+        auto& engine = instance.get_network().get_engine();
+        auto ev = engine.create_user_event(false);
 
         if (instance.dep_memory(proposal_inst::cls_scores_index).get_layout().data_type == data_types::f16)
         {
-            execute<data_type_to_type<data_types::f16>::type>(instance);
+            execute<data_type_to_type<data_types::f16>::type>(instance, engine.get_thread_pool());
         }
         else
         {
-            execute<data_type_to_type<data_types::f32>::type>(instance);
+            execute<data_type_to_type<data_types::f32>::type>(instance, engine.get_thread_pool());
         }
 
         dynamic_cast<cldnn::user_event*>(ev.get())->set(); // set as complete
@@ -401,6 +421,8 @@ namespace {
         {
             implementation_map<proposal>::add(std::make_tuple(engine_types::ocl, data_types::f32, format::bfyx), proposal_gpu::create);
             implementation_map<proposal>::add(std::make_tuple(engine_types::ocl, data_types::f16, format::bfyx), proposal_gpu::create);
+            implementation_map<proposal>::add(std::make_tuple(engine_types::cpu, data_types::f32, format::bfyx), proposal_gpu::create);
+            implementation_map<proposal>::add(std::make_tuple(engine_types::cpu, data_types::f16, format::bfyx), proposal_gpu::create);
         }
 
         ~attach() {}
@@ -53,6 +53,11 @@ public:
 
     static primitive_impl* create(const reorder_node& arg)
     {
+        if (arg.is_transfer())
+        {
+            return create_transfer(arg);
+        }
+
         auto&& input_layout = arg.input().get_output_layout();
         auto&& output_layout = arg.get_output_layout();
 
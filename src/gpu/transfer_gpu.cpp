@@ -0,0 +1,84 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "reorder_inst.h"
+#include "network_impl.h"
+#include "engine_impl.h"
+#include "memory_gpu.h"
+#include "ocl_base_event.h"
+#include "ocl_toolkit.h"
+
+#include <cstring>
+
+namespace cldnn { namespace gpu {
+
+/*
+Copy between a device buffer and a host buffer of a node executed on the host (see add_host_transfers).
+The copy is enqueued without blocking and its event is recorded in the host buffer, so host implementations wait
+for the copy only, while the queue keeps executing primitives enqueued after it.
+*/
+struct transfer_gpu : typed_primitive_impl<reorder>
+{
+    const reorder_node& outer;
+
+    explicit transfer_gpu(const reorder_node& outer)
+        : outer(outer)
+    {}
+
+    event_impl::ptr execute_impl(const std::vector<event_impl::ptr>& events, reorder_inst& instance) override
+    {
+        auto& engine = instance.get_network().get_engine();
+        auto& input = instance.input_memory();
+        auto& output = instance.output_memory();
+
+        auto host_input = dynamic_cast<gpu_host_buffer*>(&input);
+        auto host_output = dynamic_cast<gpu_host_buffer*>(&output);
+        auto device_input = dynamic_cast<gpu_buffer*>(&input);
+        auto device_output = dynamic_cast<gpu_buffer*>(&output);
+
+        if (host_output != nullptr && host_input == nullptr && device_input != nullptr)
+        {
+            auto ev = engine.get_context()->enqueue_read_buffer(device_input->get_buffer(), output.size(), host_output->host_ptr(), events);
+            host_output->set_transfer(dynamic_cast<base_event*>(ev.get())->get());
+            return ev;
+        }
+
+        if (host_input != nullptr && host_output == nullptr && device_output != nullptr)
+        {
+            // the host buffer is written by a host implementation, which has already finished
+            auto ev = engine.get_context()->enqueue_write_buffer(device_output->get_buffer(), output.size(), host_input->host_ptr(), events);
+            host_input->set_transfer(dynamic_cast<base_event*>(ev.get())->get());
+            return ev;
+        }
+
+        // other memory (e.g. images or memory set by the user) is copied through locks
+        engine.wait_for_events(events);
+        {
+            mem_lock<char> src(input);
+            mem_lock<char> dst(output);
+            std::memcpy(dst.data(), src.data(), output.size());
+        }
+        return engine.create_user_event(true);
+    }
+};
+
+primitive_impl* create_transfer(const reorder_node& arg)
+{
+    return new transfer_gpu(arg);
+}
+
+} }
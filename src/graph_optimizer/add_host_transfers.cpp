@@ -0,0 +1,159 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "program_helpers.h"
+#include "data_inst.h"
+#include "reorder_inst.h"
+#include "api_impl.h"
+
+#include <algorithm>
+#include <cstring>
+
+/*
+This pass connects nodes placed on the host (see assign_host_placement) with the rest of the program.
+Outputs of host nodes are kept in memory mapped to the host. Every output which is used on the other side is copied
+by a single transfer (a reorder which does not change the layout), enqueued right after the output is produced.
+Constant inputs of host nodes are copied to host memory once, here. Host nodes are executed just before their first
+user, so that device primitives enqueued before them run while the host computes.
+*/
+
+using namespace cldnn;
+
+namespace
+{
+    memory_impl::ptr copy_to_host(engine_impl& engine, memory_impl& mem)
+    {
+        auto host_mem = engine.allocate_memory(mem.get_layout(), resource_flags::HOST_PINNED);
+        mem_lock<char> src(mem);
+        mem_lock<char> dst(*host_mem);
+        std::memcpy(dst.data(), src.data(), mem.size());
+        return host_mem;
+    }
+}
+
+void add_host_transfers::run(program_impl& p)
+{
+    std::vector<program_node*> host_nodes;
+    for (auto& node : p.get_processing_order())
+    {
+        if (node->is_host_placed())
+            host_nodes.push_back(node);
+    }
+    if (host_nodes.empty())
+        return;
+
+    schedule_host_nodes(p);
+
+    for (auto node : host_nodes)
+    {
+        copy_constants_to_host(p, *node);
+        node->set_host_output(true);
+    }
+
+    const std::vector<program_node*> nodes(p.get_processing_order().begin(), p.get_processing_order().end());
+    for (auto node : nodes)
+    {
+        if (node->is_type<data>())
+            continue;
+
+        const bool host = program_helpers::is_on_host(*node);
+        program_node* transfer = nullptr;
+        const auto users = node->get_users();
+        for (auto usr : users)
+        {
+            if (program_helpers::is_on_host(*usr) == host)
+                continue;
+
+            if (transfer == nullptr)
+                transfer = &add_transfer(p, *node, *usr, !host);
+            else
+                usr->replace_dependency(*node, *transfer);
+        }
+    }
+}
+
+// moves host nodes just before their first users
+void add_host_transfers::schedule_host_nodes(program_impl& p)
+{
+    auto& order = p.get_processing_order();
+    std::vector<program_node*> host_nodes;
+    for (auto& node : order)
+    {
+        if (node->is_host_placed())
+            host_nodes.push_back(node);
+    }
+
+    // users are visited first, so chains of host nodes are moved together
+    for (auto itr = host_nodes.rbegin(); itr != host_nodes.rend(); ++itr)
+    {
+        auto node = *itr;
+        if (node->get_users().empty())
+            continue;
+
+        auto first_user = *std::min_element(node->get_users().begin(), node->get_users().end(),
+            [&order](program_node* a, program_node* b) { return order.get_processing_number(a) < order.get_processing_number(b); });
+        order.erase(order.get_processing_iterator(*node));
+        order.insert(order.get_processing_iterator(*first_user), node);
+    }
+}
+
+// replaces constant inputs of the host node (including inputs of fused primitives) with their copies in host memory
+void add_host_transfers::copy_constants_to_host(program_impl& p, program_node& node)
+{
+    for (size_t i = 0; i < node.get_dependencies().size(); i++)
+    {
+        auto& dep = node.get_dependency(i);
+        if (!dep.is_type<data>())
+            continue;
+
+        const auto copy_id = "_cldnn_host_" + dep.id();
+        if (!p.has_node(copy_id))
+        {
+            auto host_mem = copy_to_host(p.get_engine(), dep.as<data>().get_attached_memory());
+            //c-cpp converter does not retain since normally it is done inside API-impl layer (cldnn.cpp) so we need to do it manually
+            host_mem->add_ref();
+            auto host_data = std::make_shared<data>(copy_id, details::memory_c_to_cpp_converter::convert(api_cast(host_mem.get())));
+            auto& copy_node = p.get_or_create(host_data);
+            copy_node.constant = dep.constant;
+            copy_node.data_flow = dep.data_flow;
+            copy_node.get_output_layout();
+            p.get_processing_order().insert(std::next(p.get_processing_order().get_processing_iterator(dep)), &copy_node);
+        }
+        node.replace_dependency(i, p.get_node(copy_id));
+    }
+
+    for (auto& fused : node.fused_prims)
+    {
+        for (auto& input : fused.inputs)
+            input = copy_to_host(p.get_engine(), *input);
+    }
+}
+
+program_node& add_host_transfers::add_transfer(program_impl& p, program_node& node, program_node& usr, bool to_host)
+{
+    auto transfer = std::make_shared<reorder>(node.id() + (to_host ? "_to_host" : "_to_device"), node.id(), node.get_output_layout());
+    auto& transfer_node = p.get_or_create(transfer).as<reorder>();
+    p.add_intermediate(transfer_node, usr, node);
+
+    transfer_node.set_transfer(true);
+    transfer_node.set_host_output(to_host);
+    transfer_node.get_output_layout();
+    transfer_node.set_selected_impl(transfer_node.type()->choose_impl(p.get_engine(), transfer_node));
+    return transfer_node;
+}
@@ -0,0 +1,232 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "program_helpers.h"
+#include "internal_primitive.h"
+#include "data_inst.h"
+#include "input_layout_inst.h"
+#include "mutable_data_inst.h"
+#include "prior_box_inst.h"
+#include "concatenation_inst.h"
+#include "convolution_inst.h"
+#include "deconvolution_inst.h"
+#include "fully_connected_inst.h"
+#include "gemm_inst.h"
+#include "pooling_inst.h"
+#include "lrn_inst.h"
+#include "softmax_inst.h"
+#include "detection_output_inst.h"
+#include "proposal_inst.h"
+#include "cpu/thread_pool.h"
+
+#include <algorithm>
+#include <vector>
+
+/*
+This pass places nodes of a GPU program built with cpu_fallback option on the host, where they are executed by
+implementations of the CPU engine. Nodes without GPU implementation, and nodes whose GPU implementation runs on the
+host anyway, are always placed on the host. Other nodes are moved between the device and the host one by one, as long
+as it lowers the estimated execution time of the program, including copies between device and host memory. The
+performance model is given by host_placement_cost_model build option, throughputs it leaves unset are estimated.
+*/
+
+using namespace cldnn;
+
+namespace
+{
+    using cost_model = host_placement_cost_model;
+
+    const double device_ops_per_cycle_per_unit = 8.0;
+    const double host_ops_per_us_per_thread = 2000.0;
+
+    cost_model get_cost_model(program_impl& p)
+    {
+        auto model = p.get_options().get<build_option_type::host_placement_cost_model>()->model;
+        if (model.device_ops_per_us <= 0.0)
+        {
+            const auto& info = p.get_engine().get_engine_info();
+            model.device_ops_per_us = std::max(1.0, static_cast<double>(info.cores_count) * info.core_frequency * device_ops_per_cycle_per_unit);
+        }
+        if (model.host_ops_per_us <= 0.0)
+            model.host_ops_per_us = host_ops_per_us_per_thread * p.get_engine().get_thread_pool().threads_count();
+        return model;
+    }
+
+    // estimated number of operations executed by the node (multiply-adds of convolutions etc.)
+    double get_ops(program_node& node)
+    {
+        const auto out = node.get_output_layout();
+        const double out_count = static_cast<double>(out.count());
+
+        if (node.is_type<convolution>() || node.is_type<deconvolution>() || node.is_type<fully_connected>())
+        {
+            // weights of all input features (and kernel positions) contribute to each output value
+            const auto weights = node.get_dependency(1).get_output_layout();
+            return out_count * weights.count() / std::max(1, weights.size.batch[0]);
+        }
+        if (node.is_type<gemm>())
+            return out_count * node.get_dependency(0).get_output_layout().size.spatial[0];
+        if (node.is_type<pooling>())
+        {
+            const auto& window = node.as<pooling>().get_primitive()->size;
+            return out_count * window.spatial[0] * window.spatial[1];
+        }
+        if (node.is_type<lrn>())
+            return out_count * node.as<lrn>().get_primitive()->size;
+        if (node.is_type<softmax>())
+            return out_count * 3;
+
+        double ops = out_count;
+        for (auto& dep : node.get_dependencies())
+            ops += dep->get_output_layout().count();
+        return ops;
+    }
+
+    double exec_cost(program_node& node, const cost_model& model)
+    {
+        if (node.can_be_optimized() || node.is_type<data>() || node.is_type<input_layout>() || node.is_type<mutable_data>())
+            return 0.0;
+        if (node.is_host_placed())
+            return model.host_call_time + get_ops(node) / model.host_ops_per_us;
+        return model.kernel_launch_time + get_ops(node) / model.device_ops_per_us;
+    }
+
+    // copy of the node's output to the other side, needed when any of its users is there (outputs of the network
+    // are read by the host as well)
+    double transfer_cost(program_node& node, const cost_model& model)
+    {
+        if (node.is_type<data>())
+            return 0.0; // constants are copied to the host once, while building the network
+
+        const bool host = program_helpers::is_on_host(node);
+        bool needed = node.is_output() && !host;
+        for (auto& usr : node.get_users())
+            needed = needed || program_helpers::is_on_host(*usr) != host;
+
+        return needed ? model.transfer_latency + node.get_output_layout().bytes_count() / model.transfer_bytes_per_us : 0.0;
+    }
+
+    // Nodes whose cost depends on the placement of the node: the node itself, optimized out users which share its
+    // memory (recursively) and the dependencies of all of these, whose outputs may need to be copied.
+    std::vector<program_node*> get_affected_nodes(program_node& node)
+    {
+        std::vector<program_node*> sharing = { &node };
+        for (size_t i = 0; i < sharing.size(); i++)
+        {
+            for (auto usr : sharing[i]->get_users())
+            {
+                if (usr->can_be_optimized() && &usr->get_dependency(0) == sharing[i])
+                    sharing.push_back(usr);
+            }
+        }
+
+        std::vector<program_node*> affected = sharing;
+        for (auto shared : sharing)
+        {
+            for (auto dep : shared->get_dependencies())
+                affected.push_back(dep);
+        }
+        std::sort(affected.begin(), affected.end());
+        affected.erase(std::unique(affected.begin(), affected.end()), affected.end());
+        return affected;
+    }
+
+    double nodes_cost(const std::vector<program_node*>& nodes, const cost_model& model)
+    {
+        double cost = 0.0;
+        for (auto node : nodes)
+            cost += exec_cost(*node, model) + transfer_cost(*node, model);
+        return cost;
+    }
+
+    bool has_implementation(program_impl& p, program_node& node, bool host)
+    {
+        const bool placed = node.is_host_placed();
+        node.set_host_placed(host);
+        const bool exists = node.type()->does_an_implementation_exist(p.get_engine(), node);
+        node.set_host_placed(placed);
+        return exists;
+    }
+
+    bool can_be_placed_on_host(program_impl& p, program_node& node)
+    {
+        if (node.is_type<internal_primitive>() || node.is_type<data>() || node.is_type<input_layout>() ||
+            node.is_type<mutable_data>() || node.is_type<prior_box>())
+            return false;
+        if (node.can_be_optimized() || node.is_constant())
+            return false;
+
+        // in-place concatenation expects its inputs to write directly into its device buffer
+        for (auto& usr : node.get_users())
+        {
+            if (usr->is_type<concatenation>() && usr->can_be_optimized())
+                return false;
+        }
+        return has_implementation(p, node, true);
+    }
+
+    // GPU implementations of these primitives compute on the host, after waiting for the whole queue
+    bool runs_on_host_anyway(program_impl& p, const program_node& node)
+    {
+        if (node.is_type<detection_output>())
+            return !p.get_options().get<build_option_type::detection_output_gpu>()->enabled();
+        return node.is_type<proposal>();
+    }
+}
+
+void assign_host_placement::run(program_impl& p)
+{
+    const auto model = get_cost_model(p);
+
+    std::vector<program_node*> candidates;
+    for (auto& node : p.get_processing_order())
+    {
+        if (!can_be_placed_on_host(p, *node))
+            continue;
+
+        if (runs_on_host_anyway(p, *node) || !has_implementation(p, *node, false))
+            node->set_host_placed(true);
+        else
+            candidates.push_back(node);
+    }
+
+    // moving a node changes only the costs of its neighbourhood, so a move is evaluated on those nodes
+    std::vector<std::vector<program_node*>> affected;
+    affected.reserve(candidates.size());
+    for (auto node : candidates)
+        affected.push_back(get_affected_nodes(*node));
+
+    // greedy local search - each pass keeps every single move which lowers the cost
+    for (size_t pass = 0; pass < candidates.size(); pass++)
+    {
+        bool changed = false;
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            auto node = candidates[i];
+            const double cost = nodes_cost(affected[i], model);
+            node->set_host_placed(!node->is_host_placed());
+            if (nodes_cost(affected[i], model) < cost)
+                changed = true;
+            else
+                node->set_host_placed(!node->is_host_placed());
+        }
+        if (!changed)
+            break;
+    }
+}
@@ -0,0 +1,216 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "program_node.h"
+#include "program_impl.h"
+#include "permute_inst.h"
+#include "reorder_inst.h"
+#include "reshape_inst.h"
+
+#include <array>
+#include <vector>
+
+using namespace cldnn;
+
+//permute, reshape and plain reorder only move data around, so a chain of them is equivalent to a single permutation
+//of the chain's input. This pass composes such chains (as produced e.g. by importers around transposes) and replaces
+//them with:
+//- nothing, if the chain does not change the input at all,
+//- a reshape, if the chain only moves dimensions of size 1 (reshape is later executed in place),
+//- a single permute otherwise.
+//Chains are handled only for plain bfyx data without padding; reshapes in a chain have to keep the order of dimensions
+//bigger than 1 (i.e. only add or remove dimensions of size 1), other reshapes end the chain.
+namespace {
+    //dimensions in bfyx order
+    using dims_order = std::array<uint16_t, 4>;
+
+    std::array<tensor::value_type, 4> bfyx_sizes(const layout& l)
+    {
+        return { l.size.batch[0], l.size.feature[0], l.size.spatial[1], l.size.spatial[0] };
+    }
+
+    bool is_plain_layout(const layout& l)
+    {
+        return l.format == format::bfyx && !l.data_padding;
+    }
+
+    bool has_fused_ops(const program_node& node)
+    {
+        return node.get_fused_activation_func() != activation_none || node.has_fused_primitives();
+    }
+
+    //returns order of input dimensions which gives reshape's output, if reshape only moves dimensions of size 1
+    bool get_reshape_order(const layout& in_layout, const layout& out_layout, dims_order& order)
+    {
+        auto in = bfyx_sizes(in_layout);
+        auto out = bfyx_sizes(out_layout);
+
+        std::vector<uint16_t> in_unit, in_non_unit;
+        for (uint16_t i = 0; i < 4; i++)
+            (in[i] == 1 ? in_unit : in_non_unit).push_back(i);
+
+        size_t unit_idx = 0, non_unit_idx = 0;
+        for (size_t i = 0; i < 4; i++)
+        {
+            if (out[i] == 1)
+            {
+                if (unit_idx == in_unit.size())
+                    return false;
+                order[i] = in_unit[unit_idx++];
+            }
+            else
+            {
+                if (non_unit_idx == in_non_unit.size() || in[in_non_unit[non_unit_idx]] != out[i])
+                    return false;
+                order[i] = in_non_unit[non_unit_idx++];
+            }
+        }
+        return true;
+    }
+
+    bool is_plain_reorder(reorder_node& node)
+    {
+        auto prim = node.get_primitive();
+        return !node.has_mean() && prim->subtract_per_feature.empty() &&
+            node.get_output_layout().data_type == node.input().get_output_layout().data_type;
+    }
+
+    //checks if node can be a part of a chain and updates order of chain's input dimensions accordingly
+    bool append_to_chain(program_node& node, dims_order& order)
+    {
+        if (node.get_dependencies().size() != 1 || has_fused_ops(node) ||
+            !is_plain_layout(node.get_output_layout()) || !is_plain_layout(node.get_dependency(0).get_output_layout()))
+            return false;
+
+        dims_order node_order;
+        if (node.is_type<permute>())
+        {
+            auto& permute_order = node.as<permute>().get_primitive()->permute_order;
+            if (permute_order.size() != node_order.size())
+                return false;
+            std::copy(permute_order.begin(), permute_order.end(), node_order.begin());
+        }
+        else if (node.is_type<reshape>())
+        {
+            if (!get_reshape_order(node.get_dependency(0).get_output_layout(), node.get_output_layout(), node_order))
+                return false;
+        }
+        else if (node.is_type<reorder>() && is_plain_reorder(node.as<reorder>()))
+        {
+            node_order = { 0, 1, 2, 3 };
+        }
+        else
+        {
+            return false;
+        }
+
+        dims_order new_order;
+        for (size_t i = 0; i < 4; i++)
+            new_order[i] = order[node_order[i]];
+        order = new_order;
+        return true;
+    }
+
+    //true if chain output has the same linear memory as its input
+    bool keeps_memory_order(const layout& out_layout, const dims_order& order)
+    {
+        auto out = bfyx_sizes(out_layout);
+        int last = -1;
+        for (size_t i = 0; i < 4; i++)
+        {
+            if (out[i] == 1)
+                continue;
+            if (order[i] < last)
+                return false;
+            last = order[i];
+        }
+        return true;
+    }
+}
+
+void collapse_data_movement_chains::run(program_impl& p)
+{
+    struct chain
+    {
+        std::vector<program_node*> nodes;
+        dims_order order;
+        size_t permutes;
+    };
+
+    std::vector<chain> chains;
+    for (auto node : p.get_processing_order())
+    {
+        if (!node->is_type<permute>() && !node->is_type<reshape>() && !node->is_type<reorder>())
+            continue;
+
+        //chains are started at their first node only
+        auto& input = node->get_dependency(0);
+        dims_order unused = { 0, 1, 2, 3 };
+        if (input.get_users().size() == 1 && !input.is_output() && append_to_chain(input, unused))
+            continue;
+
+        chain c;
+        c.order = { 0, 1, 2, 3 };
+        c.permutes = 0;
+        auto current = node;
+        while (append_to_chain(*current, c.order))
+        {
+            c.nodes.push_back(current);
+            if (current->is_type<permute>())
+                c.permutes++;
+            if (current->get_users().size() != 1 || current->is_output())
+                break;
+            current = current->get_users().front();
+        }
+
+        if (c.permutes != 0 && !c.nodes.empty())
+            chains.push_back(c);
+    }
+
+    for (auto& c : chains)
+    {
+        auto& input = c.nodes.front()->get_dependency(0);
+        auto& last = *c.nodes.back();
+        auto in_layout = input.get_output_layout();
+        auto out_layout = last.get_output_layout();
+
+        bool identity = in_layout.size == out_layout.size && c.order == dims_order{ 0, 1, 2, 3 };
+        bool as_reshape = keeps_memory_order(out_layout, c.order);
+
+        //single permute which really moves data is already optimal
+        if (c.nodes.size() == 1 && !as_reshape)
+            continue;
+
+        //chain which does not change the data is removed, unless its id has to be kept as a network output
+        if (!identity || last.is_output())
+        {
+            std::shared_ptr<primitive> prim;
+            if (as_reshape)
+                prim = std::make_shared<reshape>("_collapsed_" + last.id(), input.id(), out_layout.size);
+            else
+                prim = std::make_shared<permute>("_collapsed_" + last.id(), input.id(),
+                    std::vector<uint16_t>(c.order.begin(), c.order.end()));
+            p.add_intermediate(prim, *c.nodes.front(), 0);
+        }
+
+        //the whole chain is now replaced by its input, so its nodes can be extracted one by one
+        for (auto node : c.nodes)
+            p.extract_and_remove(*node);
+    }
+}
@@ -22,6 +22,7 @@
 #include "mutable_data_inst.h"
 #include "program_node.h"
 #include "engine_impl.h"
+#include "build_profiler.h"
 
 using namespace cldnn;
 
@@ -33,7 +34,10 @@ void compile_graph::run(program_impl& p)
         {
             node->get_output_layout();
             if (!node->is_type<data>() && !(node->is_type<mutable_data>() && node->get_dependencies().empty()))
+            {
+                build_profiler::scope selection(p.get_build_profiler(), "kernel_selection", node->id());
                 node->selected_impl = node->type()->choose_impl(p.get_engine(), *node);
+            }
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,238 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "program_node.h"
+#include "program_impl.h"
+#include "data_inst.h"
+#include "reorder_inst.h"
+#include "reshape_inst.h"
+#include "permute_inst.h"
+#include "activation_inst.h"
+#include "crop_inst.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <unordered_map>
+
+using namespace cldnn;
+
+//merges nodes which compute the same thing: nodes of the same type, with the same parameters and the same inputs.
+//Only primitives handled in add_parameters() are considered. Constant data (e.g. prior boxes, which are calculated
+//during graph initialization) is merged when its contents are equal.
+namespace {
+    //content of bigger buffers is not compared to keep build time low
+    const size_t max_compared_data_size = 1024 * 1024;
+
+    void add_tensor(std::ostream& os, const tensor& t)
+    {
+        for (auto v : t.sizes())
+            os << v << ",";
+        os << ";";
+    }
+
+    void add_layout(std::ostream& os, const layout& l)
+    {
+        os << static_cast<int>(l.data_type) << ":" << static_cast<int>(l.format.value) << ":";
+        add_tensor(os, l.size);
+        add_tensor(os, l.data_padding.lower_size());
+        add_tensor(os, l.data_padding.upper_size());
+    }
+
+    //returns false for primitives which are not merged
+    bool add_parameters(std::ostream& os, program_node& node)
+    {
+        if (node.is_type<reorder>())
+        {
+            auto prim = node.as<reorder>().get_primitive();
+            os << static_cast<int>(prim->mean_mode) << ":";
+            for (auto v : prim->subtract_per_feature)
+                os << v << ",";
+            add_tensor(os, node.as<reorder>().get_input_offset());
+            return true;
+        }
+        if (node.is_type<reshape>())
+            return true; //defined by output layout
+        if (node.is_type<permute>())
+        {
+            for (auto v : node.as<permute>().get_primitive()->permute_order)
+                os << v << ",";
+            return true;
+        }
+        if (node.is_type<activation>())
+        {
+            auto prim = node.as<activation>().get_primitive();
+            os << static_cast<int>(prim->activation_func) << ":" << prim->additional_params.a << ":" << prim->additional_params.b;
+            return true;
+        }
+        if (node.is_type<crop>())
+        {
+            add_tensor(os, node.as<crop>().get_primitive()->offsets);
+            return true;
+        }
+        return false;
+    }
+
+    //names of the merged primitive types, for the merge statistics
+    const char* get_type_name(program_node& node)
+    {
+        if (node.is_type<data>()) return "data";
+        if (node.is_type<reorder>()) return "reorder";
+        if (node.is_type<reshape>()) return "reshape";
+        if (node.is_type<permute>()) return "permute";
+        if (node.is_type<activation>()) return "activation";
+        if (node.is_type<crop>()) return "crop";
+        return "other";
+    }
+
+    std::string get_key(program_node& node)
+    {
+        std::stringstream os;
+        os << node.type() << "|";
+        for (auto dep : node.get_dependencies())
+            os << dep->id() << ",";
+        os << "|";
+        add_layout(os, node.get_output_layout());
+        os << "|" << static_cast<int>(node.get_fused_activation_func()) << ":"
+           << node.get_fused_activation_params().a << ":" << node.get_fused_activation_params().b << "|";
+
+        if (node.is_type<data>())
+        {
+            //data nodes are compared by contents, key only narrows down candidates
+            auto& mem = node.as<data>().get_attached_memory();
+            os << mem.size();
+            return os.str();
+        }
+
+        if (!add_parameters(os, node))
+            return {};
+        return os.str();
+    }
+
+    bool same_data(program_node& first, program_node& second)
+    {
+        auto& mem1 = first.as<data>().get_attached_memory();
+        auto& mem2 = second.as<data>().get_attached_memory();
+        if (&mem1 == &mem2)
+            return true;
+        if (mem1.size() != mem2.size() || mem1.size() > max_compared_data_size)
+            return false;
+
+        mem_lock<char> ptr1(mem1);
+        mem_lock<char> ptr2(mem2);
+        return std::memcmp(ptr1.data(), ptr2.data(), mem1.size()) == 0;
+    }
+
+    //weights, biases and other parameters of primitives are looked up by ids stored in the primitive (e.g. by
+    //eltwise_shrinking), so only nodes used as regular input of all their users can be replaced
+    bool used_as_input(program_node& node)
+    {
+        for (auto user : node.get_users())
+        {
+            const auto& inputs = user->get_primitive()->get_input();
+            if (std::find(inputs.begin(), inputs.end(), node.id()) == inputs.end())
+                return false;
+        }
+        return true;
+    }
+
+    bool can_be_merged(program_node& node)
+    {
+        if (node.is_output() || node.has_fused_primitives() || node.can_be_optimized())
+            return false;
+
+        if (!used_as_input(node))
+            return false;
+
+        //nodes written directly into a buffer of their user (e.g. in-place concatenation) are not shared
+        for (auto user : node.get_users())
+            if (user->can_be_optimized())
+                return false;
+        return true;
+    }
+}
+
+std::string eliminate_common_subexpressions::get_profiling_details() const
+{
+    std::string details;
+    for (const auto& count : merged_nodes)
+        details += (details.empty() ? "merged " : ", ") + count.first + ": " + std::to_string(count.second);
+    return details;
+}
+
+void eliminate_common_subexpressions::run(program_impl& p)
+{
+    merged_nodes.clear();
+    std::unordered_map<std::string, std::vector<program_node*>> known_nodes;
+    std::vector<program_node*> merged;
+
+    auto itr = p.get_processing_order().begin(); //data nodes are removed as soon as they lose their users
+    while (itr != p.get_processing_order().end())
+    {
+        auto node = *itr++;
+        if (!can_be_merged(*node))
+            continue;
+
+        auto key = get_key(*node);
+        if (key.empty())
+            continue;
+
+        auto& candidates = known_nodes[key];
+        program_node* equivalent = nullptr;
+        for (auto candidate : candidates)
+        {
+            if (!node->is_type<data>() || same_data(*candidate, *node))
+            {
+                equivalent = candidate;
+                break;
+            }
+        }
+
+        if (!equivalent)
+        {
+            candidates.push_back(node);
+            continue;
+        }
+
+        merged_nodes[get_type_name(*node)]++;
+
+        //users are processed later, so their keys already use the remaining node
+        auto is_data = node->is_type<data>();
+        auto users = node->get_users();
+        for (auto user : users)
+        {
+            for (size_t i = 0; i < user->get_dependencies().size(); i++)
+                if (&user->get_dependency(i) == node)
+                    user->replace_dependency(i, *equivalent);
+        }
+
+        if (!is_data)
+        {
+            equivalent->add_merged_ids(*node);
+            merged.push_back(node);
+        }
+    }
+
+    for (auto node : merged)
+    {
+        while (!node->get_dependencies().empty())
+            node->remove_dependency(0);
+        p.remove_if_dangling(*node);
+    }
+}
@@ -25,6 +25,7 @@
 #include "lstm_inst.h"
 #include "reshape_inst.h"
 #include "upsampling_inst.h"
+#include "lstm/lstm_seq_kernel_base.h"
 
 #include <iomanip>
 
@@ -347,6 +348,30 @@ namespace cldnn
         }
     }
 
+    namespace {
+        // lstm with the whole sequence in a single input is executed by one kernel walking all the timesteps.
+        // Per-timestep inputs and stacked lstm nodes are still unrolled into lstm_gemm/lstm_elt pairs.
+        bool can_execute_as_sequence(lstm_node& node)
+        {
+            if (node.sequence_len() != 1 || node.input().is_type<lstm>())
+                return false;
+
+            for (auto& user : node.get_users())
+            {
+                if (user->is_type<lstm>())
+                    return false;
+            }
+
+            auto input_layout = node.input().get_output_layout();
+            if (input_layout.format != format::bfyx ||
+                (input_layout.data_type != data_types::f32 && input_layout.data_type != data_types::f16))
+                return false;
+
+            auto hidden_size = static_cast<size_t>(node.recurrent().get_output_layout().size.spatial[0]);
+            return hidden_size <= kernel_selector::LSTMSeqKernelBase::max_hidden_size;
+        }
+    }
+
     void graph_initializations::handle_lstm(program_impl& p)
     {
         bool has_lstm_children;
@@ -358,6 +383,9 @@ namespace cldnn
             has_lstm_children = false;
             // replace lstm node with lstm_gemm and lstm_elt nodes
             if (node->is_type<lstm>()) {
+                if (can_execute_as_sequence(node->as<lstm>()))
+                    continue;
+
                 bool initial_hidden_term = node->as<lstm>().initial_hidden_term();
                 bool initial_cell_term = node->as<lstm>().initial_cell_term();
                 bool bias_term = node->as<lstm>().bias_term();
@@ -0,0 +1,50 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "input_layout_inst.h"
+
+#include <algorithm>
+
+/*
+With dynamic batch the network may execute with a batch smaller than the batch of its inputs. This pass marks the nodes
+whose output carries that batch: inputs of the maximal batch, and nodes computed from a marked node which keep its batch.
+Kernels of marked nodes get the runtime batch, and the network returns their outputs trimmed to the valid batches.
+*/
+
+using namespace cldnn;
+
+void mark_dynamic_batch_nodes::run(program_impl& p)
+{
+    int32_t max_batch = 0;
+    for (auto input : p.get_inputs())
+    {
+        if (input->is_type<input_layout>())
+            max_batch = std::max(max_batch, input->get_output_layout().size.batch[0]);
+    }
+
+    for (auto node : p.get_processing_order())
+    {
+        if (node->get_output_layout().size.batch[0] != max_batch || node->is_constant())
+            continue;
+
+        const auto& deps = node->get_dependencies();
+        node->set_dynamic_batch(node->is_type<input_layout>() ||
+                                std::any_of(deps.begin(), deps.end(), [](const program_node* dep) { return dep->has_dynamic_batch(); }));
+    }
+}
@@ -61,8 +61,11 @@ void post_input_reorder::run(program_impl& p)
         // add a reorder if primitive's input format doesn't match implementation's input format
         if (node->is_type<fully_connected>())
         {
-            const auto& fc_impl = dynamic_cast<gpu::typed_primitive_gpu_impl<fully_connected>&>(*impl);
-            const auto& fc_params = *static_cast<kernel_selector::fully_connected_params*>(fc_impl._kernel_data.params.get());
+            // host implementations read any input format
+            const auto fc_impl = dynamic_cast<gpu::typed_primitive_gpu_impl<fully_connected>*>(impl.get());
+            if (fc_impl == nullptr)
+                continue;
+            const auto& fc_params = *static_cast<kernel_selector::fully_connected_params*>(fc_impl->_kernel_data.params.get());
 
             auto layout_format = from_data_layout(fc_params.inputs[0].GetLayout());
             auto& input = node->get_dependencies()[0];
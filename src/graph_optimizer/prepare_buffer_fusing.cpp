@@ -30,9 +30,123 @@
 #include "pass_manager.h"
 #include "program_helpers.h"
 
+#include <string>
+#include <vector>
+
 
 using namespace cldnn;
 
+//In-place concatenation: every input writes its output directly into the buffer of the concatenation, the input's
+//output padding describes where in the buffer its data lands. Nested in-place concatenations are placed as a whole
+//together with their inputs. Crops are zero-copy views of their input buffer described the same way.
+//
+//Correctness rules:
+//- a buffer can be placed in one concatenation only,
+//- a node whose output is a view of another buffer (optimized reshape, crop, ...) cannot be moved into
+//  a concatenation, and a node cannot be moved once such a view of it was created (this includes inputs of
+//  nested concatenations, which are moved with them),
+//- inputs which do not follow the rules above (or cannot write padded output) get a copy which writes into
+//  the concatenation buffer instead.
+//Memory pool restrictions of nodes written in place are also applied to the concatenation owning the buffer
+//(see add_memory_dependency() in program.cpp).
+namespace {
+    //length of an input along the concatenation axis in units of output padding
+    tensor::value_type get_length_in_buffer(const layout& l, concatenation::concatenation_axis axis)
+    {
+        auto length = l.size.raw[axis];
+        if (l.format == format::bfyx_f16 && axis == concatenation::along_f)
+            length /= 16;
+        return length;
+    }
+
+    bool is_in_place_concat_supported(concatenation_node& node)
+    {
+        if (node.get_output_layout().format != format::bfyx_f16)
+            return true;
+
+        //blocked format: inputs have to start at a block boundary
+        if (node.get_primitive()->axis != concatenation::along_f)
+            return false;
+        for (auto input : node.get_dependencies())
+        {
+            if (input->get_output_layout().size.feature[0] % 16 != 0)
+                return false;
+        }
+        return true;
+    }
+
+    //inputs of a nested in-place concatenation are moved with it, which is not possible once a view (optimized
+    //crop, reshape, ...) of any of them was created, since offsets of the view would not follow
+    bool has_views_of_nested_inputs(program_node& node)
+    {
+        if (!node.is_type<concatenation>() || !node.can_be_optimized())
+            return false;
+
+        for (auto dep : node.get_dependencies())
+        {
+            for (auto user : dep->get_users())
+            {
+                if (user != &node && user->can_be_optimized())
+                    return true;
+            }
+            if (has_views_of_nested_inputs(*dep))
+                return true;
+        }
+        return false;
+    }
+
+    bool can_write_in_place(program_node& input, concatenation_node& concat, bool is_debug)
+    {
+        //if an input is marked as network output, prevent optimizations which would affect a form of its output (unless debug flag is set)
+        if (!input.support_padding() || (input.is_output() && !is_debug))
+            return false;
+
+        //buffer of an optimized node is a view of another buffer, only nested concatenations can be moved
+        if (input.can_be_optimized() && !input.is_type<concatenation>())
+            return false;
+        if (has_views_of_nested_inputs(input))
+            return false;
+
+        auto input_layout = input.get_output_layout();
+        auto output_layout = concat.get_output_layout();
+        if (input_layout.format != output_layout.format || input_layout.data_type != output_layout.data_type)
+            return false;
+
+        //other users read the input from the concatenation buffer, but they cannot be views of it
+        size_t concat_users = 0;
+        for (auto user : input.get_users())
+        {
+            if (user->is_type<concatenation>())
+                concat_users++;
+            else if (user->can_be_optimized())
+                return false;
+        }
+        return concat_users == 1 && input.get_users().size() <= 2;
+    }
+
+    //sets padding which places input in the concatenation buffer, inputs of nested concatenations are moved with it
+    void place_in_buffer(program_node& input, const padding& padd)
+    {
+        input.set_output_padding(padd);
+        if (!input.is_type<concatenation>() || !input.can_be_optimized())
+            return;
+
+        auto axis = input.as<concatenation>().get_primitive()->axis;
+        auto total_length = get_length_in_buffer(input.get_output_layout(), axis);
+        tensor::value_type offset = 0;
+        for (auto dep : input.get_dependencies())
+        {
+            auto length = get_length_in_buffer(dep->get_output_layout(), axis);
+            auto lower_padd = padd.lower_size();
+            auto upper_padd = padd.upper_size();
+            lower_padd.raw[axis] += offset;
+            upper_padd.raw[axis] += total_length - offset - length;
+            place_in_buffer(*dep, padding(lower_padd.sizes(), upper_padd.sizes()));
+            offset += length;
+        }
+    }
+}
+
 //ToDo remove friendship relation from  program_node 
 
 void prepare_buffer_fusing::run(program_impl& p)
@@ -49,6 +163,31 @@ void prepare_buffer_fusing::run(program_impl& p)
 
         program_helpers::do_for_types<concatenation>(*node, [&p, is_debug](concatenation_node& node)
         {
+            if (!is_in_place_concat_supported(node))
+                return;
+
+            //inputs which cannot write directly into the concatenation buffer get a copy which can,
+            //it costs the same as copying them by the concatenation itself
+            std::vector<size_t> copied_inputs;
+            for (size_t i = 0; i < node.get_dependencies().size(); i++)
+            {
+                if (!can_write_in_place(node.get_dependency(i), node, is_debug))
+                    copied_inputs.push_back(i);
+            }
+            if (copied_inputs.size() == node.get_dependencies().size())
+                return;
+
+            auto output_layout = node.get_output_layout();
+            for (auto i : copied_inputs)
+            {
+                auto& input = node.get_dependency(i);
+                auto copy_prim = std::make_shared<reorder>("_in_place_copy_" + node.id() + "_" + std::to_string(i), input.id(), output_layout.format, output_layout.data_type);
+                auto& copy = p.get_or_create(copy_prim);
+                p.add_intermediate(copy, node, i);
+                copy.get_output_layout(false);
+                copy.support_padding(true); //reorder writes padded outputs
+            }
+
             // we need to avoid mixing padded and unpadded buffer 
             bool all_dependencies_padded = true;
             bool all_dependencies_unpadded = true;
@@ -61,92 +200,30 @@ void prepare_buffer_fusing::run(program_impl& p)
             }
 
             auto concat_axis = node.get_primitive()->axis;
-            auto padd = node.get_output_layout().data_padding;
+            auto padd = output_layout.data_padding;
 
             tensor lower_padd = padd.lower_size();
             tensor upper_padd = padd.upper_size();
+            upper_padd.raw[concat_axis] = output_layout.get_buffer_size().raw[concat_axis] - lower_padd.raw[concat_axis];
 
-            auto upper_padd_val = node.get_output_layout().get_buffer_size().raw[concat_axis] - lower_padd.raw[concat_axis];
-            tensor lower_padd_offset = lower_padd;
-
-            std::list<std::pair<const std::vector<program_node*>, tensor>> stack = { std::make_pair(node.get_dependencies(), tensor{ 0, 0, 0, 0 }) };
-            while (!stack.empty())
+            for (auto input : node.get_dependencies())
             {
-                auto nodes_list = stack.front();
-                stack.pop_front();
-
-                auto cascade_adjustment = nodes_list.second;
-                upper_padd.raw[concat_axis] = upper_padd_val;
-                lower_padd = lower_padd_offset;
-
-                auto first_input_format = nodes_list.first[0]->get_output_layout().format;
-
-                //check if concatenation in place can be applied for inputs set
-                for (auto input : nodes_list.first)
-                {
-                    //if any of this node's inputs is used by more than one primitive and is not optimized concatenation then do not fuse buffers,
-                    //also, if an input is marked as network output, prevent optimizations which would affect a form of its output (unless debug flag is set)
-                    // todo: in future, if this case is problem, it can be optimized further to enable buffer fusing
-                    //       per single input rather than all/none
-                    // + restrict input types to those which support padding on x,y,b and f
-                    if (!input->support_padding() ||
-                       (input->is_output() && !is_debug) ||
-                        input->get_users().size() > 2)
-                        return;
-
-                    if (input->get_users().size() > 1)
-                    {
-                        auto user_count = input->get_users().size();
-                        for (auto& user : input->get_users())
-                            if (user->is_type<concatenation>())
-                                user_count--;
-                        if (user_count != 1) // user_cout == 0 means that input will be used only by concatenations, so we cannot apply concat in place for it
-                            return;
-                    }
-
-                    //check if all inputs have the same format
-                    if (input->get_output_layout().format != first_input_format)
-                        return;
-                }
-
-                //apply concatenation in place optimization
-                for (auto input : nodes_list.first)
-                {
-                    auto input_lenght = input->get_output_layout().size.raw[concat_axis];
-
-                    if (node.get_output_layout().format == format::bfyx_f16)
-                        input_lenght /= 16;
-                    // shrink upper pad so it points at the end of the input's buffer
-                    //
-                    //   |--- lower padd ---|                    |---------- upper padd -----------|
-                    //   |-- output padd ---| ----- input1 ------|----- input2 -----|-- out padd --|
-                    upper_padd.raw[concat_axis] -= input_lenght;
-
-                    //adjust padding sizes for cascade concatenations
-                    auto lower_padd_tmp = lower_padd;
-                    lower_padd_tmp.raw[concat_axis] += cascade_adjustment.raw[concat_axis];
-                    auto upper_padd_tmp = upper_padd;
-                    upper_padd_tmp.raw[concat_axis] -= cascade_adjustment.raw[concat_axis];
-
-                    // set new padding for input
-                    input->set_output_padding(padding(lower_padd_tmp.sizes(), upper_padd_tmp.sizes()));
-
-                    // move lower padd further
-                    //
-                    //   |-------------- lower padd -------------|---------- upper padd -----------|
-                    //   |-- output padd ---| ----- input1 ------|----- input2 -----|-- out padd --|
-
-                    lower_padd.raw[concat_axis] += input_lenght;
-
-                    if (input->type() == concatenation::type_id() && input->can_be_optimized())
-                    {
-                        if (input->as<concatenation>().get_primitive()->axis != node.get_primitive()->axis)
-                            return;
-
-                        if (!input->get_dependencies().empty())
-                            stack.push_back(std::make_pair(input->get_dependencies(), input->get_output_layout().data_padding.lower_size()));
-                    }
-                }
+                auto input_length = get_length_in_buffer(input->get_output_layout(), concat_axis);
+
+                // shrink upper pad so it points at the end of the input's buffer
+                //
+                //   |--- lower padd ---|                    |---------- upper padd -----------|
+                //   |-- output padd ---| ----- input1 ------|----- input2 -----|-- out padd --|
+                upper_padd.raw[concat_axis] -= input_length;
+
+                // set new padding for input (and inputs of nested concatenations)
+                place_in_buffer(*input, padding(lower_padd.sizes(), upper_padd.sizes()));
+
+                // move lower padd further
+                //
+                //   |-------------- lower padd -------------|---------- upper padd -----------|
+                //   |-- output padd ---| ----- input1 ------|----- input2 -----|-- out padd --|
+                lower_padd.raw[concat_axis] += input_length;
             }
 
             node.can_be_optimized(true);
@@ -172,34 +249,21 @@ void prepare_buffer_fusing::run(program_impl& p)
             if (node.get_dependencies().size() == 1 &&
                 node.get_users().size() > 0)
             {
-                // optimization is available for cropping across depth(features) only
-                // if output padding has defined padding across features already it wouldn't
-                // work because it expect to have zeros in the padded area.
+                // in-place crop is a view of its input buffer, so the output of crop cannot have padding of its own
+                // (the padded area belongs to the input). Any axis can be cropped for plain formats.
                 const auto& crop_layout = node.get_output_layout();
-                auto format = crop_layout.format;
-                auto crop_prim = node.get_primitive();
                 auto input_layout = node.get_dependency(0).get_output_layout();
-                const auto& crop_size = crop_layout.size;
-                const auto& out_padd = crop_layout.data_padding;
-                if (format == format::bfyx &&
-                    crop_size.batch[0] == input_layout.size.batch[0] &&
-                    crop_size.spatial[0] == input_layout.size.spatial[0] &&
-                    crop_size.spatial[1] == input_layout.size.spatial[1] &&
-                    out_padd.lower_size().feature[0] == 0 &&
-                    out_padd.upper_size().feature[0] == 0 &&
-                    out_padd.lower_size().batch[0] == 0 &&
-                    out_padd.upper_size().batch[0] == 0 &&
-                    out_padd.lower_size().spatial[0] == 0 &&
-                    out_padd.lower_size().spatial[1] == 0 &&
-                    out_padd.upper_size().spatial[0] == 0 &&
-                    out_padd.upper_size().spatial[1] == 0)
+                auto format = crop_layout.format;
+                if ((format == format::bfyx || format == format::yxfb || format == format::byxf) &&
+                    input_layout.format == format &&
+                    !crop_layout.data_padding)
                 {
                     //  Regular crop
                     //  crop input buffer
                     //  |___________data____________|
                     //
                     //  crop output buffer
-                    //  |-------->| offsets[f]  |<--|
+                    //  |-------->| offsets     |<--|
                     //            |_____data____|
                     //             <------------>
                     //           reference size
@@ -207,11 +271,13 @@ void prepare_buffer_fusing::run(program_impl& p)
                     //  In-place crop
                     //  crop output buffer
                     //  |_low_pad_|__data_size__|___|<-upper pad
+                    //
+                    //  padding of the input buffer is added on both sides
+                    const auto& offsets = node.get_primitive()->offsets;
+                    auto lower_padd = input_layout.data_padding.lower_size().add(offsets);
+                    auto upper_padd = input_layout.data_padding.upper_size().add(input_layout.size.sub(offsets).sub(crop_layout.size));
 
-                    node.set_output_padding(padding(
-                    { out_padd.lower_size().batch[0], crop_prim->offsets.feature[0], out_padd.lower_size().spatial[0], out_padd.lower_size().spatial[1] },
-                    { out_padd.upper_size().batch[0], input_layout.size.feature[0] - crop_prim->offsets.feature[0] - crop_size.feature[0],
-                        out_padd.upper_size().spatial[0], out_padd.upper_size().spatial[1] }));
+                    node.set_output_padding(padding(lower_padd.sizes(), upper_padd.sizes()));
                     node.can_be_optimized(true);
                 }
             }
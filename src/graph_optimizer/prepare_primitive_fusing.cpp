@@ -27,8 +27,11 @@
 #include "batch_norm_inst.h"
 #include "batch_norm_grad_inst.h"
 #include "broadcast_inst.h"
+#include "convolution_inst.h"
 #include "crop_inst.h"
+#include "data_inst.h"
 #include "eltwise_inst.h"
+#include "fully_connected_inst.h"
 #include "fused_conv_bn_scale_inst.h"
 #include "fused_conv_eltwise_inst.h"
 #include "lrn_inst.h"
@@ -69,11 +72,258 @@ void prepare_primitive_fusing::fuse_skip_layers(program_impl& p, program_node* n
         if (node.get_fused_activation_func() != activation_none)
             to_fuse_with.set_fused_activation(node.get_fused_activation_func(), node.get_fused_activation_params());
         to_fuse_with.set_output_padding(node.get_output_layout().data_padding);
+        to_fuse_with.add_merged_ids(node);
 
         p.extract_and_remove(node);
     });
 }
 
+namespace
+{
+    // Rough costs of GPU kernels, in multiply-adds of an optimized kernel. Only the reference convolution and fully
+    // connected kernels apply fused primitives, and they run several times slower than the optimized ones, while
+    // a separate kernel of a fused primitive reads and writes the whole output once more.
+    const float reference_kernel_slowdown = 8.0f;
+    const float element_access_cost = 16.0f;
+    const float kernel_launch_cost = 100000.0f;
+
+    bool is_planar_format(format fmt)
+    {
+        return fmt == format::bfyx || fmt == format::byxf || fmt == format::yxfb || fmt == format::fyxb;
+    }
+
+    // primitives whose kernels apply fused_primitive_desc chains (FUSED_OPS jit), host implementations apply them too
+    bool supports_fused_primitives(program_node& node, bool gpu_engine)
+    {
+        auto out_layout = node.get_output_layout();
+        if ((out_layout.data_type != data_types::f32 && out_layout.data_type != data_types::f16) ||
+            out_layout.format == format::bfzyx)
+            return false;
+
+        // blocked formats are handled by optimized kernels only
+        if (gpu_engine && (!is_planar_format(out_layout.format) ||
+            (node.is_type<convolution>() && out_layout.format == format::fyxb)))
+            return false;
+
+        if (node.is_type<eltwise>())
+            return true;
+
+        // reference convolution kernel, only for convolutions which do not split the output features
+        if (node.is_type<convolution>())
+        {
+            auto& conv = node.as<convolution>();
+            return conv.get_split() == 1 && conv.get_groups() == 1 && !conv.get_transposed() &&
+                   !conv.weights_quantization_term() && !conv.output_calibration_term() &&
+                   conv.input().get_output_layout().data_type == out_layout.data_type;
+        }
+
+        // reference fully connected kernel
+        if (node.is_type<fully_connected>())
+        {
+            auto& fc = node.as<fully_connected>();
+            return !fc.weights_quantization_term() &&
+                   fc.input().get_output_layout().data_type == out_layout.data_type;
+        }
+
+        return false;
+    }
+
+    // multiply-adds computed for each output element of the producer
+    float get_macs_per_output(program_node& node)
+    {
+        if (node.is_type<convolution>())
+        {
+            auto& conv = node.as<convolution>();
+            auto weights = conv.weights().get_output_layout().size;
+            return static_cast<float>(conv.input().get_output_layout().size.feature[0]) *
+                   weights.spatial[0] * weights.spatial[1] * weights.spatial[2];
+        }
+
+        if (node.is_type<fully_connected>())
+        {
+            auto input = node.as<fully_connected>().input().get_output_layout().size;
+            return static_cast<float>(input.count() / input.batch[0]);
+        }
+
+        return 0.0f;
+    }
+
+    // true if the producer running fused_count more fused primitives is cheaper than the separate kernels
+    bool fusing_is_cheaper(program_node& producer, size_t constants_count, bool gpu_engine)
+    {
+        // host implementations and eltwise kernels apply fused primitives without slowing down, and a producer which
+        // has fused primitives already runs the reference kernel
+        if (!gpu_engine || producer.is_type<eltwise>() || producer.has_fused_primitives())
+            return true;
+
+        auto outputs = static_cast<float>(producer.get_output_layout().count());
+        auto slowdown = outputs * get_macs_per_output(producer) * (reference_kernel_slowdown - 1.0f);
+        auto separate_kernel = kernel_launch_cost + outputs * (2 + constants_count) * element_access_cost;
+        return slowdown < separate_kernel;
+    }
+
+    // constant operand which can be read by the producer's kernel, broadcast over its output
+    bool is_fusable_constant(program_node& node, layout const& out_layout)
+    {
+        if (!node.is_type<data>())
+            return false;
+
+        auto l = node.get_output_layout();
+        if (l.data_type != out_layout.data_type || l.data_padding ||
+            (l.format != format::bfyx && l.format != format::byxf && l.format != format::yxfb && l.format != format::fyxb))
+            return false;
+
+        auto sizes = l.size.sizes(format::bfyx);
+        auto out_sizes = out_layout.size.sizes(format::bfyx);
+        for (size_t i = 0; i < sizes.size(); i++)
+        {
+            if (sizes[i] != 1 && sizes[i] != out_sizes[i])
+                return false;
+        }
+        return true;
+    }
+
+    memory_impl::ptr get_constant_memory(program_impl& p, program_node& node)
+    {
+        auto& mem = node.as<data>().get_attached_memory();
+        if (mem.is_allocated_by(p.get_engine()))
+            return &mem;
+
+        memory_impl::ptr result = p.get_engine().allocate_memory(mem.get_layout());
+        mem_lock<char> src(mem);
+        mem_lock<char> dst(result);
+        std::copy(src.begin(), src.end(), dst.begin());
+        return result;
+    }
+
+    fused_primitive_desc make_fused_activation(primitive_id const& id, cldnn_activation_func func, cldnn_activation_additional_params params)
+    {
+        fused_primitive_desc desc;
+        desc.id = id;
+        desc.type = fused_primitive_desc::op_type::activation;
+        desc.activation_func = func;
+        desc.activation_params = params;
+        return desc;
+    }
+}
+
+void prepare_post_ops_fusing::fuse_into_producer(program_impl& p, program_node* node)
+{
+    if (!node->is_type<activation>() && !node->is_type<scale>() && !node->is_type<eltwise>())
+        return;
+
+    bool is_debug = p.get_options().get<build_option_type::debug>()->enabled();
+    if (node->is_output() || node->has_padded_dependency())
+        return;
+
+    // find the producer (the only non-constant input) and constant operands, eltwise may take the constant as its first input
+    auto out_layout = node->get_output_layout();
+    program_node* producer = nullptr;
+    std::vector<program_node*> constants;
+    for (size_t i = 0; i < node->get_dependencies().size(); i++)
+    {
+        auto& dep = node->get_dependency(i);
+        if ((i > 0 || node->is_type<eltwise>()) && is_fusable_constant(dep, out_layout))
+            constants.push_back(&dep);
+        else if (producer == nullptr)
+            producer = &dep;
+        else
+            return;
+    }
+
+    const bool gpu_engine = p.get_engine().type() == engine_types::ocl;
+    if (producer == nullptr || (producer->is_output() && !is_debug) || producer->get_users().size() != 1 ||
+        producer->can_be_optimized() || !supports_fused_primitives(*producer, gpu_engine))
+        return;
+
+    // fused ops cannot change the producer's result shape or type
+    auto producer_layout = producer->get_output_layout();
+    if (producer_layout.size != out_layout.size || producer_layout.data_type != out_layout.data_type)
+        return;
+
+    fused_primitive_desc desc;
+    desc.id = node->id();
+    std::vector<fused_primitive_desc> descs;
+
+    if (node->is_type<activation>())
+    {
+        // activations with additional params as input are not supported
+        if (!constants.empty() || node->get_dependencies().size() != 1)
+            return;
+
+        // the first activation goes through the regular fused activation, which is applied before fused ops
+        auto prim = node->as<activation>().get_primitive();
+        if (producer->get_fused_activation_func() == activation_none && !producer->has_fused_primitives())
+        {
+            producer->set_fused_activation(prim->activation_func, prim->additional_params);
+        }
+        else
+        {
+            descs.push_back(make_fused_activation(node->id(), prim->activation_func, prim->additional_params));
+        }
+    }
+    else if (node->is_type<scale>())
+    {
+        if (constants.size() != node->get_dependencies().size() - 1)
+            return;
+
+        desc.type = fused_primitive_desc::op_type::scale;
+        descs.push_back(desc);
+    }
+    else
+    {
+        auto prim = node->as<eltwise>().get_primitive();
+        if (node->as<eltwise>().inputs_count() != 2 || node->as<eltwise>().output_calibration_term() ||
+            constants.size() != 1 || !prim->stride.empty() || !prim->coefficients.empty())
+            return;
+
+        // non-commutative modes are fused only when the constant is the second operand
+        bool commutative = prim->mode == eltwise_mode::sum || prim->mode == eltwise_mode::prod ||
+                           prim->mode == eltwise_mode::max || prim->mode == eltwise_mode::min;
+        bool constant_second = constants[0] == &node->get_dependency(1);
+        if (!(commutative || ((prim->mode == eltwise_mode::sub || prim->mode == eltwise_mode::div) && constant_second)))
+            return;
+
+        desc.type = fused_primitive_desc::op_type::eltwise;
+        desc.mode = prim->mode;
+        descs.push_back(desc);
+
+        if (prim->with_activation)
+        {
+            if (prim->activation_negative_slope != 0.0f)
+                descs.push_back(make_fused_activation(node->id(), activation_relu_negative_slope, { prim->activation_negative_slope, 0.0f }));
+            else
+                descs.push_back(make_fused_activation(node->id(), activation_relu, { 0.0f, 0.0f }));
+        }
+    }
+
+    // a regular fused activation keeps the optimized kernel, fused primitives switch it to the reference one
+    if (!descs.empty() && !fusing_is_cheaper(*producer, constants.size(), gpu_engine))
+        return;
+
+    if (!descs.empty() && descs.front().type != fused_primitive_desc::op_type::activation)
+    {
+        for (auto c : constants)
+            descs.front().inputs.push_back(get_constant_memory(p, *c));
+    }
+
+    if (node->get_fused_activation_func() != activation_none)
+        descs.push_back(make_fused_activation(node->id(), node->get_fused_activation_func(), node->get_fused_activation_params()));
+
+    for (auto& d : descs)
+        producer->add_fused_primitive(d);
+    producer->set_output_padding(node->get_output_layout().data_padding);
+    producer->add_merged_ids(*node);
+
+    for (auto c : constants)
+    {
+        p.remove_connection(*c, *node);
+        p.remove_if_dangling(*c);
+    }
+
+    p.extract_and_remove(*node);
+}
+
 template<typename T>
 static bool node_is_type(program_node* n)
 {
@@ -182,8 +432,10 @@ void prepare_conv_eltw_fusing::fuse_conv_eltwise(program_impl& p, program_node*
 {
     // make sure this convolution have only 1 user and it's eltwise
     // make sure convolution is not an output
+    // make sure convolution has no fused post-ops, fused_conv_eltwise does not apply them
     if (node->get_users().size() != 1 ||
-        node->is_output())
+        node->is_output() ||
+        node->has_fused_primitives())
         return;
 
     if (!(*(node->get_users().begin()))->is_type<eltwise>())
@@ -298,6 +550,8 @@ void prepare_conv_eltw_fusing::fuse_conv_eltwise(program_impl& p, program_node*
         );
 
     auto& new_node = p.get_or_create(fused_conv_eltw);
+    new_node.add_merged_ids(*conv_node);
+    new_node.add_merged_ids(*eltw_node);
 
     p.replace(*conv_node, new_node);
 
@@ -427,6 +681,7 @@ void prepare_primitive_fusing::run(program_impl& p)
 
             input.set_fused_activation(node.get_primitive()->activation_func, node.get_primitive()->additional_params);
             input.set_output_padding(node.get_output_layout().data_padding);
+            input.add_merged_ids(node);
 
             p.extract_and_remove(node);
         });
@@ -443,6 +698,16 @@ void prepare_primitive_fusing::run(program_impl& p)
     }
 }
 
+void prepare_post_ops_fusing::run(program_impl& p)
+{
+    auto itr = p.get_processing_order().begin(); //note we need to use iterators since currently processed element can be removed
+    while (itr != p.get_processing_order().end())
+    {
+        auto node_itr = itr++;
+        fuse_into_producer(p, *node_itr);
+    }
+}
+
 void prepare_conv_eltw_fusing::run(program_impl& p)
 {
     std::list<program_node*> conv_nodes;
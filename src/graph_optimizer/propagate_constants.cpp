@@ -21,7 +21,9 @@
 #include "engine_impl.h"
 #include "program_impl.h"
 #include "network_impl.h"
+#include "build_profiler.h"
 #include "data_inst.h"
+#include "host_constant_evaluator.h"
 #include "../gpu/memory_gpu.h"
 
 using namespace cldnn;
@@ -29,13 +31,15 @@ using namespace cldnn;
 //ToDo remove friendship relation from  program_node and program_impl
 void propagate_constants::run(program_impl& p)
 {
+    fold_on_host(p);
+
     for (auto& node : p.get_processing_order())
     {
         if (node->is_constant())
             handle_constant(p, *node);
     }
 
-    auto&& to_replace = calculate(p.get_engine());
+    auto&& to_replace = calculate(p);
 
     //remove all nodes which are no longer relevant, i.e. nodes which:
     // 1. are constants, and
@@ -135,6 +139,44 @@ void propagate_constants::run(program_impl& p)
     }
 }
 
+//computes constants, which depend only on data and which host evaluator supports, directly on the host and replaces them
+//with cldnn::data. Constant users of replaced nodes are visited later in processing order, so whole chains of supported
+//primitives are folded this way. Everything else is computed by the internal network in calculate().
+void propagate_constants::fold_on_host(program_impl& p)
+{
+    auto itr = p.get_processing_order().begin();
+    while (itr != p.get_processing_order().end())
+    {
+        auto& node = *(*itr++);
+        if (!node.is_constant() || node.is_type<data>() || node.get_dependencies().empty())
+            continue;
+
+        std::vector<memory_impl::ptr> inputs;
+        for (auto dep : node.get_dependencies())
+        {
+            if (!dep->is_type<data>())
+                break;
+            inputs.push_back(&dep->as<data>().get_attached_memory());
+        }
+        if (inputs.size() != node.get_dependencies().size())
+            continue;
+
+        auto mem_impl = evaluate_constant_on_host(p.get_engine(), node, inputs);
+        if (!mem_impl)
+            continue;
+
+        memory api_memory = details::memory_c_to_cpp_converter::convert(api_cast(mem_impl.get()));
+        mem_impl->add_ref();
+        auto const_data = std::make_shared<data>("_cldnn_const_prop_" + node.id(), api_memory);
+        auto& new_node = p.get_or_create(const_data);
+
+        auto deps = node.get_dependencies();
+        for (auto dep : deps)
+            p.remove_connection(*dep, node);
+        p.replace(node, new_node);
+    }
+}
+
 bool propagate_constants::has_non_const_user(program_node& node) const {
     if (!node.is_constant()) return true;
     for (auto &user : node.get_users())
@@ -144,7 +186,7 @@ bool propagate_constants::has_non_const_user(program_node& node) const {
     return false;
 }
 
-std::list<std::pair<primitive_id, memory_impl::ptr>> propagate_constants::calculate(engine_impl &engine)
+std::list<std::pair<primitive_id, memory_impl::ptr>> propagate_constants::calculate(program_impl& p)
 {
     if (!has_non_trivial_constants)
         return{};
@@ -152,7 +194,11 @@ std::list<std::pair<primitive_id, memory_impl::ptr>> propagate_constants::calcul
     build_options bo;
     bo.set_option(build_option::optimize_data(false));
     bo.set_option(build_option::outputs(const_outputs));
-    network_impl::ptr net = engine.build_network(nodes, bo, true);
+    bo.set_option(build_option::build_profiling(p.get_build_profiler() != nullptr));
+    network_impl::ptr net = p.get_engine().build_network(nodes, bo, true);
+    // kernels cache is shared, so the internal program compiles also kernels selected for the outer one
+    if (p.get_build_profiler())
+        p.get_build_profiler()->add_entries_of(*net->get_program().get_build_profiler(), { "kernels_source", "kernels_program", "kernels_build" });
     for (auto& cin : const_inputs)
         net->set_input_data(cin->id(), cin->get_attached_memory());
 
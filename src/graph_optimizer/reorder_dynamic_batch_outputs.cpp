@@ -0,0 +1,73 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "input_layout_inst.h"
+#include "data_inst.h"
+#include "mutable_data_inst.h"
+#include "reorder_inst.h"
+
+#include <algorithm>
+
+/*
+With dynamic batch the network returns outputs as views of their valid batches, which are the beginning of the buffer
+only when the batch is the outermost dimension and is not padded. This pass reorders the other outputs which carry
+the batch of the network inputs (e.g. yxfb output of fully connected) to such format. The reorder takes over the id
+of the output, the original node is renamed.
+*/
+
+using namespace cldnn;
+
+void reorder_dynamic_batch_outputs::run(program_impl& p)
+{
+    int32_t max_batch = 0;
+    for (auto input : p.get_inputs())
+    {
+        if (input->is_type<input_layout>())
+            max_batch = std::max(max_batch, input->get_output_layout().size.batch[0]);
+    }
+
+    const auto outputs = p.get_outputs();
+    for (auto node : outputs)
+    {
+        if (node->is_type<input_layout>() || node->is_type<data>() || node->is_type<mutable_data>())
+            continue;
+
+        auto output_layout = node->get_output_layout();
+        if (output_layout.size.batch[0] != max_batch ||
+            (input_layout_inst::is_batch_outermost(output_layout.format) &&
+             output_layout.data_padding.lower_size().batch[0] == 0))
+        {
+            continue;
+        }
+
+        const auto output_id = node->id();
+        node->set_output(false);
+        p.outputs.erase(std::remove(p.outputs.begin(), p.outputs.end(), node), p.outputs.end());
+        p.rename(*node, output_id + "_dynamic_batch");
+
+        const auto format = output_layout.format.dimension() == 5 ? format::bfzyx : format::bfyx;
+        auto& reorder_node = p.get_or_create(std::make_shared<reorder>(output_id, node->id(),
+                                                                       layout(output_layout.data_type, format, output_layout.size)));
+        p.add_connection(*node, reorder_node);
+        p.get_processing_order().insert(std::next(p.get_processing_order().get_processing_iterator(*node)), &reorder_node);
+        reorder_node.set_output(true);
+        p.outputs.push_back(&reorder_node);
+        reorder_node.get_output_layout();
+    }
+}
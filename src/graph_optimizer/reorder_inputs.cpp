@@ -100,6 +100,8 @@ void reorder_inputs::run(program_impl& p, layout_optimizer& lo)
     // will be performed if at least half of layers can use bfyx_f16.
     if (can_use_f16 && opt_conv_layers_bfyx_f16 >= total_conv_layers / 2)
         lo.set_optimization_attribute(layout_optimizer::optimization_attributes_type::bfyx_f16_network, 1);
+
+    lo.select_convolution_input_formats(p);
     
     const auto reorder_input = [&p, &lo](typed_program_node<convolution>& conv_node)
     {
@@ -18,9 +18,22 @@
 #include "api_impl.h"
 #include <immintrin.h>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CLDNN_TARGET_F16C
+#define CLDNN_TARGET_AVX512F
+#define CLDNN_HALF_AVX512_SUPPORTED (_MSC_VER >= 1911)
+#else
+#include <cpuid.h>
+#define CLDNN_TARGET_F16C __attribute__((target("avx,f16c")))
+#define CLDNN_TARGET_AVX512F __attribute__((target("avx512f")))
+#define CLDNN_HALF_AVX512_SUPPORTED 1
+#endif
 
 namespace cldnn {
-    float half_to_float(uint16_t value)
+namespace {
+    // Converts four fp16 values held in the low 16 bits of each 32-bit lane of 'a'.
+    __m128 half_to_float_sse41(__m128i a)
     {
         static const uint32_t FLOAT16_EXP_SHIFT = (23 - 10);
         static const uint32_t FLOAT16_EXP_MASK = 0x7C00;
@@ -31,7 +44,6 @@ namespace cldnn {
         static const uint32_t FLOAT16_IMPLICIT_1 = (1 << 10);
         static const uint32_t FLOAT16_EXP_MIN = (1 << 10);
         static const uint32_t FLOAT16_SIGN_MASK = 0x8000;
-        __m128i a = _mm_unpacklo_epi16(_mm_set1_epi16(value), _mm_setzero_si128());
         __m128i exps = _mm_and_si128(_mm_set1_epi32(FLOAT16_EXP_MASK), a);          // Mask the exponents
         __m128i mantissa = _mm_and_si128(_mm_set1_epi32(FLOAT16_MANTISSA_MASK), a); // Mask the mantissa
         __m128i signs = _mm_and_si128(_mm_set1_epi32(FLOAT16_SIGN_MASK), a);
@@ -43,7 +55,6 @@ namespace cldnn {
 
         __m128i subnormals = _mm_cmpeq_epi32(exps, _mm_setzero_si128());
 
-        int out32;
         // e\m| 0 | 1
         // ------------
         //  0 | 0 | S
@@ -60,7 +71,7 @@ namespace cldnn {
             tmp = _mm_slli_epi32(tmp, FLOAT16_EXP_SHIFT);
             tmp = _mm_blendv_epi8(tmp, _mm_setzero_si128(), subnormals);    // The idea is of course to use blendv_ps, but epi8 will work the same and won't switch stack
             tmp = _mm_or_si128(tmp, nans);
-            out32 = _mm_extract_epi32(tmp, 0);
+            return _mm_castsi128_ps(tmp);
         }
         else
         {
@@ -72,13 +83,12 @@ namespace cldnn {
             __m128 tmp;
             tmp = _mm_mul_ps(_mm_castsi128_ps(exps), _mm_cvtepi32_ps(mantissa));
             tmp = _mm_or_ps(tmp, _mm_castsi128_ps(nans));
-            out32 = _mm_extract_ps(tmp, 0);
+            return tmp;
         }
-
-        float outf32 = *(float*)&out32;
-        return outf32;
     }
-    uint16_t float_to_half(float value)
+
+    // Converts four fp32 values; the results are packed into the low four 16-bit words.
+    __m128i float_to_half_sse41(__m128 Src)
     {
 #define TO_M128i(a) (*(__m128i*)&(a))
 #define TO_M128(a) (*(__m128*)&(a))
@@ -104,8 +114,6 @@ namespace cldnn {
 
         static const __m128 FVec4MaxFp16InWords = TO_M128(IVec4MaxFp16InWords);
 
-        __m128 Src = _mm_set1_ps(value);
-
         // Remove the sign bit from the source
         __m128 AbsSrc = _mm_andnot_ps(TO_M128(IVec4SignMask), Src);
 
@@ -145,9 +153,184 @@ namespace cldnn {
         // Pack the sign mask to 4 words
         __m128i iSignInWords = _mm_packs_epi32(iSignMask, iSignMask);
 
-        iPackedResult = _mm_or_si128(iPackedResult, iSignInWords);
-        return (uint16_t)_mm_extract_epi16(iPackedResult, 0);
+        return _mm_or_si128(iPackedResult, iSignInWords);
+
+#undef TO_M128i
+#undef TO_M128
+    }
+
+    void half_to_float_array_sse41(const uint16_t* src, float* dst, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i a = _mm_cvtepu16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + i)));
+            _mm_storeu_ps(dst + i, half_to_float_sse41(a));
+        }
+        for (; i < count; ++i)
+            dst[i] = half_to_float(src[i]);
+    }
+
+    void float_to_half_array_sse41(const float* src, uint16_t* dst, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), float_to_half_sse41(_mm_loadu_ps(src + i)));
+        for (; i < count; ++i)
+            dst[i] = float_to_half(src[i]);
+    }
+
+    // F16C and AVX-512 paths use hardware conversion. float -> half rounds towards zero, which matches
+    // the truncation (and clamping of overflows to the largest finite half) done by the SSE4.1 path;
+    // only subnormal results may differ by one ulp, as the SSE4.1 path rounds them through a float add.
+    CLDNN_TARGET_F16C
+    void half_to_float_array_f16c(const uint16_t* src, float* dst, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+        half_to_float_array_sse41(src + i, dst + i, count - i);
+    }
+
+    CLDNN_TARGET_F16C
+    void float_to_half_array_f16c(const float* src, uint16_t* dst, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_ZERO));
+        float_to_half_array_sse41(src + i, dst + i, count - i);
+    }
+
+#if CLDNN_HALF_AVX512_SUPPORTED
+    CLDNN_TARGET_AVX512F
+    void half_to_float_array_avx512f(const uint16_t* src, float* dst, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+            _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i))));
+        half_to_float_array_f16c(src + i, dst + i, count - i);
+    }
+
+    CLDNN_TARGET_AVX512F
+    void float_to_half_array_avx512f(const float* src, uint16_t* dst, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm512_cvtps_ph(_mm512_loadu_ps(src + i), _MM_FROUND_TO_ZERO));
+        float_to_half_array_f16c(src + i, dst + i, count - i);
+    }
+#endif
+
+    enum class half_conversion_isa
+    {
+        sse41,
+        f16c,
+        avx512f
+    };
+
+    void cpuid(uint32_t regs[4], uint32_t leaf)
+    {
+#if defined(_MSC_VER)
+        __cpuidex(reinterpret_cast<int*>(regs), static_cast<int>(leaf), 0);
+#else
+        __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+    }
+
+    uint64_t xgetbv0()
+    {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        uint32_t eax, edx;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+    }
+
+    half_conversion_isa detect_half_conversion_isa()
+    {
+        uint32_t regs[4];
+        cpuid(regs, 0);
+        const uint32_t max_leaf = regs[0];
+
+        cpuid(regs, 1);
+        const bool osxsave = (regs[2] & (1u << 27)) != 0;
+        const bool avx     = (regs[2] & (1u << 28)) != 0;
+        const bool f16c    = (regs[2] & (1u << 29)) != 0;
+        if (!osxsave || !avx || !f16c)
+            return half_conversion_isa::sse41;
+
+        // OS has to preserve at least XMM and YMM state.
+        const uint64_t xcr0 = xgetbv0();
+        if ((xcr0 & 0x6) != 0x6)
+            return half_conversion_isa::sse41;
+
+#if CLDNN_HALF_AVX512_SUPPORTED
+        if (max_leaf >= 7)
+        {
+            cpuid(regs, 7);
+            const bool avx512f = (regs[1] & (1u << 16)) != 0;
+            // opmask, upper ZMM and ZMM16-31 state.
+            if (avx512f && (xcr0 & 0xE6) == 0xE6)
+                return half_conversion_isa::avx512f;
+        }
+#else
+        (void)max_leaf;
+#endif
+        return half_conversion_isa::f16c;
+    }
+
+    half_conversion_isa get_half_conversion_isa()
+    {
+        static const half_conversion_isa isa = detect_half_conversion_isa();
+        return isa;
     }
 }
 
+    float half_to_float(uint16_t value)
+    {
+        return _mm_cvtss_f32(half_to_float_sse41(_mm_cvtsi32_si128(value)));
+    }
+
+    uint16_t float_to_half(float value)
+    {
+        return (uint16_t)_mm_extract_epi16(float_to_half_sse41(_mm_set1_ps(value)), 0);
+    }
 
+    void half_to_float(const uint16_t* src, float* dst, size_t count)
+    {
+        switch (get_half_conversion_isa())
+        {
+#if CLDNN_HALF_AVX512_SUPPORTED
+        case half_conversion_isa::avx512f:
+            half_to_float_array_avx512f(src, dst, count);
+            break;
+#endif
+        case half_conversion_isa::f16c:
+            half_to_float_array_f16c(src, dst, count);
+            break;
+        default:
+            half_to_float_array_sse41(src, dst, count);
+            break;
+        }
+    }
+
+    void float_to_half(const float* src, uint16_t* dst, size_t count)
+    {
+        switch (get_half_conversion_isa())
+        {
+#if CLDNN_HALF_AVX512_SUPPORTED
+        case half_conversion_isa::avx512f:
+            float_to_half_array_avx512f(src, dst, count);
+            break;
+#endif
+        case half_conversion_isa::f16c:
+            float_to_half_array_f16c(src, dst, count);
+            break;
+        default:
+            float_to_half_array_sse41(src, dst, count);
+            break;
+        }
+    }
+}
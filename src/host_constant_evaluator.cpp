@@ -0,0 +1,357 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "host_constant_evaluator.h"
+#include "layout_conversion.h"
+#include "program_node.h"
+
+#include "reorder_inst.h"
+#include "reshape_inst.h"
+#include "permute_inst.h"
+#include "concatenation_inst.h"
+#include "crop_inst.h"
+#include "eltwise_inst.h"
+#include "scale_inst.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+namespace cldnn
+{
+namespace
+{
+    // sizes in b, f, y, x order - which is the memory order of dense bfyx buffers used below
+    using dims_t = std::array<int32_t, 4>;
+
+    dims_t get_dims(const tensor& t)
+    {
+        return{ { t.batch[0], t.feature[0], t.spatial[1], t.spatial[0] } };
+    }
+
+    size_t count(const dims_t& dims)
+    {
+        return static_cast<size_t>(dims[0]) * dims[1] * dims[2] * dims[3];
+    }
+
+    bool is_supported(const layout& l)
+    {
+        return l.format.dimension() == 4 && is_host_convertible(l);
+    }
+
+    bool is_float(data_types dt)
+    {
+        return dt == data_types::f32 || dt == data_types::f16;
+    }
+
+    // copies memory into a dense buffer in 'fmt', converting data type if needed
+    std::vector<char> to_dense(memory_impl& mem, format fmt, data_types dt)
+    {
+        layout dense(dt, fmt, mem.get_layout().size);
+        std::vector<char> result(dense.bytes_count());
+        mem_lock<char> src(mem);
+        convert_layout(mem.get_layout(), src.data(), dense, result.data());
+        return result;
+    }
+
+    std::vector<float> to_dense_float(memory_impl& mem)
+    {
+        auto bytes = to_dense(mem, format::bfyx, data_types::f32);
+        std::vector<float> result(bytes.size() / sizeof(float));
+        std::memcpy(result.data(), bytes.data(), bytes.size());
+        return result;
+    }
+
+    memory_impl::ptr from_dense(engine_impl& engine, const layout& out_layout, format fmt, data_types dt, const void* data)
+    {
+        auto result = engine.allocate_memory(out_layout);
+        mem_lock<char> dst(result);
+        convert_layout(layout(dt, fmt, out_layout.size), data, out_layout, dst.data());
+        return result;
+    }
+
+    memory_impl::ptr evaluate_reorder(engine_impl& engine, reorder_node& node, memory_impl& input)
+    {
+        auto prim = node.get_primitive();
+        if (node.has_mean() || !prim->subtract_per_feature.empty() || node.get_input_offset() != tensor{ 0 })
+            return nullptr;
+
+        auto out_layout = node.get_output_layout();
+        auto result = engine.allocate_memory(out_layout);
+        mem_lock<char> src(input);
+        mem_lock<char> dst(result);
+        convert_layout(input.get_layout(), src.data(), out_layout, dst.data());
+        return result;
+    }
+
+    // reshape keeps order of elements in memory of the (common) input and output format
+    memory_impl::ptr evaluate_reshape(engine_impl& engine, reshape_node& node, memory_impl& input)
+    {
+        auto out_layout = node.get_output_layout();
+        auto fmt = input.get_layout().format;
+        if (fmt != out_layout.format ||
+            (fmt != format::bfyx && fmt != format::byxf && fmt != format::yxfb && fmt != format::fyxb))
+            return nullptr;
+
+        auto dense = to_dense(input, fmt, out_layout.data_type);
+        return from_dense(engine, out_layout, fmt, out_layout.data_type, dense.data());
+    }
+
+    // permute order refers to dimensions in the order of the (common) input and output format
+    memory_impl::ptr evaluate_permute(engine_impl& engine, permute_node& node, memory_impl& input)
+    {
+        auto out_layout = node.get_output_layout();
+        auto fmt = input.get_layout().format;
+        auto& order = node.get_primitive()->permute_order;
+        if (fmt != out_layout.format || order.size() != 4)
+            return nullptr;
+
+        auto in_sizes = input.get_layout().size.sizes(fmt);
+        auto out_sizes = out_layout.size.sizes(fmt);
+        std::array<size_t, 4> in_pitches;
+        in_pitches[3] = 1;
+        for (size_t i = 3; i > 0; i--)
+            in_pitches[i - 1] = in_pitches[i] * in_sizes[i];
+
+        // pitch of input which is advanced by each output dimension
+        std::array<size_t, 4> pitches;
+        for (size_t i = 0; i < 4; i++)
+            pitches[i] = in_pitches[order[i]];
+
+        const auto elem_size = data_type_traits::size_of(out_layout.data_type);
+        auto src = to_dense(input, fmt, out_layout.data_type);
+        std::vector<char> dst(src.size());
+        char* out = dst.data();
+        for (int32_t d0 = 0; d0 < out_sizes[0]; d0++)
+            for (int32_t d1 = 0; d1 < out_sizes[1]; d1++)
+                for (int32_t d2 = 0; d2 < out_sizes[2]; d2++)
+                {
+                    const char* in = src.data() + (d0 * pitches[0] + d1 * pitches[1] + d2 * pitches[2]) * elem_size;
+                    for (int32_t d3 = 0; d3 < out_sizes[3]; d3++, out += elem_size)
+                        std::memcpy(out, in + d3 * pitches[3] * elem_size, elem_size);
+                }
+
+        return from_dense(engine, out_layout, fmt, out_layout.data_type, dst.data());
+    }
+
+    memory_impl::ptr evaluate_concatenation(engine_impl& engine, concatenation_node& node, const std::vector<memory_impl::ptr>& inputs)
+    {
+        size_t axis;
+        switch (node.get_primitive()->axis)
+        {
+        case concatenation::along_b: axis = 0; break;
+        case concatenation::along_f: axis = 1; break;
+        case concatenation::along_y: axis = 2; break;
+        case concatenation::along_x: axis = 3; break;
+        default: return nullptr;
+        }
+
+        auto out_layout = node.get_output_layout();
+        const auto elem_size = data_type_traits::size_of(out_layout.data_type);
+        auto out_dims = get_dims(out_layout.size);
+
+        size_t outer = 1;
+        for (size_t i = 0; i < axis; i++)
+            outer *= out_dims[i];
+        size_t out_chunk = elem_size;
+        for (size_t i = axis; i < 4; i++)
+            out_chunk *= out_dims[i];
+
+        std::vector<char> dst(outer * out_chunk);
+        size_t offset = 0;
+        for (auto& input : inputs)
+        {
+            auto src = to_dense(*input, format::bfyx, out_layout.data_type);
+            const size_t in_chunk = src.size() / outer;
+            for (size_t o = 0; o < outer; o++)
+                std::memcpy(dst.data() + o * out_chunk + offset, src.data() + o * in_chunk, in_chunk);
+            offset += in_chunk;
+        }
+
+        return from_dense(engine, out_layout, format::bfyx, out_layout.data_type, dst.data());
+    }
+
+    memory_impl::ptr evaluate_crop(engine_impl& engine, crop_node& node, memory_impl& input)
+    {
+        auto out_layout = node.get_output_layout();
+        const auto elem_size = data_type_traits::size_of(out_layout.data_type);
+        auto in_dims = get_dims(input.get_layout().size);
+        auto out_dims = get_dims(out_layout.size);
+        auto offsets = get_dims(node.get_primitive()->offsets);
+
+        auto src = to_dense(input, format::bfyx, out_layout.data_type);
+        std::vector<char> dst(count(out_dims) * elem_size);
+        char* out = dst.data();
+        const size_t row_size = out_dims[3] * elem_size;
+        for (int32_t b = 0; b < out_dims[0]; b++)
+            for (int32_t f = 0; f < out_dims[1]; f++)
+                for (int32_t y = 0; y < out_dims[2]; y++, out += row_size)
+                {
+                    size_t in_idx = ((static_cast<size_t>(b + offsets[0]) * in_dims[1] + f + offsets[1]) * in_dims[2] + y + offsets[2]) * in_dims[3] + offsets[3];
+                    std::memcpy(out, src.data() + in_idx * elem_size, row_size);
+                }
+
+        return from_dense(engine, out_layout, format::bfyx, out_layout.data_type, dst.data());
+    }
+
+    // index of broadcasted input element for every output element, inputs are broadcasted along dimensions of size 1
+    // (the same way as GET_DATA_INDEX_SAFE does in kernels)
+    std::vector<size_t> broadcast_indices(const dims_t& in_dims, const dims_t& out_dims)
+    {
+        std::vector<size_t> result;
+        result.reserve(count(out_dims));
+        for (int32_t b = 0; b < out_dims[0]; b++)
+            for (int32_t f = 0; f < out_dims[1]; f++)
+                for (int32_t y = 0; y < out_dims[2]; y++)
+                    for (int32_t x = 0; x < out_dims[3]; x++)
+                        result.push_back(((static_cast<size_t>(b % in_dims[0]) * in_dims[1] + f % in_dims[1]) * in_dims[2] + y % in_dims[2]) * in_dims[3] + x % in_dims[3]);
+        return result;
+    }
+
+    // input broadcasted to 'out_dims'
+    std::vector<float> to_dense_broadcasted(memory_impl& mem, const dims_t& out_dims)
+    {
+        auto values = to_dense_float(mem);
+        auto in_dims = get_dims(mem.get_layout().size);
+        if (in_dims == out_dims)
+            return values;
+
+        auto indices = broadcast_indices(in_dims, out_dims);
+        std::vector<float> result(indices.size());
+        for (size_t i = 0; i < indices.size(); i++)
+            result[i] = values[indices[i]];
+        return result;
+    }
+
+    memory_impl::ptr evaluate_eltwise(engine_impl& engine, eltwise_node& node, const std::vector<memory_impl::ptr>& inputs)
+    {
+        auto prim = node.get_primitive();
+        auto out_layout = node.get_output_layout();
+        if (!is_float(out_layout.data_type) || node.output_calibration_term() || !prim->stride.empty() ||
+            inputs.size() != node.inputs_count())
+            return nullptr;
+
+        for (auto& input : inputs)
+            if (!is_float(input->get_layout().data_type))
+                return nullptr;
+
+        const auto mode = prim->mode;
+        switch (mode)
+        {
+        case eltwise_mode::sum:
+        case eltwise_mode::sub:
+        case eltwise_mode::max:
+        case eltwise_mode::min:
+        case eltwise_mode::prod:
+        case eltwise_mode::div:
+        case eltwise_mode::pow:
+            break;
+        default:
+            return nullptr;
+        }
+
+        auto out_dims = get_dims(out_layout.size);
+        const auto& coefficients = prim->coefficients;
+        auto coefficient = [&](size_t i) { return mode == eltwise_mode::sum && !coefficients.empty() ? coefficients[i] : 1.0f; };
+
+        auto res = to_dense_broadcasted(*inputs[0], out_dims);
+        for (auto& v : res)
+            v *= coefficient(0);
+
+        for (size_t i = 1; i < inputs.size(); i++)
+        {
+            auto in = to_dense_broadcasted(*inputs[i], out_dims);
+            const float c = coefficient(i);
+            const size_t n = res.size();
+            switch (mode)
+            {
+            case eltwise_mode::sum:  for (size_t j = 0; j < n; j++) res[j] += c * in[j]; break;
+            case eltwise_mode::sub:  for (size_t j = 0; j < n; j++) res[j] -= in[j]; break;
+            case eltwise_mode::max:  for (size_t j = 0; j < n; j++) res[j] = std::max(res[j], in[j]); break;
+            case eltwise_mode::min:  for (size_t j = 0; j < n; j++) res[j] = std::min(res[j], in[j]); break;
+            case eltwise_mode::prod: for (size_t j = 0; j < n; j++) res[j] *= in[j]; break;
+            case eltwise_mode::div:  for (size_t j = 0; j < n; j++) res[j] /= in[j]; break;
+            case eltwise_mode::pow:  for (size_t j = 0; j < n; j++) res[j] = std::pow(res[j], in[j]); break;
+            default: break;
+            }
+        }
+
+        if (prim->with_activation)
+        {
+            const float slope = prim->activation_negative_slope;
+            for (auto& v : res)
+                v = v < 0.0f ? v * slope : v;
+        }
+
+        return from_dense(engine, out_layout, format::bfyx, data_types::f32, res.data());
+    }
+
+    memory_impl::ptr evaluate_scale(engine_impl& engine, scale_node& node, const std::vector<memory_impl::ptr>& inputs)
+    {
+        auto out_layout = node.get_output_layout();
+        if (!is_float(out_layout.data_type))
+            return nullptr;
+        for (auto& input : inputs)
+            if (!is_float(input->get_layout().data_type))
+                return nullptr;
+
+        auto out_dims = get_dims(out_layout.size);
+        auto res = to_dense_broadcasted(*inputs[0], out_dims);
+        auto scale = to_dense_broadcasted(*inputs[1], out_dims);
+        for (size_t j = 0; j < res.size(); j++)
+            res[j] *= scale[j];
+
+        if (node.bias_term())
+        {
+            auto bias = to_dense_broadcasted(*inputs[2], out_dims);
+            for (size_t j = 0; j < res.size(); j++)
+                res[j] += bias[j];
+        }
+
+        return from_dense(engine, out_layout, format::bfyx, data_types::f32, res.data());
+    }
+}
+
+memory_impl::ptr evaluate_constant_on_host(engine_impl& engine, program_node& node, const std::vector<memory_impl::ptr>& inputs)
+{
+    if (node.get_fused_activation_func() != activation_none || node.has_fused_primitives() ||
+        inputs.empty() || !is_supported(node.get_output_layout()))
+        return nullptr;
+
+    for (auto& input : inputs)
+        if (!is_supported(input->get_layout()))
+            return nullptr;
+
+    if (node.is_type<reorder>())
+        return evaluate_reorder(engine, node.as<reorder>(), *inputs[0]);
+    if (node.is_type<reshape>())
+        return evaluate_reshape(engine, node.as<reshape>(), *inputs[0]);
+    if (node.is_type<permute>())
+        return evaluate_permute(engine, node.as<permute>(), *inputs[0]);
+    if (node.is_type<concatenation>())
+        return evaluate_concatenation(engine, node.as<concatenation>(), inputs);
+    if (node.is_type<crop>())
+        return evaluate_crop(engine, node.as<crop>(), *inputs[0]);
+    if (node.is_type<eltwise>())
+        return evaluate_eltwise(engine, node.as<eltwise>(), inputs);
+    if (node.is_type<scale>())
+        return evaluate_scale(engine, node.as<scale>(), inputs);
+
+    return nullptr;
+}
+}
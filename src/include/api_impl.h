@@ -54,6 +54,9 @@ namespace cldnn {
     // float <--> half convertors
     float half_to_float(uint16_t value);
     uint16_t float_to_half(float value);
+    // bulk float <--> half convertors (dispatched at runtime to the best instruction set available)
+    void half_to_float(const uint16_t* src, float* dst, size_t count);
+    void float_to_half(const float* src, uint16_t* dst, size_t count);
 }
 
 
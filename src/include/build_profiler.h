@@ -0,0 +1,97 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace cldnn
+{
+
+// Records wall time of program build steps: graph passes, kernel selection (per node and per implementation tried),
+// kernels source preparation and compilation, memory planning.
+// Steps may be nested (e.g. implementations tried during kernel selection of a node), nesting is visible from times only.
+// Programs have a profiler only when built with build_profiling option or graph dumps, so that the recording does not
+// slow down the builds it would measure.
+class build_profiler
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    struct entry
+    {
+        std::string category;               // pass, kernel_selection, implementation, kernels_source, kernels_program,
+                                            // kernels_build, memory_planning
+        std::string name;
+        std::chrono::nanoseconds start;     // relative to the creation of the profiler
+        std::chrono::nanoseconds duration;
+        uint64_t items_in;                  // pass: nodes before, kernels_source/kernels_build: kernels in the program part
+        uint64_t items_out;                 // pass: nodes after
+        std::string details;                // pass: summary of its changes (see base_pass::get_profiling_details)
+    };
+
+    // measures a step from construction to destruction, does nothing without a profiler
+    class scope
+    {
+    public:
+        scope(build_profiler* profiler, std::string category, std::string name, uint64_t items_in = 0);
+        ~scope();
+
+        void set_items_out(uint64_t items) { _items_out = items; }
+        void set_details(std::string details) { _details = std::move(details); }
+
+    private:
+        build_profiler* _profiler;
+        std::string _category;
+        std::string _name;
+        uint64_t _items_in;
+        uint64_t _items_out = 0;
+        std::string _details;
+        clock::time_point _start;
+    };
+
+    build_profiler() : _start(clock::now()) {}
+
+    void add(std::string category, std::string name, clock::time_point start, clock::time_point end, uint64_t items_in = 0, uint64_t items_out = 0,
+             std::string details = std::string());
+
+    // name of the innermost running scope, used to attribute steps which do not know their context (e.g. implementations tried)
+    std::string get_current_scope() const;
+
+    // adds entries of given categories recorded by other profiler (e.g. of an internal program), keeping their wall time
+    void add_entries_of(const build_profiler& other, const std::vector<std::string>& categories);
+
+    // entries are not copied, so they should be read once the build is finished
+    const std::vector<entry>& get_entries() const { return _entries; }
+
+    // writes entries in Chrome trace event format (chrome://tracing)
+    void dump_chrome_trace(const std::string& path, uint32_t process_id) const;
+
+private:
+    clock::time_point _start;
+    std::vector<entry> _entries;
+    std::vector<std::string> _running_scopes;
+    mutable std::mutex _mutex;
+
+    friend class scope;
+};
+
+}
@@ -20,6 +20,10 @@
 #include "network_impl.h"
 #include "primitive_inst.h"
 
+#include <algorithm>
+#include <list>
+#include <utility>
+
 namespace cldnn
 {
 namespace details
@@ -44,8 +48,22 @@ private:
 
         void set(const program_node& node)
         {
+            auto layout = node.get_dependency(0).get_output_layout();
+            auto cached = std::find_if(_programs_cache.begin(), _programs_cache.end(),
+                [&](const std::pair<cldnn::layout, program_impl::ptr>& entry) { return entry.first == layout; });
+            if (cached != _programs_cache.end())
+            {
+                _programs_cache.splice(_programs_cache.begin(), _programs_cache, cached);
+                _program = cached->second;
+                return;
+            }
+
             add_or_change_input_layout(node);
             _program = node.get_program().get_engine().build_program(*_topology, node.get_program().get_options(), true); //rebuild program 
+
+            _programs_cache.emplace_front(layout, _program);
+            if (_programs_cache.size() > max_cached_programs)
+                _programs_cache.pop_back();
         }
         program_impl::ptr get() const { return _program; }
         void set_program(program_impl::ptr prog) { _program = prog; }
@@ -55,6 +73,9 @@ private:
     private:
         topology_impl* _topology = nullptr;
         program_impl::ptr _program = nullptr;
+        // Programs built for recently seen input layouts, most recently used first.
+        static const size_t max_cached_programs = 4;
+        std::list<std::pair<cldnn::layout, program_impl::ptr>> _programs_cache;
 
         void add_or_change_input_layout(const program_node& node)
         {
@@ -124,12 +145,15 @@ public:
 
     memory_impl& input_memory() const { return dep_memory(0); }
     memory_impl& compare_memory() const { return dep_memory(1); }
+    // Single int set on the device to 1 when the condition holds.
+    memory_impl& flag_memory() const { return *_flag; }
     network_impl::ptr get_net_true() const { return _net_true; }
     network_impl::ptr get_net_false() const { return _net_false; }
     primitive_id result_id() const { return node.result_id(); }
 private:
     network_impl::ptr _net_true;
     network_impl::ptr _net_false;
+    memory_impl::ptr _flag;
 };
 
 using condition_inst = typed_primitive_inst<condition>;
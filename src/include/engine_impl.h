@@ -25,12 +25,16 @@
 #include "gpu/engine_info.h"
 
 #include <memory>
+#include <mutex>
 #include <set>
 
 namespace cldnn {
 namespace gpu { 
     class gpu_toolkit;
 }
+namespace cpu {
+    class thread_pool;
+}
 
 class build_options;
 using gpu_toolkit = gpu::gpu_toolkit;
@@ -52,7 +56,8 @@ enum class resource_flags : int
     READ_ONLY =  (1 << 1),
     WRITE_ONLY = (1 << 2),
     DEVICE_ONLY = (1 << 3), // no access from host, fill with data available only on creation
-    COPY_HOST_PTR = (1 << 4) // will copy host pointer data on creation
+    COPY_HOST_PTR = (1 << 4), // will copy host pointer data on creation
+    HOST_PINNED = (1 << 5) // allocated in host memory which stays mapped, accessed by host without waiting for the queue
 };
 inline resource_flags operator|(resource_flags a, resource_flags b)
 {
@@ -66,11 +71,11 @@ inline resource_flags operator&(resource_flags a, resource_flags b)
 struct engine_impl : public refcounted_obj<engine_impl>
 {
 public:
-    engine_impl(const engine_configuration& conf);
+    engine_impl(engine_types type, const engine_configuration& conf);
     ~engine_impl();
-    engine_types type() const { return engine_types::ocl; }
+    engine_types type() const { return _type; }
     refcounted_obj_ptr<memory_impl> allocate_and_copy_memory(refcounted_obj_ptr<memory_impl> to_copy, resource_flags flags = resource_flags::READ_WRITE);
-    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout);
+    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, resource_flags flags = resource_flags::NONE);
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, std::set<primitive_id>, bool reusable = true);
     refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, layout new_layout);
     bool is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2);
@@ -94,7 +99,7 @@ public:
         if (&node.get_program().get_engine() != this)
             throw std::invalid_argument("engine_impl::create_primitive_impl: program's engine does not match called engine");
 
-        auto factory = implementation_map<T>::get(type(), node);
+        auto factory = implementation_map<T>::get(impl_type(node), node);
         return std::move(std::unique_ptr<primitive_impl>(factory(node)));
     }
 
@@ -103,7 +108,7 @@ public:
     {
         if (&node.get_program().get_engine() != this)
           throw std::invalid_argument("engine_impl::create_primitive_impl: program's engine does not match called engine");
-        return implementation_map<T>::check(type(), node);
+        return implementation_map<T>::check(impl_type(node), node);
     }
 
     template <class T>
@@ -111,13 +116,15 @@ public:
     {
         if (&node.get_program().get_engine() != this)
             throw std::invalid_argument("engine_impl::create_primitive_impl: program's engine does not match called engine");
-        return implementation_map<T>::check_io_eq(type(), node);
+        return implementation_map<T>::check_io_eq(impl_type(node), node);
     }
 
     const engine_configuration& configuration() const { return _configuration; }
     void set_mem_pool(bool flag) { _configuration.enable_memory_pool = flag; }
     std::shared_ptr<gpu_toolkit> get_context() const { return _context; }
-    gpu::engine_info_internal get_engine_info() const;
+    // threads executing host implementations, created on first use by engines other than the CPU one
+    cpu::thread_pool& get_thread_pool() const;
+    const gpu::engine_info_internal& get_engine_info() const;
     memory_pool& get_memory_pool() { return _memory_pool; }
 
     uint64_t get_max_used_device_memory() const { return _memory_pool.get_max_peak_device_memory_used(); }
@@ -127,8 +134,17 @@ public:
     bool use_memory_pool() const;
 
 private:
+    // nodes placed on the host are executed by implementations of the CPU engine (see assign_host_placement)
+    engine_types impl_type(const program_node& node) const;
+
+    engine_types _type;
     engine_configuration _configuration;
     std::shared_ptr<gpu_toolkit> _context;
+    mutable std::unique_ptr<cpu::thread_pool> _thread_pool;
+    mutable std::once_flag _thread_pool_created;
+    // engine info of the CPU engine, queried from the system once
+    mutable std::unique_ptr<gpu::engine_info_internal> _host_engine_info;
+    mutable std::once_flag _host_engine_info_created;
 	memory_pool _memory_pool;
 };
 }
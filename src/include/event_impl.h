@@ -33,8 +33,17 @@ public:
 
     void wait();
     bool is_set();
-    virtual bool is_valid() const { return _attached; }
-    virtual void reset() { _attached = false; }
+    virtual bool is_valid() const { return _attached || _retained; }
+    virtual void reset()
+    {
+        _attached = false;
+        //the event may be attached to a new ocl event when reused, so its state and times are not valid anymore
+        _set = false;
+        _profiling_captured = false;
+        _profiling_info.clear();
+    }
+    //retained event is not reused by the events pool even after reset, e.g. until its profiling info is read
+    void set_retained(bool retained) { _retained = retained; }
     //returns true if handler has been successfully added
     bool add_event_handler(cldnn_event_handler handler, void* data);
     
@@ -50,6 +59,7 @@ private:
 protected:
     bool _set = false;
     bool _attached = false; //because ocl event can be attached later, we need mechanism to check if such event was attached
+    bool _retained = false;
     void call_handlers();
 
     virtual void wait_impl() = 0;
@@ -0,0 +1,78 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "api/CPP/tensor.hpp"
+
+#include <vector>
+
+namespace cldnn
+{
+// Chooses one format for every node of a directed acyclic graph, so that the sum of node costs (cost of executing
+// a node in the chosen format) and edge costs (cost of a reorder between nodes which got different formats) is minimal.
+//
+// Chains and trees are solved exactly with dynamic programming, for nodes with several users the result is refined
+// greedily until no single node can lower the total cost by changing its format.
+class format_assignment
+{
+public:
+    struct candidate
+    {
+        format fmt;
+        float cost;
+    };
+
+    // Nodes have to be added in topological order. Returns index of the node.
+    size_t add_node(std::vector<candidate> candidates);
+    // Data produced by node 'from' is consumed by node 'to' in the format chosen for 'from'.
+    void add_edge(size_t from, size_t to, float reorder_cost);
+    // Node consumes data which is available only in 'fmt'.
+    void add_fixed_input(size_t node, format fmt, float reorder_cost);
+
+    // Returns index of the chosen candidate for every node.
+    std::vector<size_t> solve() const;
+    float total_cost(const std::vector<size_t>& choice) const;
+
+    size_t size() const { return _nodes.size(); }
+    const format& get_format(size_t node, size_t choice) const { return _nodes.at(node).candidates.at(choice).fmt; }
+
+private:
+    struct edge
+    {
+        size_t node;
+        float cost;
+    };
+
+    struct fixed_input
+    {
+        format fmt;
+        float cost;
+    };
+
+    struct node_info
+    {
+        std::vector<candidate> candidates;
+        std::vector<edge> inputs;
+        std::vector<edge> users;
+        std::vector<fixed_input> fixed_inputs;
+    };
+
+    float local_cost(const std::vector<size_t>& choice, size_t node, size_t candidate_idx) const;
+
+    std::vector<node_info> _nodes;
+};
+}
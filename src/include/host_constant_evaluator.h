@@ -0,0 +1,30 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "memory_impl.h"
+#include "engine_impl.h"
+
+#include <vector>
+
+namespace cldnn
+{
+// Computes output of a constant node on the host from memories of its dependencies (given in the same order).
+// Supports reorder (without mean), reshape, permute, concatenation, crop, eltwise and scale.
+// Returns nullptr for other primitives or unsupported parameters - such nodes have to be computed on the device.
+memory_impl::ptr evaluate_constant_on_host(engine_impl& engine, program_node& node, const std::vector<memory_impl::ptr>& inputs);
+}
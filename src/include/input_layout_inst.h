@@ -50,6 +50,15 @@ public:
     typed_primitive_inst(network_impl& network, input_layout_node const& node);
 
     void set_data(memory_impl& mem);
+
+    // True if batches are stored one after another, so data of a smaller batch is a prefix of the buffer.
+    static bool is_batch_outermost(format fmt);
+
+private:
+    // Buffer allocated by the network for this input; inputs with batch smaller than the compiled one are copied into it.
+    memory_impl::ptr _network_buffer;
+
+    void set_data_with_smaller_batch(memory_impl& mem);
 };
 
 using input_layout_inst = typed_primitive_inst<input_layout>;
@@ -51,6 +51,7 @@ namespace kernel_selector
     using kernel_type                       = kernel_selector::KernelType;
     using weights_type                      = kernel_selector::WeightsType;
     using activation_function               = kernel_selector::ActivationFunction;
+    using fused_op_type                     = kernel_selector::FusedOpType;
     using pool_type                         = kernel_selector::PoolType;
     using pool_remainder                    = kernel_selector::PoolRemainder;
 	using argm_axis                         = kernel_selector::ArgMaxMinAxis;
@@ -70,6 +71,7 @@ namespace kernel_selector
     using tuning_mode                       = kernel_selector::TuningMode;
     using sample_type                       = kernel_selector::SampleType;
     using border_type                       = kernel_selector::BorderType;
+    using condition_function                = kernel_selector::ConditionFunction;
 
     using data_tensor                       = kernel_selector::DataTensor;
     using weights_tensor                    = kernel_selector::WeightsTensor;
@@ -145,6 +147,7 @@ inline void convert_new_activation_func(const p_type primitive, kernel_selector:
 }
 
 void set_params(const program_node& node, kernel_selector::params& params);
+void convert_fused_primitives(const program_node& node, std::vector<kernel_selector::fused_operation_desc>& fused_ops);
 
 template <typename params_t, typename arg_t>
 inline params_t get_default_params(const arg_t& arg, uint32_t split = 1)
@@ -162,6 +165,7 @@ inline params_t get_default_params(const arg_t& arg, uint32_t split = 1)
     params.layerID = arg.id();
 
     convert_fused_activation_func_params(arg, params.activation);
+    convert_fused_primitives(arg, params.fused_ops);
 
     return params;
 }
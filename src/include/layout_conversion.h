@@ -0,0 +1,36 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "api/CPP/layout.hpp"
+
+namespace cldnn
+{
+namespace cpu { class thread_pool; }
+
+// Checks if data described by @p l can be read or written by convert_layout().
+bool is_host_convertible(const layout& l);
+
+// Copies data between two layouts of the same logical size on the host. Format, data type and padding may differ;
+// padding and block alignment of the destination is filled with zeros.
+void convert_layout(const layout& src_layout, const void* src, const layout& dst_layout, void* dst);
+
+// Same as above, but with @p fill_padding set to false only the values are written and the rest of the destination
+// is left untouched. Large conversions are split between threads of @p pool, if given.
+void convert_layout(const layout& src_layout, const void* src, const layout& dst_layout, void* dst, bool fill_padding,
+                    cpu::thread_pool* pool = nullptr);
+}
@@ -39,6 +39,7 @@ namespace cldnn
 {
 
 class primitive_inst;
+class program_impl;
 
 //this class is used for both static and dynamic reordering of data withing network.
 //static reordering is done for cldnn::data (i.e. immutable) primitives via internal network 
@@ -108,6 +109,8 @@ private:
 
     std::map<cache_key, std::shared_ptr<reorder>> _cached_reorders;
     std::map<cache_key, std::shared_ptr<generic_layer>> _cached_generic_layers;
+    //input formats of convolutions chosen by select_convolution_input_formats
+    std::map<primitive_id, format> _selected_input_formats;
 
     layout get_expected_layout(layout const& current_layout, data_type type, convolution_node const& node, layout const& output_or_weights_layout);
     layout get_expected_layout(layout const& current_layout, data_type type, deconvolution_node const& node, layout const& output_or_weights_layout);
@@ -186,5 +189,11 @@ public:
     void set_optimization_attribute(optimization_attributes_type attribute, int32_t val);
 
     bool is_format_optimized(const convolution_node& node, const format& format);
+
+    //chooses between bfyx and yxfb input for all convolutions which can use both, so that the estimated cost of
+    //the whole graph (convolutions and reorders between them) is minimal instead of picking the best format for each
+    //convolution separately. Shall be called after optimization attributes are set and before convolution reorders
+    //are requested, as get_reorder() follows the choice made here.
+    void select_convolution_input_formats(program_impl& p);
 };
 }
@@ -127,6 +127,7 @@ public:
     ~memory_pool();
     refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, const primitive_id& id, uint32_t network_id,  const std::set<primitive_id>& restrictions, bool reusable = true); // get from pool or create memory allocation
     refcounted_obj_ptr<memory_impl> get_memory(const layout& layout);
+    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, resource_flags flags); // always creates new memory allocation
     refcounted_obj_ptr<memory_impl> alloc_and_copy_memory(refcounted_obj_ptr<memory_impl> src, resource_flags flags);
     refcounted_obj_ptr<memory_impl> get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>&);
     refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions);
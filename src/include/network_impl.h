@@ -24,8 +24,10 @@
 #include "event_impl.h"
 #include "program_impl.h"
 #include "refcounted_obj.h"
+#include "network_profiler.h"
 
 #include <map>
+#include <memory>
 #include <vector>
 #include <unordered_map>
 
@@ -41,12 +43,24 @@ public:
     network_impl(engine_impl& engine, const topology_impl& topo, const build_options& options = build_options(), bool is_internal = false);
     network_impl(engine_impl& engine, const std::set<std::shared_ptr<program_node>>& nodes, const build_options & options, bool is_internal);
     network_impl(engine_impl& engine, const std::string& file_name, const std::string& dump_path = "");
+    ~network_impl();
 
     const program_impl& get_program() const { return *_program; }
     engine_impl& get_engine() const { return _program->get_engine(); }
 
     void reset_execution(bool wait = true);
     void set_input_data(const primitive_id& id, memory_impl& data);
+    // Makes the output primitive write to the given buffer instead of its own one, see primitive_inst::set_output_memory().
+    bool set_output_memory(const primitive_id& id, memory_impl& mem);
+    // Output memory of the primitive; a view of the valid batches when the network runs with a smaller (dynamic) batch.
+    refcounted_obj_ptr<memory_impl> get_output_memory(const primitive_id& id);
+    // Outputs can also be addressed by handles - their positions in get_outputs(), which do not need id lookups.
+    size_t get_output_handle(const primitive_id& id) const;
+    refcounted_obj_ptr<memory_impl> get_output_memory(size_t handle);
+    const event_impl::ptr& get_output_event(size_t handle) const;
+    int32_t get_batch() const { return _batch; }
+    // Batch of the network inputs the network was built for; inputs may have a smaller batch when dynamic batch is enabled.
+    int32_t get_max_batch() const { return _max_batch; }
 
     void set_learning_rate(const float lr);
     float get_learning_rate();
@@ -67,7 +81,9 @@ public:
     // Implementation specific calls
     std::shared_ptr<primitive_inst> get_primitive(const primitive_id& id);
     std::string get_primitive_info(const primitive_id& id) const;
-    const event_impl::ptr& get_primitive_event(const primitive_id& id) const { return _events.at(id); }
+    // throws std::out_of_range when the primitive has not been executed
+    const event_impl::ptr& get_primitive_event(const primitive_id& id) const;
+    const event_impl::ptr& get_primitive_event(const primitive_inst& inst) const;
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<primitive_id>& ids);
     std::vector<std::shared_ptr<primitive_inst>> get_primitives(const std::vector<program_node*>& nodes);
     void execute_primitive(const std::shared_ptr<primitive_inst>& primitive, const std::vector<event_impl::ptr>& events);
@@ -76,11 +92,15 @@ public:
     uint32_t get_id() const { return net_id; }
     void build_exec_order();    
     bool is_internal() const { return _internal; }
+    // nullptr when engine profiling is disabled, device times of the last execution are collected first
+    network_profiler* get_profiler();
 private:
     uint32_t net_id = 0; 
     const program_impl::cptr _program;
     bool _internal;
     float _learning_rate = float(0.00001);
+    int32_t _max_batch = 0;
+    int32_t _batch = 0;
 
     std::map<primitive_id, std::shared_ptr<primitive_inst>> _primitives;
     std::vector<std::shared_ptr<primitive_inst>> _inputs;
@@ -88,13 +108,23 @@ private:
     std::list<std::shared_ptr<primitive_inst>> _exec_order;
     std::list<std::shared_ptr<primitive_inst>> _data_outputs;
 
-    std::unordered_map<primitive_id, event_impl::ptr> _events;
+    // events of the last execution indexed by primitive_inst::get_event_index(), so they are not looked up by id
+    std::vector<event_impl::ptr> _events;
+    // mutable data gets the event of its user or dependency executed last
+    std::vector<std::pair<size_t, size_t>> _mutable_data_events;
+    std::unique_ptr<network_profiler> _profiler;
+    std::vector<event_impl::ptr> _profiled_events;  // events of the last profiled execution in execution order, until their times are read
 
     void allocate_primitive_instance(program_node const& node);
     void add_to_exec_order(const primitive_id& id);
     std::shared_ptr<primitive_inst> find_in_internal_networks(const primitive_id& id);
     std::shared_ptr<primitive_inst> find_primitive(const primitive_id& id);
     void check_names();
+    void create_profiler();
+    void retain_profiled_events();
+    void collect_profiling_info();
+    void release_profiled_events();
+    refcounted_obj_ptr<memory_impl> get_runtime_memory(primitive_inst& inst);
 };
 }
 
@@ -0,0 +1,110 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "api/C/cldnn.h"
+#include "api/CPP/primitive.hpp"
+
+#include <chrono>
+#include <functional>
+#include <list>
+#include <utility>
+#include <string>
+#include <vector>
+
+namespace cldnn
+{
+
+// Aggregates execution times of network primitives over many network executions (created when engine profiling is enabled).
+// Host time spent on enqueueing a primitive is measured next to its device times, so launch-bound primitives are visible.
+// Count, min and totals cover all executions, percentiles and the trace are computed from the last max_kept_samples executions
+// of each primitive, so memory use does not grow with the number of executions.
+class network_profiler
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    struct primitive_stats
+    {
+        primitive_id id;
+        std::string kernel_name;
+        std::string original_ids;                       // comma separated ids of primitives computed by this one (after fusing)
+        uint64_t count;                                 // number of executions
+        std::chrono::nanoseconds min;                   // device execution time
+        std::chrono::nanoseconds median;                // of the kept samples
+        std::chrono::nanoseconds p99;                   // of the kept samples
+        std::chrono::nanoseconds total;
+        std::chrono::nanoseconds queued_to_start_median;// time between enqueue on the device and the start of execution
+        std::chrono::nanoseconds enqueue_median;        // host time of enqueueing the primitive
+        std::chrono::nanoseconds enqueue_total;
+    };
+
+    static const size_t max_kept_samples = 1000;
+
+    network_profiler() : _start(clock::now()) {}
+
+    // primitives are added once, in execution order, and are referred to by their execution order index
+    void add_primitive(const primitive_id& id, std::string kernel_name, const std::vector<primitive_id>& original_ids);
+
+    void add_enqueue(size_t primitive_idx, clock::time_point start, clock::time_point end);
+
+    // completes samples of primitives enqueued since the previous call with device times, should be called once per execution
+    // when the execution is finished and before its events are released
+    void add_execution(const std::function<const std::list<cldnn_profiling_interval>&(size_t)>& get_device_times);
+
+    // statistics are cached, so strings stay valid until the next call to get_stats() or reset()
+    const std::vector<primitive_stats>& get_stats();
+    void reset();
+
+    // device times are placed on the trace timeline relative to host enqueue since device and host clocks are not synchronized
+    void dump_chrome_trace(const std::string& path) const;
+    void dump_csv(const std::string& path);
+
+private:
+    struct sample
+    {
+        uint64_t execution;
+        std::chrono::nanoseconds enqueue_start;         // relative to the creation of the profiler
+        std::chrono::nanoseconds enqueue;
+        std::chrono::nanoseconds queued_to_start;
+        std::chrono::nanoseconds executing;
+        bool has_device_times;
+    };
+
+    struct primitive_samples
+    {
+        primitive_id id;
+        std::string kernel_name;
+        std::string original_ids;
+        uint64_t count;
+        uint64_t device_count;
+        std::chrono::nanoseconds min;
+        std::chrono::nanoseconds total;
+        std::chrono::nanoseconds enqueue_total;
+        std::vector<sample> samples;                    // the last max_kept_samples executions, oldest is overwritten first
+        size_t next_sample;
+    };
+
+    clock::time_point _start;
+    uint64_t _executions = 0;
+    std::vector<primitive_samples> _primitives;
+    std::vector<std::pair<size_t, size_t>> _enqueued;   // primitive and sample waiting for device times of the current execution
+    std::vector<primitive_stats> _stats;
+};
+
+}
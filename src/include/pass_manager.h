@@ -18,6 +18,10 @@
 
 #include "program_impl.h"
 #include "layout_optimizer.h"
+#include "build_profiler.h"
+
+#include <map>
+#include <string>
 
 namespace cldnn
 {
@@ -28,6 +32,8 @@ namespace cldnn
         base_pass(const std::string& pass_name) : name(pass_name) {}
         virtual void run(program_impl& p) = 0;
         std::string get_name() { return name; }
+        // summary of the changes done by the last run, reported in the build profiling entry of the pass
+        virtual std::string get_profiling_details() const { return std::string(); }
         void clean_marks(program_impl& p) {
             for (auto& node : p.get_processing_order())
             {
@@ -47,7 +53,12 @@ namespace cldnn
         }
         void run(program_impl& p, base_pass& pass)
         {
-            pass.run(p);
+            {
+                build_profiler::scope pass_scope(p.get_build_profiler(), "pass", pass.get_name(), p.get_processing_order().size());
+                pass.run(p);
+                pass_scope.set_items_out(p.get_processing_order().size());
+                pass_scope.set_details(pass.get_profiling_details());
+            }
             std::string dump_file_name;
             if (pass_count < 10)
                 dump_file_name += "0";
@@ -205,6 +216,17 @@ namespace cldnn
         void fuse_conv_bn_scale(program_impl& p, program_node* node);
     };
 
+    // fuses chains of activation, scale and eltwise with constants into the producing primitive, once formats of
+    // the primitives are selected
+    class prepare_post_ops_fusing : public base_pass
+    {
+    public:
+        prepare_post_ops_fusing() : base_pass("prepare_post_ops_fusing") {}
+    private:
+        virtual void run(program_impl& p) override;
+        void fuse_into_producer(program_impl& p, program_node* node);
+    };
+
     class pre_optimize_bias : public base_pass
     {
     public:
@@ -236,6 +258,25 @@ namespace cldnn
         program_node& add_reorder(program_impl &p, program_node* node, program_node* usr, layout reorder_layout);
     };
 
+    class assign_host_placement : public base_pass
+    {
+    public:
+        assign_host_placement() : base_pass("assign_host_placement") {}
+    private:
+        virtual void run(program_impl& p) override;
+    };
+
+    class add_host_transfers : public base_pass
+    {
+    public:
+        add_host_transfers() : base_pass("add_host_transfers") {}
+    private:
+        virtual void run(program_impl& p) override;
+        void schedule_host_nodes(program_impl& p);
+        void copy_constants_to_host(program_impl& p, program_node& node);
+        program_node& add_transfer(program_impl& p, program_node& node, program_node& usr, bool to_host);
+    };
+
     class post_optimize_weights : public base_pass
     {
     public:
@@ -254,7 +295,8 @@ namespace cldnn
         propagate_constants() : base_pass("propagate_constants") {}
     private:
         virtual void run(program_impl& p) override;
-        std::list<std::pair<primitive_id, memory_impl::ptr>> calculate(engine_impl &engine);
+        void fold_on_host(program_impl& p);
+        std::list<std::pair<primitive_id, memory_impl::ptr>> calculate(program_impl& p);
         bool has_non_const_user(program_node& node) const;
         void handle_constant(program_impl& prog, program_node& node);
         void add_constant(program_impl& prog, program_node& node);
@@ -273,6 +315,42 @@ namespace cldnn
         virtual void run(program_impl& p) override;
     };
 
+    class eliminate_common_subexpressions : public base_pass
+    {
+    public:
+        eliminate_common_subexpressions() : base_pass("eliminate_common_subexpressions") {}
+        // number of merged nodes per primitive type (constant data included)
+        const std::map<std::string, size_t>& get_merged_nodes_count() const { return merged_nodes; }
+        std::string get_profiling_details() const override;
+    private:
+        virtual void run(program_impl& p) override;
+        std::map<std::string, size_t> merged_nodes;
+    };
+
+    class collapse_data_movement_chains : public base_pass
+    {
+    public:
+        collapse_data_movement_chains() : base_pass("collapse_data_movement_chains") {}
+    private:
+        virtual void run(program_impl& p) override;
+    };
+
+    class reorder_dynamic_batch_outputs : public base_pass
+    {
+    public:
+        reorder_dynamic_batch_outputs() : base_pass("reorder_dynamic_batch_outputs") {}
+    private:
+        virtual void run(program_impl& p) override;
+    };
+
+    class mark_dynamic_batch_nodes : public base_pass
+    {
+    public:
+        mark_dynamic_batch_nodes() : base_pass("mark_dynamic_batch_nodes") {}
+    private:
+        virtual void run(program_impl& p) override;
+    };
+
     class reorder_inputs : public base_pass
     {
     public:
@@ -89,9 +89,10 @@ public:
     memory_impl& output_memory() const { return *_output; }
     size_t inputs_memory_count() const { return _node.get_primitive()->get_input().size(); }
     primitive_type_id type() const { return _node.type(); }
-    primitive_id id() const { return _node.id(); }
+    const primitive_id& id() const { return _node.id(); }
     primitive_id org_id() const { return _node.get_org_primitive_id(); }
     bool can_be_optimized() const { return _node.can_be_optimized(); }
+    bool has_dynamic_batch() const { return _node.has_dynamic_batch(); }
     std::shared_ptr<const primitive> desc() const { return _node.get_primitive(); }
     network_impl& get_network() const { return _network; }
     uint32_t get_network_id() const;
@@ -110,9 +111,16 @@ public:
     bool validate() const { return _impl->validate(*this); }
     bool output_changed() const { return _output_changed; }
     void reset_output_change() { _output_changed = false; }
+    // Makes the primitive compute its output directly in the given buffer. Returns false when the output buffer cannot be replaced
+    // (inputs, constants and primitives which share the buffer with their inputs or users).
+    bool set_output_memory(memory_impl& mem);
 
     void build_deps();
 
+    // position of the primitive's event in the network, primitives which are executed come first in execution order
+    size_t get_event_index() const { return _event_index; }
+    void set_event_index(size_t index) { _event_index = index; }
+
 protected:
     primitive_inst(network_impl& network, program_node const& node, bool allocate_memory);
 
@@ -137,6 +145,7 @@ protected:
 
     bool _output_changed; //todo: implement output reuse if neither of inputs has changed
     bool _has_valid_input = true; //by default all primitives has valid inputs, exception is input_layout (see input_layout_inst)
+    size_t _event_index = 0;
 
     memory_impl::ptr allocate_output();
     static std::vector<std::shared_ptr<primitive_inst>> build_exec_deps(std::vector<std::shared_ptr<primitive_inst>> const& mem_deps);
@@ -110,5 +110,14 @@ namespace cldnn
         static void merge_buffers(engine_impl &engine, program_node &node, layout target_layout, size_t begin_offset, size_t end_offset);
         static layout get_weights_layout(typed_program_node<cldnn::data> &data_node, int32_t split);
         static std::pair<bool, bool> are_layouts_identical(layout const& l1, layout const& l2);
+
+        //returns if output of the node is produced on the host in a device program (see assign_host_placement),
+        //nodes which are optimized out share memory of their first input, so they are on its side
+        static bool is_on_host(program_node const& node)
+        {
+            if (node.can_be_optimized() && !node.get_dependencies().empty())
+                return is_on_host(node.get_dependency(0));
+            return node.is_host_placed();
+        }
     };
 }
\ No newline at end of file
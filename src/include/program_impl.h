@@ -34,6 +34,7 @@ struct program_node;
 class layout_optimizer;
 class pass_manager;
 class base_pass;
+class build_profiler;
 class program_impl_wrapper;
 struct condition;
 
@@ -47,8 +48,10 @@ struct program_impl : public refcounted_obj<program_impl>
     friend class prepare_padding;                   // to be removed when possible
     friend class propagate_constants;               // to be removed when possible
     friend class prepare_primitive_fusing;          // to be removed when possible
+    friend class prepare_post_ops_fusing;           // to be removed when possible
     friend class prepare_conv_eltw_fusing;          // to be removed when possible
     friend class reorder_inputs;                    // to be removed when possible
+    friend class reorder_dynamic_batch_outputs;     // to be removed when possible
     friend class program_impl_wrapper;              // this class is intended to extend the interface of program_impl for 
                                                     // the usage within tests_core_internal project only
     friend struct engine_impl;
@@ -156,6 +159,8 @@ public:
 
     void remove_nodes(std::list<program_node*>& to_remove);
     void dump_program(const char* stage, bool with_full_info, std::function<bool(program_node const&)> const& filter = nullptr) const;
+    // nullptr when build steps are not recorded (see build_profiling option)
+    build_profiler* get_build_profiler() const { return profiler.get(); }
 
 private:
     uint32_t prog_id = 0;
@@ -165,6 +170,7 @@ private:
     std::vector<program_node*> outputs;
     nodes_ordering processing_order;
     std::unique_ptr<pass_manager> pm;
+    std::unique_ptr<build_profiler> profiler;
 
     std::map<primitive_id, std::shared_ptr<program_node>> nodes_map;
     std::list<primitive_id> optimized_out;
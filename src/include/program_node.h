@@ -18,7 +18,9 @@
 #include <set>
 
 #include "api/CPP/primitive.hpp"
+#include "api/CPP/eltwise.hpp"
 #include "internal_primitive.h"
+#include "memory_impl.h"
 
 #include "meta_utils.h"
 
@@ -40,6 +42,28 @@ struct internal_primitive_type_base;
 class json_composite;
 class xml_composite;
 
+/*
+    Post-operation absorbed into the kernel of the node it is attached to (see prepare_post_ops_fusing).
+    Operations are applied in order to the node's result, after its fused activation.
+    Constant operands are kept alive here since their data nodes are removed from the graph.
+*/
+struct fused_primitive_desc
+{
+    enum class op_type
+    {
+        activation,
+        scale,      // res * inputs[0] (+ inputs[1])
+        eltwise     // res <mode> inputs[0]
+    };
+
+    primitive_id id;                    // id of the fused primitive
+    op_type type = op_type::activation;
+    cldnn_activation_func activation_func = activation_none;
+    cldnn_activation_additional_params activation_params = { 0.0f, 0.0f };
+    eltwise_mode mode = eltwise_mode::sum;
+    std::vector<memory_impl::ptr> inputs;
+};
+
 /*
     Base class for all primitives which wraps API class and extends it to be used
     in graph context.
@@ -61,6 +85,7 @@ struct program_node
     friend class prepare_conv_eltw_read_write_opt;  // to be removed when possible
     friend class propagate_constants;               // to be removed when possible
     friend class post_optimize_weights;             // to be removed when possible - requires an access to selected_impl
+    friend class add_host_transfers;                // to be removed when possible - requires an access to fused_prims
 
     template <class PType>
     friend struct typed_program_node;
@@ -190,6 +215,10 @@ public:
         return fused_activation.additional_params;
     }
 
+    void add_fused_primitive(fused_primitive_desc const& desc) { fused_prims.push_back(desc); }
+    std::vector<fused_primitive_desc> const& get_fused_primitives() const { return fused_prims; }
+    bool has_fused_primitives() const { return !fused_prims.empty(); }
+
     // check/set if the node can be optimized out (removed from the network)
     bool can_be_optimized() const { return optimized; }
     void can_be_optimized(bool opt) { optimized = opt; }
@@ -198,12 +227,32 @@ public:
     bool can_share_buffer() const { return share_buffer; }
     void can_share_buffer(bool share) { share_buffer = share; }
 
+    // check/set if the node is executed by a host implementation in a program built for a device engine
+    bool is_host_placed() const { return host_placed; }
+    void set_host_placed(bool host) { host_placed = host; }
+
+    // check/set if the node's output is allocated in memory mapped to the host (read and written without a transfer)
+    bool has_host_output() const { return host_output; }
+    void set_host_output(bool host) { host_output = host; }
+
     // check/set if the node support padding in x,y,b and f
     bool support_padding() const { return _support_padding; }
     void support_padding(bool support) { _support_padding = support; }
 
+    // check/set if the node's output carries the batch of the network inputs, which may be smaller at runtime (dynamic batch)
+    bool has_dynamic_batch() const { return dynamic_batch; }
+    void set_dynamic_batch(bool dynamic) { dynamic_batch = dynamic; }
+
     primitive_id get_org_primitive_id() const { return org_id; }
 
+    // ids of primitives whose computation was merged into this node (fused or deduplicated), used to attribute execution time
+    void add_merged_ids(program_node const& node)
+    {
+        merged_ids.push_back(node.id());
+        merged_ids.insert(merged_ids.end(), node.merged_ids.begin(), node.merged_ids.end());
+    }
+    std::vector<primitive_id> const& get_merged_ids() const { return merged_ids; }
+
     bool is_constant() const { return constant; }
     
     // returns true if this node is within main data flow of the network (i.e. it does not describe helper data like convolution's weights etc.)
@@ -272,6 +321,9 @@ protected:
     bool optimized = false;
     bool share_buffer = true;
     bool _support_padding = false;
+    bool host_placed = false;
+    bool host_output = false;
+    bool dynamic_batch = false;
 
     mutable bool has_reused_memory = false;
     mutable uint32_t reused_memory_color = 0;
@@ -286,6 +338,8 @@ protected:
     };
 
     fused_activation_params fused_activation;
+    std::vector<fused_primitive_desc> fused_prims;
+    std::vector<primitive_id> merged_ids;
 
     void invalidate_users() const;
 
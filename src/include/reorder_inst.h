@@ -41,8 +41,13 @@ public:
     void set_input_offset(tensor const& io) { input_offset = io; }
     tensor get_input_offset() const { return input_offset; }
 
+    // copy between device and host memory, added for host placed nodes (see add_host_transfers)
+    bool is_transfer() const { return transfer; }
+    void set_transfer(bool val) { transfer = val; }
+
 private:
     bool req_reinterpr = false;
+    bool transfer = false;
     tensor input_offset = tensor{ 0 }; //used by reorder to winograd domain
 };
 
@@ -71,4 +76,8 @@ private:
 
 using reorder_inst = typed_primitive_inst<reorder>;
 
+namespace gpu {
+    primitive_impl* create_transfer(const reorder_node& arg);
+}
+
 }
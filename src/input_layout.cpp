@@ -39,10 +39,54 @@ input_layout_inst::typed_primitive_inst(network_impl& network, input_layout_node
     : parent(network, node)
 {
     _has_valid_input = false; //by default input for 'input_layout' is invalid as long as user doesn't call set_data
+    _network_buffer = _output;
+}
+
+bool input_layout_inst::is_batch_outermost(format fmt)
+{
+    switch (fmt)
+    {
+    case format::bfyx:
+    case format::byxf:
+    case format::bfyx_f16:
+    case format::bf8_xy16:
+    case format::byxf_af32:
+    case format::b_fs_yx_fsv4:
+    case format::bfzyx:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void input_layout_inst::set_data_with_smaller_batch(memory_impl& mem)
+{
+    auto runtime_layout = node.get_output_layout();
+    runtime_layout.size.batch[0] = mem.get_layout().size.batch[0];
+
+    CLDNN_ERROR_LAYOUT_MISMATCH("input layout", "memory layout", mem.get_layout(), "output memory layout with runtime batch", runtime_layout, "");
+    CLDNN_ERROR_BOOL(id(), "input format", !is_batch_outermost(runtime_layout.format), "dynamic batch is not supported for this input format");
+    CLDNN_ERROR_NOT_EQUAL(id(), "input batch lower padding", runtime_layout.data_padding.lower_size().batch[0], "", 0, "dynamic batch is not supported for padded batch");
+
+    // Kernels are compiled for the full batch, so data always has to land in the buffer allocated by the network.
+    mem_lock<char> src(&mem);
+    mem_lock<char> dst(_network_buffer);
+    std::copy(src.begin(), src.end(), dst.begin());
+    _output = _network_buffer;
+
+    _has_valid_input = true;
+    _output_changed = true;
 }
 
 void input_layout_inst::set_data(memory_impl& mem)
 {
+    if (node.get_program().get_options().get<build_option_type::dynamic_batch>()->enabled() &&
+        mem.get_layout().size.batch[0] < node.get_output_layout().size.batch[0])
+    {
+        set_data_with_smaller_batch(mem);
+        return;
+    }
+
 
     CLDNN_ERROR_LAYOUT_MISMATCH("input layout", "memory layout", mem.get_layout(), "output memory layout", node.get_output_layout(), "");
 
@@ -19,6 +19,7 @@
 
 #include "program_node.h"
 #include "program_impl.h"
+#include "build_profiler.h"
 
 #include "training_params.h"
 
@@ -414,6 +415,47 @@ void set_params(const program_node& node, kernel_selector::params& params)
     params.engineInfo.hostVersion = to_host_version(cldnn::get_version());
 }
 
+void convert_fused_primitives(const program_node& node, std::vector<kernel_selector::fused_operation_desc>& fused_ops)
+{
+    for (const auto& desc : node.get_fused_primitives())
+    {
+        kernel_selector::fused_operation_desc op;
+        switch (desc.type)
+        {
+        case fused_primitive_desc::op_type::activation:
+            op.type = kernel_selector::fused_op_type::ACTIVATION;
+            op.activation.function = get_kernel_selector_activation_param(desc.activation_func);
+            op.activation.m = desc.activation_params.a;
+            op.activation.n = desc.activation_params.b;
+            break;
+        case fused_primitive_desc::op_type::scale:
+            op.type = kernel_selector::fused_op_type::SCALE;
+            break;
+        case fused_primitive_desc::op_type::eltwise:
+            op.type = kernel_selector::fused_op_type::ELTWISE;
+            switch (desc.mode)
+            {
+            case eltwise_mode::sum:  op.mode = kernel_selector::eltwise_mode::ADD; break;
+            case eltwise_mode::sub:  op.mode = kernel_selector::eltwise_mode::SUB; break;
+            case eltwise_mode::prod: op.mode = kernel_selector::eltwise_mode::MUL; break;
+            case eltwise_mode::div:  op.mode = kernel_selector::eltwise_mode::DIV; break;
+            case eltwise_mode::min:  op.mode = kernel_selector::eltwise_mode::MIN; break;
+            case eltwise_mode::max:  op.mode = kernel_selector::eltwise_mode::MAX; break;
+            default:
+                throw std::runtime_error("Unsupported eltwise mode in fused primitive " + desc.id);
+            }
+            break;
+        default:
+            throw std::runtime_error("Unsupported fused primitive " + desc.id);
+        }
+
+        for (const auto& mem : desc.inputs)
+            op.tensors.push_back(convert_data_tensor(mem->get_layout()));
+
+        fused_ops.push_back(op);
+    }
+}
+
 void set_learning_params(const program_node& node, kernel_selector::training_params& params, bool use_momentum)
 {
     const auto learning_params = node.get_program().get_options().template get<build_option_type::learning_config>()->params;
@@ -427,6 +469,29 @@ void set_learning_params(const program_node& node, kernel_selector::training_par
     params.weights_decay = learning_params.weights_decay;
 }
 
+namespace
+{
+    // records implementations tried by the kernel selector under the node which is currently selected, with the JIT
+    // generation done by each of them (shown at the beginning of the implementation, as it is spread over it)
+    class build_profiler_observer : public kernel_selector::KernelSelectionObserver
+    {
+    public:
+        explicit build_profiler_observer(cldnn::build_profiler& profiler) : _profiler(profiler) {}
+
+        void ImplementationTried(const std::string& implementation, std::chrono::nanoseconds time, std::chrono::nanoseconds jit_time) override
+        {
+            auto end = cldnn::build_profiler::clock::now();
+            auto start = end - std::chrono::duration_cast<cldnn::build_profiler::clock::duration>(time);
+            auto name = _profiler.get_current_scope() + "/" + implementation;
+            _profiler.add("jit_generation", name, start, start + std::chrono::duration_cast<cldnn::build_profiler::clock::duration>(jit_time));
+            _profiler.add("implementation", std::move(name), start, end);
+        }
+
+    private:
+        cldnn::build_profiler& _profiler;
+    };
+}
+
 void set_optional_params(const program_impl& program, kernel_selector::optional_params& params)
 {
     const auto& context = program.get_engine().get_context();
@@ -435,8 +500,12 @@ void set_optional_params(const program_impl& program, kernel_selector::optional_
     params.allowStaticInputReordering = program.get_options().get<build_option_type::optimize_data>()->enabled();
     params.allowInputReordering = false;
     params.allowOutputReordering = false;
+    params.shapeAgnosticKernels = program.get_options().get<build_option_type::shape_agnostic_kernels>()->enabled();
 
     const auto& tuning_config = program.get_options().get<build_option_type::tuning_config>();
     params.tuningParams.mode = to_tuning_mode(tuning_config->config.mode);
     params.tuningParams.cacheFilePath = tuning_config->config.cache_file_path;
+
+    if (program.get_build_profiler())
+        params.selectionObserver = std::make_shared<build_profiler_observer>(*program.get_build_profiler());
 }
\ No newline at end of file
@@ -0,0 +1,458 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "layout_conversion.h"
+#include "api_impl.h"
+#include "cpu/thread_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#ifdef OPENMP_FOUND
+#include <omp.h>
+#endif
+
+namespace cldnn
+{
+namespace
+{
+    // dimensions are indexed the same way as in tensor: b, f, x, y, z
+    const size_t dims_count = 5;
+    using dims_t = std::array<int32_t, dims_count>;
+
+    dims_t get_dims(const tensor& t)
+    {
+        return{ { t.batch[0], t.feature[0], t.spatial[0], t.spatial[1], t.spatial[2] } };
+    }
+
+    size_t dim_index(char c)
+    {
+        switch (c)
+        {
+        case 'b': return 0;
+        case 'f': return 1;
+        case 'x': return 2;
+        case 'y': return 3;
+        case 'z': return 4;
+        default: throw std::invalid_argument(std::string("layout conversion: unsupported dimension '") + c + "'");
+        }
+    }
+
+    // Blocked formats handled by the conversion. Dimension order of the outer blocks comes from format_traits,
+    // the block of @p dim is stored innermost. Formats with @p split == false only align @p dim to @p size.
+    struct blocking
+    {
+        char dim;
+        int32_t size;
+        bool split;
+    };
+
+    const std::map<format::type, blocking>& blocked_formats()
+    {
+        static const std::map<format::type, blocking> formats
+        {
+            { format::bfyx_f16,      { 'f', 16, true } },
+            { format::b_fs_yx_fsv4,  { 'f', 4,  true } },
+            { format::fs_b_yx_fsv32, { 'f', 32, true } },
+            { format::os_iyx_osv16,  { 'b', 16, true } },
+            { format::os_iyx_osv32,  { 'b', 32, true } },
+            { format::os_iyx_osv64,  { 'b', 64, true } },
+            { format::byxf_af32,     { 'f', 32, false } },
+        };
+        return formats;
+    }
+
+    bool is_plain_format(format fmt)
+    {
+        return fmt == format::bfyx || fmt == format::byxf || fmt == format::yxfb || fmt == format::fyxb || fmt == format::bfzyx;
+    }
+
+    // Offsets of every coordinate of each dimension. Offset of an element is a sum of entries of its coordinates,
+    // which holds for plain formats and for formats blocked along a single dimension.
+    using offset_tables = std::array<std::vector<size_t>, dims_count>;
+
+    offset_tables make_offset_tables(const layout& l)
+    {
+        const auto fmt = l.format;
+        const auto block_itr = blocked_formats().find(fmt);
+        const bool blocked = block_itr != blocked_formats().end();
+        if (!blocked && !is_plain_format(fmt))
+            throw std::invalid_argument("layout conversion: format is not supported");
+
+        const auto size = get_dims(l.size);
+        const auto lower = get_dims(l.data_padding.lower_size());
+        const auto upper = get_dims(l.data_padding.upper_size());
+
+        dims_t extent;
+        for (size_t d = 0; d < dims_count; ++d)
+            extent[d] = lower[d] + size[d] + upper[d];
+
+        size_t block_dim = dims_count;
+        int32_t block_size = 1;
+        if (blocked)
+        {
+            block_dim = dim_index(block_itr->second.dim);
+            extent[block_dim] = align_to(extent[block_dim], block_itr->second.size);
+            if (block_itr->second.split)
+                block_size = block_itr->second.size;
+        }
+
+        const auto& order = fmt.order();
+        std::array<size_t, dims_count> pitches{};
+        std::array<bool, dims_count> in_order{};
+        size_t pitch = static_cast<size_t>(block_size);
+        for (auto itr = order.rbegin(); itr != order.rend(); ++itr)
+        {
+            auto d = dim_index(*itr);
+            in_order[d] = true;
+            pitches[d] = pitch;
+            pitch *= static_cast<size_t>(d == block_dim ? extent[d] / block_size : extent[d]);
+        }
+
+        offset_tables tables;
+        for (size_t d = 0; d < dims_count; ++d)
+        {
+            if (!in_order[d] && extent[d] != 1)
+                throw std::invalid_argument("layout conversion: size does not match the number of format dimensions");
+
+            tables[d].resize(static_cast<size_t>(size[d]));
+            for (int32_t i = 0; i < size[d]; ++i)
+            {
+                auto p = static_cast<size_t>(i + lower[d]);
+                tables[d][i] = d == block_dim && block_size > 1
+                    ? (p / block_size) * pitches[d] + p % block_size
+                    : p * pitches[d];
+            }
+        }
+        return tables;
+    }
+
+    bool is_contiguous(const std::vector<size_t>& table)
+    {
+        for (size_t i = 1; i < table.size(); ++i)
+        {
+            if (table[i] != table[0] + i)
+                return false;
+        }
+        return true;
+    }
+
+    // floating point values are rounded to nearest even and saturated, like in quantizing device reorders
+    // (a plain cast of an out of range value is undefined)
+    template <typename DstT, typename SrcT>
+    typename std::enable_if<std::is_floating_point<SrcT>::value && std::is_integral<DstT>::value, DstT>::type
+        saturate_cast(SrcT v)
+    {
+        if (std::isnan(v))
+            return 0;
+        const auto rounded = std::nearbyint(v);
+        if (rounded <= static_cast<SrcT>(std::numeric_limits<DstT>::lowest()))
+            return std::numeric_limits<DstT>::lowest();
+        if (rounded >= static_cast<SrcT>(std::numeric_limits<DstT>::max()))
+            return std::numeric_limits<DstT>::max();
+        return static_cast<DstT>(rounded);
+    }
+
+    // narrowing integral values are saturated as well (e.g. i32 -> u8), instead of wrapping around
+    template <typename DstT, typename SrcT>
+    typename std::enable_if<std::is_integral<SrcT>::value && std::is_integral<DstT>::value, DstT>::type
+        saturate_cast(SrcT v)
+    {
+        const bool negative = std::is_signed<SrcT>::value && static_cast<intmax_t>(v) < 0;
+        if (negative)
+        {
+            if (!std::is_signed<DstT>::value)
+                return 0;
+            if (static_cast<intmax_t>(v) < static_cast<intmax_t>(std::numeric_limits<DstT>::lowest()))
+                return std::numeric_limits<DstT>::lowest();
+        }
+        else if (static_cast<uintmax_t>(v) > static_cast<uintmax_t>(std::numeric_limits<DstT>::max()))
+        {
+            return std::numeric_limits<DstT>::max();
+        }
+        return static_cast<DstT>(v);
+    }
+
+    template <typename DstT, typename SrcT>
+    typename std::enable_if<!std::is_integral<DstT>::value, DstT>::type
+        saturate_cast(SrcT v)
+    {
+        return static_cast<DstT>(v);
+    }
+
+    // fp16 values are stored as uint16_t, no other data type uses it
+    template <typename SrcT, typename DstT>
+    struct value_cast
+    {
+        static DstT apply(SrcT v) { return saturate_cast<DstT>(v); }
+    };
+
+    template <typename DstT>
+    struct value_cast<uint16_t, DstT>
+    {
+        static DstT apply(uint16_t v) { return saturate_cast<DstT>(half_to_float(v)); }
+    };
+
+    template <typename SrcT>
+    struct value_cast<SrcT, uint16_t>
+    {
+        static uint16_t apply(SrcT v) { return float_to_half(static_cast<float>(v)); }
+    };
+
+    template <>
+    struct value_cast<uint16_t, uint16_t>
+    {
+        static uint16_t apply(uint16_t v) { return v; }
+    };
+
+    template <typename SrcT, typename DstT>
+    void convert_run(const SrcT* src, DstT* dst, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            dst[i] = value_cast<SrcT, DstT>::apply(src[i]);
+    }
+
+    template <typename T>
+    void convert_run(const T* src, T* dst, size_t count)
+    {
+        std::memcpy(dst, src, count * sizeof(T));
+    }
+
+    void convert_run(const float* src, uint16_t* dst, size_t count)
+    {
+        float_to_half(src, dst, count);
+    }
+
+    void convert_run(const uint16_t* src, float* dst, size_t count)
+    {
+        half_to_float(src, dst, count);
+    }
+
+    struct conversion_plan
+    {
+        offset_tables src;
+        offset_tables dst;
+        dims_t size;
+        // dimension written contiguously into the destination
+        size_t inner;
+        // dimension read contiguously from the source, if it differs from inner the copy is done in tiles
+        size_t tiled;
+        // remaining dimensions, from the outermost one
+        std::vector<size_t> outer;
+        bool contiguous_run;
+    };
+
+    size_t fastest_dim(const offset_tables& tables, const dims_t& size)
+    {
+        size_t result = dims_count;
+        size_t best_pitch = 0;
+        for (size_t d = 0; d < dims_count; ++d)
+        {
+            if (size[d] < 2)
+                continue;
+            auto pitch = tables[d][1] - tables[d][0];
+            if (result == dims_count || pitch < best_pitch)
+            {
+                result = d;
+                best_pitch = pitch;
+            }
+        }
+        return result == dims_count ? 0 : result;
+    }
+
+    conversion_plan make_plan(const layout& src_layout, const layout& dst_layout)
+    {
+        conversion_plan plan;
+        plan.src = make_offset_tables(src_layout);
+        plan.dst = make_offset_tables(dst_layout);
+        plan.size = get_dims(src_layout.size);
+        plan.inner = fastest_dim(plan.dst, plan.size);
+        plan.tiled = fastest_dim(plan.src, plan.size);
+        if (plan.tiled == plan.inner || plan.size[plan.tiled] < 2)
+            plan.tiled = dims_count;
+
+        std::vector<size_t> outer;
+        for (size_t d = 0; d < dims_count; ++d)
+        {
+            if (d != plan.inner && d != plan.tiled)
+                outer.push_back(d);
+        }
+        // outer loops go from the largest destination pitch
+        std::sort(outer.begin(), outer.end(), [&](size_t a, size_t b)
+        {
+            auto pitch = [&](size_t d) { return plan.size[d] > 1 ? plan.dst[d][1] - plan.dst[d][0] : 0; };
+            return pitch(a) > pitch(b);
+        });
+        plan.outer = outer;
+        plan.contiguous_run = plan.tiled == dims_count && is_contiguous(plan.src[plan.inner]) && is_contiguous(plan.dst[plan.inner]);
+        return plan;
+    }
+
+    template <typename SrcT, typename DstT>
+    void convert_typed(const conversion_plan& plan, const void* src_ptr, void* dst_ptr, cpu::thread_pool* pool)
+    {
+        const auto* src = static_cast<const SrcT*>(src_ptr);
+        auto* dst = static_cast<DstT*>(dst_ptr);
+
+        const auto& inner_src = plan.src[plan.inner];
+        const auto& inner_dst = plan.dst[plan.inner];
+        const size_t inner_size = static_cast<size_t>(plan.size[plan.inner]);
+        const size_t tiled_size = plan.tiled == dims_count ? 1 : static_cast<size_t>(plan.size[plan.tiled]);
+        const size_t tile = 16;
+
+        int64_t outer_count = 1;
+        for (auto d : plan.outer)
+            outer_count *= plan.size[d];
+
+        auto convert_outer = [&](int64_t idx)
+        {
+            size_t src_base = 0;
+            size_t dst_base = 0;
+            auto rest = idx;
+            for (auto itr = plan.outer.rbegin(); itr != plan.outer.rend(); ++itr)
+            {
+                auto d = *itr;
+                auto c = static_cast<size_t>(rest % plan.size[d]);
+                rest /= plan.size[d];
+                src_base += plan.src[d][c];
+                dst_base += plan.dst[d][c];
+            }
+
+            if (plan.contiguous_run)
+            {
+                convert_run(src + src_base + inner_src[0], dst + dst_base + inner_dst[0], inner_size);
+            }
+            else if (plan.tiled == dims_count)
+            {
+                for (size_t i = 0; i < inner_size; ++i)
+                    dst[dst_base + inner_dst[i]] = value_cast<SrcT, DstT>::apply(src[src_base + inner_src[i]]);
+            }
+            else
+            {
+                // transposition: walk tiles so both source and destination lines stay in cache
+                const auto& tiled_src = plan.src[plan.tiled];
+                const auto& tiled_dst = plan.dst[plan.tiled];
+                for (size_t i0 = 0; i0 < inner_size; i0 += tile)
+                {
+                    const size_t i1 = std::min(inner_size, i0 + tile);
+                    for (size_t j = 0; j < tiled_size; ++j)
+                    {
+                        const size_t s = src_base + tiled_src[j];
+                        const size_t t = dst_base + tiled_dst[j];
+                        for (size_t i = i0; i < i1; ++i)
+                            dst[t + inner_dst[i]] = value_cast<SrcT, DstT>::apply(src[s + inner_src[i]]);
+                    }
+                }
+            }
+        };
+
+        // small conversions are not worth waking up other threads
+        const bool parallel = outer_count > 1 && outer_count * inner_size * tiled_size > 64 * 1024;
+        if (pool != nullptr && parallel)
+        {
+            pool->parallel_for(static_cast<size_t>(outer_count), [&](size_t idx) { convert_outer(static_cast<int64_t>(idx)); });
+            return;
+        }
+
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for if (parallel)
+#endif
+        for (int64_t idx = 0; idx < outer_count; ++idx)
+            convert_outer(idx);
+    }
+
+    template <typename SrcT>
+    void convert_to(data_types dst_type, const conversion_plan& plan, const void* src, void* dst, cpu::thread_pool* pool)
+    {
+        switch (dst_type)
+        {
+        case data_types::f32: return convert_typed<SrcT, float>(plan, src, dst, pool);
+        case data_types::f16: return convert_typed<SrcT, uint16_t>(plan, src, dst, pool);
+        case data_types::i8: return convert_typed<SrcT, int8_t>(plan, src, dst, pool);
+        case data_types::u8: return convert_typed<SrcT, uint8_t>(plan, src, dst, pool);
+        case data_types::i32: return convert_typed<SrcT, int32_t>(plan, src, dst, pool);
+        case data_types::i64: return convert_typed<SrcT, int64_t>(plan, src, dst, pool);
+        default: throw std::invalid_argument("layout conversion: unsupported destination data type");
+        }
+    }
+}
+
+bool is_host_convertible(const layout& l)
+{
+    if (!is_plain_format(l.format) && blocked_formats().count(l.format) == 0)
+        return false;
+
+    const auto& order = l.format.order();
+    const auto lower = get_dims(l.data_padding.lower_size());
+    const auto upper = get_dims(l.data_padding.upper_size());
+    const auto size = get_dims(l.size);
+    for (size_t d = 0; d < dims_count; ++d)
+    {
+        const char c = "bfxyz"[d];
+        if (order.find(c) == std::string::npos && lower[d] + size[d] + upper[d] != 1)
+            return false;
+    }
+    return true;
+}
+
+void convert_layout(const layout& src_layout, const void* src, const layout& dst_layout, void* dst)
+{
+    convert_layout(src_layout, src, dst_layout, dst, true);
+}
+
+void convert_layout(const layout& src_layout, const void* src, const layout& dst_layout, void* dst, bool fill_padding, cpu::thread_pool* pool)
+{
+    if (src_layout.size != dst_layout.size)
+        throw std::invalid_argument("layout conversion: source and destination sizes differ");
+    if (src_layout.count() == 0)
+        return;
+    if (src == nullptr || dst == nullptr)
+        throw std::invalid_argument("layout conversion: null buffer");
+
+    const bool dst_padded = dst_layout.get_linear_size() != dst_layout.count();
+    if (src_layout == dst_layout && (fill_padding || !dst_padded))
+    {
+        std::memcpy(dst, src, src_layout.bytes_count());
+        return;
+    }
+
+    const auto plan = make_plan(src_layout, dst_layout);
+
+    // padding and alignment of the destination is not covered by the copy below
+    if (fill_padding && dst_padded)
+        std::memset(dst, 0, dst_layout.bytes_count());
+
+    switch (src_layout.data_type)
+    {
+    case data_types::f32: return convert_to<float>(dst_layout.data_type, plan, src, dst, pool);
+    case data_types::f16: return convert_to<uint16_t>(dst_layout.data_type, plan, src, dst, pool);
+    case data_types::i8: return convert_to<int8_t>(dst_layout.data_type, plan, src, dst, pool);
+    case data_types::u8: return convert_to<uint8_t>(dst_layout.data_type, plan, src, dst, pool);
+    case data_types::i32: return convert_to<int32_t>(dst_layout.data_type, plan, src, dst, pool);
+    case data_types::i64: return convert_to<int64_t>(dst_layout.data_type, plan, src, dst, pool);
+    default: throw std::invalid_argument("layout conversion: unsupported source data type");
+    }
+}
+}
@@ -27,6 +27,10 @@
 
 #include "eltwise_inst.h"
 #include "pooling_inst.h"
+#include "activation_inst.h"
+#include "scale_inst.h"
+#include "program_impl.h"
+#include "format_assignment.h"
 
 using namespace cldnn;
 
@@ -55,6 +59,18 @@ namespace {
     {
         return ((value > 0) && !(value & (value - 1)));
     }
+
+    //rough ratio of arithmetic throughput to memory bandwidth, expresses convolution work in bytes moved by a reorder
+    const float conv_macs_per_byte = 16.0f;
+    //estimated slowdown of a convolution which runs in the format not preferred by convolution_bfyx_opt
+    const float non_preferred_format_penalty = 1.5f;
+
+    //primitives which produce output in the format of their first input
+    bool is_format_transparent(program_node const& node)
+    {
+        return node.type() == cldnn::activation::type_id() || node.type() == cldnn::eltwise::type_id() ||
+            node.type() == cldnn::pooling::type_id() || node.type() == cldnn::scale::type_id();
+    }
 }
 
 layout_optimizer::layout_optimizer(bool output_size_handling_enabled)
@@ -248,6 +264,11 @@ layout layout_optimizer::get_expected_layout(layout const& current_layout, data_
             expected_tensor = current_layout.size;
             expected_format = current_layout.format;//cldnn::format::byxf_af32;
         }
+        else if (_selected_input_formats.count(node.id()) != 0)
+        {
+            expected_tensor = current_layout.size;
+            expected_format = _selected_input_formats.at(node.id());
+        }
         else if (layout_optimizer::convolution_bfyx_opt(current_layout, output_or_weights_layout, prim)
             || (_output_size_handling_enabled && prim->with_output_size) ||
             node.get_transposed())
@@ -533,3 +554,71 @@ bool layout_optimizer::is_format_optimized(const convolution_node& node, const f
         throw std::invalid_argument("[Layout optimizer] Other formats in is_format_optimized(...) method are not implemented!");
     }
 }
+
+void layout_optimizer::select_convolution_input_formats(program_impl& p)
+{
+    _selected_input_formats.clear();
+
+    format_assignment assignment;
+    std::map<program_node const*, size_t> assignment_nodes;
+    std::vector<convolution_node const*> convolutions;
+
+    for (auto node : p.get_processing_order())
+    {
+        if (node->type() != cldnn::convolution::type_id())
+            continue;
+
+        auto& conv = node->as<convolution>();
+        auto prim = conv.get_primitive();
+        auto input_layout = conv.input().get_output_layout();
+        auto weights_layout = conv.weights(0).get_output_layout();
+
+        //only convolutions which are free to use both bfyx and yxfb take part, other formats are chosen for performance
+        //reasons which outweigh reorders (or are required by the kernels)
+        if ((input_layout.data_type != data_types::f32 && input_layout.data_type != data_types::f16) ||
+            (input_layout.format != format::bfyx && input_layout.format != format::yxfb) ||
+            (_output_size_handling_enabled && prim->with_output_size) ||
+            conv.get_transposed() ||
+            _optimization_attributes.bfyx_only_layer)
+            continue;
+
+        auto preferred = get_expected_layout(input_layout, data_type::input, conv, weights_layout).format;
+        if (preferred != format::bfyx && preferred != format::yxfb)
+            continue;
+
+        auto other = preferred == format::bfyx ? format::yxfb : format::bfyx;
+        auto macs = static_cast<float>(conv.get_output_layout().count()) *
+            static_cast<float>(weights_layout.count() / std::max(weights_layout.size.batch[0], 1));
+        auto conv_cost = macs / conv_macs_per_byte;
+        auto idx = assignment.add_node({ { preferred, conv_cost }, { other, conv_cost * non_preferred_format_penalty } });
+        assignment_nodes[&conv] = idx;
+        convolutions.push_back(&conv);
+
+        //reorder reads and writes whole input
+        auto reorder_cost = 2.0f * static_cast<float>(input_layout.bytes_count());
+
+        //reorder which is direct input of convolution gets its output format changed instead of adding another one
+        if (conv.input().type() == cldnn::reorder::type_id())
+            continue;
+
+        auto source = &conv.input();
+        while (is_format_transparent(*source))
+            source = &source->get_dependency(0);
+
+        auto source_node = assignment_nodes.find(source);
+        if (source_node != assignment_nodes.end())
+            assignment.add_edge(source_node->second, idx, reorder_cost);
+        else
+            assignment.add_fixed_input(idx, source->get_output_layout().format, reorder_cost);
+    }
+
+    if (convolutions.empty())
+        return;
+
+    auto choice = assignment.solve();
+    for (auto conv : convolutions)
+    {
+        auto idx = assignment_nodes.at(conv);
+        _selected_input_formats.emplace(conv->id(), assignment.get_format(idx, choice[idx]));
+    }
+}
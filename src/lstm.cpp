@@ -34,7 +34,8 @@ layout lstm_inst::calc_output_layout(lstm_node const& node)
     assert((bool)node.get_primitive()->get_output_data_type() == false
            && "Output data type forcing is not supported for lstm_node!");
     auto input_layout = node.input().get_output_layout();
-    auto hidden_layout = node.inital_hidden().get_output_layout();
+    auto recurrent_layout = node.recurrent().get_output_layout();
+    auto desc = node.get_primitive();
 
     // input     = [ batch,  sequence,       direction,      input_size ]
     // weights   = [     1, direction, 4 * hidden_size,      input_size ]
@@ -43,9 +44,19 @@ layout lstm_inst::calc_output_layout(lstm_node const& node)
     // hidden    = [ batch,         1,       direction,     hidden_size ]
     // cell      = [ batch,         1,       direction,     hidden_size ]
     // output    = [ batch,  sequence,       direction,     hidden_size ]
-	auto result = layout(input_layout.data_type, format::bfyx,
-                  tensor(hidden_layout.size.feature[0], input_layout.size.feature[0],
-                         hidden_layout.size.spatial[0], hidden_layout.size.spatial[1]));
+    // Only the last hidden state is stored if the sequence is not requested, the last cell state is appended
+    // along the sequence axis.
+    bool emit_sequence = desc->output_selection == cldnn_lstm_output_sequence ||
+                         desc->output_selection == cldnn_lstm_output_sequence_cell;
+    bool emit_last_cell = desc->output_selection == cldnn_lstm_output_hidden_cell ||
+                          desc->output_selection == cldnn_lstm_output_sequence_cell;
+    int32_t sequence_len = node.sequence_len() > 1 ? static_cast<int32_t>(node.sequence_len())
+                                                   : input_layout.size.feature[0];
+    int32_t output_len = (emit_sequence ? sequence_len : 1) + (emit_last_cell ? 1 : 0);
+
+    auto result = layout(input_layout.data_type, format::bfyx,
+                  tensor(input_layout.size.batch[0], output_len,
+                         recurrent_layout.size.spatial[0], recurrent_layout.size.feature[0]));
     return result;
 }
 
@@ -27,6 +27,7 @@
 #include "program_node.h"
 
 #include "gpu/memory_gpu.h"
+#include "cpu/host_memory.h"
 namespace cldnn
 {
     memory_record::memory_record(memory_set users, refcounted_obj_ptr<memory_impl>& memory, uint32_t net_id) :
@@ -37,23 +38,32 @@ namespace cldnn
 
     memory_impl::ptr memory_pool::alloc_memory(const layout& layout, resource_flags flags, memory_impl::ptr to_copy)
     {
-        auto context = _engine->get_context();
-        
-        if (layout.bytes_count() > context->get_engine_info().max_alloc_mem_size)
+        const auto& engine_info = _engine->get_engine_info();
+
+        if (layout.bytes_count() > engine_info.max_alloc_mem_size)
         {
             throw error("exceeded max size of memory object allocation", CLDNN_ALLOC_SIZE_EXCEEDED);
         }
 
         add_memory_used(layout.bytes_count());
 
-        if (_max_peak_memory_used > context->get_engine_info().max_global_mem_size)
+        if (_max_peak_memory_used > engine_info.max_global_mem_size)
         {
             throw error("exceeded global device memory", CLDNN_GLOBAL_SIZE_EXCEEDED);
         }
 
+        if (_engine->type() == engine_types::cpu)
+        {
+            if (to_copy != nullptr)
+                return{ new cpu::host_memory(_engine, *to_copy), false };
+            return{ new cpu::host_memory(_engine, layout), false };
+        }
+
         try {
             if (layout.format.is_image_2d())
                 return{ new gpu::gpu_image2d(_engine, layout), false };
+            else if (resource_flags::NONE != (flags & resource_flags::HOST_PINNED))
+                return{ new gpu::gpu_host_buffer(_engine, layout), false };
             else
             {
                 if (to_copy != nullptr)
@@ -184,6 +194,11 @@ namespace cldnn
         return alloc_memory(layout, resource_flags::NONE, nullptr);
     }
 
+    memory_impl::ptr memory_pool::get_memory(const layout& layout, resource_flags flags)
+    {
+        return alloc_memory(layout, flags, nullptr);
+    }
+
     memory_impl::ptr memory_pool::alloc_and_copy_memory(memory_impl::ptr src, resource_flags flags)
     {
         return alloc_memory(src->get_layout(), flags, src);
@@ -29,6 +29,7 @@
 #include "condition_inst.h"
 #include "kernel_selector_helper.h"
 #include <algorithm>
+#include <limits>
 
 #include "gpu/ocl_toolkit.h"
 
@@ -53,6 +54,16 @@ network_impl::network_impl(const program_impl& program, bool is_internal)
     build_exec_order();
     validate_primitives();
     _program->dump_memory_pool();
+
+    if (!_internal && get_engine().configuration().enable_profiling)
+        create_profiler();
+
+    for (auto const& input : _inputs)
+    {
+        if (input->type() == input_layout::type_id())
+            _max_batch = std::max(_max_batch, std::static_pointer_cast<const input_layout>(input->desc())->layout.size.batch[0]);
+    }
+    _batch = _max_batch;
 }
 
 network_impl::network_impl(engine_impl& engine, const topology_impl& topo, const build_options& options, bool is_internal)
@@ -65,6 +76,11 @@ network_impl::network_impl(engine_impl& engine, const std::set<std::shared_ptr<p
 {
 }
 
+network_impl::~network_impl()
+{
+    release_profiled_events();
+}
+
 void network_impl::validate_primitives()
 {
     for (auto const& prim : _exec_order)
@@ -76,13 +92,12 @@ void network_impl::validate_primitives()
 
 void network_impl::reset_execution(bool wait)
 {
-    if (wait && _events.size() > 0)
+    if (wait)
     {
         std::vector<event_impl::ptr> events;
-        for (auto& pair : _events)
+        for (auto& ev : _events)
         {
-            auto& ev = pair.second;
-            if (ev->is_set())
+            if (!ev || ev->is_set())
                 continue;
 
             events.push_back(ev);
@@ -90,7 +105,7 @@ void network_impl::reset_execution(bool wait)
 
         get_engine().wait_for_events(events);
     }
-    _events.clear();
+    std::fill(_events.begin(), _events.end(), nullptr);
 }
 
 void network_impl::set_input_data(const primitive_id& id, memory_impl& data)
@@ -112,6 +127,79 @@ void network_impl::set_input_data(const primitive_id& id, memory_impl& data)
     //Wait for previous execution completion
     reset_execution(true);
     input->set_data(data);
+
+    if (_program->get_options().get<build_option_type::dynamic_batch>()->enabled() &&
+        std::static_pointer_cast<const input_layout>(input->desc())->layout.size.batch[0] == _max_batch)
+    {
+        _batch = data.get_layout().size.batch[0];
+    }
+}
+
+refcounted_obj_ptr<memory_impl> network_impl::get_output_memory(const primitive_id& id)
+{
+    return get_runtime_memory(*get_primitive(id));
+}
+
+size_t network_impl::get_output_handle(const primitive_id& id) const
+{
+    auto output = std::find_if(_outputs.begin(), _outputs.end(),
+        [&](const std::shared_ptr<primitive_inst>& inst) { return inst->id() == id; });
+    if (output == _outputs.end())
+        throw std::runtime_error("primitive " + id + " is not an output of the network");
+
+    return static_cast<size_t>(std::distance(_outputs.begin(), output));
+}
+
+refcounted_obj_ptr<memory_impl> network_impl::get_output_memory(size_t handle)
+{
+    if (handle >= _outputs.size())
+        throw std::out_of_range("invalid network output handle");
+
+    return get_runtime_memory(*_outputs[handle]);
+}
+
+const event_impl::ptr& network_impl::get_output_event(size_t handle) const
+{
+    if (handle >= _outputs.size())
+        throw std::out_of_range("invalid network output handle");
+
+    return get_primitive_event(*_outputs[handle]);
+}
+
+const event_impl::ptr& network_impl::get_primitive_event(const primitive_id& id) const
+{
+    auto prim = _primitives.find(id);
+    if (prim == _primitives.end())
+        throw std::out_of_range("primitive " + id + " is not a part of the network");
+    return get_primitive_event(*prim->second);
+}
+
+const event_impl::ptr& network_impl::get_primitive_event(const primitive_inst& inst) const
+{
+    const auto& ev = _events[inst.get_event_index()];
+    if (!ev)
+        throw std::out_of_range("primitive " + inst.id() + " has not been executed");
+    return ev;
+}
+
+refcounted_obj_ptr<memory_impl> network_impl::get_runtime_memory(primitive_inst& inst)
+{
+    auto& mem = inst.output_memory();
+    if (_batch == _max_batch || !inst.has_dynamic_batch())
+        return &mem;
+
+    // Only outputs which carry the network batch are trimmed; batches past the runtime one hold stale data.
+    auto runtime_layout = mem.get_layout();
+    if (runtime_layout.size.batch[0] != _max_batch ||
+        !input_layout_inst::is_batch_outermost(runtime_layout.format) ||
+        runtime_layout.data_padding.lower_size().batch[0] != 0 ||
+        !mem.is_allocated_by(get_engine()))
+    {
+        return &mem;
+    }
+
+    runtime_layout.size.batch[0] = _batch;
+    return get_engine().reinterpret_buffer(mem, runtime_layout);
 }
 
 void cldnn::network_impl::check_names()
@@ -124,6 +212,11 @@ void cldnn::network_impl::check_names()
     }
 }
 
+bool network_impl::set_output_memory(const primitive_id& id, memory_impl& mem)
+{
+    return _outputs[get_output_handle(id)]->set_output_memory(mem);
+}
+
 std::shared_ptr<primitive_inst> cldnn::network_impl::find_primitive(const primitive_id& id)
 {
     std::shared_ptr<primitive_inst> ret;
@@ -207,6 +300,52 @@ void network_impl::build_exec_order()
             add_to_exec_order(node->id());
         }
     }
+
+    // executed primitives get events at their execution order positions, the remaining ones follow
+    const auto not_executed = std::numeric_limits<size_t>::max();
+    for (auto& prim : _primitives)
+        prim.second->set_event_index(not_executed);
+    size_t event_index = 0;
+    for (auto& inst : _exec_order)
+        inst->set_event_index(event_index++);
+    for (auto& prim : _primitives)
+    {
+        if (prim.second->get_event_index() == not_executed)
+            prim.second->set_event_index(event_index++);
+    }
+    _events.resize(event_index);
+
+    for (auto& node : _program->get_processing_order())
+    {
+        //Special handling for mutable data. The event should be the same as the user or dependency with highest processing_num as
+        //the mutable_data can be updated when is both user or dependency.
+        if (!node->is_type<mutable_data>())
+            continue;
+
+        program_node* source = nullptr;
+        decltype(_program->get_processing_order().get_processing_number(node)) proc_num = 0;
+        for (auto& user : node->get_users())
+        {
+            auto user_proc_num = _program->get_processing_order().get_processing_number(user);
+            if (user_proc_num > proc_num)
+            {
+                source = user;
+                proc_num = user_proc_num;
+            }
+        }
+        for (auto& dep : node->get_dependencies())
+        {
+            auto dep_proc_num = _program->get_processing_order().get_processing_number(dep);
+            if (dep_proc_num > proc_num)
+            {
+                source = dep;
+                proc_num = dep_proc_num;
+            }
+        }
+
+        if (source)
+            _mutable_data_events.push_back({ get_primitive(node->id())->get_event_index(), get_primitive(source->id())->get_event_index() });
+    }
 }
 void network_impl::add_to_exec_order(const primitive_id& id)
 {
@@ -218,47 +357,23 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
 {
     //Wait for previous execution completion
     reset_execution(false);
+    if (_profiler)
+        collect_profiling_info();
 
     for (auto& inst : _exec_order)
     {
         execute_primitive(inst, events);
     }
 
-    for (auto& inst : _program->get_processing_order())
-    {
-        //Special handling for mutable data. The event should be the same as the user or dependency with highest processing_num as
-        //the mutable_data can be updated when is both user or dependency.
-        if (inst->is_type<mutable_data>())
-        {
-            decltype(_program->get_processing_order().get_processing_number(inst)) proc_num = 0;
-            for (auto& user : inst->get_users())
-            {
-                auto user_proc_num = _program->get_processing_order().get_processing_number(user);
-                if (user_proc_num > proc_num)
-                {
-                    _events[inst->id()] = _events[user->id()];
-                    proc_num = user_proc_num;
-                }
-            }
+    for (auto& mutable_data_event : _mutable_data_events)
+        _events[mutable_data_event.first] = _events[mutable_data_event.second];
 
-            if (!inst->get_dependencies().empty())
-            {
-                for (auto& dep : inst->get_dependencies())
-                {
-                    auto dep_proc_num = _program->get_processing_order().get_processing_number(dep);
-                    if (dep_proc_num > proc_num)
-                    {
-                        _events[inst->id()] = _events[dep->id()];
-                        proc_num = dep_proc_num;
-                    }
-                }
-            }
-        }
-    }
+    if (_profiler)
+        retain_profiled_events();
 
     for (auto& dout : _data_outputs) //data primitives are not executed so if they are marked as output we need to add them valid events manually
     {
-        _events[dout->id()] = get_engine().create_user_event(true);
+        _events[dout->get_event_index()] = get_engine().create_user_event(true);
     }
 
     for (auto& prim : _primitives)
@@ -266,7 +381,8 @@ void network_impl::execute(const std::vector<refcounted_obj_ptr<event_impl>>& ev
         prim.second->reset_output_change();
     }
 
-    get_engine().get_context()->reset_events();
+    if (get_engine().get_context())
+        get_engine().get_context()->reset_events();
 
     // Using output of previouse network as input to another one may cause hazard (in OOOQ mode) if user would not 
     // provide proper event to execution. Flushing pipeline should prevent this kind of issues. 
@@ -339,17 +455,70 @@ std::vector<std::shared_ptr<primitive_inst>> network_impl::get_primitives(const
 
 void network_impl::execute_primitive(const std::shared_ptr<primitive_inst>& primitive, const std::vector<refcounted_obj_ptr<event_impl>>& events)
 {
-    auto id = primitive->id();
-    auto it = _events.find(id);
-    bool found = (it != _events.end());
-    CLDNN_ERROR_BOOL(id, "Invalid primitive call ", found, "Primitive " + id + " is tried to be executed for the second time");
+    const auto& id = primitive->id();
+    auto& ev_slot = _events[primitive->get_event_index()];
+    CLDNN_ERROR_BOOL(id, "Invalid primitive call ", !!ev_slot, "Primitive " + id + " is tried to be executed for the second time");
 
+    auto enqueue_start = network_profiler::clock::now();
     event_impl::ptr ev;
-    if (!get_engine().get_context()->enabled_single_kernel() || get_engine().get_context()->single_kernel_name() == id)
+    const auto& context = get_engine().get_context();
+    if (!context || !context->enabled_single_kernel() || context->single_kernel_name() == id)
         ev = primitive->execute(events);
     else
         ev = get_engine().create_user_event(true);
-    _events.insert({ id, ev });
+    ev_slot = ev;
+
+    if (_profiler)
+        _profiler->add_enqueue(primitive->get_event_index(), enqueue_start, network_profiler::clock::now());
+}
+
+void network_impl::create_profiler()
+{
+    _profiler.reset(new network_profiler());
+    for (auto& inst : _exec_order)
+    {
+        auto& node = _program->get_node(inst->id());
+        std::vector<primitive_id> original_ids = { node.get_org_primitive_id() };
+        original_ids.insert(original_ids.end(), node.get_merged_ids().begin(), node.get_merged_ids().end());
+        _profiler->add_primitive(inst->id(), inst->get_impl() ? inst->get_impl()->get_kernel_name() : std::string(), original_ids);
+    }
+}
+
+network_profiler* network_impl::get_profiler()
+{
+    if (_profiler)
+        collect_profiling_info();
+    return _profiler.get();
+}
+
+// events are returned to the engine's pool at the end of the execution, events of a profiled execution are kept out of
+// the pool until their device times are read at the next execution or when statistics are requested, so the execution
+// itself does not wait for the device
+void network_impl::retain_profiled_events()
+{
+    _profiled_events.assign(_events.begin(), _events.begin() + _exec_order.size());
+    for (auto& ev : _profiled_events)
+        ev->set_retained(true);
+}
+
+void network_impl::collect_profiling_info()
+{
+    if (_profiled_events.empty())
+        return;
+
+    get_engine().wait_for_events(_profiled_events);
+    _profiler->add_execution([&](size_t idx) -> const std::list<cldnn_profiling_interval>&
+    {
+        return _profiled_events[idx]->get_profiling_info();
+    });
+    release_profiled_events();
+}
+
+void network_impl::release_profiled_events()
+{
+    for (auto& ev : _profiled_events)
+        ev->set_retained(false);
+    _profiled_events.clear();
 }
 
 void network_impl::allocate_primitive_instance(program_node const& node)
@@ -0,0 +1,232 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include "network_profiler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+
+namespace cldnn
+{
+namespace
+{
+    std::string escape_json(const std::string& str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        for (auto c : str)
+        {
+            if (c == '"' || c == '\\')
+                result += '\\';
+            if (static_cast<unsigned char>(c) < 0x20)
+                continue;
+            result += c;
+        }
+        return result;
+    }
+
+    // fields with separators or quotes are quoted, quotes inside are doubled
+    std::string escape_csv(const std::string& str)
+    {
+        if (str.find_first_of(",\"\r\n") == std::string::npos)
+            return str;
+
+        std::string result = "\"";
+        for (auto c : str)
+        {
+            if (c == '"')
+                result += '"';
+            result += c;
+        }
+        return result + "\"";
+    }
+
+    double to_microseconds(std::chrono::nanoseconds time)
+    {
+        return std::chrono::duration<double, std::micro>(time).count();
+    }
+
+    // nearest-rank percentile of sorted values
+    std::chrono::nanoseconds percentile(const std::vector<std::chrono::nanoseconds>& sorted, double p)
+    {
+        if (sorted.empty())
+            return std::chrono::nanoseconds(0);
+        auto rank = static_cast<size_t>(std::ceil(p * sorted.size()));
+        return sorted[std::min(std::max<size_t>(rank, 1), sorted.size()) - 1];
+    }
+}
+
+void network_profiler::add_primitive(const primitive_id& id, std::string kernel_name, const std::vector<primitive_id>& original_ids)
+{
+    std::string ids;
+    for (auto& original_id : original_ids)
+        ids += (ids.empty() ? "" : ",") + original_id;
+
+    _primitives.push_back({ id, std::move(kernel_name), std::move(ids), 0, 0,
+        std::chrono::nanoseconds::max(), std::chrono::nanoseconds(0), std::chrono::nanoseconds(0), {}, 0 });
+}
+
+void network_profiler::add_enqueue(size_t primitive_idx, clock::time_point start, clock::time_point end)
+{
+    auto& prim = _primitives.at(primitive_idx);
+    sample s{ _executions,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(start - _start),
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start),
+        std::chrono::nanoseconds(0), std::chrono::nanoseconds(0), false };
+
+    prim.count++;
+    prim.enqueue_total += s.enqueue;
+
+    auto slot = prim.next_sample;
+    if (slot < prim.samples.size())
+        prim.samples[slot] = s;
+    else
+        prim.samples.push_back(s);
+    prim.next_sample = (slot + 1) % max_kept_samples;
+    _enqueued.push_back({ primitive_idx, slot });
+}
+
+void network_profiler::add_execution(const std::function<const std::list<cldnn_profiling_interval>&(size_t)>& get_device_times)
+{
+    for (auto& enqueued : _enqueued)
+    {
+        auto& prim = _primitives[enqueued.first];
+        auto& s = prim.samples[enqueued.second];
+        for (auto& interval : get_device_times(enqueued.first))
+        {
+            // intervals reported by gpu events: submission, starting and executing
+            if (std::strcmp(interval.name, "executing") == 0)
+            {
+                s.executing = std::chrono::nanoseconds(interval.nanoseconds);
+                s.has_device_times = true;
+            }
+            else
+            {
+                s.queued_to_start += std::chrono::nanoseconds(interval.nanoseconds);
+            }
+        }
+
+        if (s.has_device_times)
+        {
+            prim.device_count++;
+            prim.min = std::min(prim.min, s.executing);
+            prim.total += s.executing;
+        }
+    }
+    _enqueued.clear();
+    _executions++;
+}
+
+const std::vector<network_profiler::primitive_stats>& network_profiler::get_stats()
+{
+    _stats.clear();
+    for (auto& prim : _primitives)
+    {
+        std::vector<std::chrono::nanoseconds> executing, queued_to_start, enqueue;
+        for (auto& s : prim.samples)
+        {
+            enqueue.push_back(s.enqueue);
+            if (!s.has_device_times)
+                continue;
+            executing.push_back(s.executing);
+            queued_to_start.push_back(s.queued_to_start);
+        }
+        std::sort(executing.begin(), executing.end());
+        std::sort(queued_to_start.begin(), queued_to_start.end());
+        std::sort(enqueue.begin(), enqueue.end());
+
+        primitive_stats stats;
+        stats.id = prim.id;
+        stats.kernel_name = prim.kernel_name;
+        stats.original_ids = prim.original_ids;
+        stats.count = prim.count;
+        stats.min = prim.device_count == 0 ? std::chrono::nanoseconds(0) : prim.min;
+        stats.median = percentile(executing, 0.5);
+        stats.p99 = percentile(executing, 0.99);
+        stats.total = prim.total;
+        stats.queued_to_start_median = percentile(queued_to_start, 0.5);
+        stats.enqueue_median = percentile(enqueue, 0.5);
+        stats.enqueue_total = prim.enqueue_total;
+        _stats.push_back(std::move(stats));
+    }
+    return _stats;
+}
+
+void network_profiler::reset()
+{
+    for (auto& prim : _primitives)
+    {
+        prim.count = 0;
+        prim.device_count = 0;
+        prim.min = std::chrono::nanoseconds::max();
+        prim.total = std::chrono::nanoseconds(0);
+        prim.enqueue_total = std::chrono::nanoseconds(0);
+        prim.samples.clear();
+        prim.next_sample = 0;
+    }
+    _enqueued.clear();
+    _stats.clear();
+}
+
+void network_profiler::dump_chrome_trace(const std::string& path) const
+{
+    std::ofstream trace(path);
+    trace << std::fixed << std::setprecision(3);
+    trace << "{\"traceEvents\":[";
+    bool first = true;
+    auto add_event = [&](const primitive_samples& prim, const char* category, std::chrono::nanoseconds start, std::chrono::nanoseconds duration,
+                         int thread, uint64_t execution)
+    {
+        trace << (first ? "\n" : ",\n")
+              << "{\"name\":\"" << escape_json(prim.id) << "\",\"cat\":\"" << category << "\",\"ph\":\"X\""
+              << ",\"ts\":" << to_microseconds(start) << ",\"dur\":" << to_microseconds(duration)
+              << ",\"pid\":0,\"tid\":" << thread
+              << ",\"args\":{\"kernel\":\"" << escape_json(prim.kernel_name) << "\",\"original_ids\":\"" << escape_json(prim.original_ids)
+              << "\",\"execution\":" << execution << "}}";
+        first = false;
+    };
+
+    for (auto& prim : _primitives)
+    {
+        for (auto& s : prim.samples)
+        {
+            add_event(prim, "enqueue", s.enqueue_start, s.enqueue, 0, s.execution);
+            if (s.has_device_times)
+                add_event(prim, "device", s.enqueue_start + s.queued_to_start, s.executing, 1, s.execution);
+        }
+    }
+    trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+void network_profiler::dump_csv(const std::string& path)
+{
+    std::ofstream csv(path);
+    csv << std::fixed << std::setprecision(3);
+    csv << "primitive,kernel,original_ids,count,min_us,median_us,p99_us,total_us,queued_to_start_median_us,enqueue_median_us,enqueue_total_us\n";
+    for (auto& s : get_stats())
+    {
+        csv << escape_csv(s.id) << "," << escape_csv(s.kernel_name) << "," << escape_csv(s.original_ids) << "," << s.count << ","
+            << to_microseconds(s.min) << "," << to_microseconds(s.median) << "," << to_microseconds(s.p99) << ","
+            << to_microseconds(s.total) << "," << to_microseconds(s.queued_to_start_median) << ","
+            << to_microseconds(s.enqueue_median) << "," << to_microseconds(s.enqueue_total) << "\n";
+    }
+}
+
+}
@@ -52,20 +52,37 @@ event_impl::ptr primitive_inst::execute(const std::vector<event_impl::ptr>& even
     dependencies.reserve(_exec_deps.size());
     for (auto& input : _exec_deps)
     {
-        auto id = input->id();
         try {
             // if the requested event deos not exits it means that it has not been executed, so the processing_order is wrong or synchronization failed.
-            auto ev = get_network().get_primitive_event(id);
+            auto ev = get_network().get_primitive_event(*input);
             dependencies.emplace_back(ev);
             }
         catch (const std::out_of_range& oor) {
             std::string temp = std::string("internal CLDNN error: execution order corrupted.") + std::string("\n") + std::string(oor.what() + std::string("\n"));
-            CLDNN_ERROR_MESSAGE(id, temp);
+            CLDNN_ERROR_MESSAGE(input->id(), temp);
         }
     }
     return _impl->execute(dependencies, *this);
 }
 
+bool primitive_inst::set_output_memory(memory_impl& mem)
+{
+    if (_node.is_type<input_layout>() || _node.is_type<data>() || _node.is_type<mutable_data>() ||
+        _node.can_be_optimized() || mem.get_layout() != _output->get_layout())
+    {
+        return false;
+    }
+
+    for (auto user : _node.get_users())
+    {
+        if (user->can_be_optimized() || user->is_type<mutable_data>())
+            return false;
+    }
+
+    _output = &mem;
+    return true;
+}
+
 void primitive_inst::build_deps()
 {
     if (_deps.empty() && !_node.get_dependencies().empty())
@@ -126,6 +143,13 @@ memory_impl::ptr primitive_inst::allocate_output()
 {
     auto layout = _node.get_output_layout();
 
+    // outputs of nodes placed on the host (and of transfers to them) are not shared through the pool, as their memory
+    // is accessed outside of the queue
+    if (_node.has_host_output())
+    {
+        return get_network().get_engine().allocate_memory(layout, resource_flags::HOST_PINNED);
+    }
+
     if (!_network.is_internal() &&
         (_node.can_be_optimized() ||
         _node.is_type<generic_layer>()))
@@ -18,6 +18,7 @@
 #include "primitive_type_base.h"
 #include "error_handler.h"
 #include "json_object.h"
+#include "cpu/thread_pool.h"
 
 #include <cmath>
 
@@ -31,7 +32,7 @@ primitive_type_id prior_box_type_id()
 
 namespace {
     template<typename dtype>
-    void calculate_prior_box_output(memory_impl& output_mem, layout const& input_layout, prior_box& argument)
+    void calculate_prior_box_output(memory_impl& output_mem, layout const& input_layout, prior_box& argument, cpu::thread_pool& pool)
     {
         // Calculate output.
         // All the inputs for this layer are known at this point,
@@ -56,9 +57,11 @@ namespace {
         mem_lock<dtype> lock{ output_mem };
         auto out_ptr = lock.begin();
 
-        int dim = layer_height * layer_width * num_priors * 4;
-        int idx = 0;
-        for (int h = 0; h < layer_height; ++h) {
+        // rows are computed in parallel, each of them fills a fixed part of the output
+        const int row_size = layer_width * num_priors * 4;
+        pool.parallel_for(static_cast<size_t>(layer_height), [&](size_t row) {
+            const int h = static_cast<int>(row);
+            int idx = h * row_size;
             for (int w = 0; w < layer_width; ++w) {
                 float center_x = (w + offset) * step_w;
                 float center_y = (h + offset) * step_h;
@@ -115,14 +118,14 @@ namespace {
                     }
                 }
             }
-        }
 
-        // clip the prior's coordinate such that it is within [0, 1]
-        if (argument.clip) {
-            for (int d = 0; d < dim; ++d) {
-                out_ptr[d] = (dtype)std::min(std::max((float)out_ptr[d], 0.f), 1.f);
+            // clip the prior's coordinate such that it is within [0, 1]
+            if (argument.clip) {
+                for (int d = h * row_size; d < (h + 1) * row_size; ++d) {
+                    out_ptr[d] = (dtype)std::min(std::max((float)out_ptr[d], 0.f), 1.f);
+                }
             }
-        }
+        });
 
         // set the variance.
         int count = output_mem.get_layout().size.spatial[0] * output_mem.get_layout().size.spatial[1];
@@ -187,9 +190,9 @@ void prior_box_node::calc_result()
 
     //perform calculations
     if (input().get_output_layout().data_type == data_types::f16)
-        calculate_prior_box_output<data_type_to_type<data_types::f16>::type>(*result, input().get_output_layout(), *typed_desc());
+        calculate_prior_box_output<data_type_to_type<data_types::f16>::type>(*result, input().get_output_layout(), *typed_desc(), get_program().get_engine().get_thread_pool());
     else
-        calculate_prior_box_output<data_type_to_type<data_types::f32>::type>(*result, input().get_output_layout(), *typed_desc());
+        calculate_prior_box_output<data_type_to_type<data_types::f32>::type>(*result, input().get_output_layout(), *typed_desc(), get_program().get_engine().get_thread_pool());
 }
 
 layout prior_box_inst::calc_output_layout(prior_box_node const& node)
@@ -17,6 +17,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "error_handler.h"
+#include "build_profiler.h"
 #include "kernel_selector_helper.h"
 #include "internal_primitive.h"
 #include "internal_primitive_type_base.h"
@@ -56,8 +57,20 @@
 #include <iomanip>
 #include <memory>
 
+namespace
+{
+    // build steps are recorded on request, or to be dumped next to the graphs
+    std::unique_ptr<build_profiler> make_build_profiler(const build_options& options)
+    {
+        if (!options.get<build_option_type::build_profiling>()->enabled() && get_dir_path(options).empty())
+            return nullptr;
+        return std::unique_ptr<build_profiler>(new build_profiler());
+    }
+}
+
 program_impl::program_impl(engine_impl& engine_ref, topology_impl const& topology, build_options const& options, bool is_internal, bool no_optimizations)
     : engine(&engine_ref), options(options), processing_order(* new nodes_ordering), pm(std::unique_ptr<pass_manager>(new pass_manager()))
+    , profiler(make_build_profiler(options))
 {
     set_options();
     prepare_nodes(topology);
@@ -70,6 +83,7 @@ program_impl::program_impl(engine_impl& engine_ref, topology_impl const& topolog
 
 program_impl::program_impl(engine_impl& engine_ref, std::set<std::shared_ptr<program_node>> const& nodes, build_options const& options, bool is_internal)
     : engine(&engine_ref), options(options), processing_order(*new nodes_ordering), pm(std::unique_ptr<pass_manager>(new pass_manager()))
+    , profiler(make_build_profiler(options))
 {
     set_options();
     prepare_nodes(nodes);
@@ -319,9 +333,16 @@ void program_impl::build_program(bool is_internal)
     {
         post_optimize_graph(is_internal);
     }
-    prepare_memory_dependencies();
+    {
+        build_profiler::scope memory_planning(profiler.get(), "memory_planning", "prepare_memory_dependencies", processing_order.size());
+        prepare_memory_dependencies();
+    }
     engine->compile_program(*this);
     cleanup();
+
+    auto path = get_dir_path(options);
+    if (!path.empty() && profiler)
+        profiler->dump_chrome_trace(path + "cldnn_program_" + std::to_string(prog_id) + "_build_trace.json", prog_id);
 }
 
 void program_impl::init_graph()
@@ -364,11 +385,20 @@ void program_impl::pre_optimize_graph(bool is_internal)
             node->get_output_layout();
     }
 
+    // host implementations read any plain format, so layouts and primitives optimized for GPU kernels are not used
+    const bool gpu_engine = get_engine().type() == engine_types::ocl;
+
     if (options.get<build_option_type::optimize_data>()->enabled())
     {
+        eliminate_common_subexpressions eliminate_common_subexpressions_pass; // merge duplicated branches (e.g. after import)
+        apply_opt_pass(eliminate_common_subexpressions_pass);
+
         prepare_primitive_fusing prepare_primitive_fusing_pass;
         apply_opt_pass(prepare_primitive_fusing_pass);
+    }
 
+    if (options.get<build_option_type::optimize_data>()->enabled() && gpu_engine)
+    {
         layout_optimizer lo(output_size_handling_enabled);
         reorder_inputs reorder_inputs_pass(lo);
         apply_opt_pass(reorder_inputs_pass);
@@ -394,17 +424,33 @@ void program_impl::pre_optimize_graph(bool is_internal)
         apply_opt_pass(prepare_conv_eltw_read_write_opt_pass);
     }
 
+    // formats are known at this point, so post-ops are fused only into kernels which can apply them
+    if (options.get<build_option_type::optimize_data>()->enabled())
+    {
+        prepare_post_ops_fusing prepare_post_ops_fusing_pass;
+        apply_opt_pass(prepare_post_ops_fusing_pass);
+    }
+
     handle_reshape handle_reshape_pass;
     apply_opt_pass(handle_reshape_pass);
 
     remove_redundant_reorders remove_redundant_reorders_pass;
     apply_opt_pass(remove_redundant_reorders_pass);
 
+    if (options.get<build_option_type::optimize_data>()->enabled())
+    {
+        collapse_data_movement_chains collapse_data_movement_chains_pass;
+        apply_opt_pass(collapse_data_movement_chains_pass);
+    }
+
     prepare_padding prepare_padding_pass(output_size_handling_enabled);
     apply_opt_pass(prepare_padding_pass);
 
-    prepare_depthwise_sep_opt prepare_depthwise_sep_opt_pass;
-    apply_opt_pass(prepare_depthwise_sep_opt_pass);
+    if (gpu_engine)
+    {
+        prepare_depthwise_sep_opt prepare_depthwise_sep_opt_pass;
+        apply_opt_pass(prepare_depthwise_sep_opt_pass);
+    }
 
     if (!is_internal)
     {
@@ -419,10 +465,29 @@ void program_impl::pre_optimize_graph(bool is_internal)
         apply_opt_pass(prepare_buffer_fusing_pass);
     }
 
+    // place nodes on the host, before reorders required by their implementations are added
+    if (gpu_engine && !is_internal && options.get<build_option_type::cpu_fallback>()->enabled())
+    {
+        assign_host_placement assign_host_placement_pass;
+        apply_opt_pass(assign_host_placement_pass);
+    }
+
     //check if there exists some layout incompatibilities and add an reorder node if required
     add_required_reorders add_required_reorders_pass;
     apply_opt_pass(add_required_reorders_pass);
 
+    if (options.get<build_option_type::dynamic_batch>()->enabled())
+    {
+        reorder_dynamic_batch_outputs reorder_dynamic_batch_outputs_pass;
+        apply_opt_pass(reorder_dynamic_batch_outputs_pass);
+    }
+
+    if (options.get<build_option_type::optimize_data>()->enabled())
+    {
+        eliminate_common_subexpressions eliminate_common_subexpressions_pass; // merge reorders added for the same input
+        apply_opt_pass(eliminate_common_subexpressions_pass);
+    }
+
     processing_order.calculate_BFS_processing_order(); // this method makes sense only for OOOQ (out of order execution queue)
 }
 
@@ -444,8 +509,21 @@ void program_impl::post_optimize_graph(bool is_internal)
         apply_opt_pass(propagate_constants_pass);
     }
 
-    prep_opt_depthwise_sep_post prep_opt_depthwise_sep_post_pass;
-    apply_opt_pass(prep_opt_depthwise_sep_post_pass);
+    if (get_engine().type() == engine_types::ocl)
+    {
+        prep_opt_depthwise_sep_post prep_opt_depthwise_sep_post_pass;
+        apply_opt_pass(prep_opt_depthwise_sep_post_pass);
+    }
+
+    // copies between device and host memory for nodes placed on the host
+    add_host_transfers add_host_transfers_pass;
+    apply_opt_pass(add_host_transfers_pass);
+
+    if (options.get<build_option_type::dynamic_batch>()->enabled())
+    {
+        mark_dynamic_batch_nodes mark_dynamic_batch_nodes_pass;
+        apply_opt_pass(mark_dynamic_batch_nodes_pass);
+    }
 }
 
 // mark if the node is constant assuming that all dependencies are marked properly
@@ -546,12 +624,35 @@ const program_impl::nodes_ordering& program_impl::get_processing_order() const
     return processing_order;
 }
 
+// nodes written in place into a concatenation do not own their buffer, it belongs to the outermost optimized concatenation
+program_node* get_buffer_owner(program_node* node)
+{
+    bool moved = true;
+    while (moved)
+    {
+        moved = false;
+        for (auto user : node->get_users())
+        {
+            if (user->is_type<concatenation>() && user->can_be_optimized())
+            {
+                node = user;
+                moved = true;
+                break;
+            }
+        }
+    }
+    return node;
+}
+
 void add_memory_dependency(program_node* node, program_node* dep)
 {
     if (node->can_be_optimized() ||
         !dep->can_be_optimized())
     {
         node->add_memory_dependency(dep->id());
+        auto owner = get_buffer_owner(dep);
+        if (owner != dep && owner != node)
+            node->add_memory_dependency(owner->id());
     }
     else
     {
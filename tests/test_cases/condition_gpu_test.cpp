@@ -26,6 +26,8 @@
 #include <api/CPP/softmax.hpp>
 #include <api/CPP/scale.hpp>
 #include <api/CPP/data.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/reshape.hpp>
 #include "test_utils/test_utils.h"
 
 #include <cstddef>
@@ -407,6 +409,100 @@ TEST(condition_gpu, basic_stacked_ifs) {
     EXPECT_TRUE(is_output_equal(out_data, {1.0f, 2.0f}));
 }
 
+TEST(condition_gpu, int32_greater_comp_with_offset) {
+    const auto& engine = get_test_engine();
+    build_options bs;
+    bs.set_option(build_option::optimize_data(true));
+    auto input = memory::allocate(engine, { data_types::i32, format::bfyx,{ 1, 1, 4, 1 } });
+    auto compare = memory::allocate(engine, { data_types::i32, format::bfyx,{ 1, 1, 2, 1 } });
+
+    topology branch_true;
+    branch_true.add(
+        eltwise("condi_when_true", "condi", "condi", eltwise_mode::sum)
+    );
+    topology branch_false;
+    branch_false.add(
+        eltwise("condi_when_false", "condi", "condi", eltwise_mode::prod)
+    );
+
+    topology topology;
+    topology.add(
+        input_layout("input", input.get_layout())
+    );
+    topology.add(
+        input_layout("compare", compare.get_layout())
+    );
+    topology.add(
+        condition("condi", "input", branch_true, branch_false, "compare", cond_functions::GREATER, { 0, 0, 1, 0 })
+    );
+
+    network net(engine, topology, bs);
+    set_values<int32_t>(input, { 1, 5, 7, 2 });
+    net.set_input_data("input", input);
+
+    //WHEN TRUE
+    set_values<int32_t>(compare, { 4, 6 });
+    net.set_input_data("compare", compare);
+    auto out = net.execute();
+    {
+        // the output is released before the next execution, which computes the branch result in the same buffer
+        auto out_ptr = out.at("condi").get_memory().pointer<int32_t>();
+        EXPECT_EQ(std::vector<int32_t>(out_ptr.begin(), out_ptr.end()), std::vector<int32_t>({ 2, 10, 14, 4 }));
+    }
+
+    //WHEN FALSE
+    set_values<int32_t>(compare, { 4, 7 });
+    net.set_input_data("compare", compare);
+    out = net.execute();
+    auto out_ptr = out.at("condi").get_memory().pointer<int32_t>();
+    EXPECT_EQ(std::vector<int32_t>(out_ptr.begin(), out_ptr.end()), std::vector<int32_t>({ 1, 25, 49, 4 }));
+}
+
+TEST(condition_gpu, branch_output_sharing_input_buffer) {
+    const auto& engine = get_test_engine();
+    build_options bs;
+    bs.set_option(build_option::optimize_data(true));
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 4, 1 } });
+    auto compare = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+
+    // reshape of the true branch reuses the input buffer, so its result cannot be computed in the condition output
+    topology branch_true;
+    branch_true.add(
+        reshape("condi_when_true", "condi", { 1, 1, 4, 1 })
+    );
+    topology branch_false;
+    branch_false.add(
+        eltwise("condi_when_false", "condi", "condi", eltwise_mode::sum)
+    );
+
+    topology topology;
+    topology.add(
+        input_layout("input", input.get_layout())
+    );
+    topology.add(
+        input_layout("compare", compare.get_layout())
+    );
+    topology.add(
+        condition("condi", "input", branch_true, branch_false, "compare", cond_functions::LESS)
+    );
+
+    network net(engine, topology, bs);
+    set_values(input, { 1.0f, 2.0f, 3.0f, 4.0f });
+    net.set_input_data("input", input);
+
+    //WHEN TRUE
+    set_values(compare, { 2.0f });
+    net.set_input_data("compare", compare);
+    auto out = net.execute();
+    EXPECT_TRUE(is_output_equal(out.at("condi").get_memory(), { 1.0f, 2.0f, 3.0f, 4.0f }));
+
+    //WHEN FALSE
+    set_values(compare, { 1.0f });
+    net.set_input_data("compare", compare);
+    out = net.execute();
+    EXPECT_TRUE(is_output_equal(out.at("condi").get_memory(), { 2.0f, 4.0f, 6.0f, 8.0f }));
+}
+
 TEST(condition_gpu, basic_nested_ifs) {
 
     /*
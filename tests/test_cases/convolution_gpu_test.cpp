@@ -34,6 +34,8 @@
 #include <thread>
 #include <fstream>
 #include <api/CPP/reorder.hpp>
+#include <api/CPP/scale.hpp>
+#include <api/CPP/eltwise.hpp>
 
 using namespace cldnn;
 using namespace tests;
@@ -202,6 +204,102 @@ TEST(convolution_f32_fw_gpu, basic_convolution_no_bias) {
     //print_2d(temp_vec);
 }
 
+TEST(convolution_f32_fw_gpu, fused_scale_and_eltwise) {
+    //  Filter : 1x1, 2 output features
+    //  Input  : 2x2
+    //  Output : 2x2x2
+    //
+    //  Scale and the constant product after the convolution are applied by the convolution kernel.
+
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 1, 1, 1 } });
+    auto scale_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+    auto shift_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+    auto mul_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+
+    std::vector<float> in = { 1.0f, -2.0f, 3.0f, -4.0f };
+    std::vector<float> w = { 2.0f, -1.0f };
+    std::vector<float> scales = { 0.5f, 3.0f };
+    std::vector<float> shifts = { 1.0f, -1.0f };
+    std::vector<float> muls = { 1.0f, 2.0f, 3.0f, 4.0f, -1.0f, -2.0f, -3.0f, -4.0f };
+    set_values(input, in);
+    set_values(weights, w);
+    set_values(scale_mem, scales);
+    set_values(shift_mem, shifts);
+    set_values(mul_mem, muls);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("scale_data", scale_mem),
+        data("shift_data", shift_mem),
+        data("mul_data", mul_mem),
+        convolution("conv", "input", { "weights" }),
+        scale("scale", "conv", "scale_data", "shift_data"),
+        eltwise("mul", { "scale", "mul_data" }, eltwise_mode::prod),
+        reorder("out", "mul", format::bfyx, data_types::f32));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "conv"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "scale"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "mul"), executed.end());
+
+    auto output_memory = outputs.at("out").get_memory();
+    auto output_ptr = output_memory.pointer<float>();
+    for (size_t f = 0; f < 2; f++)
+    {
+        for (size_t yx = 0; yx < 4; yx++)
+        {
+            float expected = (in[yx] * w[f] * scales[f] + shifts[f]) * muls[f * 4 + yx];
+            EXPECT_FLOAT_EQ(expected, output_ptr[f * 4 + yx]);
+        }
+    }
+}
+
+TEST(convolution_f32_fw_gpu, scale_is_not_fused_into_heavy_convolution) {
+    //  Filter : 3x3x64, 16 output features
+    //  Input  : 8x8x64
+    //
+    //  Applying the scale would switch the convolution to the reference kernel, which costs more than the separate
+    //  scale kernel, so the scale stays a separate primitive.
+
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 64, 8, 8 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 16, 64, 3, 3 } });
+    auto scale_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 1, 1 } });
+    set_values(input, generate_random_1d<float>(input.get_layout().count(), -1, 1));
+    set_values(weights, generate_random_1d<float>(weights.get_layout().count(), -1, 1));
+    set_values(scale_mem, generate_random_1d<float>(scale_mem.get_layout().count(), -1, 1));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("scale_data", scale_mem),
+        convolution("conv", "input", { "weights" }),
+        scale("scale", "conv", "scale_data"),
+        reorder("out", "scale", format::bfyx, data_types::f32));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+    network.execute();
+
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "conv"), executed.end());
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "scale"), executed.end());
+}
+
 TEST(convolution_f32_fw_gpu, basic_convolution_int8_no_bias) {
     //  Filter : 2x3
     //  Stride : 2x1
@@ -0,0 +1,405 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/fully_connected.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/softmax.hpp>
+#include <api/CPP/concatenation.hpp>
+#include <api/CPP/reorder.hpp>
+#include <api/CPP/reshape.hpp>
+#include <api/CPP/lrn.hpp>
+#include <api/CPP/gemm.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+
+#include <cmath>
+#include <thread>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    const cldnn::engine& get_cpu_engine()
+    {
+        static const cldnn::engine engine(engine_types::cpu, 0);
+        return engine;
+    }
+
+    std::vector<float> random_values(size_t count)
+    {
+        return generate_random_1d<float>(count, -10, 10);
+    }
+
+    std::vector<float> read_output(network& network, const primitive_id& id)
+    {
+        auto output = network.get_output(id).get_memory();
+        auto ptr = output.pointer<float>();
+        return std::vector<float>(ptr.begin(), ptr.end());
+    }
+
+    void expect_near(const std::vector<float>& expected, const std::vector<float>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_NEAR(expected[i], actual[i], 1e-4f * std::max(1.0f, std::fabs(expected[i]))) << "at index " << i;
+    }
+}
+
+TEST(cpu_engine, reports_its_type_and_info)
+{
+    const auto& engine = get_cpu_engine();
+
+    EXPECT_EQ(engine_types::cpu, engine.get_type());
+    EXPECT_EQ(1u, cldnn::engine::engine_count(engine_types::cpu));
+
+    auto info = engine.get_info();
+    EXPECT_GE(info.cores_count, 1u);
+    EXPECT_GT(info.max_alloc_mem_size, 0u);
+    EXPECT_EQ(0, info.supports_image);
+}
+
+TEST(cpu_engine, host_threads_are_configurable_and_shared_by_networks)
+{
+    const engine_configuration config(false, false, false, "", "", true, "", "", priority_mode_types::disabled,
+                                      throttle_mode_types::disabled, true, nullptr, "cache.json", 4, true);
+    const cldnn::engine engine(engine_types::cpu, 0, config);
+    EXPECT_EQ(4u, engine.get_info().cores_count);
+
+    // the conversion is large enough to be split between threads
+    const tensor size(8, 16, 32, 32);
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, size });
+    auto values = random_values(input.count());
+    set_values(input, values);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        reorder("reorder", "input", format::yxfb, data_types::f32));
+
+    network first(engine, topology);
+    network second(engine, topology);
+    first.set_input_data("input", input);
+    second.set_input_data("input", input);
+
+    // both networks use the pool of the engine at the same time
+    std::vector<float> first_result, second_result;
+    std::thread thread([&] { first.execute(); first_result = read_output(first, "reorder"); });
+    second.execute();
+    second_result = read_output(second, "reorder");
+    thread.join();
+
+    std::vector<float> expected(values.size());
+    for (int b = 0; b < size.batch[0]; b++)
+        for (int f = 0; f < size.feature[0]; f++)
+            for (int y = 0; y < size.spatial[1]; y++)
+                for (int x = 0; x < size.spatial[0]; x++)
+                {
+                    const size_t bfyx = ((b * size.feature[0] + f) * size.spatial[1] + y) * size.spatial[0] + x;
+                    const size_t yxfb = ((y * size.spatial[0] + x) * size.feature[0] + f) * size.batch[0] + b;
+                    expected[yxfb] = values[bfyx];
+                }
+
+    EXPECT_EQ(expected, first_result);
+    EXPECT_EQ(expected, second_result);
+}
+
+TEST(cpu_engine, convolution_with_offset_stride_bias_and_activation)
+{
+    const auto& engine = get_cpu_engine();
+    const int batch = 2, ifm = 3, ofm = 4, in_y = 7, in_x = 6, k = 3, stride = 2, offset = -1;
+    const int out_y = (in_y - 2 * offset - k) / stride + 1;
+    const int out_x = (in_x - 2 * offset - k) / stride + 1;
+    const float slope = 0.1f;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { batch, ifm, in_x, in_y } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { ofm, ifm, k, k } });
+    auto bias = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, ofm, 1 } });
+    auto input_values = random_values(batch * ifm * in_y * in_x);
+    auto weights_values = random_values(ofm * ifm * k * k);
+    auto bias_values = random_values(ofm);
+    set_values(input, input_values);
+    set_values(weights, weights_values);
+    set_values(bias, bias_values);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("bias", bias),
+        convolution("conv", "input", { "weights" }, { "bias" }, { 1, 1, stride, stride }, { 0, 0, offset, offset }, { 1, 1, 1, 1 }, true, slope));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.execute();
+
+    std::vector<float> expected(batch * ofm * out_y * out_x);
+    for (int b = 0; b < batch; b++)
+        for (int o = 0; o < ofm; o++)
+            for (int y = 0; y < out_y; y++)
+                for (int x = 0; x < out_x; x++)
+                {
+                    float sum = bias_values[o];
+                    for (int i = 0; i < ifm; i++)
+                        for (int ky = 0; ky < k; ky++)
+                            for (int kx = 0; kx < k; kx++)
+                            {
+                                const int iy = y * stride + offset + ky;
+                                const int ix = x * stride + offset + kx;
+                                if (iy < 0 || iy >= in_y || ix < 0 || ix >= in_x)
+                                    continue;
+                                sum += input_values[((b * ifm + i) * in_y + iy) * in_x + ix] * weights_values[((o * ifm + i) * k + ky) * k + kx];
+                            }
+                    expected[((b * ofm + o) * out_y + y) * out_x + x] = sum > 0.0f ? sum : sum * slope;
+                }
+
+    expect_near(expected, read_output(network, "conv"));
+}
+
+TEST(cpu_engine, fully_connected_with_bias)
+{
+    const auto& engine = get_cpu_engine();
+    const int batch = 3, ifm = 2, in_y = 3, in_x = 5, ofm = 7;
+    const int inputs = ifm * in_y * in_x;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { batch, ifm, in_x, in_y } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { ofm, ifm, in_x, in_y } });
+    auto bias = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, ofm, 1 } });
+    auto input_values = random_values(batch * inputs);
+    auto weights_values = random_values(ofm * inputs);
+    auto bias_values = random_values(ofm);
+    set_values(input, input_values);
+    set_values(weights, weights_values);
+    set_values(bias, bias_values);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("bias", bias),
+        fully_connected("fc", "input", "weights", "bias"));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.execute();
+
+    // output of fully connected with batch > 1 is in yxfb format
+    EXPECT_EQ(format::yxfb, network.get_output("fc").get_memory().get_layout().format);
+
+    std::vector<float> expected(batch * ofm);
+    for (int b = 0; b < batch; b++)
+        for (int o = 0; o < ofm; o++)
+        {
+            float sum = bias_values[o];
+            for (int i = 0; i < inputs; i++)
+                sum += input_values[b * inputs + i] * weights_values[o * inputs + i];
+            expected[o * batch + b] = sum;
+        }
+
+    expect_near(expected, read_output(network, "fc"));
+}
+
+TEST(cpu_engine, max_and_average_pooling_with_offset)
+{
+    const auto& engine = get_cpu_engine();
+
+    // 1x1x4x4 input, 3x3 window, stride 2, offset -1 gives 3x3 output (the last window covers only the last row/column)
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 4 } });
+    set_values(input, {
+        1.0f,  2.0f,  3.0f,  4.0f,
+        5.0f,  6.0f,  7.0f,  8.0f,
+        9.0f, 10.0f, 11.0f, 12.0f,
+       13.0f, 14.0f, 15.0f, 16.0f });
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        pooling("max", "input", pooling_mode::max, { 1, 1, 3, 3 }, { 1, 1, 2, 2 }, { 0, 0, -1, -1 }),
+        pooling("avg", "input", pooling_mode::average, { 1, 1, 3, 3 }, { 1, 1, 2, 2 }, { 0, 0, -1, -1 }),
+        pooling("avg_np", "input", pooling_mode::average_no_padding, { 1, 1, 3, 3 }, { 1, 1, 2, 2 }, { 0, 0, -1, -1 }));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.execute();
+
+    expect_near({
+        6.0f,  8.0f,  8.0f,
+       14.0f, 16.0f, 16.0f,
+       14.0f, 16.0f, 16.0f }, read_output(network, "max"));
+    // padding added by the offset is counted by the divisor, area past the padding is not
+    expect_near({
+        14.0f / 9.0f, 30.0f / 9.0f, 12.0f / 6.0f,
+        57.0f / 9.0f, 99.0f / 9.0f, 36.0f / 6.0f,
+        27.0f / 6.0f, 45.0f / 6.0f, 16.0f / 4.0f }, read_output(network, "avg"));
+    expect_near({
+        14.0f / 4.0f, 30.0f / 6.0f, 12.0f / 2.0f,
+        57.0f / 6.0f, 99.0f / 9.0f, 36.0f / 3.0f,
+        27.0f / 2.0f, 45.0f / 3.0f, 16.0f / 1.0f }, read_output(network, "avg_np"));
+}
+
+TEST(cpu_engine, eltwise_broadcast_and_fused_activation)
+{
+    const auto& engine = get_cpu_engine();
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 3, 1 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+    set_values(input1, { 1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f });
+    set_values(input2, { 1.0f, 2.0f });
+
+    topology topology(
+        input_layout("input1", input1.get_layout()),
+        input_layout("input2", input2.get_layout()),
+        eltwise("prod", { "input1", "input2" }, eltwise_mode::prod),
+        activation("relu", "prod", activation_relu));
+
+    network network(engine, topology);
+    network.set_input_data("input1", input1);
+    network.set_input_data("input2", input2);
+    network.execute();
+
+    expect_near({ 1.0f, 0.0f, 3.0f, 0.0f, 10.0f, 0.0f }, read_output(network, "relu"));
+}
+
+TEST(cpu_engine, softmax_over_features_of_reordered_input)
+{
+    const auto& engine = get_cpu_engine();
+    const int batch = 2, features = 3, size_y = 2, size_x = 2;
+
+    // input in yxfb is converted by the reorder, softmax is computed per (b, y, x)
+    auto input = memory::allocate(engine, { data_types::f32, format::yxfb, { batch, features, size_x, size_y } });
+    auto input_values = random_values(batch * features * size_y * size_x);
+    set_values(input, input_values);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        reorder("reorder", "input", format::bfyx, data_types::f32),
+        softmax("softmax", "reorder", softmax::normalize_f));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.execute();
+
+    std::vector<float> expected(input_values.size());
+    for (int b = 0; b < batch; b++)
+        for (int y = 0; y < size_y; y++)
+            for (int x = 0; x < size_x; x++)
+            {
+                // yxfb index of (b, f, y, x)
+                auto in_index = [&](int f) { return ((y * size_x + x) * features + f) * batch + b; };
+                float sum = 0.0f;
+                for (int f = 0; f < features; f++)
+                    sum += std::exp(input_values[in_index(f)]);
+                for (int f = 0; f < features; f++)
+                    expected[((b * features + f) * size_y + y) * size_x + x] = std::exp(input_values[in_index(f)]) / sum;
+            }
+
+    expect_near(expected, read_output(network, "softmax"));
+}
+
+TEST(cpu_engine, concatenation_along_features_and_reshape)
+{
+    const auto& engine = get_cpu_engine();
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 1, 2, 1 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 2, 2, 1 } });
+    set_values(input1, { 1.0f, 2.0f, 3.0f, 4.0f });
+    set_values(input2, { 10.0f, 20.0f, 30.0f, 40.0f, 50.0f, 60.0f, 70.0f, 80.0f });
+
+    topology topology(
+        input_layout("input1", input1.get_layout()),
+        input_layout("input2", input2.get_layout()),
+        concatenation("concat", { "input1", "input2" }, concatenation::along_f),
+        reshape("reshape", "concat", { 1, 1, 12, 1 }));
+
+    network network(engine, topology);
+    network.set_input_data("input1", input1);
+    network.set_input_data("input2", input2);
+    network.execute();
+
+    expect_near({ 1.0f, 2.0f, 10.0f, 20.0f, 30.0f, 40.0f, 3.0f, 4.0f, 50.0f, 60.0f, 70.0f, 80.0f }, read_output(network, "reshape"));
+}
+
+TEST(cpu_engine, lrn_across_channel)
+{
+    const auto& engine = get_cpu_engine();
+    const int features = 5, size = 3;
+    const float k = 1.0f, alpha = 0.5f, beta = 0.75f;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, features, 1, 1 } });
+    std::vector<float> input_values = { 1.0f, -2.0f, 3.0f, 0.5f, 4.0f };
+    set_values(input, input_values);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        lrn("lrn", "input", size, k, alpha, beta, cldnn_lrn_norm_region_across_channel));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.execute();
+
+    std::vector<float> expected(features);
+    for (int f = 0; f < features; f++)
+    {
+        float sum = 0.0f;
+        for (int c = f - 1; c <= f + 1; c++)
+            if (c >= 0 && c < features)
+                sum += input_values[c] * input_values[c];
+        expected[f] = input_values[f] * std::pow(k + alpha * sum / size, -beta);
+    }
+
+    expect_near(expected, read_output(network, "lrn"));
+}
+
+TEST(cpu_engine, gemm_with_transposed_second_input)
+{
+    const auto& engine = get_cpu_engine();
+    const int m = 2, n = 3, depth = 4;
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, depth, m } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, depth, n } });
+    auto values1 = random_values(m * depth);
+    auto values2 = random_values(n * depth);
+    set_values(input1, values1);
+    set_values(input2, values2);
+
+    topology topology(
+        input_layout("input1", input1.get_layout()),
+        input_layout("input2", input2.get_layout()),
+        gemm("gemm", "input1", "input2", false, true, 2.0f));
+
+    network network(engine, topology);
+    network.set_input_data("input1", input1);
+    network.set_input_data("input2", input2);
+    network.execute();
+
+    std::vector<float> expected(m * n);
+    for (int i = 0; i < m; i++)
+        for (int j = 0; j < n; j++)
+        {
+            float sum = 0.0f;
+            for (int d = 0; d < depth; d++)
+                sum += values1[i * depth + d] * values2[j * depth + d];
+            expected[i * n + j] = 2.0f * sum;
+        }
+
+    expect_near(expected, read_output(network, "gemm"));
+}
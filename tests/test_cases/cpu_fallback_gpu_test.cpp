@@ -0,0 +1,99 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+
+#include <algorithm>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    bool has_primitive(const network& network, const primitive_id& id)
+    {
+        const auto ids = network.get_all_primitive_ids();
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+
+    build_options cpu_fallback_options()
+    {
+        build_options options;
+        options.set_option(build_option::cpu_fallback(true));
+        return options;
+    }
+}
+
+TEST(cpu_fallback_gpu, results_do_not_depend_on_placement)
+{
+    // the placement depends on the device, see assign_host_placement tests in tests_core_internal for placement checks
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 3 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 3, 2, 1, 1 } });
+    auto values = generate_random_1d<float>(input.count(), -10, 10);
+    std::vector<float> weights_values = { 1.0f, -1.0f, 0.5f, 0.5f, -2.0f, 1.0f };
+    set_values(input, values);
+    set_values(weights, weights_values);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        activation("relu", "input", activation_relu),
+        convolution("conv", "relu", { "weights" }),
+        activation("out", "conv", activation_linear, { 2.0f, 1.0f }));
+
+    network network(engine, topology, cpu_fallback_options());
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("out").get_memory();
+    auto ptr = output.pointer<float>();
+    ASSERT_EQ(size_t(3 * 12), ptr.size());
+    for (size_t f = 0; f < 3; f++)
+    {
+        for (size_t yx = 0; yx < 12; yx++)
+        {
+            float conv = weights_values[f * 2] * std::max(values[yx], 0.0f) + weights_values[f * 2 + 1] * std::max(values[12 + yx], 0.0f);
+            EXPECT_NEAR(2.0f * conv + 1.0f, ptr[f * 12 + yx], 1e-4f) << "at feature " << f << " position " << yx;
+        }
+    }
+}
+
+TEST(cpu_fallback_gpu, disabled_by_default)
+{
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 3 } });
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_relu));
+
+    network network(engine, topology);
+
+    EXPECT_FALSE(has_primitive(network, "input_to_host"));
+}
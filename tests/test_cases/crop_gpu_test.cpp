@@ -692,3 +692,86 @@ TEST(crop_gpu, basic_in1x4x1x1_split_w_relu) {
         EXPECT_EQ(output_ptr_2[i], out2[i]);
 }
 
+
+TEST(crop_gpu, basic_in1x1x4x1_split_along_x_in_place) {
+    //  INPUT(1x1x4x1)--RELU--CROP_1(1x1x2x1,offset(0x0x0x0)) --> RELU
+    //                      |_CROP_2(1x1x2x1,offset(0x0x2x0)) --> RELU
+    //
+    //  Both crops are executed in place as views of RELU output.
+
+    // disable memory pool when we want to check optimized out internal results
+    engine_configuration cfg{ false, false, false, std::string(), std::string(), true /*oooq*/, std::string(),std::string(), priority_mode_types::disabled,  throttle_mode_types::disabled, false /*mem_pool*/ };
+    engine engine{ cfg };
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ tensor(spatial(4, 1), feature(1), batch(1)) } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(crop("crop1", "relu", tensor(batch(1), spatial(2, 1), feature(1)), { tensor(feature(0), spatial(0, 0), batch(0)) }));
+    topology.add(crop("crop2", "relu", tensor(batch(1), spatial(2, 1), feature(1)), { tensor(feature(0), spatial(2, 0), batch(0)) }));
+    topology.add(activation("relu1", "crop1", activation_relu));
+    topology.add(activation("relu2", "crop2", activation_relu));
+
+    std::vector<float> input_vec = { -1.f, 2.f, -3.f, 4.f };
+    std::vector<float> out1 = { 0.f, 2.f };
+    std::vector<float> out2 = { 0.f, 4.f };
+    set_values(input, input_vec);
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    bo.set_option(build_option::debug(true)); //required to have optimized crop despite the fact that it's specified as an output
+
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    // check if crops have been executed in place
+    EXPECT_TRUE(outputs.at("crop1").get_memory().is_the_same_buffer(outputs.at("relu").get_memory()));
+    EXPECT_TRUE(outputs.at("crop2").get_memory().is_the_same_buffer(outputs.at("relu").get_memory()));
+
+    auto output_ptr = outputs.at("relu1").get_memory().pointer<float>();
+    for (size_t i = 0; i < out1.size(); i++)
+        EXPECT_EQ(output_ptr[i], out1[i]);
+
+    auto output_ptr_2 = outputs.at("relu2").get_memory().pointer<float>();
+    for (size_t i = 0; i < out2.size(); i++)
+        EXPECT_EQ(output_ptr_2[i], out2[i]);
+}
+
+TEST(crop_gpu, in_place_crop_of_nested_concatenation_input) {
+    //  INPUT(1x2x1x1)--RELU-----CONCAT_INNER--CONCAT_OUTER--RELU_OUT
+    //               |--LINEAR_|              |
+    //               |--LINEAR_Z--------------|
+    //  RELU--CROP(1x1x1x1,offset(0x1x0x0))--RELU_CROP
+    //
+    //  Crop must read RELU at its final place in the buffer of the outer concatenation.
+
+    const auto& engine = get_test_engine();
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 2, 1, 1 } });
+    set_values(input, { -1.f, 2.f });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(activation("linear", "input", activation_linear, { 2.f, 0.f }));
+    topology.add(activation("linear_z", "input", activation_linear, { 10.f, 0.f }));
+    topology.add(concatenation("concat_inner", { "relu", "linear" }, concatenation::along_f));
+    topology.add(concatenation("concat_outer", { "linear_z", "concat_inner" }, concatenation::along_f));
+    topology.add(activation("relu_out", "concat_outer", activation_linear, { 1.f, 0.f }));
+    topology.add(crop("crop", "relu", tensor(batch(1), spatial(1, 1), feature(1)), { tensor(feature(1), spatial(0, 0), batch(0)) }));
+    topology.add(activation("relu_crop", "crop", activation_relu));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+
+    network network(engine, topology, bo);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto crop_ptr = outputs.at("relu_crop").get_memory().pointer<float>();
+    EXPECT_EQ(2.f, crop_ptr[0]);
+
+    std::vector<float> expected = { -10.f, 20.f, 0.f, 2.f, -2.f, 4.f };
+    auto output_ptr = outputs.at("relu_out").get_memory().pointer<float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_EQ(expected[i], output_ptr[i]);
+}
@@ -0,0 +1,181 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include "api/CPP/activation.hpp"
+#include "api/CPP/convolution.hpp"
+#include "api/CPP/fully_connected.hpp"
+#include <api/CPP/data.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+TEST(dynamic_batch_gpu, relu_smaller_batch_without_rebuild) {
+    const auto& engine = get_test_engine();
+
+    const int max_batch = 4;
+    topology topology(
+        input_layout("input", { data_types::f32, format::bfyx, { max_batch, 2, 2, 2 } }),
+        activation("relu", "input", activation_relu));
+
+    network network(engine, topology, build_options(build_option::dynamic_batch(true)));
+
+    for (int batch : { 4, 1, 3 })
+    {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { batch, 2, 2, 2 } });
+        std::vector<float> input_vec(input.get_layout().count());
+        for (size_t i = 0; i < input_vec.size(); ++i)
+            input_vec[i] = (i % 2 ? -1.0f : 1.0f) * static_cast<float>(i + batch);
+        set_values(input, input_vec);
+
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output_memory = outputs.at("relu").get_memory();
+        auto output_layout = output_memory.get_layout();
+        EXPECT_EQ(output_layout.size.batch[0], batch);
+        ASSERT_EQ(output_layout.count(), input_vec.size());
+
+        auto output_ptr = output_memory.pointer<float>();
+        for (size_t i = 0; i < input_vec.size(); ++i)
+            EXPECT_FLOAT_EQ(std::max(input_vec[i], 0.0f), output_ptr[i]);
+    }
+}
+
+TEST(dynamic_batch_gpu, convolution_and_fully_connected_smaller_batch) {
+    // kernels which support it are enqueued only for the runtime batch
+    const auto& engine = get_test_engine();
+
+    const int max_batch = 4;
+    auto conv_weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 1, 2, 2 } });
+    auto fc_weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 3, 2, 2, 2 } });
+    std::vector<float> conv_weights_vec = { 1.0f, 2.0f, -1.0f, 0.5f, 0.0f, -2.0f, 1.0f, 1.0f };
+    std::vector<float> fc_weights_vec(fc_weights.get_layout().count());
+    for (size_t i = 0; i < fc_weights_vec.size(); ++i)
+        fc_weights_vec[i] = static_cast<float>(i % 5) - 2.0f;
+    set_values(conv_weights, conv_weights_vec);
+    set_values(fc_weights, fc_weights_vec);
+
+    topology topology(
+        input_layout("input", { data_types::f32, format::bfyx, { max_batch, 1, 3, 3 } }),
+        data("conv_weights", conv_weights),
+        data("fc_weights", fc_weights),
+        convolution("conv", "input", { "conv_weights" }),
+        activation("relu", "conv", activation_relu),
+        fully_connected("fc", "relu", "fc_weights"));
+
+    build_options bo;
+    bo.set_option(build_option::dynamic_batch(true));
+    bo.set_option(build_option::outputs({ "relu", "fc" }));
+    network network(engine, topology, bo);
+
+    for (int batch : { 1, 3, 4, 2 })
+    {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { batch, 1, 3, 3 } });
+        std::vector<float> input_vec(input.get_layout().count());
+        for (size_t i = 0; i < input_vec.size(); ++i)
+            input_vec[i] = static_cast<float>((i * 7 + batch) % 11) - 5.0f;
+        set_values(input, input_vec);
+
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        // relu(conv) is b x 2 x 2 x 2, fc is b x 3
+        std::vector<float> relu_ref;
+        for (int b = 0; b < batch; ++b)
+            for (int f = 0; f < 2; ++f)
+                for (int y = 0; y < 2; ++y)
+                    for (int x = 0; x < 2; ++x)
+                    {
+                        float sum = 0.0f;
+                        for (int ky = 0; ky < 2; ++ky)
+                            for (int kx = 0; kx < 2; ++kx)
+                                sum += input_vec[b * 9 + (y + ky) * 3 + x + kx] * conv_weights_vec[f * 4 + ky * 2 + kx];
+                        relu_ref.push_back(std::max(sum, 0.0f));
+                    }
+
+        auto relu_memory = outputs.at("relu").get_memory();
+        EXPECT_EQ(relu_memory.get_layout().size.batch[0], batch);
+        ASSERT_EQ(relu_memory.get_layout().count(), relu_ref.size());
+        auto relu_ptr = relu_memory.pointer<float>();
+        for (size_t i = 0; i < relu_ref.size(); ++i)
+            EXPECT_FLOAT_EQ(relu_ref[i], relu_ptr[i]) << "batch " << batch << " at " << i;
+
+        auto fc_memory = outputs.at("fc").get_memory();
+        EXPECT_EQ(fc_memory.get_layout().size.batch[0], batch);
+        auto fc_ptr = fc_memory.pointer<float>();
+        for (int b = 0; b < batch; ++b)
+            for (int o = 0; o < 3; ++o)
+            {
+                float sum = 0.0f;
+                for (int i = 0; i < 8; ++i)
+                    sum += relu_ref[b * 8 + i] * fc_weights_vec[o * 8 + i];
+                EXPECT_FLOAT_EQ(sum, fc_ptr[b * 3 + o]) << "batch " << batch;
+            }
+    }
+}
+
+TEST(dynamic_batch_gpu, smaller_batch_rejected_when_disabled) {
+    const auto& engine = get_test_engine();
+
+    topology topology(
+        input_layout("input", { data_types::f32, format::bfyx, { 4, 2, 2, 2 } }),
+        activation("relu", "input", activation_relu));
+
+    network network(engine, topology);
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 2, 2, 2 } });
+    EXPECT_ANY_THROW(network.set_input_data("input", input));
+}
+
+TEST(dynamic_batch_gpu, constant_outputs_keep_their_batch) {
+    // only outputs computed from the network inputs carry the runtime batch, regardless of their own batch
+    const auto& engine = get_test_engine();
+
+    const int max_batch = 4;
+    auto constant = memory::allocate(engine, { data_types::f32, format::bfyx, { max_batch, 1, 1, 1 } });
+    set_values(constant, { -1.0f, 2.0f, -3.0f, 4.0f });
+
+    topology topology(
+        input_layout("input", { data_types::f32, format::bfyx, { max_batch, 1, 1, 1 } }),
+        data("constant", constant),
+        activation("relu", "input", activation_relu),
+        activation("constant_relu", "constant", activation_relu));
+
+    build_options bo;
+    bo.set_option(build_option::dynamic_batch(true));
+    bo.set_option(build_option::outputs({ "relu", "constant_relu" }));
+    network network(engine, topology, bo);
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 1, 1, 1 } });
+    set_values(input, { 1.0f, -2.0f });
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_EQ(outputs.at("relu").get_memory().get_layout().size.batch[0], 2);
+    auto constant_memory = outputs.at("constant_relu").get_memory();
+    EXPECT_EQ(constant_memory.get_layout().size.batch[0], max_batch);
+    auto constant_ptr = constant_memory.pointer<float>();
+    EXPECT_EQ(std::vector<float>(constant_ptr.begin(), constant_ptr.end()), std::vector<float>({ 0.0f, 2.0f, 0.0f, 4.0f }));
+}
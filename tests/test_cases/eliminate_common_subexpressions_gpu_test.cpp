@@ -0,0 +1,186 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+#include <api/CPP/activation.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/data.hpp>
+
+#include <algorithm>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+    bool has_primitive(const network& net, const primitive_id& id)
+    {
+        auto ids = net.get_all_primitive_ids();
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+}
+
+TEST(eliminate_common_subexpressions, duplicated_activations_are_merged) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 2, 2 } });
+    set_values(input, { -1.0f, 2.0f, -3.0f, 4.0f });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("act1", "input", activation_relu_negative_slope, { 0.5f, 0.0f }));
+    topology.add(activation("act2", "input", activation_relu_negative_slope, { 0.5f, 0.0f }));
+    topology.add(eltwise("sum", { "act1", "act2" }, eltwise_mode::sum));
+    network network(engine, topology, build_opt);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "sum");
+
+    // either of the duplicates may be kept, depending on the processing order
+    EXPECT_NE(has_primitive(network, "act1"), has_primitive(network, "act2"));
+
+    std::vector<float> expected = { -1.0f, 4.0f, -3.0f, 8.0f };
+    auto output = outputs.at("sum").get_memory().pointer<float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], output[i]);
+}
+
+TEST(eliminate_common_subexpressions, activations_with_different_parameters_are_kept) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 2, 2 } });
+    set_values(input, { -1.0f, 2.0f, -3.0f, 4.0f });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("act1", "input", activation_relu_negative_slope, { 0.5f, 0.0f }));
+    topology.add(activation("act2", "input", activation_relu_negative_slope, { 0.25f, 0.0f }));
+    topology.add(eltwise("sum", { "act1", "act2" }, eltwise_mode::sum));
+    network network(engine, topology, build_opt);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    EXPECT_TRUE(has_primitive(network, "act1"));
+    EXPECT_TRUE(has_primitive(network, "act2"));
+
+    std::vector<float> expected = { -0.75f, 4.0f, -2.25f, 8.0f };
+    auto output = outputs.at("sum").get_memory().pointer<float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], output[i]);
+}
+
+TEST(eliminate_common_subexpressions, equal_weights_of_convolutions_are_kept) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 4, 4 } });
+    set_values(input, { 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f });
+    auto weights1 = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+    auto weights2 = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+    set_values(weights1, { 0.5f });
+    set_values(weights2, { 0.5f });
+
+    // convolutions 1x1 with stride are users of eltwise, so graph optimizer looks their weights up by ids
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights1", weights1));
+    topology.add(data("weights2", weights2));
+    topology.add(eltwise("sum", { "input", "input" }, eltwise_mode::sum));
+    topology.add(convolution("conv1", "sum", { "weights1" }, { 1, 1, 2, 2 }));
+    topology.add(convolution("conv2", "sum", { "weights2" }, { 1, 1, 2, 2 }));
+    network network(engine, topology, build_opt);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    std::vector<float> expected = { 1.0f, 3.0f, 9.0f, 11.0f };
+    for (auto id : { "conv1", "conv2" })
+    {
+        auto output = outputs.at(id).get_memory().pointer<float>();
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_FLOAT_EQ(expected[i], output[i]) << id;
+    }
+}
+
+TEST(eliminate_common_subexpressions, equal_weights_computed_by_primitives_are_kept) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 2, 2 } });
+    set_values(input, { 1.0f, 2.0f, 3.0f, 4.0f });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+    set_values(weights, { 0.5f });
+
+    // activations are equal, but convolutions refer to them by ids of their weights
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights", weights));
+    topology.add(activation("weights1", "weights", activation_relu));
+    topology.add(activation("weights2", "weights", activation_relu));
+    topology.add(convolution("conv1", "input", { "weights1" }));
+    topology.add(convolution("conv2", "input", { "weights2" }));
+    network network(engine, topology, build_opt);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    std::vector<float> expected = { 0.5f, 1.0f, 1.5f, 2.0f };
+    for (auto id : { "conv1", "conv2" })
+    {
+        auto output = outputs.at(id).get_memory().pointer<float>();
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_FLOAT_EQ(expected[i], output[i]) << id;
+    }
+}
+
+TEST(eliminate_common_subexpressions, merged_nodes_are_reported_in_build_profiling) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+    build_opt.set_option(build_option::build_profiling(true));
+
+    topology topology;
+    topology.add(input_layout("input", layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 })));
+    topology.add(activation("act1", "input", activation_relu));
+    topology.add(activation("act2", "input", activation_relu));
+    topology.add(eltwise("sum", { "act1", "act2" }, eltwise_mode::sum));
+    program prog(engine, topology, build_opt);
+
+    auto entries = prog.get_build_profiling_info();
+    auto merged = std::find_if(entries.begin(), entries.end(), [](const build_profiling_entry& e)
+    {
+        return e.category == "pass" && e.name == "eliminate_common_subexpressions" && !e.details.empty();
+    });
+    ASSERT_NE(merged, entries.end());
+    EXPECT_EQ(merged->details, "merged activation: 1");
+}
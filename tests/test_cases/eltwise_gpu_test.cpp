@@ -24,6 +24,8 @@
 #include <api/CPP/engine.hpp>
 #include <api/CPP/reorder.hpp>
 #include <api/CPP/data.hpp>
+#include <api/CPP/scale.hpp>
+#include <api/CPP/activation.hpp>
 #include "test_utils/test_utils.h"
 
 namespace cldnn
@@ -2118,6 +2120,110 @@ TEST(eltwise_gpu, b_fs_yx_fsv4_wo_callib) {
     }
 }
 
+TEST(eltwise_gpu, fused_scale_activation_eltwise_chain) {
+    const auto& engine = get_test_engine();
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    auto scale_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+    auto shift_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+    auto mul_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+
+    std::vector<float> in1 = { 1.f, -2.f, 3.f, -4.f, 5.f, -6.f, 7.f, -8.f };
+    std::vector<float> in2 = { 0.5f, 0.5f, -0.5f, -0.5f, 1.f, 1.f, -1.f, -1.f };
+    std::vector<float> scales = { 2.f, -1.f };
+    std::vector<float> shifts = { 1.f, 0.5f };
+    std::vector<float> muls = { 3.f, 0.25f };
+    set_values(input1, in1);
+    set_values(input2, in2);
+    set_values(scale_mem, scales);
+    set_values(shift_mem, shifts);
+    set_values(mul_mem, muls);
+
+    topology topology(
+        input_layout("input1", input1.get_layout()),
+        input_layout("input2", input2.get_layout()),
+        data("scale_data", scale_mem),
+        data("shift_data", shift_mem),
+        data("mul_data", mul_mem),
+        eltwise("sum", { "input1", "input2" }, eltwise_mode::sum),
+        scale("scale", "sum", "scale_data", "shift_data"),
+        activation("relu", "scale", activation_relu),
+        eltwise("mul", { "mul_data", "relu" }, eltwise_mode::prod),
+        reorder("out", "mul", format::yxfb, data_types::f32));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    network network(engine, topology, bo);
+    network.set_input_data("input1", input1);
+    network.set_input_data("input2", input2);
+    auto outputs = network.execute();
+
+    // scale, relu and mul are executed by the sum kernel
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "sum"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "scale"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "relu"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "mul"), executed.end());
+
+    auto output = outputs.at("out").get_memory();
+    auto output_ptr = output.pointer<float>();
+    for (int f = 0; f < 2; f++)
+    {
+        for (int yx = 0; yx < 4; yx++)
+        {
+            size_t idx = f * 4 + yx;
+            float expected = std::max((in1[idx] + in2[idx]) * scales[f] + shifts[f], 0.f) * muls[f];
+            // yxfb output: f is the second fastest dimension after b
+            EXPECT_FLOAT_EQ(expected, output_ptr[yx * 2 + f]);
+        }
+    }
+}
+
+TEST(eltwise_gpu, not_fused_when_constant_is_first_operand_of_sub) {
+    const auto& engine = get_test_engine();
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    auto sub_mem = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+
+    std::vector<float> in1 = { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f };
+    std::vector<float> in2 = { 1.f, 1.f, 1.f, 1.f, 2.f, 2.f, 2.f, 2.f };
+    std::vector<float> subs = { 10.f, 20.f };
+    set_values(input1, in1);
+    set_values(input2, in2);
+    set_values(sub_mem, subs);
+
+    topology topology(
+        input_layout("input1", input1.get_layout()),
+        input_layout("input2", input2.get_layout()),
+        data("sub_data", sub_mem),
+        eltwise("sum", { "input1", "input2" }, eltwise_mode::sum),
+        eltwise("sub", { "sub_data", "sum" }, eltwise_mode::sub),
+        reorder("out", "sub", format::yxfb, data_types::f32));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    network network(engine, topology, bo);
+    network.set_input_data("input1", input1);
+    network.set_input_data("input2", input2);
+    auto outputs = network.execute();
+
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "sub"), executed.end());
+
+    auto output = outputs.at("out").get_memory();
+    auto output_ptr = output.pointer<float>();
+    for (int f = 0; f < 2; f++)
+    {
+        for (int yx = 0; yx < 4; yx++)
+        {
+            size_t idx = f * 4 + yx;
+            EXPECT_FLOAT_EQ(subs[f] - (in1[idx] + in2[idx]), output_ptr[yx * 2 + f]);
+        }
+    }
+}
+
 TEST(DISABLED_eltwise_gpu, generic_random) {
     VF<cldnn::format> test_inputs_fmts = { cldnn::format::bfyx, cldnn::format::yxfb };
     VF<cldnn::eltwise_mode> modes = { cldnn::eltwise_mode::sum, cldnn::eltwise_mode::sub, cldnn::eltwise_mode::max, cldnn::eltwise_mode::prod };
@@ -25,7 +25,11 @@
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
 #include <api/CPP/data.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/reorder.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace cldnn
@@ -775,6 +779,57 @@ TEST(fully_connected_gpu, x_f32_relu_with_negative_slope) {
     EXPECT_EQ(-0.1f, output_ptr[3]);
 }
 
+TEST(fully_connected_gpu, fused_eltwise_and_activation) {
+    //  Input  : 3x1
+    //  Output : 4x1
+    //  Weights: 4x3
+    //
+    //  FC output: 1.5  -0.25  -1.25  3.0
+    //  Shift:     -1    1      2    -4
+    //  After sum and relu: 0.5  0.75  0.75  0
+
+    const auto& engine = get_test_engine();
+
+    auto input_prim = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 3, 1 } });
+    auto weights_prim = memory::allocate(engine, { data_types::f32, format::bfyx, { 4, 1, 3, 1 } });
+    auto shift_prim = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 4, 1, 1 } });
+
+    set_values(input_prim, { -0.5f, 2.0f, 0.5f });
+    set_values(weights_prim, { 1.5f, 1.0f, 0.5f, -1.0f, 0.0f, 0.5f, 0.5f, -0.5f, -2.0f, -0.5f, 1.0f, 1.5f });
+    set_values(shift_prim, { -1.0f, 1.0f, 2.0f, -4.0f });
+
+    topology topology(
+        input_layout("input", input_prim.get_layout()),
+        data("weights", weights_prim),
+        data("shift", shift_prim),
+        fully_connected("fc", "input", "weights"),
+        eltwise("sum", { "fc", "shift" }, eltwise_mode::sum),
+        activation("relu", "sum", activation_relu),
+        reorder("out", "relu", format::bfyx, data_types::f32)
+    );
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    network network(engine, topology, bo);
+    network.set_input_data("input", input_prim);
+
+    auto outputs = network.execute();
+
+    // sum and relu are applied by the fully connected kernel
+    auto executed = network.get_executed_primitive_ids();
+    EXPECT_NE(std::find(executed.begin(), executed.end(), "fc"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "sum"), executed.end());
+    EXPECT_EQ(std::find(executed.begin(), executed.end(), "relu"), executed.end());
+
+    auto output_prim = outputs.at("out").get_memory();
+    auto output_ptr = output_prim.pointer<float>();
+
+    EXPECT_FLOAT_EQ(0.5f, output_ptr[0]);
+    EXPECT_FLOAT_EQ(0.75f, output_ptr[1]);
+    EXPECT_FLOAT_EQ(0.75f, output_ptr[2]);
+    EXPECT_FLOAT_EQ(0.0f, output_ptr[3]);
+}
+
 TEST(fully_connected_gpu, b_fs_yx_fsv4)
 {
     const auto& engine = get_test_engine();
@@ -0,0 +1,125 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+#include <api/CPP/cldnn_defs.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    uint32_t float_bits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    bool is_half_nan(uint16_t value)
+    {
+        return (value & 0x7C00) == 0x7C00 && (value & 0x03FF) != 0;
+    }
+}
+
+TEST(half_conversion, half_to_float_array_matches_scalar_for_all_values)
+{
+    // odd size to exercise the tail of every vector path
+    std::vector<half_t> src(0x10000 + 3);
+    for (size_t i = 0; i < src.size(); ++i)
+        src[i] = half_t(static_cast<uint16_t>(i & 0xFFFF));
+    std::vector<float> dst(src.size());
+
+    cldnn::half_to_float(src.data(), dst.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        const uint16_t h = static_cast<uint16_t>(src[i]);
+        const float expected = static_cast<float>(src[i]);
+        if (is_half_nan(h))
+        {
+            EXPECT_NE(dst[i], dst[i]) << "half: " << h;
+            continue;
+        }
+        EXPECT_EQ(float_bits(expected), float_bits(dst[i])) << "half: " << h;
+    }
+}
+
+TEST(half_conversion, float_to_half_array_matches_scalar)
+{
+    std::vector<float> src = {
+        0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 3.14159f, -2.71828f,
+        65504.0f, -65504.0f, 65519.0f, 70000.0f, -1.0e10f,
+        std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+        6.103515625e-05f, 6.0e-05f, 1.0e-06f, -3.0e-07f, 1.0e-10f
+    };
+    // normal range of half, with mantissa bits which have to be dropped
+    for (int i = -14; i <= 15; ++i)
+    {
+        for (float m = 1.0f; m < 2.0f; m += 0.0371f)
+        {
+            src.push_back(std::ldexp(m, i));
+            src.push_back(-std::ldexp(m, i));
+        }
+    }
+    std::vector<half_t> dst(src.size());
+
+    cldnn::float_to_half(src.data(), dst.data(), src.size());
+
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        const int expected = static_cast<uint16_t>(half_t(src[i]));
+        const int actual = static_cast<uint16_t>(dst[i]);
+        // hardware conversion truncates subnormals exactly, scalar one may round them up by one ulp
+        if (std::fabs(src[i]) < 6.103515625e-05f)
+            EXPECT_LE(std::abs(expected - actual), 1) << "float: " << src[i];
+        else
+            EXPECT_EQ(expected, actual) << "float: " << src[i];
+    }
+}
+
+TEST(half_conversion, empty_array)
+{
+    EXPECT_NO_THROW(cldnn::float_to_half(nullptr, nullptr, 0));
+    EXPECT_NO_THROW(cldnn::half_to_float(nullptr, nullptr, 0));
+}
+
+TEST(half_conversion, DISABLED_throughput)
+{
+    const size_t count = 1 << 22;
+    const int iterations = 20;
+    std::vector<float> src(count);
+    for (size_t i = 0; i < count; ++i)
+        src[i] = static_cast<float>(i % 4096) / 64.0f - 32.0f;
+    std::vector<half_t> half_dst(count);
+    std::vector<float> float_dst(count);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        cldnn::float_to_half(src.data(), half_dst.data(), count);
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i)
+        cldnn::half_to_float(half_dst.data(), float_dst.data(), count);
+    auto end = std::chrono::high_resolution_clock::now();
+
+    const double elements = static_cast<double>(count) * iterations;
+    std::cout << "float_to_half: " << elements / std::chrono::duration<double>(mid - start).count() / 1e6 << " Melem/s" << std::endl;
+    std::cout << "half_to_float: " << elements / std::chrono::duration<double>(end - mid).count() / 1e6 << " Melem/s" << std::endl;
+}
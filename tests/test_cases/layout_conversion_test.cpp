@@ -0,0 +1,225 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace cldnn;
+
+namespace
+{
+    std::vector<float> make_bfyx_data(const tensor& size)
+    {
+        std::vector<float> data(size.count());
+        for (size_t i = 0; i < data.size(); ++i)
+            data[i] = static_cast<float>(i % 1000) - 500.0f;
+        return data;
+    }
+
+    size_t bfyx_index(const tensor& size, int b, int f, int y, int x)
+    {
+        return ((static_cast<size_t>(b) * size.feature[0] + f) * size.spatial[1] + y) * size.spatial[0] + x;
+    }
+}
+
+TEST(layout_conversion, plain_formats_round_trip)
+{
+    const tensor size(3, 37, 17, 19);
+    const layout bfyx_layout(data_types::f32, format::bfyx, size);
+    auto src = make_bfyx_data(size);
+
+    for (auto fmt : { format::byxf, format::yxfb, format::fyxb })
+    {
+        const layout other_layout(data_types::f32, fmt, size);
+        std::vector<float> converted(other_layout.get_linear_size());
+        std::vector<float> back(src.size());
+
+        convert_layout(bfyx_layout, src.data(), other_layout, converted.data());
+        convert_layout(other_layout, converted.data(), bfyx_layout, back.data());
+
+        for (int b = 0; b < size.batch[0]; ++b)
+            for (int f = 0; f < size.feature[0]; ++f)
+                for (int y = 0; y < size.spatial[1]; ++y)
+                    for (int x = 0; x < size.spatial[0]; ++x)
+                    {
+                        auto expected = src[bfyx_index(size, b, f, y, x)];
+                        ASSERT_EQ(expected, converted[other_layout.get_linear_offset(tensor(b, f, x, y, 0))]);
+                    }
+        EXPECT_EQ(src, back);
+    }
+}
+
+TEST(layout_conversion, padded_destination_is_zero_filled)
+{
+    const tensor size(2, 3, 4, 5);
+    const layout src_layout(data_types::f32, format::bfyx, size);
+    const layout dst_layout(data_types::f32, format::bfyx, size, padding({ 0, 0, 1, 2 }, 0.0f));
+    auto src = make_bfyx_data(size);
+    std::vector<float> dst(dst_layout.get_linear_size(), 42.0f);
+
+    convert_layout(src_layout, src.data(), dst_layout, dst.data());
+
+    size_t non_zero = 0;
+    for (auto v : dst)
+        non_zero += v != 0.0f ? 1 : 0;
+    EXPECT_LE(non_zero, src.size());
+
+    for (int b = 0; b < size.batch[0]; ++b)
+        for (int f = 0; f < size.feature[0]; ++f)
+            for (int y = 0; y < size.spatial[1]; ++y)
+                for (int x = 0; x < size.spatial[0]; ++x)
+                    ASSERT_EQ(src[bfyx_index(size, b, f, y, x)], dst[dst_layout.get_linear_offset(tensor(b, f, x, y, 0))]);
+}
+
+TEST(layout_conversion, bfyx_to_bfyx_f16_with_type_conversion)
+{
+    const tensor size(2, 20, 3, 2);
+    const layout src_layout(data_types::f32, format::bfyx, size);
+    const layout dst_layout(data_types::f16, format::bfyx_f16, size);
+    auto src = make_bfyx_data(size);
+    std::vector<half_t> dst(dst_layout.get_linear_size());
+
+    convert_layout(src_layout, src.data(), dst_layout, dst.data());
+
+    // b, f / 16, y, x, f % 16; features are aligned to 32
+    const int x_pitch = 16;
+    const int y_pitch = x_pitch * size.spatial[0];
+    const int fs_pitch = y_pitch * size.spatial[1];
+    const int b_pitch = fs_pitch * 2;
+    for (int b = 0; b < size.batch[0]; ++b)
+        for (int f = 0; f < 32; ++f)
+            for (int y = 0; y < size.spatial[1]; ++y)
+                for (int x = 0; x < size.spatial[0]; ++x)
+                {
+                    auto idx = b * b_pitch + (f / 16) * fs_pitch + y * y_pitch + x * x_pitch + f % 16;
+                    auto expected = f < size.feature[0] ? src[bfyx_index(size, b, f, y, x)] : 0.0f;
+                    ASSERT_EQ(expected, static_cast<float>(dst[idx]));
+                }
+}
+
+TEST(layout_conversion, fs_b_yx_fsv32_round_trip)
+{
+    const tensor size(3, 40, 5, 3);
+    const layout bfyx_layout(data_types::f32, format::bfyx, size);
+    const layout blocked_layout(data_types::f32, format::fs_b_yx_fsv32, size);
+    auto src = make_bfyx_data(size);
+    std::vector<float> blocked(blocked_layout.get_linear_size());
+    std::vector<float> back(src.size());
+
+    convert_layout(bfyx_layout, src.data(), blocked_layout, blocked.data());
+    convert_layout(blocked_layout, blocked.data(), bfyx_layout, back.data());
+
+    // fs, b, y, x, f % 32
+    const int b = 2, f = 35, y = 1, x = 4;
+    auto idx = (((f / 32) * size.batch[0] + b) * size.spatial[1] + y) * size.spatial[0] * 32 + x * 32 + f % 32;
+    EXPECT_EQ(src[bfyx_index(size, b, f, y, x)], blocked[idx]);
+    EXPECT_EQ(src, back);
+}
+
+TEST(layout_conversion, os_iyx_osv16_weights)
+{
+    const tensor size(20, 3, 3, 3);
+    const layout src_layout(data_types::f32, format::bfyx, size);
+    const layout dst_layout(data_types::f32, format::os_iyx_osv16, size);
+    auto src = make_bfyx_data(size);
+    std::vector<float> dst(dst_layout.get_linear_size());
+
+    convert_layout(src_layout, src.data(), dst_layout, dst.data());
+
+    for (int o = 0; o < size.batch[0]; ++o)
+        for (int i = 0; i < size.feature[0]; ++i)
+            for (int y = 0; y < size.spatial[1]; ++y)
+                for (int x = 0; x < size.spatial[0]; ++x)
+                {
+                    auto idx = (o / 16) * 16 * 27 + ((i * 3 + y) * 3 + x) * 16 + o % 16;
+                    ASSERT_EQ(src[bfyx_index(size, o, i, y, x)], dst[idx]);
+                }
+}
+
+TEST(layout_conversion, memory_objects)
+{
+    const tensor size(1, 3, 2, 2);
+    std::vector<float> src_data = make_bfyx_data(size);
+    for (auto& v : src_data)
+        v = std::abs(v) / 4.0f;
+    std::vector<uint8_t> dst_data(size.count());
+    auto src = memory::attach(layout(data_types::f32, format::bfyx, size), src_data.data(), src_data.size());
+    auto dst = memory::attach(layout(data_types::u8, format::byxf, size), dst_data.data(), dst_data.size());
+
+    convert_layout(src, dst);
+
+    auto dst_layout = dst.get_layout();
+    for (int f = 0; f < 3; ++f)
+        for (int y = 0; y < 2; ++y)
+            for (int x = 0; x < 2; ++x)
+                EXPECT_EQ(static_cast<uint8_t>(std::nearbyint(src_data[bfyx_index(size, 0, f, y, x)])), dst_data[dst_layout.get_linear_offset(tensor(0, f, x, y, 0))]);
+}
+
+TEST(layout_conversion, invalid_arguments)
+{
+    std::vector<float> src(64), dst(1024);
+    const layout src_layout(data_types::f32, format::bfyx, { 1, 4, 4, 4 });
+
+    EXPECT_ANY_THROW(convert_layout(src_layout, src.data(), layout(data_types::f32, format::bfyx, { 1, 4, 4, 2 }), dst.data()));
+    EXPECT_ANY_THROW(convert_layout(src_layout, src.data(), layout(data_types::f32, format::bf8_xy16, { 1, 4, 4, 4 }), dst.data()));
+}
+
+TEST(layout_conversion, float_to_int8_is_rounded_and_saturated)
+{
+    const tensor size(1, 1, 8, 1);
+    const layout src_layout(data_types::f32, format::bfyx, size);
+    std::vector<float> src = { 1.4f, 1.5f, 2.5f, -2.6f, 300.0f, -300.0f, 1e20f, NAN };
+
+    std::vector<int8_t> dst_i8(src.size());
+    convert_layout(src_layout, src.data(), layout(data_types::i8, format::bfyx, size), dst_i8.data());
+    EXPECT_EQ(std::vector<int8_t>({ 1, 2, 2, -3, 127, -128, 127, 0 }), dst_i8);
+
+    std::vector<uint8_t> dst_u8(src.size());
+    convert_layout(src_layout, src.data(), layout(data_types::u8, format::bfyx, size), dst_u8.data());
+    EXPECT_EQ(std::vector<uint8_t>({ 1, 2, 2, 0, 255, 0, 255, 0 }), dst_u8);
+}
+
+TEST(layout_conversion, integer_narrowing_is_saturated)
+{
+    const tensor size(1, 1, 6, 1);
+
+    std::vector<int32_t> src_i32 = { 0, 100, 300, -5, -300, 2147483647 };
+    const layout src_i32_layout(data_types::i32, format::bfyx, size);
+
+    std::vector<uint8_t> dst_u8(src_i32.size());
+    convert_layout(src_i32_layout, src_i32.data(), layout(data_types::u8, format::bfyx, size), dst_u8.data());
+    EXPECT_EQ(std::vector<uint8_t>({ 0, 100, 255, 0, 0, 255 }), dst_u8);
+
+    std::vector<int8_t> dst_i8(src_i32.size());
+    convert_layout(src_i32_layout, src_i32.data(), layout(data_types::i8, format::bfyx, size), dst_i8.data());
+    EXPECT_EQ(std::vector<int8_t>({ 0, 100, 127, -5, -128, 127 }), dst_i8);
+
+    std::vector<int64_t> src_i64 = { 1, -1, 129, -129, INT64_MAX, INT64_MIN };
+    std::vector<int8_t> dst_i8_from_i64(src_i64.size());
+    convert_layout(layout(data_types::i64, format::bfyx, size), src_i64.data(), layout(data_types::i8, format::bfyx, size), dst_i8_from_i64.data());
+    EXPECT_EQ(std::vector<int8_t>({ 1, -1, 127, -128, 127, -128 }), dst_i8_from_i64);
+
+    std::vector<uint8_t> src_u8 = { 0, 1, 127, 128, 200, 255 };
+    std::vector<int8_t> dst_i8_from_u8(src_u8.size());
+    convert_layout(layout(data_types::u8, format::bfyx, size), src_u8.data(), layout(data_types::i8, format::bfyx, size), dst_i8_from_u8.data());
+    EXPECT_EQ(std::vector<int8_t>({ 0, 1, 127, 127, 127, 127 }), dst_i8_from_u8);
+}
@@ -657,7 +657,7 @@ void generic_lstm_gpu_test(int layers, int sequence_len, int direction, int batc
 
 // -------------------------------------------------------
 template<typename T>
-void lstm_gpu_output_test(const cldnn_lstm_output& output_selection, int directions) {
+void lstm_gpu_output_test(const cldnn_lstm_output& output_selection, int directions, bool concatenated_input = false) {
     int layers = 1;
     int sequence_len = 4;
     int batch_size = 3;
@@ -718,12 +718,19 @@ void lstm_gpu_output_test(const cldnn_lstm_output& output_selection, int directi
     std::vector<primitive_id> output_ids_offsets;
 
     topology.add(input_layout("input", input.get_layout()));
-    for (int i = 0; i < sequence_len; ++i)
+    if (concatenated_input)
     {
-        input_ids_offsets.push_back({get_string_id(i), {0, i, 0, 0}});
-        lstm_inputs.push_back("inputSplit:"+get_string_id(i));
+        lstm_inputs.push_back("input");
+    }
+    else
+    {
+        for (int i = 0; i < sequence_len; ++i)
+        {
+            input_ids_offsets.push_back({get_string_id(i), {0, i, 0, 0}});
+            lstm_inputs.push_back("inputSplit:"+get_string_id(i));
+        }
+        topology.add(split("inputSplit", "input", input_ids_offsets));
     }
-    topology.add(split("inputSplit", "input", input_ids_offsets));
     topology.add(data("weights", weights));
     topology.add(data("recurrent", recurrent));
     topology.add(data("biases", biases));
@@ -747,6 +754,14 @@ void lstm_gpu_output_test(const cldnn_lstm_output& output_selection, int directi
     network.set_input_data("cell", cell);
 
     auto outputs = network.execute();
+
+    if (concatenated_input)
+    {
+        // the whole sequence is executed by a single primitive, no per-timestep nodes are created
+        for (auto& id : network.get_all_primitive_ids())
+            EXPECT_EQ(std::string::npos, id.find("lstm_gemm")) << id;
+    }
+
 	uint32_t ref_num_output_primitives = 1;  // Output will return atleast 1 primitive
 
 	if (emit_last_cell) {
@@ -1887,6 +1902,39 @@ TEST(lstm_gpu, generic_lstm_concatenated_input_multi_layer) {
     lstm_gpu_concatenated_input_test<float>(5, 5, 2, 1, 1, 4, true, true, true);
 }
 
+TEST(lstm_gpu, generic_lstm_concatenated_input_long_sequence) {
+    lstm_gpu_concatenated_input_test<float>(1, 100, 1, 2, 3, 8, true, true, true);
+}
+
+TEST(lstm_gpu, generic_lstm_concatenated_input_long_sequence_bi) {
+    lstm_gpu_concatenated_input_test<float>(1, 100, 2, 2, 3, 8, true, true, true);
+}
+
+TEST(lstm_gpu, generic_lstm_concatenated_input_no_bias_hidden_cell) {
+    lstm_gpu_concatenated_input_test<float>(1, 7, 1, 3, 5, 4, false, false, false);
+}
+
+TEST(lstm_gpu, generic_lstm_concatenated_input_clip_input_forget) {
+    lstm_gpu_concatenated_input_test<float>(1, 7, 1, 3, 5, 4, true, true, true, 0.3f, true);
+}
+
+// LSTM with concatenated input executed as a single sequence primitive
+TEST(lstm_gpu, output_test_concatenated_sequence_f32) {
+    lstm_gpu_output_test<float>(cldnn_lstm_output::cldnn_lstm_output_sequence, 1, true);
+}
+
+TEST(lstm_gpu, output_test_concatenated_hidden_f32) {
+    lstm_gpu_output_test<float>(cldnn_lstm_output::cldnn_lstm_output_hidden, 1, true);
+}
+
+TEST(lstm_gpu, output_test_concatenated_hidden_cell_f32) {
+    lstm_gpu_output_test<float>(cldnn_lstm_output::cldnn_lstm_output_hidden_cell, 1, true);
+}
+
+TEST(lstm_gpu, output_test_concatenated_sequence_cell_bi_f32) {
+    lstm_gpu_output_test<float>(cldnn_lstm_output::cldnn_lstm_output_sequence_cell, 2, true);
+}
+
 // test for LSTM with chain and stack (multilayer)
 TEST(lstm_gpu, generic_lstm_chained_unidirectional_f32) {
     // batch size = 1
@@ -0,0 +1,76 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include "api/CPP/activation.hpp"
+#include "api/CPP/pooling.hpp"
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+    std::vector<float> values(const memory& mem)
+    {
+        auto ptr = mem.pointer<float>();
+        return std::vector<float>(ptr.begin(), ptr.end());
+    }
+}
+
+TEST(network_output_handles, execute_fills_outputs_of_handles) {
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 1 } });
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_relu),
+        pooling("pool", "relu", pooling_mode::max, { 1, 1, 2, 1 }, { 1, 1, 2, 1 }));
+
+    build_options options;
+    options.set_option(build_option::outputs({ "relu", "pool" }));
+    network network(engine, topology, options);
+
+    std::vector<network_output_handle> handles = { network.get_output_handle("pool"), network.get_output_handle("relu") };
+    EXPECT_NE(handles[0], handles[1]);
+    EXPECT_ANY_THROW(network.get_output_handle("input"));
+
+    std::vector<network_output> outputs;
+    set_values(input, { -1.0f, 2.0f, 3.0f, -4.0f });
+    network.set_input_data("input", input);
+    network.execute(handles, outputs);
+    ASSERT_EQ(outputs.size(), 2u);
+    EXPECT_EQ(values(outputs[0].get_memory()), std::vector<float>({ 2.0f, 3.0f }));
+    EXPECT_EQ(values(outputs[1].get_memory()), std::vector<float>({ 0.0f, 2.0f, 3.0f, 0.0f }));
+
+    // results of the next execution are stored in the same elements
+    auto results = network.execute();
+    set_values(input, { 5.0f, -6.0f, -7.0f, 8.0f });
+    network.set_input_data("input", input);
+    network.execute(handles, outputs);
+    ASSERT_EQ(outputs.size(), 2u);
+    EXPECT_EQ(values(outputs[0].get_memory()), std::vector<float>({ 5.0f, 8.0f }));
+    EXPECT_EQ(values(outputs[1].get_memory()), std::vector<float>({ 5.0f, 0.0f, 0.0f, 8.0f }));
+    EXPECT_TRUE(outputs[0].get_memory() == results.at("pool").get_memory());
+    EXPECT_TRUE(outputs[1].get_memory() == results.at("relu").get_memory());
+}
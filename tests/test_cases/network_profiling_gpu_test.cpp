@@ -0,0 +1,140 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+#include <api/CPP/activation.hpp>
+#include <api/CPP/pooling.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+    topology make_pooling_relu_topology(const layout& input_layout_desc)
+    {
+        topology topology;
+        topology.add(input_layout("input", input_layout_desc));
+        topology.add(pooling("pool", "input", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+        topology.add(activation("act", "pool", activation_relu));
+        // outputs are not fused, so the activation fused into pooling needs a user
+        topology.add(activation("out", "act", activation_linear, { 2.0f, 0.0f }));
+        return topology;
+    }
+}
+
+TEST(network_profiling, stats_are_aggregated_over_executions) {
+    engine engine(engine_configuration(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 4, 4 } });
+    set_values(input, std::vector<float>(16, 1.0f));
+
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+    network network(engine, make_pooling_relu_topology(input.get_layout()), build_opt);
+    network.set_input_data("input", input);
+
+    const uint64_t executions = 5;
+    for (uint64_t i = 0; i < executions; i++)
+        network.execute();
+
+    auto stats = network.get_profiling_stats();
+    auto pool = std::find_if(stats.begin(), stats.end(), [](const primitive_profiling_stats& s) { return s.id == "pool"; });
+    ASSERT_NE(pool, stats.end());
+
+    EXPECT_EQ(pool->count, executions);
+    EXPECT_FALSE(pool->kernel_name.empty());
+    // activation is fused into pooling, so its time is attributed to pooling
+    EXPECT_NE(std::find(pool->original_ids.begin(), pool->original_ids.end(), "act"), pool->original_ids.end());
+    EXPECT_LE(pool->min, pool->median);
+    EXPECT_LE(pool->median, pool->p99);
+    EXPECT_GE(pool->total, pool->min * executions);
+    EXPECT_GT(pool->enqueue_total.count(), 0);
+
+    network.reset_profiling_stats();
+    network.execute();
+    stats = network.get_profiling_stats();
+    pool = std::find_if(stats.begin(), stats.end(), [](const primitive_profiling_stats& s) { return s.id == "pool"; });
+    ASSERT_NE(pool, stats.end());
+    EXPECT_EQ(pool->count, 1u);
+}
+
+TEST(network_profiling, stats_are_exported_to_csv) {
+    engine engine(engine_configuration(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 4, 4 } });
+    set_values(input, std::vector<float>(16, 1.0f));
+
+    network network(engine, make_pooling_relu_topology(input.get_layout()));
+    network.set_input_data("input", input);
+    network.execute();
+
+    const std::string csv_path = "network_profiling_stats_test.csv";
+    network.dump_profiling_stats("", csv_path);
+
+    std::ifstream csv(csv_path);
+    ASSERT_TRUE(csv.good());
+    std::string header, line;
+    std::getline(csv, header);
+    EXPECT_EQ(header.find("primitive,kernel,original_ids,count"), 0u);
+
+    bool pool_found = false;
+    while (std::getline(csv, line))
+        pool_found |= line.find("pool,") == 0;
+    EXPECT_TRUE(pool_found);
+
+    csv.close();
+    std::remove(csv_path.c_str());
+}
+
+TEST(network_profiling, csv_quotes_ids_with_separators) {
+    engine engine(engine_configuration(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 4, 4 } });
+    set_values(input, std::vector<float>(16, 1.0f));
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(pooling("pool,\"1\"", "input", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.execute();
+
+    const std::string csv_path = "network_profiling_quoted_ids_test.csv";
+    network.dump_profiling_stats("", csv_path);
+
+    std::ifstream csv(csv_path);
+    ASSERT_TRUE(csv.good());
+    std::string line;
+    bool pool_found = false;
+    while (std::getline(csv, line))
+        pool_found |= line.find("\"pool,\"\"1\"\"\",") == 0;
+    EXPECT_TRUE(pool_found);
+
+    csv.close();
+    std::remove(csv_path.c_str());
+}
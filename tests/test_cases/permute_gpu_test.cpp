@@ -25,7 +25,10 @@
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
 #include <api/CPP/data.hpp>
+#include <api/CPP/reshape.hpp>
+#include <api/CPP/activation.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <gmock/gmock.h>
 #include <limits>
@@ -338,4 +341,120 @@ TEST(permute_gpu_i32, basic_bfyx_permute_0_1_3_2) {
 
 TEST(permute_gpu_i64, basic_bfyx_permute_0_1_3_2) {
     permute_test_with_reorder<data_types::i64>();
-}
\ No newline at end of file
+}
+
+namespace {
+    // dims and order are in bfyx order, output dimension i is input dimension order[i]
+    std::vector<float> permute_reference(const std::vector<float>& input, const std::vector<int>& dims, const std::vector<uint16_t>& order)
+    {
+        std::vector<int> out_dims(4);
+        for (size_t i = 0; i < 4; i++)
+            out_dims[i] = dims[order[i]];
+
+        std::vector<float> output;
+        std::vector<int> in_coord(4);
+        for (int b = 0; b < out_dims[0]; b++)
+            for (int f = 0; f < out_dims[1]; f++)
+                for (int y = 0; y < out_dims[2]; y++)
+                    for (int x = 0; x < out_dims[3]; x++)
+                    {
+                        int out_coord[4] = { b, f, y, x };
+                        for (size_t i = 0; i < 4; i++)
+                            in_coord[order[i]] = out_coord[i];
+                        output.push_back(input[((in_coord[0] * dims[1] + in_coord[1]) * dims[2] + in_coord[2]) * dims[3] + in_coord[3]]);
+                    }
+        return output;
+    }
+
+    bool has_primitive(const network& network, const primitive_id& id)
+    {
+        auto ids = network.get_all_primitive_ids();
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+}
+
+TEST(permute_gpu_f32, chain_of_permutes_is_merged)
+{
+    const auto& engine = get_test_engine();
+
+    // bfyx: 2x3x4x5
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 3, 5, 4 } });
+    auto input_vec = generate_random_1d<float>(input.get_layout().count(), -10, 10);
+    set_values(input, input_vec);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        permute("permute1", "input", { 0, 2, 1, 3 }),
+        permute("permute2", "permute1", { 0, 1, 3, 2 }));
+
+    network network(engine, topology, build_options(build_option::optimize_data(true)));
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_FALSE(has_primitive(network, "permute1"));
+
+    // permute2 over permute1 is input dimension permute1[permute2[i]]
+    auto expected = permute_reference(input_vec, { 2, 3, 4, 5 }, { 0, 2, 3, 1 });
+    auto output_ptr = outputs.at("permute2").get_memory().pointer<float>();
+    ASSERT_EQ(outputs.at("permute2").get_memory().get_layout().count(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], output_ptr[i]);
+}
+
+TEST(permute_gpu_f32, permute_reshape_permute_chain_is_removed)
+{
+    const auto& engine = get_test_engine();
+
+    // bfyx: 1x2x4x3, permute and reshape only move dimensions of size 1 or undo each other
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 3, 4 } });
+    auto input_vec = generate_random_1d<float>(input.get_layout().count(), -10, 10);
+    set_values(input, input_vec);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        permute("permute1", "input", { 0, 1, 3, 2 }),
+        reshape("reshape", "permute1", { 2, 1, 4, 3 }),
+        permute("permute2", "reshape", { 1, 0, 3, 2 }),
+        activation("relu", "permute2", activation_relu));
+
+    network network(engine, topology, build_options(build_option::optimize_data(true)));
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_FALSE(has_primitive(network, "permute1"));
+    EXPECT_FALSE(has_primitive(network, "reshape"));
+    EXPECT_FALSE(has_primitive(network, "permute2"));
+
+    auto output = outputs.at("relu").get_memory();
+    EXPECT_EQ(output.get_layout().size, input.get_layout().size);
+    auto output_ptr = output.pointer<float>();
+    for (size_t i = 0; i < input_vec.size(); i++)
+        EXPECT_FLOAT_EQ(std::max(input_vec[i], 0.0f), output_ptr[i]);
+}
+
+TEST(permute_gpu_f32, permute_of_unit_dimensions_becomes_reshape)
+{
+    const auto& engine = get_test_engine();
+
+    // bfyx: 1x3x1x5 -> 3x1x5x1, memory order of the data is not changed
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 3, 5, 1 } });
+    auto input_vec = generate_random_1d<float>(input.get_layout().count(), -10, 10);
+    set_values(input, input_vec);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        permute("permute", "input", { 1, 0, 3, 2 }),
+        activation("relu", "permute", activation_relu));
+
+    network network(engine, topology, build_options(build_option::optimize_data(true)));
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    EXPECT_FALSE(has_primitive(network, "permute"));
+
+    auto output = outputs.at("relu").get_memory();
+    EXPECT_EQ(output.get_layout().size, tensor(3, 1, 1, 5));
+    auto output_ptr = output.pointer<float>();
+    for (size_t i = 0; i < input_vec.size(); i++)
+        EXPECT_FLOAT_EQ(std::max(input_vec[i], 0.0f), output_ptr[i]);
+}
@@ -0,0 +1,122 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/program.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+#include <api/CPP/activation.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/eltwise.hpp>
+
+#include <algorithm>
+
+using namespace cldnn;
+using namespace tests;
+
+TEST(program_build_profiling, passes_and_kernel_selection_are_recorded) {
+    const auto& engine = get_test_engine();
+
+    topology topology;
+    topology.add(input_layout("input", layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 })));
+    topology.add(activation("act", "input", activation_relu));
+
+    build_options options;
+    options.set_option(build_option::build_profiling(true));
+    program prog(engine, topology, options);
+    auto entries = prog.get_build_profiling_info();
+    ASSERT_FALSE(entries.empty());
+
+    auto find = [&](const std::string& category, const std::string& name)
+    {
+        return std::find_if(entries.begin(), entries.end(), [&](const build_profiling_entry& e)
+        {
+            return e.category == category && e.name == name;
+        });
+    };
+
+    auto compile = find("pass", "compile_graph");
+    ASSERT_NE(compile, entries.end());
+    EXPECT_EQ(compile->items_in, 2u);
+    EXPECT_EQ(compile->items_out, 2u);
+
+    auto selection = find("kernel_selection", "act");
+    ASSERT_NE(selection, entries.end());
+    // kernel selection of a node happens during compile_graph pass
+    EXPECT_GE(selection->start, compile->start);
+    EXPECT_LE(selection->start + selection->duration, compile->start + compile->duration);
+
+    // JIT generation of the implementations tried is reported apart from them
+    auto jit = std::find_if(entries.begin(), entries.end(), [](const build_profiling_entry& e)
+    {
+        return e.category == "jit_generation" && e.name.compare(0, 4, "act/") == 0;
+    });
+    ASSERT_NE(jit, entries.end());
+    auto implementation = find("implementation", jit->name);
+    ASSERT_NE(implementation, entries.end());
+    EXPECT_LE(jit->duration, implementation->duration);
+
+    EXPECT_NE(std::find_if(entries.begin(), entries.end(), [](const build_profiling_entry& e) { return e.category == "memory_planning"; }), entries.end());
+}
+
+TEST(program_build_profiling, kernels_compiled_by_constant_propagation_are_recorded) {
+    const auto& engine = get_test_engine();
+
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    set_values(weights, { -1.f, 2.f, -3.f, 4.f });
+
+    // activation of constant data is not evaluated on the host, so it is computed by internal network
+    topology topology;
+    topology.add(input_layout("input", layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 })));
+    topology.add(data("weights", weights));
+    topology.add(activation("const_act", "weights", activation_relu));
+    topology.add(eltwise("sum", { "input", "const_act" }, eltwise_mode::sum));
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    options.set_option(build_option::build_profiling(true));
+    program prog(engine, topology, options);
+    auto entries = prog.get_build_profiling_info();
+
+    auto propagation = std::find_if(entries.begin(), entries.end(), [](const build_profiling_entry& e)
+    {
+        return e.category == "pass" && e.name == "propagate_constants";
+    });
+    ASSERT_NE(propagation, entries.end());
+
+    auto compilation = std::find_if(entries.begin(), entries.end(), [&](const build_profiling_entry& e)
+    {
+        return e.category == "kernels_program" && e.start >= propagation->start &&
+               e.start + e.duration <= propagation->start + propagation->duration;
+    });
+    EXPECT_NE(compilation, entries.end());
+}
+
+TEST(program_build_profiling, nothing_is_recorded_by_default) {
+    const auto& engine = get_test_engine();
+
+    topology topology;
+    topology.add(input_layout("input", layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 })));
+    topology.add(activation("act", "input", activation_relu));
+
+    program prog(engine, topology);
+    EXPECT_TRUE(prog.get_build_profiling_info().empty());
+}
@@ -27,6 +27,11 @@
 #include <api/CPP/reorder.hpp>
 #include <api/CPP/data.hpp>
 #include <api/CPP/reshape.hpp>
+#include <api/CPP/permute.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/activation.hpp>
+
+#include <algorithm>
 
 using namespace cldnn;
 using namespace tests;
@@ -66,4 +71,73 @@ TEST(propagate_constants, copy_dependecies_from_nodes) {
         auto output = it.second.get_memory().pointer<float>();
         EXPECT_NEAR(7.8f, output[0], epsilon);
     }
-}
\ No newline at end of file
+}
+
+TEST(propagate_constants, data_movement_and_eltwise_chain_is_folded) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 2, 2, 2 } });
+    auto const1 = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 2, 2 } });
+    auto const2 = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 1, 1 } });
+    auto const3 = memory::allocate(engine, { data_types::f16, format::yxfb,{ 1, 1, 2, 2 } });
+
+    set_values(input, { 0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f });
+    set_values(const1, { 1.f, 2.f, 3.f, 4.f });
+    set_values(const2, { 2.f });
+    set_values(const3, { FLOAT16(10.f), FLOAT16(20.f), FLOAT16(30.f), FLOAT16(40.f) });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("const1", const1));
+    topology.add(data("const2", const2));
+    topology.add(data("const3", const3));
+    topology.add(permute("permute", "const1", { 0, 1, 3, 2 }));
+    topology.add(eltwise("scaled", { "permute", "const2" }, eltwise_mode::prod));
+    topology.add(reorder("converted", "const3", layout(data_types::f32, format::bfyx, { 1, 1, 2, 2 })));
+    topology.add(concatenation("concat", { "scaled", "converted" }, concatenation::along_f));
+    topology.add(eltwise("sum", { "input", "concat" }, eltwise_mode::sum));
+    network network(engine, topology, build_opt);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    // only input and the final eltwise are left to execute
+    auto executed = network.get_executed_primitive_ids();
+    for (auto& id : { "permute", "scaled", "converted", "concat" })
+        EXPECT_EQ(std::find(executed.begin(), executed.end(), id), executed.end()) << id;
+
+    std::vector<float> expected = { 2.f, 7.f, 6.f, 11.f, 14.f, 25.f, 36.f, 47.f };
+    auto output = outputs.at("sum").get_memory().pointer<float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], output[i]);
+}
+
+TEST(propagate_constants, unsupported_primitive_falls_back_to_device) {
+    const auto& engine = get_test_engine();
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 4, 1, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 2, 2 } });
+
+    set_values(input, { 1.f, 1.f, 1.f, 1.f });
+    set_values(weights, { -1.f, 2.f, -3.f, 4.f });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights", weights));
+    topology.add(activation("relu", "weights", activation_relu));
+    topology.add(reshape("reshape", "relu", tensor(1, 4, 1, 1)));
+    topology.add(eltwise("sum", { "input", "reshape" }, eltwise_mode::sum));
+    network network(engine, topology, build_opt);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    std::vector<float> expected = { 1.f, 3.f, 1.f, 5.f };
+    auto output = outputs.at("sum").get_memory().pointer<float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], output[i]);
+}
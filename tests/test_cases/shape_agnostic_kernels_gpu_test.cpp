@@ -0,0 +1,107 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include "api/CPP/activation.hpp"
+#include "api/CPP/pooling.hpp"
+#include "api/CPP/concatenation.hpp"
+#include "api/CPP/eltwise.hpp"
+#include "api/CPP/mutable_data.hpp"
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace {
+    std::vector<float> execute(const engine& engine, const topology& topology, const memory& input, bool shape_agnostic,
+                               const primitive_id& output_id = "sum")
+    {
+        build_options options;
+        options.set_option(build_option::shape_agnostic_kernels(shape_agnostic));
+        network network(engine, topology, options);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+
+        auto output_ptr = outputs.at(output_id).get_memory().pointer<float>();
+        return std::vector<float>(output_ptr.begin(), output_ptr.end());
+    }
+}
+
+TEST(shape_agnostic_kernels_gpu, results_match_kernels_made_for_shapes) {
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 3, 6, 6 } });
+    std::vector<float> input_vec(input.get_layout().count());
+    for (size_t i = 0; i < input_vec.size(); ++i)
+        input_vec[i] = (i % 3 ? -0.5f : 1.0f) * static_cast<float>(i % 17);
+    set_values(input, input_vec);
+
+    // activations, poolings and concatenation inputs of different shapes share kernels
+    topology topology(
+        input_layout("input", input.get_layout()),
+        activation("relu1", "input", activation_relu),
+        pooling("pool1", "relu1", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }),
+        activation("relu2", "pool1", activation_relu_negative_slope, { 0.5f, 0.f }),
+        pooling("pool2", "input", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }),
+        concatenation("concat", { "relu2", "pool2" }, concatenation::along_f),
+        eltwise("sum", { "concat", "concat" }, eltwise_mode::sum));
+
+    auto expected = execute(engine, topology, input, false);
+    auto result = execute(engine, topology, input, true);
+    ASSERT_EQ(expected.size(), result.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_FLOAT_EQ(expected[i], result[i]) << "at " << i;
+}
+
+TEST(shape_agnostic_kernels_gpu, max_with_argmax_pooling) {
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 3, 6, 4 } });
+    std::vector<float> input_vec(input.get_layout().count());
+    for (size_t i = 0; i < input_vec.size(); ++i)
+        input_vec[i] = (i % 3 ? -0.5f : 1.0f) * static_cast<float>(i % 13);
+    set_values(input, input_vec);
+
+    auto run = [&](bool shape_agnostic, std::vector<float>& arg_max_vec) {
+        auto arg_max = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 3, 3, 2 } });
+        topology topology(
+            input_layout("input", input.get_layout()),
+            mutable_data("arg_max", arg_max),
+            pooling("pool", "input", "arg_max", pooling_mode::max_with_argmax, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+
+        auto result = execute(engine, topology, input, shape_agnostic, "pool");
+        auto arg_max_ptr = arg_max.pointer<float>();
+        arg_max_vec.assign(arg_max_ptr.begin(), arg_max_ptr.end());
+        return result;
+    };
+
+    std::vector<float> expected_arg_max, arg_max;
+    auto expected = run(false, expected_arg_max);
+    auto result = run(true, arg_max);
+    ASSERT_EQ(expected.size(), result.size());
+    for (size_t i = 0; i < expected.size(); ++i)
+        EXPECT_FLOAT_EQ(expected[i], result[i]) << "at " << i;
+    ASSERT_EQ(expected_arg_max.size(), arg_max.size());
+    for (size_t i = 0; i < expected_arg_max.size(); ++i)
+        EXPECT_FLOAT_EQ(expected_arg_max[i], arg_max[i]) << "at " << i;
+}
@@ -20,6 +20,8 @@
 #include "api/CPP/memory.hpp"
 #include <api/CPP/input_layout.hpp>
 #include "api/CPP/concatenation.hpp"
+#include "api/CPP/pooling.hpp"
+#include "api/CPP/activation.hpp"
 #include <api/CPP/topology.hpp>
 #include <api/CPP/network.hpp>
 #include <api/CPP/engine.hpp>
@@ -792,4 +794,55 @@ TEST(spatial_concatenate_f32_gpu, inputs3d_3_uneven_axis_b) {
             EXPECT_FLOAT_EQ(value, expected_output[idx++]);
         }
     }
-}
\ No newline at end of file
+}
+TEST(spatial_concatenate_f32_gpu, in_place_along_y_with_input_copy) {
+    // pool1 writes directly into the concatenation buffer, input2 cannot write padded output so it is copied there
+    // disable memory pool when we want to check optimized out internal results
+    engine_configuration cfg{ false, false, false, std::string(), std::string(), true /*oooq*/, std::string(),std::string(), priority_mode_types::disabled,  throttle_mode_types::disabled, false /*mem_pool*/ };
+    engine engine{ cfg };
+
+    memory input1 = memory::allocate(engine, layout{ data_types::f32, format::bfyx, tensor{ 1, 1, 2, 2 } });
+    memory input2 = memory::allocate(engine, layout{ data_types::f32, format::bfyx, tensor{ 1, 1, 2, 1 } });
+
+    set_values(input1, {
+        1.0f, -2.0f,
+        3.0f, -4.0f
+    });
+
+    set_values(input2, {
+        5.0f, -6.0f
+    });
+
+    const auto expected_output = std::vector<float>{
+        1.0f, 0.0f,
+        3.0f, 0.0f,
+        5.0f, 0.0f
+    };
+
+    topology tpl;
+    tpl.add(input_layout("in1", input1.get_layout()));
+    tpl.add(input_layout("in2", input2.get_layout()));
+    tpl.add(pooling("pool1", "in1", pooling_mode::max, { 1, 1, 1, 1 }, { 1, 1, 1, 1 }));
+    tpl.add(concatenation("conc", { "pool1", "in2" }, concatenation::along_y));
+    tpl.add(activation("relu", "conc", activation_relu));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    bo.set_option(build_option::debug(true)); //required to query internal buffers
+
+    network net(engine, tpl, bo);
+    net.set_input_data("in1", input1);
+    net.set_input_data("in2", input2);
+
+    auto outputs = net.execute();
+
+    EXPECT_TRUE(outputs.at("pool1").get_memory().is_the_same_buffer(outputs.at("conc").get_memory()));
+
+    auto output_mem = outputs.at("relu").get_memory();
+    auto output_ptr = output_mem.pointer<float>();
+    ASSERT_EQ(output_ptr.size(), expected_output.size());
+    for (size_t idx = 0; idx < expected_output.size(); idx++)
+    {
+        EXPECT_FLOAT_EQ(output_ptr[idx], expected_output[idx]);
+    }
+}
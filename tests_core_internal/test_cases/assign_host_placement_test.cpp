@@ -0,0 +1,133 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+
+#include "pass_manager.h"
+#include "test_utils.h"
+
+#include <algorithm>
+#include <memory>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace
+{
+    host_placement_cost_model fast_host_model()
+    {
+        host_placement_cost_model model;
+        model.kernel_launch_time = 100.0;
+        model.host_call_time = 0.0;
+        model.transfer_latency = 1.0;
+        model.transfer_bytes_per_us = 1e9;
+        model.device_ops_per_us = 1.0;
+        model.host_ops_per_us = 1e9;
+        return model;
+    }
+
+    host_placement_cost_model fast_device_model()
+    {
+        host_placement_cost_model model;
+        model.kernel_launch_time = 0.0;
+        model.host_call_time = 100.0;
+        model.transfer_latency = 100.0;
+        model.transfer_bytes_per_us = 1.0;
+        model.device_ops_per_us = 1e9;
+        model.host_ops_per_us = 1.0;
+        return model;
+    }
+
+    bool has_primitive(const network& network, const primitive_id& id)
+    {
+        const auto ids = network.get_all_primitive_ids();
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+
+    // the placement is decided by the given cost model instead of the one estimated from the device
+    build_options cpu_fallback_options(const host_placement_cost_model& model)
+    {
+        build_options options;
+        options.set_option(build_option::cpu_fallback(true));
+        options.set_option(build_option::host_placement_cost_model(model));
+        return options;
+    }
+}
+
+TEST(assign_host_placement, primitives_run_on_host_when_it_is_cheaper)
+{
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 3 } });
+    auto values = generate_random_1d<float>(input.count(), -10, 10);
+    set_values(input, values);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_relu),
+        activation("out", "relu", activation_linear, { 2.0f, 1.0f }));
+
+    network network(engine, topology, cpu_fallback_options(fast_host_model()));
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    // the input is copied to the host once and both activations are computed there
+    EXPECT_TRUE(has_primitive(network, "input_to_host"));
+    EXPECT_FALSE(has_primitive(network, "relu_to_host"));
+
+    auto output = outputs.at("out").get_memory();
+    auto ptr = output.pointer<float>();
+    ASSERT_EQ(values.size(), ptr.size());
+    for (size_t i = 0; i < values.size(); i++)
+        EXPECT_FLOAT_EQ(2.0f * std::max(values[i], 0.0f) + 1.0f, ptr[i]) << "at index " << i;
+
+    // the second execution reuses the transfers
+    set_values(input, std::vector<float>(values.size(), -1.0f));
+    outputs = network.execute();
+    auto second = outputs.at("out").get_memory().pointer<float>();
+    for (size_t i = 0; i < values.size(); i++)
+        EXPECT_FLOAT_EQ(1.0f, second[i]) << "at index " << i;
+}
+
+TEST(assign_host_placement, primitives_stay_on_device_when_it_is_cheaper)
+{
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 8, 8 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 32, 16, 3, 3 } });
+    set_values(weights, generate_random_1d<float>(weights.count(), -1, 1));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        convolution("conv", "input", { "weights" }, { 1, 1, 1, 1 }, { 0, 0, -1, -1 }),
+        activation("relu", "conv", activation_relu));
+
+    network network(engine, topology, cpu_fallback_options(fast_device_model()));
+
+    EXPECT_FALSE(has_primitive(network, "input_to_host"));
+    EXPECT_FALSE(has_primitive(network, "conv_to_host"));
+}
@@ -0,0 +1,52 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "program_impl.h"
+#include "api_impl.h"
+#include "topology_impl.h"
+#include "engine_impl.h"
+#include "permute_inst.h"
+#include "pass_manager.h"
+
+#include "test_utils.h"
+#include "program_impl_wrapper.h"
+
+using namespace cldnn;
+using namespace ::tests;
+
+/* Permute with a 5-D order is rejected by permute_inst, so the pass is run on a program which is not compiled */
+TEST(collapse_data_movement_chains, permute_with_5d_order_ends_chain)
+{
+    const auto& engine = get_test_engine();
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 3, 5, 4 } });
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        permute("permute1", "input", { 0, 2, 1, 3, 4 }),
+        permute("permute2", "permute1", { 0, 1, 3, 2 }));
+
+    program_impl::ptr prog = api_cast(engine.get())->build_program(*api_cast(topology.get()), build_options(), false, true);
+    collapse_data_movement_chains pass;
+    program_impl_wrapper::apply_opt_pass(*prog, pass);
+
+    // order with more entries than dimensions handled by the pass must not be composed with other permutes
+    ASSERT_TRUE(prog->has_node("permute1"));
+    ASSERT_TRUE(prog->has_node("permute2"));
+    EXPECT_EQ(prog->get_node("permute1").id(), prog->get_node("permute2").get_dependency(0).id());
+}
@@ -0,0 +1,63 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/layout.hpp"
+#include "kernel_selector_helper.h"
+#include "condition/condition_kernel_selector.h"
+#include "condition/condition_kernel_base.h"
+
+using namespace cldnn;
+
+namespace {
+    kernel_selector::condition_params make_condition_params(data_types dt, const tensor& input_size, const tensor& compare_size)
+    {
+        kernel_selector::condition_params params;
+        params.inputs[0] = convert_data_tensor(layout(dt, format::yxfb, input_size));
+        params.inputs.push_back(convert_data_tensor(layout(dt, format::bfyx, compare_size)));
+        params.output = convert_data_tensor(layout(data_types::i32, format::bfyx, { 1, 1, 1, 1 }));
+        params.function = kernel_selector::condition_function::GREATER;
+        params.offset = convert_dim_vector(tensor(0, 1, 2, 0));
+        params.engineInfo.maxWorkGroupSize = 256;
+        params.engineInfo.bFP16Support = true;
+        params.layerID = "condi";
+        return params;
+    }
+}
+
+TEST(condition_kernel, evaluates_condition_of_any_data_type_in_single_work_group) {
+    auto& selector = kernel_selector::condition_kernel_selector::Instance();
+    kernel_selector::condition_optional_params options;
+
+    for (auto dt : { data_types::f32, data_types::f16, data_types::i8, data_types::u8, data_types::i32, data_types::i64 })
+    {
+        auto kernels = selector.GetBestKernels(make_condition_params(dt, { 2, 4, 8, 8 }, { 2, 3, 6, 8 }), options);
+        ASSERT_EQ(kernels.size(), 1u) << data_type_traits::name(dt);
+        EXPECT_EQ(kernels[0].kernelName, "condition_ref");
+
+        const auto& kernel = kernels[0].kernels[0];
+        EXPECT_EQ(kernel.workGroups.global, std::vector<size_t>({ 256, 1, 1 }));
+        EXPECT_EQ(kernel.workGroups.local, kernel.workGroups.global);
+        EXPECT_NE(kernel.kernelString->jit.find("#define CONDITION(a, b) ((a) > (b))"), std::string::npos);
+        EXPECT_NE(kernel.kernelString->jit.find("#define OFFSET_FEATURE_NUM 1"), std::string::npos);
+    }
+
+    // small compare tensors use one work item per element
+    auto kernels = selector.GetBestKernels(make_condition_params(data_types::f32, { 1, 1, 4, 1 }, { 1, 1, 3, 1 }), options);
+    ASSERT_EQ(kernels.size(), 1u);
+    EXPECT_EQ(kernels[0].kernels[0].workGroups.global, std::vector<size_t>({ 3, 1, 1 }));
+}
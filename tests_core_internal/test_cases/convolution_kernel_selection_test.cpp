@@ -0,0 +1,202 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/layout.hpp"
+#include "kernel_selector_helper.h"
+#include "kernel_base.h"
+#include "convolution/convolution_params.h"
+#include "convolution/convolution_kernel_selector.h"
+
+#include <chrono>
+#include <iostream>
+
+using namespace cldnn;
+
+namespace {
+    class test_convolution_selector : public kernel_selector::convolution_kernel_selector
+    {
+    public:
+        kernel_selector::KernelsData select(const kernel_selector::Params& params, const kernel_selector::optional_params& options) const
+        {
+            return GetNaiveBestKernel(params, options, kernel_selector::KernelType::CONVOLUTION);
+        }
+
+        // reference selection which generates kernels of every supported implementation
+        kernel_selector::KernelsData select_by_generating_all(const kernel_selector::Params& params, const kernel_selector::optional_params& options) const
+        {
+            const auto requireKey = params.GetParamsKey().Merge(options.GetSupportedKey());
+            kernel_selector::KernelsData best;
+            std::string name;
+            for (const auto& implementation : implementations)
+            {
+                if (!implementation->GetSupportedKey().Support(requireKey))
+                    continue;
+                try
+                {
+                    auto kds = implementation->GetKernelsData(params, options);
+                    if (kds.size() && kds[0].kernels.size() && (best.empty() || kds[0].estimatedTime < best[0].estimatedTime))
+                    {
+                        best = kds;
+                        name = implementation->GetName();
+                    }
+                }
+                catch (std::runtime_error&) {}
+            }
+            if (best.size())
+                best[0].kernelName = name;
+            return best;
+        }
+    };
+
+    struct conv_case
+    {
+        tensor input;       // b, f, x, y
+        tensor weights;     // ofm, ifm, x, y
+        tensor stride;
+        tensor input_offset;
+    };
+
+    // convolutions of common classification networks (AlexNet, GoogLeNet, ResNet-50, VGG-16)
+    std::vector<conv_case> model_zoo_convolutions()
+    {
+        return {
+            { { 1, 3, 227, 227 },   { 96, 3, 11, 11 },      { 1, 1, 4, 4 }, { 0, 0, 0, 0 } },
+            { { 1, 96, 27, 27 },    { 256, 96, 5, 5 },      { 1, 1, 1, 1 }, { 0, 0, -2, -2 } },
+            { { 1, 256, 13, 13 },   { 384, 256, 3, 3 },     { 1, 1, 1, 1 }, { 0, 0, -1, -1 } },
+            { { 1, 3, 224, 224 },   { 64, 3, 7, 7 },        { 1, 1, 2, 2 }, { 0, 0, -3, -3 } },
+            { { 1, 192, 28, 28 },   { 64, 192, 1, 1 },      { 1, 1, 1, 1 }, { 0, 0, 0, 0 } },
+            { { 1, 96, 28, 28 },    { 128, 96, 3, 3 },      { 1, 1, 1, 1 }, { 0, 0, -1, -1 } },
+            { { 1, 16, 28, 28 },    { 32, 16, 5, 5 },       { 1, 1, 1, 1 }, { 0, 0, -2, -2 } },
+            { { 1, 64, 56, 56 },    { 64, 64, 1, 1 },       { 1, 1, 1, 1 }, { 0, 0, 0, 0 } },
+            { { 1, 64, 56, 56 },    { 64, 64, 3, 3 },       { 1, 1, 1, 1 }, { 0, 0, -1, -1 } },
+            { { 1, 64, 56, 56 },    { 256, 64, 1, 1 },      { 1, 1, 1, 1 }, { 0, 0, 0, 0 } },
+            { { 1, 256, 56, 56 },   { 512, 256, 1, 1 },     { 1, 1, 2, 2 }, { 0, 0, 0, 0 } },
+            { { 1, 128, 28, 28 },   { 128, 128, 3, 3 },     { 1, 1, 1, 1 }, { 0, 0, -1, -1 } },
+            { { 1, 1024, 14, 14 },  { 256, 1024, 1, 1 },    { 1, 1, 1, 1 }, { 0, 0, 0, 0 } },
+            { { 1, 512, 7, 7 },     { 2048, 512, 1, 1 },    { 1, 1, 1, 1 }, { 0, 0, 0, 0 } },
+            { { 1, 512, 14, 14 },   { 512, 512, 3, 3 },     { 1, 1, 1, 1 }, { 0, 0, -1, -1 } },
+        };
+    }
+
+    kernel_selector::convolution_params make_params(const conv_case& c, data_types dt, format fmt, int32_t batch)
+    {
+        auto input_size = c.input;
+        input_size.batch[0] = batch;
+        const auto out_x = (input_size.spatial[0] - 2 * c.input_offset.spatial[0] - c.weights.spatial[0]) / c.stride.spatial[0] + 1;
+        const auto out_y = (input_size.spatial[1] - 2 * c.input_offset.spatial[1] - c.weights.spatial[1]) / c.stride.spatial[1] + 1;
+
+        kernel_selector::convolution_params params;
+        params.inputs[0] = convert_data_tensor(layout(dt, fmt, input_size));
+        params.output = convert_data_tensor(layout(dt, fmt, { batch, c.weights.batch[0], out_x, out_y }));
+        params.weights = convert_weights_tensor(layout(dt, format::bfyx, c.weights));
+        params.bias.push_back(convert_data_tensor(layout(dt, format::bfyx, { 1, 1, c.weights.batch[0], 1 })).FlattenFeatureAndSpatials());
+        params.filterSize = { (uint32_t)c.weights.spatial[0], (uint32_t)c.weights.spatial[1] };
+        params.stride = { (uint32_t)c.stride.spatial[0], (uint32_t)c.stride.spatial[1] };
+        params.dilation = { 1, 1 };
+        params.padding = { (uint32_t)-c.input_offset.spatial[0], (uint32_t)-c.input_offset.spatial[1] };
+        params.layerID = "conv";
+
+        // capabilities of a Gen9 GT2 device
+        params.engineInfo.bSubGroupSupport = true;
+        params.engineInfo.bSubGroupShortSupport = true;
+        params.engineInfo.bFP16Support = true;
+        params.engineInfo.bImageSupport = true;
+        params.engineInfo.maxWorkGroupSize = 256;
+        params.engineInfo.maxLocalMemSize = 65536;
+        params.engineInfo.maxImage2dWidth = 16384;
+        params.engineInfo.maxImage2dHeight = 16384;
+        params.engineInfo.computeUnitsCount = 24;
+        return params;
+    }
+
+    kernel_selector::convolution_optional_params make_options()
+    {
+        kernel_selector::convolution_optional_params options;
+        options.allowStaticInputReordering = true;
+        options.allowInputReordering = false;
+        options.allowOutputReordering = false;
+        options.tuningParams.mode = kernel_selector::TuningMode::TUNING_DISABLED;
+        return options;
+    }
+
+    struct selection_config
+    {
+        data_types dt;
+        format fmt;
+        int32_t batch;
+    };
+
+    std::vector<selection_config> selection_configs()
+    {
+        return {
+            { data_types::f32, format::bfyx, 1 },
+            { data_types::f16, format::bfyx, 1 },
+            { data_types::f32, format::yxfb, 8 },
+            { data_types::f16, format::yxfb, 32 },
+            { data_types::f32, format::byxf, 1 },
+            { data_types::f16, format::bfyx_f16, 1 },
+        };
+    }
+}
+
+TEST(convolution_kernel_selection, estimates_select_the_same_kernel_as_generating_all) {
+    test_convolution_selector selector;
+    auto options = make_options();
+
+    for (const auto& config : selection_configs())
+    {
+        for (const auto& c : model_zoo_convolutions())
+        {
+            auto params = make_params(c, config.dt, config.fmt, config.batch);
+            auto expected = selector.select_by_generating_all(params, options);
+            auto selected = selector.select(params, options);
+
+            ASSERT_EQ(expected.size(), selected.size()) << params.to_string();
+            if (expected.empty())
+                continue;
+            EXPECT_EQ(expected[0].kernelName, selected[0].kernelName) << params.to_string();
+            EXPECT_EQ(expected[0].estimatedTime, selected[0].estimatedTime) << params.to_string();
+        }
+    }
+}
+
+// run with --gtest_also_run_disabled_tests to compare selection times
+TEST(convolution_kernel_selection, DISABLED_selection_time_on_model_zoo_convolutions) {
+    test_convolution_selector selector;
+    auto options = make_options();
+    const int iterations = 10;
+
+    std::vector<kernel_selector::convolution_params> corpus;
+    for (const auto& config : selection_configs())
+        for (const auto& c : model_zoo_convolutions())
+            corpus.push_back(make_params(c, config.dt, config.fmt, config.batch));
+
+    auto measure = [&](bool generate_all)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++)
+            for (const auto& params : corpus)
+                generate_all ? selector.select_by_generating_all(params, options) : selector.select(params, options);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+    };
+
+    auto all_time = measure(true);
+    auto selection_time = measure(false);
+    std::cout << corpus.size() << " convolutions: generating all supported implementations " << all_time
+              << " ms, generating by estimates " << selection_time << " ms" << std::endl;
+}
@@ -0,0 +1,165 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "format_assignment.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace cldnn;
+
+namespace
+{
+    std::vector<format_assignment::candidate> bfyx_yxfb(float bfyx_cost, float yxfb_cost)
+    {
+        return { { format::bfyx, bfyx_cost }, { format::yxfb, yxfb_cost } };
+    }
+
+    float brute_force_cost(const format_assignment& assignment)
+    {
+        // every node has two candidates
+        float best = std::numeric_limits<float>::max();
+        std::vector<size_t> choice(assignment.size());
+        for (size_t mask = 0; mask < (size_t(1) << assignment.size()); mask++)
+        {
+            for (size_t i = 0; i < choice.size(); i++)
+                choice[i] = (mask >> i) & 1;
+            best = std::min(best, assignment.total_cost(choice));
+        }
+        return best;
+    }
+}
+
+TEST(format_assignment, chain_keeps_format_when_reorders_cost_more)
+{
+    // middle node prefers yxfb, but switching to it and back costs more than running it in bfyx
+    format_assignment assignment;
+    auto first = assignment.add_node(bfyx_yxfb(10.0f, 15.0f));
+    auto middle = assignment.add_node(bfyx_yxfb(12.0f, 8.0f));
+    auto last = assignment.add_node(bfyx_yxfb(10.0f, 15.0f));
+    assignment.add_fixed_input(first, format::bfyx, 5.0f);
+    assignment.add_edge(first, middle, 3.0f);
+    assignment.add_edge(middle, last, 3.0f);
+
+    auto choice = assignment.solve();
+    EXPECT_EQ(assignment.get_format(first, choice[first]), format::bfyx);
+    EXPECT_EQ(assignment.get_format(middle, choice[middle]), format::bfyx);
+    EXPECT_EQ(assignment.get_format(last, choice[last]), format::bfyx);
+    EXPECT_FLOAT_EQ(assignment.total_cost(choice), 32.0f);
+}
+
+TEST(format_assignment, chain_switches_format_when_node_gain_outweighs_reorders)
+{
+    format_assignment assignment;
+    auto first = assignment.add_node(bfyx_yxfb(10.0f, 15.0f));
+    auto middle = assignment.add_node(bfyx_yxfb(20.0f, 8.0f));
+    auto last = assignment.add_node(bfyx_yxfb(10.0f, 15.0f));
+    assignment.add_fixed_input(first, format::bfyx, 5.0f);
+    assignment.add_edge(first, middle, 3.0f);
+    assignment.add_edge(middle, last, 3.0f);
+
+    auto choice = assignment.solve();
+    EXPECT_EQ(assignment.get_format(first, choice[first]), format::bfyx);
+    EXPECT_EQ(assignment.get_format(middle, choice[middle]), format::yxfb);
+    EXPECT_EQ(assignment.get_format(last, choice[last]), format::bfyx);
+    EXPECT_FLOAT_EQ(assignment.total_cost(choice), 34.0f);
+}
+
+TEST(format_assignment, chain_follows_fixed_input_format)
+{
+    // whole chain is cheaper in yxfb once the input is yxfb, even though each node alone prefers bfyx
+    format_assignment assignment;
+    size_t prev = assignment.add_node(bfyx_yxfb(10.0f, 10.5f));
+    assignment.add_fixed_input(prev, format::yxfb, 4.0f);
+    for (int i = 0; i < 3; i++)
+    {
+        auto node = assignment.add_node(bfyx_yxfb(10.0f, 10.5f));
+        assignment.add_edge(prev, node, 4.0f);
+        prev = node;
+    }
+
+    auto choice = assignment.solve();
+    for (size_t i = 0; i < assignment.size(); i++)
+        EXPECT_EQ(assignment.get_format(i, choice[i]), format::yxfb);
+}
+
+TEST(format_assignment, trees_are_solved_exactly)
+{
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> cost(1.0f, 20.0f);
+
+    for (int test = 0; test < 50; test++)
+    {
+        // every node has at most one user, inputs are chosen among not yet used nodes
+        format_assignment assignment;
+        std::vector<size_t> unused;
+        for (size_t i = 0; i < 10; i++)
+        {
+            auto node = assignment.add_node(bfyx_yxfb(cost(gen), cost(gen)));
+            if (gen() % 3 == 0)
+                assignment.add_fixed_input(node, gen() % 2 ? format::bfyx : format::yxfb, cost(gen));
+            auto inputs = gen() % 3;
+            for (size_t in = 0; in < inputs && !unused.empty(); in++)
+            {
+                auto pos = gen() % unused.size();
+                assignment.add_edge(unused[pos], node, cost(gen));
+                unused.erase(unused.begin() + pos);
+            }
+            unused.push_back(node);
+        }
+
+        EXPECT_FLOAT_EQ(assignment.total_cost(assignment.solve()), brute_force_cost(assignment)) << "test: " << test;
+    }
+}
+
+TEST(format_assignment, dag_is_not_worse_than_local_choice)
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> cost(1.0f, 20.0f);
+
+    for (int test = 0; test < 50; test++)
+    {
+        format_assignment assignment;
+        std::vector<size_t> local_choice;
+        for (size_t i = 0; i < 10; i++)
+        {
+            auto bfyx_cost = cost(gen);
+            auto yxfb_cost = cost(gen);
+            auto node = assignment.add_node(bfyx_yxfb(bfyx_cost, yxfb_cost));
+            local_choice.push_back(bfyx_cost <= yxfb_cost ? 0 : 1);
+            for (size_t in = 0; in < node; in++)
+                if (gen() % 4 == 0)
+                    assignment.add_edge(in, node, cost(gen));
+        }
+
+        auto choice = assignment.solve();
+        EXPECT_LE(assignment.total_cost(choice), assignment.total_cost(local_choice)) << "test: " << test;
+        EXPECT_GE(assignment.total_cost(choice), brute_force_cost(assignment)) << "test: " << test;
+    }
+}
+
+TEST(format_assignment, rejects_edges_against_node_order)
+{
+    format_assignment assignment;
+    auto first = assignment.add_node(bfyx_yxfb(1.0f, 1.0f));
+    auto second = assignment.add_node(bfyx_yxfb(1.0f, 1.0f));
+    EXPECT_ANY_THROW(assignment.add_edge(second, first, 1.0f));
+    EXPECT_ANY_THROW(assignment.add_node({}));
+}
@@ -0,0 +1,128 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/layout.hpp"
+#include "kernel_selector_helper.h"
+#include "jitter.h"
+
+#include <limits>
+
+using namespace kernel_selector;
+
+namespace {
+    std::string format_definitions(const JitConstants& constants)
+    {
+        std::string result;
+        for (const auto& definition : constants.GetDefinitions())
+            result += "#define " + definition.first + " " + definition.second + "\n";
+        return result;
+    }
+
+    std::string write(const JitConstants& constants)
+    {
+        JitWriter writer;
+        constants.Write(writer);
+        return writer.str();
+    }
+
+    DataTensor make_padded_data_tensor(cldnn::data_types dt, cldnn::format fmt)
+    {
+        return convert_data_tensor(cldnn::layout(dt, fmt, { 2, 3, 5, 7 }, cldnn::padding({ 0, 1, 2, 1 }, { 0, 2, 1, 3 })));
+    }
+}
+
+TEST(jitter, writes_scalar_constants_the_same_as_definitions) {
+    JitConstants constants{
+        MakeJitConstant("INT", -42),
+        MakeJitConstant("INT_MIN_VALUE", std::numeric_limits<int32_t>::min()),
+        MakeJitConstant("INT64_MIN_VALUE", std::numeric_limits<int64_t>::min()),
+        MakeJitConstant("UINT64_MAX_VALUE", std::numeric_limits<uint64_t>::max()),
+        MakeJitConstant("SIZE", size_t(0)),
+        MakeJitConstant("CHAR", int8_t(-7)),
+        MakeJitConstant("UCHAR", uint8_t(200)),
+        MakeJitConstant("ENABLED", true),
+        MakeJitConstant("DISABLED", false),
+        MakeJitConstant("FLOAT", 0.5f),
+        MakeJitConstant("INF", std::numeric_limits<float>::infinity()),
+        MakeJitConstant("DOUBLE", -1.25),
+        MakeJitConstant("STRING", std::string("(a + b)")),
+        MakeJitConstant("LITERAL", "input"),
+        MakeJitConstant("EMPTY", ""),
+        MakeJitConstant("MACRO(x, y)", "((x) * (y))"),
+    };
+
+    EXPECT_EQ(format_definitions(constants), write(constants));
+}
+
+TEST(jitter, writes_vector_and_size_constants_the_same_as_definitions) {
+    JitConstants constants{
+        MakeJitConstant("FLOATS", std::vector<float>{ 1.f, -2.5f, 0.f }),
+        MakeJitConstant("INTS", std::vector<int32_t>{ 3, -4 }),
+        MakeJitConstant("NO_VALUES", std::vector<uint32_t>{}),
+        MakeJitConstant("STRIDE", Size<uint32_t>(2, 3, 1)),
+        MakeJitConstant("OUT", DimTensor<uint32_t>(1, 16, 1, 28, 28)),
+    };
+
+    EXPECT_EQ(format_definitions(constants), write(constants));
+}
+
+TEST(jitter, writes_tensor_constants_the_same_as_definitions) {
+    for (auto dt : { cldnn::data_types::i8, cldnn::data_types::u8, cldnn::data_types::i32, cldnn::data_types::i64,
+                     cldnn::data_types::f16, cldnn::data_types::f32 })
+    {
+        for (auto fmt : { cldnn::format::bfyx, cldnn::format::yxfb, cldnn::format::byxf, cldnn::format::bfyx_f16 })
+        {
+            JitConstants constants{ MakeJitConstant("INPUT0", make_padded_data_tensor(dt, fmt)) };
+            EXPECT_EQ(format_definitions(constants), write(constants)) << cldnn::data_type_traits::name(dt) << " " << cldnn::format::order(fmt);
+        }
+    }
+
+    for (auto wt : { WeightsType::F16, WeightsType::F32, WeightsType::INT8, WeightsType::UINT8 })
+    {
+        JitConstants constants{ MakeJitConstant("FILTER", WeightsTensor({ 3, 3, 16, 32 }, wt, WeightsLayout::oiyx)) };
+        EXPECT_EQ(format_definitions(constants), write(constants)) << toString(wt);
+
+        JitWriter writer;
+        WriteTypeJitConstants(writer, wt, "ACCUMULATOR");
+        EXPECT_EQ(format_definitions(MakeTypeJitConstants(wt, "ACCUMULATOR")), writer.str()) << toString(wt);
+    }
+}
+
+TEST(jitter, shape_agnostic_tensor_constants_use_shape_info_arguments) {
+    auto tensor = make_padded_data_tensor(cldnn::data_types::f32, cldnn::format::yxfb);
+    auto definitions = MakeShapeAgnosticJitConstant("INPUT0", tensor)->GetDefinitions();
+    auto value = [&](const std::string& name) {
+        for (const auto& definition : definitions)
+        {
+            if (definition.first == name)
+                return definition.second;
+        }
+        return std::string("<undefined>");
+    };
+
+    for (const auto& info : GetShapeInfo(tensor))
+        EXPECT_EQ(value("INPUT0" + info.first), "shape_INPUT0" + info.first);
+
+    // dims of yxfb are ordered from the innermost one
+    EXPECT_EQ(value("INPUT0_SIZES"), "(size_t []){ shape_INPUT0_BATCH_NUM,shape_INPUT0_FEATURE_NUM,shape_INPUT0_SIZE_X,shape_INPUT0_SIZE_Y,1,1,1,1, } ");
+    EXPECT_EQ(value("INPUT0_DIMS"), "4");
+    EXPECT_EQ(value("INPUT0_LAYOUT_YXFB"), "1");
+    EXPECT_EQ(value("INPUT0_TYPE"), "float");
+    EXPECT_EQ(format_definitions(JitConstants{ MakeShapeAgnosticJitConstant("INPUT0", tensor) }),
+              write(JitConstants{ MakeShapeAgnosticJitConstant("INPUT0", tensor) }));
+}
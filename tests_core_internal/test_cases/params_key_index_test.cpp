@@ -0,0 +1,211 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "kernel_base.h"
+#include "convolution/convolution_kernel_selector.h"
+#include "fully_connected/fully_connected_kernel_selector.h"
+#include "pooling/pooling_kernel_selector.h"
+#include "eltwise/eltwise_kernel_selector.h"
+#include "reorder/reorder_kernel_selector.h"
+#include "reorder/reorder_weights_kernel_selector.h"
+
+#include <random>
+
+using namespace kernel_selector;
+
+namespace {
+    template <typename Selector>
+    class exposed_selector : public Selector
+    {
+    public:
+        std::vector<size_t> supporting_by_index(const ParamsKey& key) const
+        {
+            return this->implementationsIndex.GetSupporting(key);
+        }
+
+        std::vector<size_t> supporting_by_linear_scan(const ParamsKey& key) const
+        {
+            std::vector<size_t> result;
+            for (size_t i = 0; i < this->implementations.size(); i++)
+            {
+                if (this->implementations[i]->GetSupportedKey().Support(key))
+                    result.push_back(i);
+            }
+            return result;
+        }
+
+        std::vector<ParamsKey> supported_keys() const
+        {
+            std::vector<ParamsKey> keys;
+            for (const auto& implementation : this->implementations)
+                keys.push_back(implementation->GetSupportedKey());
+            return keys;
+        }
+    };
+
+    // required keys similar to the ones made from params: single data types and layouts, a few restrictions
+    ParamsKey random_required_key(std::mt19937& rng)
+    {
+        auto chance = [&](int percent) { return static_cast<int>(rng() % 100) < percent; };
+        auto data_type = [&]() { return static_cast<Datatype>(1 + rng() % static_cast<uint32_t>(Datatype::F32)); };
+        auto weights_type = [&]() { return static_cast<WeightsType>(1 + rng() % static_cast<uint32_t>(WeightsType::UINT8)); };
+
+        ParamsKey k;
+        k.EnableInputDataType(data_type());
+        k.EnableOutputDataType(chance(80) ? data_type() : Datatype::F32);
+        if (chance(50))
+        {
+            k.EnableInputWeightsType(weights_type());
+            k.EnableOutputWeightsType(weights_type());
+        }
+        if (chance(95))
+            k.EnableInputLayout(static_cast<DataLayout>(rng() % DataLayout::DataLayoutCount));
+        if (chance(95))
+            k.EnableOutputLayout(static_cast<DataLayout>(rng() % DataLayout::DataLayoutCount));
+        if (chance(50))
+        {
+            k.EnableInputWeightsLayout(static_cast<WeightsLayout>(rng() % WeightsLayout::WeightsLayoutCount));
+            k.EnableOutputWeightsLayout(static_cast<WeightsLayout>(rng() % WeightsLayout::WeightsLayoutCount));
+        }
+
+        if (chance(30)) k.EnableTensorOffset();
+        if (chance(30)) k.EnableTensorPitches();
+        if (chance(50)) k.EnableBatching();
+        if (chance(30)) k.EnableBiasPerFeature();
+        if (chance(10)) k.EnableBiasPerOutput();
+        if (chance(20)) k.EnableNonBiasTerm();
+        if (chance(10)) k.EnableDifferentTypes();
+        if (chance(10)) k.EnableSplitSupport();
+        if (chance(10)) k.EnableDilation();
+        if (chance(10)) k.EnableDepthwiseSeparableOpt();
+        if (chance(10)) k.EnableInt8Quantization();
+        if (chance(10)) k.EnableOutputCalibration();
+        if (chance(10)) k.EnableFusedOps();
+        if (chance(10)) k.EnableShapeAgnostic();
+        if (chance(10)) k.EnablePoolType(PoolType::MAX);
+        if (chance(10)) k.EnablePoolRemainder(PoolRemainder::FLOOR);
+        if (chance(80)) k.EnableSubGroup();
+        if (chance(80)) k.EnableSubGroupShort();
+        return k;
+    }
+
+    template <typename Selector>
+    void check_index_matches_linear_scan()
+    {
+        exposed_selector<Selector> selector;
+        std::mt19937 rng(42);
+
+        // keys of implementations cover multi-bit layouts and are supported at least by themselves,
+        // random keys cover typical required keys
+        auto keys = selector.supported_keys();
+        keys.push_back(ParamsKey());
+        for (int i = 0; i < 5000; i++)
+            keys.push_back(random_required_key(rng));
+
+        for (const auto& key : keys)
+            ASSERT_EQ(selector.supporting_by_linear_scan(key), selector.supporting_by_index(key));
+    }
+}
+
+TEST(params_key_index, empty_index_has_no_candidates) {
+    ParamsKeyIndex index;
+    EXPECT_TRUE(index.GetSupporting(ParamsKey()).empty());
+}
+
+TEST(params_key_index, follows_support_rules_of_each_key_part) {
+    ParamsKey f32_bfyx;
+    f32_bfyx.EnableInputDataType(Datatype::F32);
+    f32_bfyx.EnableOutputDataType(Datatype::F32);
+    f32_bfyx.EnableInputLayout(DataLayout::bfyx);
+    f32_bfyx.EnableOutputLayout(DataLayout::bfyx);
+    f32_bfyx.EnableBatching();
+
+    ParamsKey any_layout_subgroup = f32_bfyx;
+    any_layout_subgroup.EnableAllInputLayout();
+    any_layout_subgroup.EnableAllOutputLayout();
+    any_layout_subgroup.EnableSubGroup();
+    any_layout_subgroup.EnableTensorOffset();
+
+    ParamsKey no_layout;
+    no_layout.EnableInputDataType(Datatype::F32);
+    no_layout.EnableOutputDataType(Datatype::F32);
+
+    ParamsKeyIndex index;
+    index.Add(f32_bfyx);
+    index.Add(any_layout_subgroup);
+    index.Add(no_layout);
+    ASSERT_EQ(index.Size(), 3u);
+
+    ParamsKey required;
+    required.EnableInputDataType(Datatype::F32);
+    required.EnableOutputDataType(Datatype::F32);
+    EXPECT_EQ(index.GetSupporting(required), std::vector<size_t>({ 2 }));
+
+    required.EnableInputLayout(DataLayout::bfyx);
+    required.EnableOutputLayout(DataLayout::bfyx);
+    EXPECT_EQ(index.GetSupporting(required), std::vector<size_t>({ 0 }));
+
+    // machine has to provide subgroups required by the key
+    required.EnableSubGroup();
+    EXPECT_EQ(index.GetSupporting(required), std::vector<size_t>({ 0, 1 }));
+
+    // every required restriction has to be supported
+    required.EnableTensorOffset();
+    EXPECT_EQ(index.GetSupporting(required), std::vector<size_t>({ 1 }));
+
+    required.EnableInputDataType(Datatype::F16);
+    EXPECT_TRUE(index.GetSupporting(required).empty());
+}
+
+TEST(params_key_index, handles_more_keys_than_bits_in_word) {
+    ParamsKeyIndex index;
+    for (int i = 0; i < 150; i++)
+    {
+        ParamsKey k;
+        k.EnableInputDataType(i % 2 ? Datatype::F16 : Datatype::F32);
+        index.Add(k);
+    }
+
+    ParamsKey required;
+    required.EnableInputDataType(Datatype::F16);
+    auto supporting = index.GetSupporting(required);
+    ASSERT_EQ(supporting.size(), 75u);
+    for (size_t i = 0; i < supporting.size(); i++)
+        EXPECT_EQ(supporting[i], 2 * i + 1);
+}
+
+TEST(params_key_index, convolution_selector_index_matches_linear_scan) {
+    check_index_matches_linear_scan<convolution_kernel_selector>();
+}
+
+TEST(params_key_index, fully_connected_selector_index_matches_linear_scan) {
+    check_index_matches_linear_scan<fully_connected_kernel_selector>();
+}
+
+TEST(params_key_index, pooling_selector_index_matches_linear_scan) {
+    check_index_matches_linear_scan<pooling_kernel_selector>();
+}
+
+TEST(params_key_index, eltwise_selector_index_matches_linear_scan) {
+    check_index_matches_linear_scan<eltwise_kernel_selector>();
+}
+
+TEST(params_key_index, reorder_selectors_index_matches_linear_scan) {
+    check_index_matches_linear_scan<reorder_kernel_selector>();
+    check_index_matches_linear_scan<ReorderWeightsKernelSelctor>();
+}
@@ -0,0 +1,63 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "kernel_base.h"
+
+using namespace kernel_selector;
+using kernel_selector::gpu::cache::primitive_id;
+
+namespace {
+    size_t count(const std::string& str, const std::string& sub)
+    {
+        size_t n = 0;
+        for (auto pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + sub.size()))
+            n++;
+        return n;
+    }
+}
+
+TEST(primitive_db, expands_every_header_once) {
+    const auto& db = KernelBase::get_db();
+
+    // includes common.cl directly and through include_all.cl
+    auto code = db.get("convolution_gpu_bfyx_gemm_like_fp32");
+    ASSERT_EQ(code.size(), 1u);
+    EXPECT_EQ(count(code[0], "#include"), 0u);
+    EXPECT_EQ(count(code[0], "#define CAT("), 1u);
+    EXPECT_EQ(count(code[0], "#define DOT_PRODUCT_8("), 2u);   // sub_group.cl and the kernel itself
+    EXPECT_EQ(count(code[0], "FUNC(get_bfyx_f16_index)"), 1u);
+}
+
+TEST(primitive_db, leaves_shared_headers_out_of_kernel_code) {
+    const auto& db = KernelBase::get_db();
+
+    std::vector<primitive_id> shared_headers;
+    auto code = db.get("convolution_gpu_bfyx_gemm_like_fp32", shared_headers);
+    ASSERT_EQ(code.size(), 1u);
+    EXPECT_EQ(shared_headers, std::vector<primitive_id>({ "include/common.cl", "include/sub_group.cl", "include/vec_typedefs.cl" }));
+
+    EXPECT_EQ(count(code[0], "#include"), 0u);
+    EXPECT_EQ(count(code[0], "#define CAT("), 0u);
+    EXPECT_EQ(count(code[0], "#define DOT_PRODUCT_8("), 1u);
+    // fetch.cl depends on JIT of the kernel, so it is expanded
+    EXPECT_EQ(count(code[0], "FUNC(get_bfyx_f16_index)"), 1u);
+
+    EXPECT_EQ(count(*db.get_header("include/common.cl"), "#define CAT("), 1u);
+    EXPECT_EQ(count(*db.get_header("include/sub_group.cl"), "#define DOT_PRODUCT_8("), 1u);
+    EXPECT_THROW(db.get_header("include/missing.cl"), std::runtime_error);
+}
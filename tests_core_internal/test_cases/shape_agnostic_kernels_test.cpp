@@ -0,0 +1,131 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include "api/CPP/layout.hpp"
+#include "kernel_selector_helper.h"
+#include "activation/activation_kernel_selector.h"
+#include "activation/activation_kernel_base.h"
+#include "pooling/pooling_kernel_selector.h"
+#include "pooling/pooling_kernel_base.h"
+
+using namespace cldnn;
+
+namespace {
+    // code of the kernel as it is compared by kernels cache: entry points are unique for every kernel
+    std::string kernel_code(const kernel_selector::clKernelData& kernel)
+    {
+        const auto& entry_point = kernel.kernelString->entry_point;
+        auto jit = kernel.kernelString->jit;
+        for (auto pos = jit.find(entry_point); pos != std::string::npos; pos = jit.find(entry_point, pos))
+            jit.replace(pos, entry_point.size(), "__ENTRY_POINT__");
+        return kernel.kernelString->str + jit;
+    }
+
+    std::vector<int32_t> scalar_values(const kernel_selector::clKernelData& kernel)
+    {
+        std::vector<int32_t> values;
+        for (const auto& s : kernel.scalars)
+        {
+            EXPECT_EQ(s.t, kernel_selector::ScalarDescriptor::Types::INT32);
+            values.push_back(s.v.s32);
+        }
+        return values;
+    }
+
+    kernel_selector::activation_params make_activation_params(const tensor& size, const std::string& layer_id)
+    {
+        kernel_selector::activation_params params;
+        params.inputs[0] = convert_data_tensor(layout(data_types::f32, format::bfyx, size));
+        params.output = convert_data_tensor(layout(data_types::f32, format::bfyx, size, padding({ 0, 0, 1, 1 }, 0.f)));
+        params.activation.function = kernel_selector::ActivationFunction::RELU;
+        params.layerID = layer_id;
+        return params;
+    }
+
+    kernel_selector::pooling_params make_pooling_params(data_types dt, const tensor& size)
+    {
+        kernel_selector::pooling_params params;
+        params.inputs[0] = convert_data_tensor(layout(dt, format::bfyx, size));
+        params.output = convert_data_tensor(layout(dt, format::bfyx, { size.batch[0], size.feature[0], size.spatial[0] / 2, size.spatial[1] / 2 }));
+        params.poolType = kernel_selector::PoolType::MAX;
+        params.remainderAction = kernel_selector::PoolRemainder::FLOOR;
+        params.divMode = kernel_selector::KernelDividerMode::FIXED;
+        params.poolSize = { 2, 2, 1 };
+        params.poolStride = { 2, 2, 1 };
+        params.poolPad = { 0, 0, 0 };
+        params.layerID = "pool";
+        return params;
+    }
+}
+
+TEST(shape_agnostic_kernels, activations_of_different_shapes_share_code) {
+    kernel_selector::activation_optional_params options;
+    options.shapeAgnosticKernels = true;
+
+    auto& selector = kernel_selector::activation_kernel_selector::Instance();
+    auto small = selector.GetBestKernels(make_activation_params({ 1, 16, 28, 28 }, "relu1"), options);
+    auto large = selector.GetBestKernels(make_activation_params({ 2, 64, 56, 56 }, "relu2"), options);
+    ASSERT_EQ(small.size(), 1u);
+    ASSERT_EQ(large.size(), 1u);
+    EXPECT_EQ(small[0].kernelName, "activation_ref");
+
+    const auto& small_kernel = small[0].kernels[0];
+    const auto& large_kernel = large[0].kernels[0];
+    EXPECT_EQ(kernel_code(small_kernel), kernel_code(large_kernel));
+    EXPECT_NE(scalar_values(small_kernel), scalar_values(large_kernel));
+
+    // input, output and one scalar argument per shape info value of both tensors
+    ASSERT_EQ(small_kernel.arguments.size(), 2 + small_kernel.scalars.size());
+    for (size_t i = 0; i < small_kernel.scalars.size(); i++)
+    {
+        EXPECT_EQ(small_kernel.arguments[2 + i].t, kernel_selector::ArgumentDescriptor::Types::SCALAR);
+        EXPECT_EQ(small_kernel.arguments[2 + i].index, i);
+    }
+
+    // sizes come first, then pitches, paddings and offsets
+    auto values = scalar_values(large_kernel);
+    ASSERT_EQ(values.size(), 2 * kernel_selector::GetShapeInfo(make_activation_params({ 2, 64, 56, 56 }, "").output).size());
+    EXPECT_EQ(std::vector<int32_t>(values.begin(), values.begin() + 6), std::vector<int32_t>({ 56, 56, 1, 64, 1, 2 }));
+
+    kernel_selector::activation_optional_params static_options;
+    auto small_static = selector.GetBestKernels(make_activation_params({ 1, 16, 28, 28 }, "relu1"), static_options);
+    auto large_static = selector.GetBestKernels(make_activation_params({ 2, 64, 56, 56 }, "relu2"), static_options);
+    ASSERT_EQ(small_static.size(), 1u);
+    ASSERT_EQ(large_static.size(), 1u);
+    EXPECT_NE(kernel_code(small_static[0].kernels[0]), kernel_code(large_static[0].kernels[0]));
+    EXPECT_TRUE(small_static[0].kernels[0].scalars.empty());
+}
+
+TEST(shape_agnostic_kernels, selection_falls_back_to_kernels_compiled_for_shapes) {
+    kernel_selector::pooling_optional_params options;
+    options.shapeAgnosticKernels = true;
+
+    auto& selector = kernel_selector::pooling_kernel_selector::Instance();
+    auto first = selector.GetBestKernels(make_pooling_params(data_types::f32, { 1, 32, 28, 28 }), options);
+    auto second = selector.GetBestKernels(make_pooling_params(data_types::f32, { 1, 64, 14, 14 }), options);
+    ASSERT_EQ(first.size(), 1u);
+    ASSERT_EQ(second.size(), 1u);
+    EXPECT_EQ(first[0].kernelName, "pooling_gpu_ref");
+    EXPECT_EQ(kernel_code(first[0].kernels[0]), kernel_code(second[0].kernels[0]));
+
+    // no shape agnostic implementation supports int8 pooling
+    auto int8 = selector.GetBestKernels(make_pooling_params(data_types::i8, { 1, 32, 28, 28 }), options);
+    ASSERT_EQ(int8.size(), 1u);
+    EXPECT_NE(int8[0].kernelName, "pooling_gpu_ref");
+    EXPECT_TRUE(int8[0].kernels[0].scalars.empty());
+}
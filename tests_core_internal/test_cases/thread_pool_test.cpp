@@ -0,0 +1,130 @@
+/*
+// Copyright (c) 2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <gtest/gtest.h>
+
+#include "cpu/thread_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace cldnn;
+
+TEST(thread_pool, parallel_for_visits_each_index_once)
+{
+    cpu::thread_pool pool(4, true);
+    EXPECT_EQ(4u, pool.threads_count());
+
+    std::vector<std::atomic<int>> visits(1000);
+    for (auto& v : visits)
+        v = 0;
+
+    pool.parallel_for(visits.size(), [&](size_t i)
+    {
+        visits[i]++;
+        // nested loops run serially on the thread which executes the outer iteration
+        pool.parallel_for(3, [&](size_t) { visits[i]++; });
+    });
+
+    for (size_t i = 0; i < visits.size(); i++)
+        EXPECT_EQ(4, visits[i].load()) << "at index " << i;
+}
+
+TEST(thread_pool, run_tasks_runs_each_task_once)
+{
+    cpu::thread_pool pool(3);
+
+    std::vector<int> results(5, 0);
+    std::vector<std::function<void()>> tasks;
+    for (size_t i = 0; i < results.size(); i++)
+        tasks.push_back([&results, i] { results[i] += static_cast<int>(i) + 1; });
+
+    pool.run_tasks(tasks);
+    EXPECT_EQ(std::vector<int>({ 1, 2, 3, 4, 5 }), results);
+}
+
+TEST(thread_pool, concurrent_callers_and_errors)
+{
+    cpu::thread_pool pool(2);
+
+    // loops of concurrent callers run on the pool at the same time
+    std::atomic<size_t> first(0), second(0);
+    std::thread thread([&] { pool.parallel_for(10000, [&](size_t) { first++; }); });
+    pool.parallel_for(10000, [&](size_t) { second++; });
+    thread.join();
+    EXPECT_EQ(10000u, first.load());
+    EXPECT_EQ(10000u, second.load());
+
+    EXPECT_THROW(pool.run_tasks({ [] {}, [] { throw std::runtime_error("task failed"); } }), std::runtime_error);
+
+    // the pool stays usable after an error
+    std::atomic<size_t> count(0);
+    pool.parallel_for(100, [&](size_t) { count++; });
+    EXPECT_EQ(100u, count.load());
+}
+
+TEST(thread_pool, concurrent_callers_share_workers)
+{
+    cpu::thread_pool pool(3);
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool first_started = false;
+    bool second_done = false;
+
+    // the first caller keeps one thread busy until the loop of the second caller is finished
+    std::thread first([&]
+    {
+        pool.run_tasks({ [&]
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            first_started = true;
+            cv.notify_all();
+            cv.wait(lock, [&] { return second_done; });
+        }, [] {} });
+    });
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return first_started; });
+    }
+
+    // the idle worker joins the loop of the second caller, which would otherwise wait here until the timeout
+    std::set<std::thread::id> threads;
+    pool.run(8, [&](size_t, size_t)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        threads.insert(std::this_thread::get_id());
+        cv.notify_all();
+        cv.wait_for(lock, std::chrono::seconds(5), [&] { return threads.size() > 1; });
+    });
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        second_done = true;
+    }
+    cv.notify_all();
+    first.join();
+
+    EXPECT_LT(1u, threads.size());
+}